@@ -26,6 +26,7 @@ Tutorial demonstrating shadow-pass rendering with Methane graphics API
 #include <Methane/Samples/AppSettings.hpp>
 #include <Methane/Graphics/CubeMesh.hpp>
 #include <Methane/Data/TimeAnimation.h>
+#include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
 
@@ -224,6 +225,25 @@ void ShadowCubeApp::Init()
         gfx::Texture::Usage::RenderTarget | gfx::Texture::Usage::ShaderRead
     );
 
+    // Frame graph of shadow and final passes is compiled to the schedule with automatically generated resource barriers,
+    // shadow map is a transient texture shared by all frames, since their passes are executed in order on the render queue.
+    // Graph is declared again on context re-initialization, so the previous declaration is cleared, while its schedule is reused
+    m_frame_graph.Clear();
+    m_shadow_map_id = m_frame_graph.CreateTransientTexture("Shadow Map", shadow_texture_settings);
+    m_screen_id     = m_frame_graph.ImportResource("Screen", gfx::Resource::State::Present);
+    m_shadow_pass.frame_graph_pass_id = m_frame_graph.AddPass({
+        "Shadow Pass",
+        { },
+        { { m_shadow_map_id, gfx::Resource::State::DepthWrite } }
+    });
+    m_final_pass.frame_graph_pass_id = m_frame_graph.AddPass({
+        "Final Pass",
+        { { m_shadow_map_id, gfx::Resource::State::ShaderResource } },
+        { { m_screen_id,     gfx::Resource::State::RenderTarget } }
+    });
+    m_frame_graph.Compile();
+    m_frame_graph.AllocateTransientTextures(GetRenderContext());
+
     for(ShadowCubeFrame& frame : GetFrames())
     {
         // Create uniforms buffer with volatile parameters for the whole scene rendering
@@ -252,9 +272,8 @@ void ShadowCubeApp::Init()
         }, frame.index);
         frame.shadow_pass.floor.program_bindings_ptr->SetName(IndexedName("Floor Shadow-Pass Bindings {}", frame.index));
 
-        // Create depth texture for shadow map rendering
-        frame.shadow_pass.rt_texture_ptr = gfx::Texture::CreateRenderTarget(GetRenderContext(), shadow_texture_settings);
-        frame.shadow_pass.rt_texture_ptr->SetName(IndexedName("Shadow Map", frame.index));
+        // Depth texture for shadow map rendering is allocated by frame graph
+        frame.shadow_pass.rt_texture_ptr = m_frame_graph.GetTransientTexturePtr(m_shadow_map_id);
         
         // Create shadow pass configuration with depth attachment
         frame.shadow_pass.render_pass_ptr = gfx::RenderPass::Create(*m_shadow_pass_pattern_ptr, {
@@ -303,11 +322,13 @@ void ShadowCubeApp::Init()
         frame.final_pass.cmd_list_ptr = gfx::RenderCommandList::Create(GetRenderContext().GetRenderCommandKit().GetQueue(), *frame.final_pass.render_pass_ptr);
         frame.final_pass.cmd_list_ptr->SetName(IndexedName("Final Scene Rendering", frame.index));
 
-        // Rendering command lists sequence
-        frame.execute_cmd_list_set_ptr = gfx::CommandListSet::Create({
-            *frame.shadow_pass.cmd_list_ptr,
-            *frame.final_pass.cmd_list_ptr
-        }, frame.index);
+        // Rendering command lists sequence in the order of frame graph schedule
+        Refs<gfx::CommandList> execute_cmd_lists;
+        for(const gfx::FrameGraph::ScheduledPass& scheduled_pass : m_frame_graph.GetSchedule().passes)
+        {
+            execute_cmd_lists.emplace_back(*GetPassResources(frame, GetRenderPassState(scheduled_pass.pass_id)).cmd_list_ptr);
+        }
+        frame.execute_cmd_list_set_ptr = gfx::CommandListSet::Create(execute_cmd_lists, frame.index);
     }
 
     UserInterfaceApp::CompleteInitialization();
@@ -396,9 +417,16 @@ bool ShadowCubeApp::Render()
     frame.final_pass.floor.uniforms_buffer_ptr->SetData(m_floor_buffers_ptr->GetFinalPassUniformsSubresources(), render_cmd_queue);
     frame.final_pass.cube.uniforms_buffer_ptr->SetData(m_cube_buffers_ptr->GetFinalPassUniformsSubresources(), render_cmd_queue);
 
-    // Record commands for shadow & final render passes
-    RenderScene(m_shadow_pass, frame.shadow_pass);
-    RenderScene(m_final_pass, frame.final_pass);
+    // Transient textures are acquired every frame, which reuses textures of the compiled schedule and releases idle textures
+    m_frame_graph.AllocateTransientTextures(GetRenderContext());
+
+    // Record commands for shadow & final render passes in the order of frame graph schedule
+    m_frame_graph.BindResource(m_screen_id, *frame.screen_texture_ptr);
+    for(const gfx::FrameGraph::ScheduledPass& scheduled_pass : m_frame_graph.GetSchedule().passes)
+    {
+        const RenderPassState& render_pass = GetRenderPassState(scheduled_pass.pass_id);
+        RenderScene(render_pass, GetPassResources(frame, render_pass));
+    }
 
     // Execute rendering commands and present frame to screen
     render_cmd_queue.Execute(*frame.execute_cmd_list_set_ptr);
@@ -407,12 +435,13 @@ bool ShadowCubeApp::Render()
     return true;
 }
 
-void ShadowCubeApp::RenderScene(const RenderPassState& render_pass, const ShadowCubeFrame::PassResources& render_pass_resources) const
+void ShadowCubeApp::RenderScene(const RenderPassState& render_pass, const ShadowCubeFrame::PassResources& render_pass_resources)
 {
     gfx::RenderCommandList& cmd_list = *render_pass_resources.cmd_list_ptr;
 
-    // Reset command list with initial rendering state
+    // Reset command list with initial rendering state and set resource barriers of the frame graph pass
     cmd_list.ResetWithState(*render_pass.render_state_ptr, render_pass.debug_group_ptr.get());
+    m_frame_graph.SetPassBarriers(render_pass.frame_graph_pass_id, cmd_list);
     cmd_list.SetViewState(*render_pass.view_state_ptr);
 
     // Draw scene with cube and floor
@@ -427,6 +456,20 @@ void ShadowCubeApp::RenderScene(const RenderPassState& render_pass, const Shadow
     cmd_list.Commit();
 }
 
+const ShadowCubeApp::RenderPassState& ShadowCubeApp::GetRenderPassState(gfx::FrameGraph::PassId pass_id) const
+{
+    if (pass_id == m_shadow_pass.frame_graph_pass_id)
+        return m_shadow_pass;
+
+    META_CHECK_ARG_EQUAL_DESCR(pass_id, m_final_pass.frame_graph_pass_id, "unexpected frame graph pass");
+    return m_final_pass;
+}
+
+const ShadowCubeFrame::PassResources& ShadowCubeApp::GetPassResources(const ShadowCubeFrame& frame, const RenderPassState& render_pass) noexcept
+{
+    return render_pass.is_final_pass ? frame.final_pass : frame.shadow_pass;
+}
+
 void ShadowCubeApp::OnContextReleased(gfx::Context& context)
 {
     m_final_pass.Release();
@@ -438,6 +481,7 @@ void ShadowCubeApp::OnContextReleased(gfx::Context& context)
     m_texture_sampler_ptr.reset();
     m_const_buffer_ptr.reset();
     m_shadow_pass_pattern_ptr.reset();
+    m_frame_graph.ReleaseResources();
 
     UserInterfaceApp::OnContextReleased(context);
 }
@@ -110,10 +110,14 @@ private:
         const Ptr<gfx::CommandList::DebugGroup> debug_group_ptr;
         Ptr<gfx::RenderState>                   render_state_ptr;
         Ptr<gfx::ViewState>                     view_state_ptr;
+        gfx::FrameGraph::PassId                 frame_graph_pass_id = 0U;
     };
 
     bool Animate(double elapsed_seconds, double delta_seconds);
-    void RenderScene(const RenderPassState& render_pass, const ShadowCubeFrame::PassResources& render_pass_resources) const;
+    void RenderScene(const RenderPassState& render_pass, const ShadowCubeFrame::PassResources& render_pass_resources);
+    const RenderPassState& GetRenderPassState(gfx::FrameGraph::PassId pass_id) const;
+
+    static const ShadowCubeFrame::PassResources& GetPassResources(const ShadowCubeFrame& frame, const RenderPassState& render_pass) noexcept;
 
     const float                 m_scene_scale = 15.F;
     const hlslpp::Constants     m_scene_constants{
@@ -134,6 +138,9 @@ private:
     Ptr<TexturedMeshBuffers>    m_cube_buffers_ptr;
     Ptr<TexturedMeshBuffers>    m_floor_buffers_ptr;
     Ptr<gfx::RenderPattern>     m_shadow_pass_pattern_ptr;
+    gfx::FrameGraph             m_frame_graph;
+    gfx::FrameGraph::ResourceId m_shadow_map_id = 0U;
+    gfx::FrameGraph::ResourceId m_screen_id     = 0U;
     RenderPassState             m_shadow_pass { false, "Shadow Render Pass" };
     RenderPassState             m_final_pass  { true,  "Final Render Pass" };
 };
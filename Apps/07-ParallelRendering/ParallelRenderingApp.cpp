@@ -70,8 +70,8 @@ static const std::map<pal::Keyboard::State, ParallelRenderingAppAction> g_parall
 bool ParallelRenderingApp::Settings::operator==(const Settings& other) const noexcept
 {
     META_FUNCTION_TASK();
-    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled) ==
-           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled);
+    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled, command_bundles_enabled, adaptive_scheduling_enabled) ==
+           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled, other.command_bundles_enabled, other.adaptive_scheduling_enabled);
 }
 
 uint32_t ParallelRenderingApp::Settings::GetTotalCubesCount() const noexcept
@@ -104,6 +104,8 @@ ParallelRenderingApp::ParallelRenderingApp()
     add_option("-p,--parallel-render", m_settings.parallel_rendering_enabled, "enable parallel rendering")->group(options_group);
     add_option("-g,--cubes-grid-size", m_settings.cubes_grid_size,            "cubes grid size")->group(options_group);
     add_option("-t,--threads-count",   m_settings.render_thread_count,        "render threads count")->group(options_group);
+    add_option("-c,--command-bundles", m_settings.command_bundles_enabled,    "encode cubes once to command bundles in serial rendering mode")->group(options_group);
+    add_option("-s,--adaptive-scheduling", m_settings.adaptive_scheduling_enabled, "balance cubes between parallel render command lists by measured encoding time")->group(options_group);
 
     // Setup animations
     GetAnimations().emplace_back(std::make_shared<Data::TimeAnimation>(std::bind(&ParallelRenderingApp::Animate, this, std::placeholders::_1, std::placeholders::_2)));
@@ -233,11 +235,28 @@ void ParallelRenderingApp::Init()
             frame.serial_render_cmd_list_ptr->SetName(IndexedName("Serial Cubes Rendering", frame.index));
             frame.serial_render_cmd_list_ptr->SetValidationEnabled(false);
             frame.execute_cmd_list_set_ptr = gfx::CommandListSet::Create({ *frame.serial_render_cmd_list_ptr }, frame.index);
+
+            if (m_settings.command_bundles_enabled)
+            {
+                // Create command bundle to encode static cubes rendering commands once and execute them in every frame
+                frame.serial_render_cmd_bundle_ptr = gfx::RenderCommandList::CreateBundle(GetRenderContext().GetRenderCommandKit().GetQueue(), *frame.screen_pass_ptr);
+                frame.serial_render_cmd_bundle_ptr->SetName(IndexedName("Cubes Rendering Bundle", frame.index));
+                frame.serial_render_cmd_bundle_ptr->SetValidationEnabled(false);
+            }
         }
     }
     
     // Execute parallel program bindings copy initialization for all cubes
     GetRenderContext().GetParallelExecutor().run(program_bindings_task_flow).get();
+
+    if (m_settings.parallel_rendering_enabled && m_settings.adaptive_scheduling_enabled)
+    {
+        // Scheduler count of parallel command lists is limited with texture array size used to label cubes with command list index
+        gfx::ParallelRenderScheduler::Settings scheduler_settings;
+        scheduler_settings.max_command_lists_count = m_settings.render_thread_count;
+        m_parallel_render_scheduler_ptr = std::make_shared<gfx::ParallelRenderScheduler>(scheduler_settings, m_settings.render_thread_count);
+        m_parallel_render_scheduler_ptr->SetItemsCount(cubes_count);
+    }
     
     // Create all resources for texture labels rendering before resources upload in UserInterfaceApp::CompleteInitialization()
     TextureLabeler::Settings texture_labeler_settings;
@@ -353,6 +372,13 @@ bool ParallelRenderingApp::Resize(const gfx::FrameSize& frame_size, bool is_mini
         return false;
 
     m_camera.Resize(frame_size);
+
+    // Command bundles are encoded with view state of the previous frame size, so they are reset to be encoded again
+    for(const ParallelRenderingFrame& frame : GetFrames())
+    {
+        if (frame.serial_render_cmd_bundle_ptr)
+            frame.serial_render_cmd_bundle_ptr->Reset();
+    }
     return true;
 }
 
@@ -370,7 +396,9 @@ bool ParallelRenderingApp::Update()
             const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
             hlslpp::Uniforms uniforms{};
             uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
-            uniforms.texture_index = cube_params.thread_index;
+            uniforms.texture_index = m_parallel_render_scheduler_ptr
+                                   ? m_parallel_render_scheduler_ptr->GetCommandListIndexOfItem(cube_index)
+                                   : cube_params.thread_index;
             m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
         });
 
@@ -393,6 +421,11 @@ bool ParallelRenderingApp::Render()
     if (m_settings.parallel_rendering_enabled)
     {
         META_DEBUG_GROUP_CREATE_VAR(s_debug_group, "Parallel Cubes Rendering");
+        if (m_parallel_render_scheduler_ptr)
+        {
+            // Count of nested command lists may be changed by scheduler tuning and should be applied before command list reset
+            m_parallel_render_scheduler_ptr->ApplyCommandListsCount(*frame.parallel_render_cmd_list_ptr);
+        }
         frame.parallel_render_cmd_list_ptr->ResetWithState(*m_render_state_ptr, s_debug_group.get());
         frame.parallel_render_cmd_list_ptr->SetViewState(GetViewState());
 
@@ -415,7 +448,10 @@ bool ParallelRenderingApp::Render()
         GetRenderContext().GetParallelExecutor().run(render_task_flow).get();
 #else
         // The same parallel rendering is done inside of MeshBuffers::DrawParallel helper function
-        m_cube_array_buffers_ptr->DrawParallel(*frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+        if (m_parallel_render_scheduler_ptr)
+            m_cube_array_buffers_ptr->DrawParallel(*m_parallel_render_scheduler_ptr, *frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+        else
+            m_cube_array_buffers_ptr->DrawParallel(*frame.parallel_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
 #endif
 
         RenderOverlay(frame.parallel_render_cmd_list_ptr->GetParallelCommandLists().back().get());
@@ -427,11 +463,27 @@ bool ParallelRenderingApp::Render()
         frame.serial_render_cmd_list_ptr->ResetWithState(*m_render_state_ptr, s_debug_group.get());
         frame.serial_render_cmd_list_ptr->SetViewState(GetViewState());
 
+        if (frame.serial_render_cmd_bundle_ptr)
+        {
+            // Cubes rendering commands are encoded to the bundle only once and executed in every frame without re-encoding
+            gfx::RenderCommandList& cubes_bundle = *frame.serial_render_cmd_bundle_ptr;
+            if (cubes_bundle.GetState() != gfx::CommandList::State::Committed)
+            {
+                cubes_bundle.ResetWithState(*m_render_state_ptr);
+                cubes_bundle.SetViewState(GetViewState());
+                RenderCubesRange(cubes_bundle, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+                cubes_bundle.Commit();
+            }
+            frame.serial_render_cmd_list_ptr->ExecuteBundle(cubes_bundle);
+        }
+        else
+        {
 #ifdef EXPLICIT_PARALLEL_RENDERING_ENABLED
-        RenderCubesRange(*frame.serial_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
+            RenderCubesRange(*frame.serial_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance, 0U, m_cube_array_buffers_ptr->GetInstanceCount());
 #else
-        m_cube_array_buffers_ptr->Draw(*frame.serial_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
+            m_cube_array_buffers_ptr->Draw(*frame.serial_render_cmd_list_ptr, frame.cubes_array.program_bindings_per_instance);
 #endif
+        }
 
         RenderOverlay(*frame.serial_render_cmd_list_ptr);
         frame.serial_render_cmd_list_ptr->Commit();
@@ -476,6 +528,8 @@ std::string ParallelRenderingApp::GetParametersString()
     ss << "Parallel Rendering parameters:"
         << std::endl << "  - parallel rendering:   " << (m_settings.parallel_rendering_enabled ? "ON" : "OFF")
         << std::endl << "  - render threads count: " << m_settings.GetActiveRenderThreadCount()
+        << std::endl << "  - command bundles:      " << (!m_settings.parallel_rendering_enabled && m_settings.command_bundles_enabled ? "ON" : "OFF")
+        << std::endl << "  - adaptive scheduling:  " << (m_settings.parallel_rendering_enabled && m_settings.adaptive_scheduling_enabled ? "ON" : "OFF")
         << std::endl << "  - cubes grid size:      " << m_settings.cubes_grid_size
         << std::endl << "  - total cubes count:    " << m_settings.GetTotalCubesCount()
         << std::endl << "  - texture array size:   " << g_texture_size.GetWidth() <<
@@ -499,6 +553,7 @@ void ParallelRenderingApp::OnContextReleased(gfx::Context& context)
 {
     META_FUNCTION_TASK();
     m_cube_array_buffers_ptr.reset();
+    m_parallel_render_scheduler_ptr.reset();
     m_texture_array_ptr.reset();
     m_texture_sampler_ptr.reset();
     m_render_state_ptr.reset();
@@ -43,6 +43,7 @@ struct ParallelRenderingFrame final : Graphics::AppFrame
     gfx::InstancedMeshBufferBindings    cubes_array;
     Ptr<gfx::ParallelRenderCommandList> parallel_render_cmd_list_ptr;
     Ptr<gfx::RenderCommandList>         serial_render_cmd_list_ptr;
+    Ptr<gfx::RenderCommandList>         serial_render_cmd_bundle_ptr;
     Ptr<gfx::CommandListSet>            execute_cmd_list_set_ptr;
 
     using gfx::AppFrame::AppFrame;
@@ -55,9 +56,11 @@ class ParallelRenderingApp final : public UserInterfaceApp // NOSONAR
 public:
     struct Settings
     {
-        uint32_t cubes_grid_size            = 12U; // total_cubes_count = pow(cubes_grid_size, 3)
-        uint32_t render_thread_count        = std::thread::hardware_concurrency();
-        bool     parallel_rendering_enabled = true;
+        uint32_t cubes_grid_size             = 12U; // total_cubes_count = pow(cubes_grid_size, 3)
+        uint32_t render_thread_count         = std::thread::hardware_concurrency();
+        bool     parallel_rendering_enabled  = true;
+        bool     command_bundles_enabled     = false; // cubes are encoded once to command bundle in serial rendering mode
+        bool     adaptive_scheduling_enabled = false; // cubes are balanced between parallel command lists by measured encoding time
 
         bool operator==(const Settings& other) const noexcept;
 
@@ -101,13 +104,14 @@ private:
     void RenderCubesRange(gfx::RenderCommandList& remder_cmd_list, const Ptrs<gfx::ProgramBindings>& program_bindings_per_instance,
                           uint32_t begin_instance_index, const uint32_t end_instance_index) const;
 
-    Settings              m_settings;
-    gfx::Camera           m_camera;
-    Ptr<gfx::RenderState> m_render_state_ptr;
-    Ptr<gfx::Texture>     m_texture_array_ptr;
-    Ptr<gfx::Sampler>     m_texture_sampler_ptr;
-    Ptr<MeshBuffers>      m_cube_array_buffers_ptr;
-    CubeArrayParameters   m_cube_array_parameters;
+    Settings                          m_settings;
+    gfx::Camera                       m_camera;
+    Ptr<gfx::RenderState>             m_render_state_ptr;
+    Ptr<gfx::Texture>                 m_texture_array_ptr;
+    Ptr<gfx::Sampler>                 m_texture_sampler_ptr;
+    Ptr<MeshBuffers>                  m_cube_array_buffers_ptr;
+    CubeArrayParameters               m_cube_array_parameters;
+    Ptr<gfx::ParallelRenderScheduler> m_parallel_render_scheduler_ptr;
 };
 
 } // namespace Methane::Tutorials
@@ -31,6 +31,8 @@ function(get_shader_profile SHADER_TYPE PROFILE_VER OUT_PROFILE)
         set(_PROFILE_TYPE ps)
     elseif(SHADER_TYPE STREQUAL "vert")
         set(_PROFILE_TYPE vs)
+    elseif(SHADER_TYPE STREQUAL "comp")
+        set(_PROFILE_TYPE cs)
     else()
         message(FATAL_ERROR "Unsupported shader type: " ${SHADER_TYPE})
     endif()
@@ -0,0 +1,209 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/DeferredDeletionQueue.hpp
+Queue of objects with deferred deletion after completion of the epoch of their release,
+objects are deleted in batches limited by count and duration budget.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Timer.hpp>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+class DeferredDeletionQueue
+{
+public:
+    using Epoch     = uint64_t;
+    using TimePoint = Timer::TimePoint;
+
+    // Clock measuring deletion duration is replaced in tests to check time budget deterministically
+    struct IClock
+    {
+        [[nodiscard]] virtual TimePoint Now() const = 0;
+
+        virtual ~IClock() = default;
+    };
+
+    static const IClock& GetSystemClock() noexcept
+    {
+        static const SystemClock s_system_clock;
+        return s_system_clock;
+    }
+
+    struct Statistics
+    {
+        size_t pending_objects_count       = 0U;
+        size_t deleted_objects_count       = 0U; // objects deleted in the last deletion call
+        size_t total_deleted_objects_count = 0U;
+        double deletion_duration_sec       = 0.0; // duration of the last deletion call
+        double max_deletion_duration_sec   = 0.0;
+    };
+
+    explicit DeferredDeletionQueue(const IClock& clock = GetSystemClock()) noexcept
+        : m_clock_ptr(&clock)
+    { }
+
+    ~DeferredDeletionQueue() = default;
+
+    DeferredDeletionQueue(const DeferredDeletionQueue&) = delete;
+    DeferredDeletionQueue(DeferredDeletionQueue&&) = delete;
+
+    DeferredDeletionQueue& operator=(const DeferredDeletionQueue&) = delete;
+    DeferredDeletionQueue& operator=(DeferredDeletionQueue&&) = delete;
+
+    // Object is moved to the queue and deleted after completion of the given epoch
+    template<typename T>
+    void Push(Epoch epoch, T&& object)
+    {
+        META_FUNCTION_TASK();
+        auto object_holder_ptr = std::make_unique<ObjectHolder<std::decay_t<T>>>(std::forward<T>(object));
+        std::scoped_lock lock_guard(m_mutex);
+        m_pending_objects.push_back({ epoch, std::move(object_holder_ptr) });
+        m_statistics.pending_objects_count = m_pending_objects.size();
+    }
+
+    // Delete objects pushed in completed epochs in the order of pushing, while deleted objects count
+    // and deletion duration fit into the budget, which is unlimited when its values are zero
+    size_t DeleteCompleted(Epoch completed_epoch, uint32_t max_objects_count = 0U, double max_duration_sec = 0.0)
+    {
+        META_FUNCTION_TASK();
+        const TimePoint deletion_start_time = m_clock_ptr->Now();
+        size_t deleted_objects_count = 0U;
+        while(!max_objects_count || deleted_objects_count < max_objects_count)
+        {
+            if (max_duration_sec > 0.0 && GetElapsedSeconds(deletion_start_time) >= max_duration_sec)
+                break;
+
+            // Object is deleted outside of the lock, so that objects can be pushed to the queue from other threads
+            UniquePtr<ObjectHolderBase> object_holder_ptr = PopCompleted(completed_epoch);
+            if (!object_holder_ptr)
+                break;
+
+            object_holder_ptr.reset();
+            deleted_objects_count++;
+        }
+
+        UpdateStatistics(deleted_objects_count, GetElapsedSeconds(deletion_start_time));
+        return deleted_objects_count;
+    }
+
+    size_t DeleteAll()
+    {
+        META_FUNCTION_TASK();
+        const TimePoint deletion_start_time = m_clock_ptr->Now();
+        PendingObjects deleted_objects;
+        {
+            std::scoped_lock lock_guard(m_mutex);
+            std::swap(deleted_objects, m_pending_objects);
+        }
+
+        const size_t deleted_objects_count = deleted_objects.size();
+        deleted_objects.clear();
+
+        UpdateStatistics(deleted_objects_count, GetElapsedSeconds(deletion_start_time));
+        return deleted_objects_count;
+    }
+
+    [[nodiscard]] size_t GetPendingObjectsCount() const
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        return m_pending_objects.size();
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        return m_statistics;
+    }
+
+private:
+    struct SystemClock final : IClock
+    {
+        [[nodiscard]] TimePoint Now() const override { return Timer::Clock::now(); }
+    };
+
+    struct ObjectHolderBase
+    {
+        virtual ~ObjectHolderBase() = default;
+    };
+
+    template<typename T>
+    struct ObjectHolder final : ObjectHolderBase
+    {
+        template<typename U>
+        explicit ObjectHolder(U&& object_to_hold) : object(std::forward<U>(object_to_hold)) { }
+
+        T object;
+    };
+
+    struct PendingObject
+    {
+        Epoch                       epoch;
+        UniquePtr<ObjectHolderBase> holder_ptr;
+    };
+
+    using PendingObjects = std::deque<PendingObject>;
+
+    UniquePtr<ObjectHolderBase> PopCompleted(Epoch completed_epoch)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        if (m_pending_objects.empty() || m_pending_objects.front().epoch > completed_epoch)
+            return {};
+
+        UniquePtr<ObjectHolderBase> object_holder_ptr = std::move(m_pending_objects.front().holder_ptr);
+        m_pending_objects.pop_front();
+        return object_holder_ptr;
+    }
+
+    [[nodiscard]] double GetElapsedSeconds(TimePoint start_time) const
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double>>(m_clock_ptr->Now() - start_time).count();
+    }
+
+    void UpdateStatistics(size_t deleted_objects_count, double deletion_duration_sec)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        m_statistics.pending_objects_count        = m_pending_objects.size();
+        m_statistics.deleted_objects_count        = deleted_objects_count;
+        m_statistics.total_deleted_objects_count += deleted_objects_count;
+        m_statistics.deletion_duration_sec        = deletion_duration_sec;
+        m_statistics.max_deletion_duration_sec    = std::max(m_statistics.max_deletion_duration_sec, deletion_duration_sec);
+    }
+
+    const IClock*      m_clock_ptr;
+    PendingObjects     m_pending_objects;
+    Statistics         m_statistics;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace Methane::Data
@@ -39,12 +39,14 @@ struct IApp
         bool                 animations_enabled         = true;
         bool                 show_hud_in_window_title   = true;
         int32_t              default_device_index       = 0;    // 0 - default h/w GPU, 1 - second h/w GPU, -1 - emulated WARP device
+        uint32_t             max_fps                    = 0U;   // 0 - frame rate is not limited by frame limiter
         Device::Capabilities device_capabilities;
 
         Settings& SetScreenPassAccess(RenderPass::Access new_screen_pass_access) noexcept;
         Settings& SetAnimationsEnabled(bool new_animations_enabled) noexcept;
         Settings& SetShowHudInWindowTitle(bool new_show_hud_in_window_title) noexcept;
         Settings& SetDefaultDeviceIndex(int32_t new_default_device_index) noexcept;
+        Settings& SetMaxFps(uint32_t new_max_fps) noexcept;
         Settings& SetDeviceCapabilities(Device::Capabilities&& new_device_capabilities) noexcept;
     };
 
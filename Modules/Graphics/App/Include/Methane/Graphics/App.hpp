@@ -108,6 +108,12 @@ public:
         if (!AppBase::Resize(frame_size, is_minimized))
             return false;
 
+        // Render context waits for GPU rendering completion on resize, but it is not resized when only frame attachments are reallocated:
+        // in this case frames in flight have to be completed here, since render passes below replace frame buffers used by these frames
+        const bool is_context_resized = GetRenderContext().GetSettings().frame_size != frame_size;
+        if (!is_context_resized)
+            GetRenderContext().WaitForGpu(RenderContext::WaitFor::RenderComplete);
+
         // Save frame and depth textures restore information and delete obsolete resources
         std::vector<ResourceRestoreInfo> frame_restore_infos;
         frame_restore_infos.reserve(m_frames.size());
@@ -119,8 +125,9 @@ public:
         }
         const Opt<ResourceRestoreInfo> depth_restore_info_opt = ReleaseDepthTexture();
 
-        // Resize render context
-        GetRenderContext().Resize(frame_size);
+        // Resize render context, swap-chain is not recreated when only frame attachments are reallocated
+        if (is_context_resized)
+            GetRenderContext().Resize(frame_size);
 
         // Restore frame and depth buffers with new size and update textures in render pass settings
         RestoreDepthTexture(depth_restore_info_opt);
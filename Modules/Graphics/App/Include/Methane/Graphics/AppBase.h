@@ -31,6 +31,8 @@ Base implementation of the Methane graphics application.
 #include <Methane/Platform/App.h>
 #include <Methane/Graphics/RenderContext.h>
 #include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/FrameLimiter.h>
+#include <Methane/Graphics/ResizeCoalescer.h>
 #include <Methane/Checks.hpp>
 
 namespace Methane::Graphics
@@ -133,6 +135,8 @@ private:
     RenderContext::Settings  m_initial_context_settings;
     RenderPattern::Settings  m_screen_pass_pattern_settings;
     Timer                    m_title_update_timer;
+    FrameLimiter             m_frame_limiter;
+    ResizeCoalescer          m_resize_coalescer;
     ImageLoader              m_image_loader;
     Data::AnimationsPool     m_animations;
     Ptr<RenderContext>       m_context_ptr;
@@ -140,6 +144,7 @@ private:
     Ptr<RenderPattern>       m_screen_render_pattern_ptr;
     Ptr<ViewState>           m_view_state_ptr;
     bool                     m_restore_animations_enabled = true;
+    bool                     m_is_resize_applying = false;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
@@ -69,6 +69,13 @@ IApp::Settings& IApp::Settings::SetDefaultDeviceIndex(int32_t new_default_device
     return *this;
 }
 
+IApp::Settings& IApp::Settings::SetMaxFps(uint32_t new_max_fps) noexcept
+{
+    META_FUNCTION_TASK();
+    max_fps = new_max_fps;
+    return *this;
+}
+
 IApp::Settings& IApp::Settings::SetDeviceCapabilities(Device::Capabilities&& new_device_capabilities) noexcept
 {
     META_FUNCTION_TASK();
@@ -114,7 +121,22 @@ AppBase::AppBase(const AppSettings& settings, Data::Provider& textures_provider)
     add_option("-a,--animations", m_settings.animations_enabled, "Enable animations");
     add_option("-d,--device", m_settings.default_device_index, "Render at adapter index, use -1 for software adapter");
     add_option("-v,--vsync", m_initial_context_settings.vsync_enabled, "Vertical synchronization");
+    add_option("-m,--max-fps", m_settings.max_fps, "Max frame rate limited with precise frame pacing (0 - unlimited)");
     add_option("-b,--frame-buffers", m_initial_context_settings.frame_buffers_count, "Frame buffers count in swap-chain");
+    add_option("--frames-in-flight", m_initial_context_settings.max_frames_in_flight, "Max frames in flight, limited by frame buffers count (0 - no extra limit)");
+    add_option("-l,--low-latency", m_initial_context_settings.low_latency_enabled, "Low latency mode with frame wait before input sampling");
+    add_flag("-r,--epoch-retention",
+             [this](int64_t is_enabled) { if (is_enabled) m_initial_context_settings.options_mask |= Context::Options::EpochResourceRetention; },
+             "Retain resources used by command lists once per frame instead of every use");
+    add_flag("-u,--batched-submit",
+             [this](int64_t is_enabled) { if (is_enabled) m_initial_context_settings.options_mask |= Context::Options::BatchedSubmitOnVulkan; },
+             "Submit command lists executed during frame in one batch on present with Vulkan API");
+    add_flag("--present-thread",
+             [this](int64_t is_enabled) { if (is_enabled) m_initial_context_settings.options_mask |= Context::Options::PresentThreadOnVulkan; },
+             "Present frames and acquire next frame images ahead on dedicated thread with Vulkan API");
+    add_flag("--dynamic-rendering",
+             [this](int64_t is_enabled) { if (is_enabled) m_initial_context_settings.options_mask |= Context::Options::DynamicRenderingOnVulkan; },
+             "Begin render passes with dynamic rendering instead of render pass and frame buffer objects with Vulkan API");
 
 #ifdef _WIN32
     add_flag("-e,--emulated-render-pass",
@@ -211,6 +233,8 @@ void AppBase::Init()
     META_CHECK_ARG_NOT_NULL(m_context_ptr);
     const RenderContext::Settings& context_settings = m_context_ptr->GetSettings();
 
+    m_resize_coalescer.Reset(context_settings.frame_size);
+
     // Create frame depth texture and attachment description
     if (context_settings.depth_stencil_format != PixelFormat::Unknown)
     {
@@ -248,11 +272,22 @@ void AppBase::EndResizing()
 bool AppBase::Resize(const FrameSize& frame_size, bool is_minimized)
 {
     META_FUNCTION_TASK();
-    if (!Platform::App::Resize(frame_size, is_minimized))
+    if (!m_is_resize_applying && Platform::App::IsInitialized() && !is_minimized && !Platform::App::IsMinimized())
+    {
+        // Window resize events are coalesced to the latest frame size, which is applied at most once per frame on update
+        m_resize_coalescer.RequestResize(frame_size);
+        return false;
+    }
+
+    // Coalesced resize is applied even for unchanged frame size, when frame attachments have to be reallocated
+    if (!Platform::App::Resize(frame_size, is_minimized) && !m_is_resize_applying)
         return false;
 
     META_LOG("\n========================== FRAMES RESIZING ==========================");
 
+    if (!m_is_resize_applying)
+        m_resize_coalescer.Reset(frame_size);
+
     m_initial_context_settings.frame_size = frame_size;
 
     // Update viewports and scissor rects state
@@ -272,6 +307,23 @@ bool AppBase::Update()
 
     System::Get().CheckForChanges();
 
+    // Coalesced resize request is applied at most once per frame before updating frame state
+    if (const Opt<ResizeCoalescer::Resize> resize_opt = m_resize_coalescer.ApplyPendingResize(Platform::App::IsResizing());
+        resize_opt)
+    {
+        m_is_resize_applying = true;
+        Resize(resize_opt->frame_size, false);
+        m_is_resize_applying = false;
+    }
+
+    // Frame limiter waits for the next frame deadline before updating frame state
+    m_frame_limiter.SetTargetFps(m_settings.max_fps);
+    if (m_frame_limiter.IsEnabled() && m_context_ptr)
+    {
+        const double frame_pacing_error_sec = m_frame_limiter.WaitForNextFrame();
+        m_context_ptr->GetFpsCounter().OnCpuFramePaced(frame_pacing_error_sec);
+    }
+
     // Update HUD info in window title
     if (m_settings.show_hud_in_window_title &&
         m_title_update_timer.GetElapsedSecondsD() >= g_title_update_interval_sec)
@@ -380,6 +432,10 @@ Opt<AppBase::ResourceRestoreInfo> AppBase::ReleaseDepthTexture()
     if (!m_depth_texture_ptr)
         return std::nullopt;
 
+    // Depth texture allocated with slack during live resizing is kept while frame attachments size is unchanged
+    if (m_depth_texture_ptr->GetSettings().dimensions == Dimensions(m_resize_coalescer.GetAttachmentsSize()))
+        return std::nullopt;
+
     ResourceRestoreInfo depth_restore_info(*m_depth_texture_ptr);
     m_depth_texture_ptr.reset();
     return depth_restore_info;
@@ -391,7 +447,9 @@ void AppBase::RestoreDepthTexture(const Opt<ResourceRestoreInfo>& depth_restore_
     if (!depth_restore_info_opt)
         return;
 
-    m_depth_texture_ptr = Texture::CreateDepthStencilBuffer(GetRenderContext());
+    const RenderContext::Settings& context_settings = GetRenderContext().GetSettings();
+    m_depth_texture_ptr = Texture::CreateRenderTarget(GetRenderContext(),
+        Texture::Settings::DepthStencilBuffer(Dimensions(m_resize_coalescer.GetAttachmentsSize()), context_settings.depth_stencil_format));
     m_depth_texture_ptr->RestoreDescriptorViews(depth_restore_info_opt->descriptor_by_view_id);
     m_depth_texture_ptr->SetName(depth_restore_info_opt->name);
 }
@@ -409,11 +467,17 @@ void AppBase::UpdateWindowTitle()
     const FpsCounter&              fps_counter           = m_context_ptr->GetFpsCounter();
     const uint32_t                 average_fps           = fps_counter.GetFramesPerSecond();
     const FpsCounter::FrameTiming  average_frame_timing  = fps_counter.GetAverageFrameTiming();
-    const std::string title = fmt::format("{:s}        {:d} FPS, {:.2f} ms, {:.2f}% CPU |  {:d} x {:d}  |  {:d} FB  |  VSync {:s}  |  {:s}  |  {:s}  |  F1 - help",
+    const std::string frame_pacing_info = m_frame_limiter.IsEnabled()
+                                        ? fmt::format(", {:.2f} ms jitter", fps_counter.GetFrameTimeJitterSec() * 1000.0)
+                                        : std::string();
+    const std::string title = fmt::format("{:s}        {:d} FPS, {:.2f} ms, {:.2f}% CPU, {:.2f} ms latency{:s} |  {:d} x {:d}  |  {:d} FB, {:d} in flight{:s}  |  VSync {:s}  |  {:s}  |  {:s}  |  F1 - help",
                                           GetPlatformAppSettings().name,
                                           average_fps, average_frame_timing.GetTotalTimeMSec(), average_frame_timing.GetCpuTimePercent(),
+                                          average_frame_timing.GetInputLatencyMSec(), frame_pacing_info,
                                           context_settings.frame_size.GetWidth(), context_settings.frame_size.GetHeight(),
-                                          context_settings.frame_buffers_count, (context_settings.vsync_enabled ? "ON" : "OFF"),
+                                          context_settings.frame_buffers_count, m_context_ptr->GetMaxFramesInFlight(),
+                                          (context_settings.low_latency_enabled ? " (low latency)" : ""),
+                                          (context_settings.vsync_enabled ? "ON" : "OFF"),
                                           m_context_ptr->GetDevice().GetAdapterName(),
                                           magic_enum::enum_name(System::GetGraphicsApi()));
 
@@ -62,6 +62,8 @@ struct Buffer : virtual Resource // NOSONAR
     [[nodiscard]] static Ptr<Buffer> CreateIndexBuffer(const Context& context, Data::Size size, PixelFormat format, bool is_volatile = false);
     [[nodiscard]] static Ptr<Buffer> CreateConstantBuffer(const Context& context, Data::Size size, bool addressable = false, bool is_volatile = false);
     [[nodiscard]] static Ptr<Buffer> CreateReadBackBuffer(const Context& context, Data::Size size);
+    [[nodiscard]] static Ptr<Buffer> CreateIndirectBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_volatile = false);
+    [[nodiscard]] static Ptr<Buffer> CreateStorageBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_read_back = false);
 
     // Auxiliary functions
     [[nodiscard]] static Data::Size  GetAlignedBufferSize(Data::Size size) noexcept;
@@ -57,6 +57,7 @@ struct CommandList
         Blit,
         Render,
         ParallelRender,
+        Compute,
     };
 
     enum class State
@@ -42,6 +42,7 @@ struct CommandQueue : virtual Object // NOSONAR
     [[nodiscard]] virtual CommandList::Type GetCommandListType() const noexcept = 0;
     [[nodiscard]] virtual uint32_t          GetFamilyIndex() const noexcept = 0;
     virtual void Execute(CommandListSet& command_lists, const CommandList::CompletedCallback& completed_callback = {}) = 0;
+    virtual void FlushSubmits() = 0;
 };
 
 } // namespace Methane::Graphics
@@ -0,0 +1,57 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeCommandList.h
+Methane compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandList.h"
+#include "ComputeState.h"
+#include "Buffer.h"
+
+#include <Methane/Memory.hpp>
+
+namespace Methane::Graphics
+{
+
+struct ComputeCommandList : virtual CommandList // NOSONAR
+{
+    static constexpr Type type = Type::Compute;
+
+    // Indirect dispatch arguments layout in buffer memory, binary compatible with native graphics API structures
+    struct DispatchArguments
+    {
+        uint32_t thread_groups_count_x;
+        uint32_t thread_groups_count_y;
+        uint32_t thread_groups_count_z;
+    };
+
+    // Create ComputeCommandList instance
+    [[nodiscard]] static Ptr<ComputeCommandList> Create(CommandQueue& command_queue);
+
+    // ComputeCommandList interface
+    virtual void ResetWithState(ComputeState& compute_state, DebugGroup* p_debug_group = nullptr) = 0;
+    virtual void SetComputeState(ComputeState& compute_state) = 0;
+    virtual void Dispatch(const ThreadGroupsCount& thread_groups_count) = 0;
+    virtual void DispatchIndirect(Buffer& arguments_buffer, Data::Size arguments_offset = 0) = 0;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,60 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeState.h
+Methane compute state interface: specifies configuration of the compute pipeline.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Object.h"
+#include "Program.h"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Graphics/Volume.hpp>
+
+namespace Methane::Graphics
+{
+
+struct Context;
+
+using ThreadGroupSize   = VolumeSize<uint32_t>;
+using ThreadGroupsCount = VolumeSize<uint32_t>;
+
+struct ComputeState : virtual Object // NOSONAR
+{
+    struct Settings
+    {
+        Ptr<Program>    program_ptr;
+        ThreadGroupSize thread_group_size; // Must be equal to the thread group size of the compute shader (numthreads in HLSL)
+
+        [[nodiscard]] bool operator==(const Settings& other) const noexcept;
+        [[nodiscard]] bool operator!=(const Settings& other) const noexcept;
+        [[nodiscard]] explicit operator std::string() const;
+    };
+
+    // Create ComputeState instance
+    [[nodiscard]] static Ptr<ComputeState> Create(const Context& context, const Settings& state_settings);
+
+    // ComputeState interface
+    [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
+    virtual void Reset(const Settings& settings) = 0;
+};
+
+} // namespace Methane::Graphics
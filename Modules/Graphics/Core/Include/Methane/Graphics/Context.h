@@ -45,6 +45,7 @@ namespace Methane::Graphics
 struct Device;
 struct CommandKit;
 struct Context;
+class ResourceUploadBatch;
 
 struct IContextCallback
 {
@@ -83,6 +84,20 @@ struct Context
         None                         = 0U,
         BlitWithDirectQueueOnWindows = 1U << 0U, // Blit command lists and queues in DX API are created with DIRECT type instead of COPY type
         EmulatedRenderPassOnWindows  = 1U << 1U, // Render passes are emulated with traditional DX API, instead of using native DX render pass API
+        EpochResourceRetention       = 1U << 2U, // Resources used by command lists are retained by context once per epoch instead of retaining on every use
+        BatchedSubmitOnVulkan        = 1U << 3U, // Command list sets executed in Vulkan render queue are submitted in one batch on present, CPU wait or explicit queue flush
+        PresentThreadOnVulkan        = 1U << 4U, // Frames are presented and next frame images are acquired ahead on a dedicated thread with Vulkan API
+        DynamicRenderingOnVulkan     = 1U << 5U, // Render passes are begun with attachment infos using dynamic rendering instead of render pass and frame buffer objects with Vulkan API
+        StagingUploadOnVulkan        = 1U << 6U, // Private buffers are always uploaded with copy commands from staging buffers, even when device local memory is host visible with Vulkan API
+        TransientMappingOnVulkan     = 1U << 7U, // Host visible buffer memory is mapped on every data access instead of persistent mapping for the buffer lifetime with Vulkan API
+    };
+
+    // Deferred deletion of native objects released in completed frames is limited per frame to avoid hitches,
+    // zero limit values mean unlimited deletion
+    struct DeferredDeletionBudget
+    {
+        uint32_t max_objects_count = 0U;
+        double   max_duration_sec  = 0.0;
     };
 
     class IncompatibleException: public std::runtime_error
@@ -103,7 +118,10 @@ struct Context
     virtual void WaitForGpu(WaitFor wait_for) = 0;
     virtual void Reset(Device& device) = 0;
     virtual void Reset() = 0;
+    virtual void SubmitUploadBatch(ResourceUploadBatch& upload_batch, CommandQueue& target_cmd_queue) = 0;
     [[nodiscard]] virtual const Device& GetDevice() const = 0;
+    [[nodiscard]] virtual const DeferredDeletionBudget& GetDeferredDeletionBudget() const noexcept = 0;
+    virtual void SetDeferredDeletionBudget(const DeferredDeletionBudget& deletion_budget) = 0;
     [[nodiscard]] virtual CommandKit& GetDefaultCommandKit(CommandList::Type type) const = 0;
     [[nodiscard]] virtual CommandKit& GetDefaultCommandKit(CommandQueue& cmd_queue) const = 0;
     [[nodiscard]] inline  CommandKit& GetUploadCommandKit() const { return GetDefaultCommandKit(CommandList::Type::Blit); }
@@ -31,12 +31,17 @@ Methane graphics core interfaces: all headers under one umbrella.
 #include "RenderState.h"
 #include "RenderPass.h"
 #include "RenderState.h"
+#include "ComputeState.h"
 #include "Resource.h"
 #include "Buffer.h"
 #include "Texture.h"
 #include "Sampler.h"
+#include "ResourceUploadBatch.h"
+#include "FrameGraph.h"
+#include "TransientTexturePool.h"
 #include "CommandKit.h"
 #include "CommandQueue.h"
 #include "BlitCommandList.h"
 #include "RenderCommandList.h"
 #include "ParallelRenderCommandList.h"
+#include "ComputeCommandList.h"
@@ -29,7 +29,11 @@ is used to create graphics context for rendering.
 #include <Methane/Data/IEmitter.h>
 #include <Methane/Memory.hpp>
 
+#include <magic_enum.hpp>
+
 #include <array>
+#include <vector>
+#include <string>
 #include <functional>
 
 namespace Methane::Platform
@@ -46,6 +50,7 @@ struct IDeviceCallback
 {
     virtual void OnDeviceRemovalRequested(Device& device) = 0;
     virtual void OnDeviceRemoved(Device& device) = 0;
+    virtual void OnDeviceMemoryBudgetExceeded(Device& device, uint32_t heap_index) = 0;
 
     virtual ~IDeviceCallback() = default;
 };
@@ -60,25 +65,73 @@ struct Device
         BasicRendering       = 1U << 0U,
         AnisotropicFiltering = 1U << 2U,
         ImageCubeArray       = 1U << 3U,
+        DrawIndirectCount    = 1U << 4U,
         All                  = ~0U,
     };
 
     struct Capabilities
     {
-        Features features            = Device::Features::All;
-        bool     present_to_window   = true;
-        uint32_t render_queues_count = 1U;
-        uint32_t blit_queues_count   = 1U;
+        Features features             = Device::Features::All;
+        bool     present_to_window    = true;
+        uint32_t render_queues_count  = 1U;
+        uint32_t blit_queues_count    = 1U;
+        uint32_t compute_queues_count = 0U; // async compute queues, which are preferably allocated in dedicated compute queue family
 
         Capabilities& SetFeatures(Features new_features) noexcept;
         Capabilities& SetPresentToWindow(bool new_present_to_window) noexcept;
         Capabilities& SetRenderQueuesCount(uint32_t new_render_queues_count) noexcept;
         Capabilities& SetBlitQueuesCount(uint32_t new_blit_queues_count) noexcept;
+        Capabilities& SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept;
+    };
+
+    enum class MemoryType : uint32_t
+    {
+        Buffer,
+        Texture,
+        Staging,
+        Descriptors
+    };
+
+    struct MemoryHeapStatistics
+    {
+        bool     is_device_local = false;
+        uint64_t size            = 0U;
+        uint64_t budget          = 0U; // memory available to the process, equal to heap size when budget is not reported by device
+        uint64_t usage           = 0U; // memory used by the process, equal to zero when budget is not reported by device
+
+        [[nodiscard]] bool IsBudgetExceeded() const noexcept { return budget && usage > budget; }
+    };
+
+    struct MemoryTypeStatistics
+    {
+        uint64_t allocated_size          = 0U;
+        uint64_t max_allocated_size      = 0U; // high-water mark of allocated memory size
+        uint32_t allocations_count       = 0U;
+        uint32_t total_allocations_count = 0U;
+
+        void AddAllocation(uint64_t size) noexcept;
+        void RemoveAllocation(uint64_t size) noexcept;
+    };
+
+    struct MemoryStatistics
+    {
+        using TypeStatistics = std::array<MemoryTypeStatistics, magic_enum::enum_count<MemoryType>()>;
+
+        bool                              is_budget_supported = false;
+        std::vector<MemoryHeapStatistics> heaps;
+        TypeStatistics                    types;
+        MemoryTypeStatistics              total;
+
+        [[nodiscard]] const MemoryTypeStatistics& GetTypeStatistics(MemoryType memory_type) const noexcept;
+        [[nodiscard]] uint64_t GetDeviceLocalBudget() const noexcept;
+        [[nodiscard]] uint64_t GetDeviceLocalUsage() const noexcept;
+        [[nodiscard]] explicit operator std::string() const;
     };
 
     [[nodiscard]] virtual const std::string&  GetAdapterName() const noexcept = 0;
     [[nodiscard]] virtual bool                IsSoftwareAdapter() const noexcept = 0;
     [[nodiscard]] virtual const Capabilities& GetCapabilities() const noexcept = 0;
+    [[nodiscard]] virtual MemoryStatistics    GetMemoryStatistics() const = 0;
     [[nodiscard]] virtual std::string         ToString() const = 0;
 };
 
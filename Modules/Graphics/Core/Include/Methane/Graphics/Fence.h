@@ -37,8 +37,11 @@ struct Fence : virtual Object // NOSONAR
     [[nodiscard]] static Ptr<Fence> Create(CommandQueue& command_queue);
 
     // Fence interface
+    [[nodiscard]] virtual uint64_t GetValue() const noexcept = 0;
+    [[nodiscard]] virtual uint64_t GetCompletedValue() const = 0;
     virtual void Signal() = 0;
     virtual void WaitOnCpu() = 0;
+    virtual void WaitOnCpu(uint64_t wait_value) = 0;
     virtual void WaitOnGpu(CommandQueue& wait_on_command_queue) = 0;
     virtual void FlushOnCpu() = 0;
     virtual void FlushOnGpu(CommandQueue& wait_on_command_queue) = 0;
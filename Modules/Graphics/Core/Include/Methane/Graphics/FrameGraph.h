@@ -0,0 +1,185 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameGraph.h
+Frame graph of render passes with declared resource accesses, which is compiled
+to the ordered passes schedule with automatic resource barriers and aliased transient textures.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Texture.h"
+#include "ResourceBarriers.h"
+#include "TransientTexturePool.h"
+
+#include <Methane/Memory.hpp>
+
+#include <vector>
+#include <string>
+
+namespace Methane::Graphics
+{
+
+struct RenderContext;
+struct CommandList;
+
+class FrameGraph
+{
+public:
+    using ResourceId = uint32_t;
+    using PassId     = uint32_t;
+
+    struct ResourceAccess
+    {
+        ResourceId    resource_id;
+        ResourceState state;
+
+        [[nodiscard]] bool operator==(const ResourceAccess& other) const noexcept;
+        [[nodiscard]] bool operator!=(const ResourceAccess& other) const noexcept { return !operator==(other); }
+    };
+
+    using ResourceAccesses = std::vector<ResourceAccess>;
+
+    struct PassSettings
+    {
+        std::string      name;
+        ResourceAccesses reads;
+        ResourceAccesses writes;
+        bool             has_side_effects = false; // pass is never culled, even if it does not write to imported resources
+
+        [[nodiscard]] bool operator==(const PassSettings& other) const noexcept;
+        [[nodiscard]] bool operator!=(const PassSettings& other) const noexcept { return !operator==(other); }
+    };
+
+    struct Barrier
+    {
+        ResourceId    resource_id;
+        ResourceState state_before;
+        ResourceState state_after;
+
+        [[nodiscard]] bool operator==(const Barrier& other) const noexcept;
+        [[nodiscard]] bool operator!=(const Barrier& other) const noexcept { return !operator==(other); }
+        [[nodiscard]] bool IsUnorderedAccessBarrier() const noexcept
+        { return state_before == ResourceState::UnorderedAccess && state_after == ResourceState::UnorderedAccess; }
+    };
+
+    using Barriers = std::vector<Barrier>;
+
+    struct ScheduledPass
+    {
+        PassId   pass_id;
+        Barriers barriers; // resource barriers which have to be set before pass commands
+    };
+
+    struct TransientAllocation
+    {
+        uint32_t memory_slot_index;
+        uint32_t first_pass_index; // index of the first scheduled pass using transient resource
+        uint32_t last_pass_index;  // index of the last scheduled pass using transient resource
+    };
+
+    struct MemorySlot
+    {
+        Texture::Settings texture_settings;
+        Data::Size        memory_size;
+    };
+
+    struct Schedule
+    {
+        std::vector<ScheduledPass>            passes;
+        Barriers                              final_barriers; // transitions of imported resources to their final states
+        std::vector<Opt<TransientAllocation>> transient_allocations; // indexed by resource id, empty for imported and unused resources
+        std::vector<MemorySlot>               memory_slots;
+
+        [[nodiscard]] size_t     GetBarriersCount() const noexcept;
+        [[nodiscard]] Data::Size GetTransientMemorySize() const noexcept;
+        [[nodiscard]] Data::Size GetTransientMemorySizeWithoutAliasing() const noexcept;
+        [[nodiscard]] Opt<uint32_t> GetPassIndex(PassId pass_id) const noexcept;
+    };
+
+    // Graph topology declaration
+    [[nodiscard]] ResourceId ImportResource(const std::string& name, ResourceState initial_state, const Opt<ResourceState>& final_state_opt = {});
+    [[nodiscard]] ResourceId CreateTransientTexture(const std::string& name, const Texture::Settings& settings);
+    [[nodiscard]] PassId     AddPass(const PassSettings& pass_settings);
+
+    // Declared topology is cleared, but compiled schedule is kept and reused if the same topology is declared again
+    void Clear() noexcept;
+
+    // Graph is compiled only when declared topology differs from the topology of the last compiled schedule
+    const Schedule& Compile();
+
+    [[nodiscard]] bool            IsCompiled() const noexcept;
+    [[nodiscard]] const Schedule& GetSchedule() const;
+    [[nodiscard]] uint32_t        GetCompilationsCount() const noexcept { return m_compilations_count; }
+    [[nodiscard]] size_t          GetResourcesCount() const noexcept    { return m_resources.size(); }
+    [[nodiscard]] size_t          GetPassesCount() const noexcept       { return m_passes.size(); }
+
+    // Transient textures are acquired from the pool for lifetimes of compiled schedule, so that textures are created only for new allocations
+    // and memory of transient textures with different settings is aliased when supported by graphics API.
+    // Called every frame to count pool frames, so that textures not used by the current schedule are released after idle frames
+    void AllocateTransientTextures(const RenderContext& context);
+    [[nodiscard]] const Ptr<Texture>& GetTransientTexturePtr(ResourceId resource_id) const;
+    [[nodiscard]] const TransientTexturePool& GetTexturePool() const noexcept { return m_texture_pool; }
+
+    // Releases transient textures, bound resources and barriers, while keeping declared topology and compiled schedule
+    void ReleaseResources() noexcept;
+
+    // Imported resources have to be bound before setting barriers, for example to the current frame buffer texture
+    void BindResource(ResourceId resource_id, Resource& resource);
+
+    // Barriers are set with the resource state tracking, so transitions already done by render passes are skipped
+    void SetPassBarriers(PassId pass_id, CommandList& command_list);
+    void SetFinalBarriers(CommandList& command_list);
+
+private:
+    struct ResourceInfo
+    {
+        std::string            name;
+        Opt<Texture::Settings> transient_settings_opt; // empty for imported resources
+        ResourceState          initial_state;
+        Opt<ResourceState>     final_state_opt;
+
+        [[nodiscard]] bool operator==(const ResourceInfo& other) const noexcept;
+        [[nodiscard]] bool operator!=(const ResourceInfo& other) const noexcept { return !operator==(other); }
+    };
+
+    using ResourceInfos = std::vector<ResourceInfo>;
+    using PassSettingsList = std::vector<PassSettings>;
+
+    void ValidatePass(const PassSettings& pass_settings) const;
+    Resource& GetResource(ResourceId resource_id) const;
+    Opt<ResourceId> GetTransientAliasId(ResourceId resource_id, const Opt<uint32_t>& pass_index_opt) const;
+    void SetBarriers(const Barriers& barriers, const Opt<uint32_t>& pass_index_opt,
+                     Ptr<Resource::Barriers>& resource_barriers_ptr, CommandList& command_list) const;
+
+    ResourceInfos                   m_resources;
+    PassSettingsList                m_passes;
+    ResourceInfos                   m_compiled_resources;
+    PassSettingsList                m_compiled_passes;
+    Schedule                        m_schedule;
+    bool                            m_is_schedule_compiled = false;
+    uint32_t                        m_compilations_count = 0U;
+    std::vector<Resource*>          m_bound_resources;
+    TransientTexturePool            m_texture_pool{ TransientTexturePool::Settings{ 3U, Texture::IsMemoryAliasingSupported() } };
+    Ptrs<Texture>                   m_transient_textures; // indexed by resource id
+    std::vector<Opt<ResourceId>>    m_transient_alias_ids; // indexed by resource id, previous transient texture in the same aliased memory
+    std::vector<Ptr<Resource::Barriers>> m_pass_barriers; // indexed by scheduled pass, last one is for final barriers
+};
+
+} // namespace Methane::Graphics
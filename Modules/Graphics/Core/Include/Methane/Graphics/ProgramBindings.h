@@ -56,6 +56,7 @@ struct ProgramBindings : virtual Object // NOSONAR
             Program::ArgumentAccessor argument;
             Resource::Type            resource_type;
             uint32_t                  resource_count = 1;
+            bool                      is_shader_writable = false; // storage images are written by shaders in unordered access state
         };
 
         class ConstantModificationException : public std::logic_error
@@ -48,14 +48,37 @@ struct RenderCommandList : virtual CommandList // NOSONAR
         TriangleStrip
     };
 
+    // Indirect draw arguments layout in buffer memory, binary compatible with native graphics API structures
+    struct DrawArguments
+    {
+        uint32_t vertex_count;
+        uint32_t instance_count;
+        uint32_t start_vertex;
+        uint32_t start_instance;
+    };
+
+    struct DrawIndexedArguments
+    {
+        uint32_t index_count;
+        uint32_t instance_count;
+        uint32_t start_index;
+        int32_t  start_vertex;
+        uint32_t start_instance;
+    };
+
     // Create RenderCommandList instance
     [[nodiscard]] static Ptr<RenderCommandList> Create(CommandQueue& command_queue, RenderPass& render_pass);
     [[nodiscard]] static Ptr<RenderCommandList> Create(ParallelRenderCommandList& parallel_command_list);
+
+    // Create render command bundle, which is encoded once and executed many times with ExecuteBundle(...)
+    // inside render passes of other render command lists compatible with the given render pass pattern
+    [[nodiscard]] static Ptr<RenderCommandList> CreateBundle(CommandQueue& command_queue, RenderPass& render_pass);
     
     // RenderCommandList interface
     [[nodiscard]] virtual bool IsValidationEnabled() const noexcept = 0;
     virtual void SetValidationEnabled(bool is_validation_enabled) = 0;
     [[nodiscard]] virtual RenderPass& GetRenderPass() const = 0;
+    [[nodiscard]] virtual bool IsBundle() const noexcept = 0;
     virtual void ResetWithState(RenderState& render_state, DebugGroup* p_debug_group = nullptr) = 0;
     virtual void ResetWithStateOnce(RenderState& render_state, DebugGroup* p_debug_group = nullptr) = 0;
     virtual void SetRenderState(RenderState& render_state, RenderState::Groups state_groups = RenderState::Groups::All) = 0;
@@ -66,6 +89,11 @@ struct RenderCommandList : virtual CommandList // NOSONAR
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+    virtual void DrawIndexedIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count = 1, Data::Size arguments_offset = 0,
+                                     Buffer* p_count_buffer = nullptr, Data::Size count_offset = 0) = 0;
+    virtual void DrawIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count = 1, Data::Size arguments_offset = 0,
+                              Buffer* p_count_buffer = nullptr, Data::Size count_offset = 0) = 0;
+    virtual void ExecuteBundle(RenderCommandList& bundle) = 0;
     
     using CommandList::Reset;
 };
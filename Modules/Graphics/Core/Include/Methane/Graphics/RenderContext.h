@@ -55,6 +55,8 @@ struct RenderContext : virtual Context // NOSONAR
         bool              is_full_screen       = false;
         Options           options_mask         = Options::None;
         uint32_t          unsync_max_fps       = 1000U; // MacOS only
+        uint32_t          max_frames_in_flight = 0U;    // lowers the limit of frame buffers count for lower latency, 0 - limited by frame buffers count only
+        bool              low_latency_enabled  = false; // wait for the next frame slot right after present, before sampling the next frame input
 
         Settings& SetFrameSize(FrameSize&& new_frame_size) noexcept;
         Settings& SetColorFormat(PixelFormat new_color_format) noexcept;
@@ -66,11 +68,17 @@ struct RenderContext : virtual Context // NOSONAR
         Settings& SetFullscreen(bool new_full_screen) noexcept;
         Settings& SetOptionsMask(Options new_options_mask) noexcept;
         Settings& SetUnsyncMaxFps(uint32_t new_unsync_max_fps) noexcept;
+        Settings& SetMaxFramesInFlight(uint32_t new_max_frames_in_flight) noexcept;
+        Settings& SetLowLatencyEnabled(bool new_low_latency_enabled) noexcept;
     };
 
     // Create RenderContext instance
     [[nodiscard]] static Ptr<RenderContext> Create(const Platform::AppEnvironment& env, Device& device, tf::Executor& parallel_executor, const Settings& settings);
 
+    // Create headless RenderContext instance without window and swap-chain, which renders frames to the ring of offscreen frame buffers,
+    // device should be created without presentation to window capability
+    [[nodiscard]] static Ptr<RenderContext> CreateHeadless(Device& device, tf::Executor& parallel_executor, const Settings& settings);
+
     // RenderContext interface
     [[nodiscard]] virtual bool ReadyToRender() const = 0;
     virtual void Resize(const FrameSize& frame_size) = 0;
@@ -80,7 +88,9 @@ struct RenderContext : virtual Context // NOSONAR
     [[nodiscard]] virtual const Settings&   GetSettings() const noexcept = 0;
     [[nodiscard]] virtual uint32_t          GetFrameBufferIndex() const noexcept = 0;
     [[nodiscard]] virtual uint32_t          GetFrameIndex() const noexcept = 0;
+    [[nodiscard]] virtual uint32_t          GetMaxFramesInFlight() const noexcept = 0;
     [[nodiscard]] virtual const FpsCounter& GetFpsCounter() const noexcept = 0;
+    [[nodiscard]] virtual FpsCounter&       GetFpsCounter() noexcept = 0;
 
     virtual bool SetVSyncEnabled(bool vsync_enabled) = 0;
     virtual bool SetFrameBuffersCount(uint32_t frame_buffers_count) = 0;
@@ -32,6 +32,7 @@ Methane resource interface: base class of all GPU resources.
 #include <Methane/Graphics/Types.h>
 
 #include <string_view>
+#include <future>
 
 namespace Methane::Graphics
 {
@@ -92,6 +93,9 @@ struct Resource
     using Barrier       = Methane::Graphics::ResourceBarrier;
     using Barriers      = Methane::Graphics::ResourceBarriers;
 
+    // Future-like handle of asynchronously read sub-resource data, which is resolved when GPU completes the copy commands
+    using ReadDataFuture = std::shared_future<SubResource>;
+
     template<typename TResource>
     static Views CreateViews(const Ptrs<TResource>& resources) { return CreateResourceViews(resources); }
 
@@ -104,6 +108,7 @@ struct Resource
     virtual void RestoreDescriptorViews(const DescriptorByViewId& descriptor_by_view_id) = 0;
 
     [[nodiscard]] virtual SubResource               GetData(const SubResource::Index& sub_resource_index = SubResource::Index(), const BytesRangeOpt& data_range = {}) = 0;
+    [[nodiscard]] virtual ReadDataFuture            ReadDataAsync(CommandQueue& cmd_queue, const SubResource::Index& sub_resource_index = SubResource::Index(), const BytesRangeOpt& data_range = {}) = 0;
     [[nodiscard]] virtual Data::Size                GetDataSize(Data::MemoryState size_type = Data::MemoryState::Reserved) const noexcept = 0;
     [[nodiscard]] virtual Data::Size                GetSubResourceDataSize(const SubResource::Index& sub_resource_index = SubResource::Index()) const = 0;
     [[nodiscard]] virtual const SubResource::Count& GetSubresourceCount() const noexcept = 0;
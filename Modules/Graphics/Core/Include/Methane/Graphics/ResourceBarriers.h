@@ -68,6 +68,7 @@ public:
     {
         StateTransition,
         OwnerTransition,
+        AliasingTransition, // state transition of resource aliasing memory of another resource, which discards resource content
     };
 
     class Id
@@ -99,6 +100,10 @@ public:
         [[nodiscard]] ResourceState GetStateBefore() const noexcept { return m_before; }
         [[nodiscard]] ResourceState GetStateAfter() const noexcept  { return m_after; }
 
+        // Transition from UnorderedAccess to the same state is used to synchronize shader writes with subsequent reads and writes
+        [[nodiscard]] bool IsUnorderedAccessBarrier() const noexcept
+        { return m_before == ResourceState::UnorderedAccess && m_after == ResourceState::UnorderedAccess; }
+
     private:
         ResourceState m_before;
         ResourceState m_after;
@@ -122,6 +127,7 @@ public:
     };
 
     ResourceBarrier(Resource& resource, const StateChange& state_change);
+    ResourceBarrier(Type type, Resource& resource, const StateChange& state_change);
     ResourceBarrier(Resource& resource, const OwnerChange& owner_change);
     ResourceBarrier(Resource& resource, ResourceState state_before, ResourceState state_after);
     ResourceBarrier(Resource& resource, uint32_t queue_family_before, uint32_t queue_family_after);
@@ -181,6 +187,7 @@ public:
     [[nodiscard]] const ResourceBarrier* GetBarrier(const ResourceBarrier::Id& id) const noexcept;
     [[nodiscard]] bool  HasStateTransition(Resource& resource, ResourceState before, ResourceState after);
     [[nodiscard]] bool  HasOwnerTransition(Resource& resource, uint32_t queue_family_before, uint32_t queue_family_after);
+    [[nodiscard]] bool  HasUnorderedAccessBarrier(Resource& resource);
 
     bool Remove(ResourceBarrier::Type type, Resource& resource);
     bool RemoveStateTransition(Resource& resource);
@@ -188,6 +195,10 @@ public:
 
     AddResult AddStateTransition(Resource& resource, ResourceState before, ResourceState after);
     AddResult AddOwnerTransition(Resource& resource, uint32_t queue_family_before, uint32_t queue_family_after);
+    AddResult AddUnorderedAccessBarrier(Resource& resource);
+
+    // Aliasing transition waits for the last access of another resource in the aliased memory in the 'before' state
+    AddResult AddAliasingTransition(Resource& resource, ResourceState alias_state_before, ResourceState after);
 
     virtual AddResult Add(const ResourceBarrier::Id& id, const ResourceBarrier& barrier);
     virtual bool      Remove(const ResourceBarrier::Id& id);
@@ -0,0 +1,64 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ResourceUploadBatch.h
+Batch of resource data updates uploaded to GPU with a single command list submission.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Resource.h"
+
+#include <Methane/Memory.hpp>
+
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class ResourceUploadBatch
+{
+public:
+    struct ResourceUpload
+    {
+        Ptr<Resource> resource_ptr;
+        SubResources  sub_resources;
+    };
+
+    using ResourceUploads = std::vector<ResourceUpload>;
+
+    void Add(Resource& resource, SubResources sub_resources);
+    void Clear() noexcept;
+
+    // Sort uploads by destination resource type and resource, then merge uploads to the same resource,
+    // so that each resource data is set once and its copy commands are recorded together;
+    // repeated updates of the same sub-resource data range are collapsed to the latest one
+    const ResourceUploads& SortByDestination();
+
+    [[nodiscard]] bool                   IsEmpty() const noexcept         { return m_uploads.empty(); }
+    [[nodiscard]] size_t                 GetUploadsCount() const noexcept { return m_uploads.size(); }
+    [[nodiscard]] Data::Size             GetDataSize() const noexcept     { return m_data_size; }
+    [[nodiscard]] const ResourceUploads& GetUploads() const noexcept      { return m_uploads; }
+
+private:
+    ResourceUploads m_uploads;
+    Data::Size      m_data_size = 0U;
+};
+
+} // namespace Methane::Graphics
@@ -150,6 +150,7 @@ enum class ResourceUsage : uint32_t
     // Secondary usages
     ReadBack     = 1U << 3U,
     Addressable  = 1U << 4U,
+    Indirect     = 1U << 5U,
 };
 
 enum class TextureDimensionType : uint32_t
@@ -46,6 +46,7 @@ struct Shader
     {
         Vertex,
         Pixel,
+        Compute,
         All
     };
     
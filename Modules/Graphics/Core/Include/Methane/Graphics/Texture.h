@@ -78,6 +78,12 @@ struct Texture : virtual Resource // NOSONAR
         [[nodiscard]] static Settings Cube(uint32_t dimension_size, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped, Usage usage);
         [[nodiscard]] static Settings FrameBuffer(const Dimensions& dimensions, PixelFormat pixel_format);
         [[nodiscard]] static Settings DepthStencilBuffer(const Dimensions& dimensions, PixelFormat pixel_format, Usage usage_mask = Usage::RenderTarget);
+
+        // Memory size is estimated without alignment and tiling overhead of the particular graphics API
+        [[nodiscard]] Data::Size GetEstimatedMemorySize() const;
+
+        [[nodiscard]] bool operator==(const Settings& other) const noexcept;
+        [[nodiscard]] bool operator!=(const Settings& other) const noexcept { return !operator==(other); }
     };
 
     using FrameBufferIndex = uint32_t;
@@ -86,11 +92,20 @@ struct Texture : virtual Resource // NOSONAR
     [[nodiscard]] static Ptr<Texture> CreateRenderTarget(const RenderContext& context, const Settings& settings);
     [[nodiscard]] static Ptr<Texture> CreateFrameBuffer(const RenderContext& context, FrameBufferIndex frame_buffer_index);
     [[nodiscard]] static Ptr<Texture> CreateDepthStencilBuffer(const RenderContext& context);
-    [[nodiscard]] static Ptr<Texture> CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped);
+    [[nodiscard]] static Ptr<Texture> CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped,
+                                                  bool is_read_back = false);
     [[nodiscard]] static Ptr<Texture> CreateCube(const Context& context, uint32_t dimension_size, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped);
 
+    // Create render target texture aliasing device memory of another render target texture, which is retained by the created texture.
+    // Aliased textures can be used only in non-overlapping passes and their content has to be fully overwritten on first use in pass.
+    // Texture is created with its own memory when memory requirements are incompatible with aliased memory.
+    [[nodiscard]] static Ptr<Texture> CreateAliasedRenderTarget(const RenderContext& context, const Settings& settings, const Ptr<Texture>& memory_texture_ptr);
+    [[nodiscard]] static bool IsMemoryAliasingSupported() noexcept;
+
     // Texture interface
     [[nodiscard]] virtual const Settings& GetSettings() const = 0;
+    [[nodiscard]] virtual Data::Size      GetMemorySize() const = 0; // device memory size required by texture with alignment and tiling overhead
+    [[nodiscard]] virtual bool            IsMemoryAliased() const noexcept = 0; // true when texture was created aliasing memory of another texture
 };
 
 } // namespace Methane::Graphics
@@ -0,0 +1,119 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/TransientTexturePool.h
+Pool of transient render target textures keyed by texture settings, which are acquired
+for spans of passes within frame and alias memory of non-overlapping users.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Texture.h"
+
+#include <Methane/Memory.hpp>
+
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+struct RenderContext;
+
+class TransientTexturePool
+{
+public:
+    using PassIndex = uint32_t;
+
+    struct Settings
+    {
+        uint32_t release_idle_frames_count = 3U;   // textures which were not acquired during this number of frames are released
+        bool     is_memory_aliasing_enabled = true; // memory is aliased by textures with different settings, see Texture::IsMemoryAliasingSupported()
+    };
+
+    struct Allocation
+    {
+        uint32_t memory_block_index;
+        uint32_t texture_index; // index of texture in memory block, first texture owns memory aliased by others
+
+        [[nodiscard]] bool operator==(const Allocation& other) const noexcept;
+        [[nodiscard]] bool operator!=(const Allocation& other) const noexcept { return !operator==(other); }
+    };
+
+    TransientTexturePool();
+    explicit TransientTexturePool(const Settings& settings);
+
+    // Allocations are valid only between frame begin and end, textures acquired for overlapping spans of passes never share memory
+    void BeginFrame();
+    [[nodiscard]] Allocation Acquire(const Texture::Settings& texture_settings, PassIndex first_pass_index, PassIndex last_pass_index);
+    void EndFrame();
+
+    // Textures are created only for new allocations, so that acquiring the same textures every frame does not create GPU resources
+    void AllocateTextures(const RenderContext& context);
+    [[nodiscard]] const Ptr<Texture>& GetTexturePtr(const Allocation& allocation) const;
+    [[nodiscard]] bool                IsMemoryShared(const Allocation& allocation) const; // texture memory is owned by or aliased with memory block
+    void Release() noexcept;
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept         { return m_settings; }
+    [[nodiscard]] bool            IsFrameBegun() const noexcept        { return m_is_frame_begun; }
+    [[nodiscard]] uint64_t        GetFrameIndex() const noexcept       { return m_frame_index; }
+    [[nodiscard]] size_t          GetMemoryBlocksCount() const noexcept { return m_memory_blocks.size(); }
+    [[nodiscard]] size_t          GetTexturesCount() const noexcept;
+    [[nodiscard]] size_t          GetAliasedTexturesCount() const noexcept;
+
+    // Memory sizes are estimated from texture settings until textures are allocated, then memory block size is updated
+    // with actual memory requirements of the owner texture, and textures which could not alias memory are counted separately
+    [[nodiscard]] Data::Size GetMemorySize() const noexcept;
+    [[nodiscard]] Data::Size GetPeakMemorySize() const noexcept        { return m_peak_memory_size; }
+    [[nodiscard]] Data::Size GetFrameAcquiredMemorySize() const noexcept { return m_frame_acquired_memory_size; }
+
+private:
+    struct PassSpan
+    {
+        PassIndex first_pass_index;
+        PassIndex last_pass_index;
+    };
+
+    struct PooledTexture
+    {
+        Texture::Settings settings;
+        Ptr<Texture>      texture_ptr;
+        uint64_t          last_acquired_frame_index;
+    };
+
+    struct MemoryBlock
+    {
+        Data::Size                 memory_size;
+        std::vector<PooledTexture> textures;
+        std::vector<PassSpan>      frame_pass_spans; // spans of passes acquired in current frame
+        uint64_t                   last_acquired_frame_index;
+
+        [[nodiscard]] bool IsFreeInPassSpan(const PassSpan& pass_span) const noexcept;
+    };
+
+    Allocation AcquireInMemoryBlock(uint32_t memory_block_index, uint32_t texture_index, const PassSpan& pass_span);
+
+    const Settings           m_settings;
+    std::vector<MemoryBlock> m_memory_blocks;
+    uint64_t                 m_frame_index = 0U;
+    bool                     m_is_frame_begun = false;
+    Data::Size               m_peak_memory_size = 0U;
+    Data::Size               m_frame_acquired_memory_size = 0U;
+};
+
+} // namespace Methane::Graphics
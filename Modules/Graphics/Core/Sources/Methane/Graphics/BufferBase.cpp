@@ -29,6 +29,7 @@ Base implementation of the buffer interface.
 
 #include <magic_enum.hpp>
 #include <sstream>
+#include <iterator>
 
 namespace Methane::Graphics
 {
@@ -56,6 +57,32 @@ uint32_t BufferBase::GetFormattedItemsCount() const noexcept
     return m_settings.item_stride_size > 0U ? GetDataSize(Data::MemoryState::Initialized) / m_settings.item_stride_size : 0U;
 }
 
+Data::Size BufferBase::GetSubResourcesDataExtent(const SubResources& sub_resources) const
+{
+    META_FUNCTION_TASK();
+    // Sub-resources are written at the start offsets of their data ranges, so overlapping ranges do not add up in size
+    const BytesRangeSet data_ranges = GetSubResourcesDataRanges(sub_resources);
+    return data_ranges.IsEmpty() ? 0U : std::prev(data_ranges.end())->GetEnd();
+}
+
+BufferBase::BytesRangeSet BufferBase::GetSubResourcesDataRanges(const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    BytesRangeSet data_ranges;
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        const Data::Index data_offset = GetSubResourceDataOffset(sub_resource);
+        data_ranges.Add(BytesRange(data_offset, data_offset + sub_resource.GetDataSize()));
+    }
+    return data_ranges;
+}
+
+Data::Index BufferBase::GetSubResourceDataOffset(const SubResource& sub_resource) noexcept
+{
+    META_FUNCTION_TASK();
+    return sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+}
+
 BufferSetBase::BufferSetBase(Buffer::Type buffers_type, const Refs<Buffer>& buffer_refs)
     : m_buffers_type(buffers_type)
     , m_refs(buffer_refs)
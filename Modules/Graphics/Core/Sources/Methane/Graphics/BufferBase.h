@@ -27,6 +27,7 @@ Base implementation of the buffer interface.
 #include "ContextBase.h"
 
 #include <Methane/Graphics/Buffer.h>
+#include <Methane/Data/RangeSet.hpp>
 
 #include <magic_enum.hpp>
 
@@ -48,6 +49,16 @@ public:
     const Settings& GetSettings() const noexcept final { return m_settings; }
     uint32_t GetFormattedItemsCount() const noexcept final;
 
+protected:
+    using BytesRangeSet = Data::RangeSet<Data::Index>;
+
+    // ResourceBase overrides
+    Data::Size GetSubResourcesDataExtent(const SubResources& sub_resources) const override;
+
+    // Buffer byte ranges updated with the given sub-resources, where overlapping and adjacent ranges are coalesced
+    static BytesRangeSet GetSubResourcesDataRanges(const SubResources& sub_resources);
+    static Data::Index   GetSubResourceDataOffset(const SubResource& sub_resource) noexcept;
+
 private:
     Settings m_settings;
 };
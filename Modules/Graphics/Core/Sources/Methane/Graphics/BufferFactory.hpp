@@ -100,4 +100,39 @@ CreateReadBackBuffer(const Context& context, Data::Size size, ExtraConstructorAr
     return std::make_shared<NativeBufferType>(dynamic_cast<const ContextBase&>(context), settings, extra_construct_args...);
 }
 
+template<typename NativeBufferType, typename ...ExtraConstructorArgTypes>
+std::enable_if_t<std::is_base_of_v<BufferBase, NativeBufferType>, Ptr<NativeBufferType>>
+CreateIndirectBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_volatile, ExtraConstructorArgTypes... extra_construct_args)
+{
+    META_FUNCTION_TASK();
+    const Buffer::Settings settings{
+        Buffer::Type::Storage,
+        Resource::Usage::Indirect,
+        size,
+        stride,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+    return std::make_shared<NativeBufferType>(dynamic_cast<const ContextBase&>(context), settings, extra_construct_args...);
+}
+
+template<typename NativeBufferType, typename ...ExtraConstructorArgTypes>
+std::enable_if_t<std::is_base_of_v<BufferBase, NativeBufferType>, Ptr<NativeBufferType>>
+CreateStorageBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_read_back, ExtraConstructorArgTypes... extra_construct_args)
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    const Resource::Usage  usage_mask = Resource::Usage::ShaderRead | Resource::Usage::ShaderWrite
+                                      | (is_read_back ? Resource::Usage::ReadBack : Resource::Usage::None);
+    const Buffer::Settings settings{
+        Buffer::Type::Storage,
+        usage_mask,
+        size,
+        stride,
+        PixelFormat::Unknown,
+        Buffer::StorageMode::Private
+    };
+    return std::make_shared<NativeBufferType>(dynamic_cast<const ContextBase&>(context), settings, extra_construct_args...);
+}
+
 } // namespace Methane::Graphics
@@ -28,6 +28,7 @@ Methane command kit implementation.
 #include <Methane/Graphics/Fence.h>
 #include <Methane/Graphics/CommandKit.h>
 #include <Methane/Graphics/BlitCommandList.h>
+#include <Methane/Graphics/ComputeCommandList.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
@@ -72,6 +73,7 @@ bool CommandKitBase::SetName(const std::string& name)
     if (!ObjectBase::SetName(name))
         return false;
 
+    std::scoped_lock lock_guard(m_mutex);
     if (m_cmd_queue_ptr)
         m_cmd_queue_ptr->SetName(fmt::format("{} Command Queue", GetName()));
 
@@ -95,6 +97,7 @@ bool CommandKitBase::SetName(const std::string& name)
 CommandQueue& CommandKitBase::GetQueue() const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     if (m_cmd_queue_ptr)
         return *m_cmd_queue_ptr;
 
@@ -106,6 +109,7 @@ CommandQueue& CommandKitBase::GetQueue() const
 bool CommandKitBase::HasList(CommandListId cmd_list_id) const noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     const CommandListIndex cmd_list_index = GetCommandListIndexById(cmd_list_id);
     return cmd_list_index < m_cmd_list_ptrs.size() && m_cmd_list_ptrs[cmd_list_index];
 }
@@ -113,6 +117,7 @@ bool CommandKitBase::HasList(CommandListId cmd_list_id) const noexcept
 bool CommandKitBase::HasListWithState(CommandList::State cmd_list_state, CommandListId cmd_list_id) const noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     const CommandListIndex cmd_list_index = GetCommandListIndexById(cmd_list_id);
     return cmd_list_index < m_cmd_list_ptrs.size() && m_cmd_list_ptrs[cmd_list_index] && m_cmd_list_ptrs[cmd_list_index]->GetState() == cmd_list_state;
 }
@@ -120,6 +125,7 @@ bool CommandKitBase::HasListWithState(CommandList::State cmd_list_state, Command
 CommandList& CommandKitBase::GetList(CommandListId cmd_list_id = 0U) const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     const CommandListIndex cmd_list_index = GetCommandListIndexById(cmd_list_id);
     META_CHECK_ARG_LESS_DESCR(cmd_list_index, g_max_cmd_lists_count, "no more than 32 command lists are supported in one command kit");
     if (cmd_list_index >= m_cmd_list_ptrs.size())
@@ -131,9 +137,10 @@ CommandList& CommandKitBase::GetList(CommandListId cmd_list_id = 0U) const
 
     switch (m_cmd_list_type)
     {
-    case CommandList::Type::Blit:   cmd_list_ptr = BlitCommandList::Create(GetQueue()); break;
-    case CommandList::Type::Render: cmd_list_ptr = RenderCommandListBase::CreateForSynchronization(GetQueue()); break;
-    default:                        META_UNEXPECTED_ARG(m_cmd_list_type);
+    case CommandList::Type::Blit:    cmd_list_ptr = BlitCommandList::Create(GetQueue()); break;
+    case CommandList::Type::Render:  cmd_list_ptr = RenderCommandListBase::CreateForSynchronization(GetQueue()); break;
+    case CommandList::Type::Compute: cmd_list_ptr = ComputeCommandList::Create(GetQueue()); break;
+    default:                         META_UNEXPECTED_ARG(m_cmd_list_type);
     }
 
     cmd_list_ptr->SetName(fmt::format("{} Utility Command List {}", GetName(), cmd_list_id));
@@ -170,6 +177,7 @@ CommandListSet& CommandKitBase::GetListSet(const std::vector<CommandListId>& cmd
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_EMPTY(cmd_list_ids);
+    std::scoped_lock lock_guard(m_mutex);
     const CommandListSetId cmd_list_set_id = GetCommandListSetId(cmd_list_ids, frame_index_opt);
 
     Ptr<CommandListSet>& cmd_list_set_ptr = m_cmd_list_set_by_id[cmd_list_set_id];
@@ -189,6 +197,7 @@ CommandListSet& CommandKitBase::GetListSet(const std::vector<CommandListId>& cmd
 Fence& CommandKitBase::GetFence(CommandListId fence_id) const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     const uint32_t fence_index = GetCommandListIndexById(fence_id);
     if (fence_index >= m_fence_ptrs.size())
         m_fence_ptrs.resize(fence_index + 1);
@@ -206,6 +215,7 @@ Fence& CommandKitBase::GetFence(CommandListId fence_id) const
 CommandKitBase::CommandListIndex CommandKitBase::GetCommandListIndexById(CommandListId cmd_list_id) const noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
     const auto [it, success] = m_cmd_list_index_by_id.try_emplace(cmd_list_id, static_cast<CommandListIndex>(m_cmd_list_index_by_id.size()));
     return it->second;
 }
@@ -26,8 +26,10 @@ Methane command kit implementation.
 #include "ObjectBase.h"
 
 #include <Methane/Graphics/CommandKit.h>
+#include <Methane/Instrumentation.h>
 
 #include <map>
+#include <mutex>
 
 namespace Methane::Graphics
 {
@@ -70,6 +72,7 @@ private:
     mutable CommandListIndexById m_cmd_list_index_by_id;
     mutable CommandListSetById   m_cmd_list_set_by_id;
     mutable Ptrs<Fence>          m_fence_ptrs;
+    mutable TracyLockable(std::recursive_mutex, m_mutex)
 };
 
 } // namespace Methane::Graphics
@@ -22,6 +22,7 @@ Base implementation of the command list interface.
 ******************************************************************************/
 
 #include "DeviceBase.h"
+#include "ContextBase.h"
 #include "CommandQueueBase.h"
 #include "ProgramBindingsBase.h"
 #include "ResourceBase.h"
@@ -81,6 +82,12 @@ CommandListBase::CommandListBase(CommandQueueBase& command_queue, Type type)
     , m_tracy_gpu_scope(TRACY_GPU_SCOPE_INIT(command_queue.GetTracyContextPtr())) // NOSONAR - do not use in-class initializer
 {
     META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    const ContextBase& context = command_queue.GetContextBase();
+    if (static_cast<bool>(context.GetOptions() & Context::Options::EpochResourceRetention))
+    {
+        m_p_epoch_retainer = &context.GetObjectEpochRetainer();
+    }
     TRACY_GPU_SCOPE_TRY_BEGIN_UNNAMED(m_tracy_gpu_scope);
     META_LOG("{} Command list '{}' was created", magic_enum::enum_name(m_type), GetName());
     META_UNUSED(m_tracy_gpu_scope); // silence unused member warning on MacOS when Tracy GPU profiling
@@ -90,6 +97,7 @@ CommandListBase::~CommandListBase()
 {
     META_FUNCTION_TASK();
     META_LOG("{} Command list '{}' was destroyed", magic_enum::enum_name(m_type), GetName());
+    EndRetentionEpoch();
 }
 
 void CommandListBase::PushDebugGroup(DebugGroup& debug_group)
@@ -131,6 +139,7 @@ void CommandListBase::Reset(DebugGroup* p_debug_group)
              p_debug_group ? fmt::format("with debug group '{}'", p_debug_group->GetName()) : "");
 
     ResetCommandState();
+    BeginRetentionEpoch();
     SetCommandListStateNoLock(State::Encoding);
 
     const bool debug_group_changed = GetTopOpenDebugGroup() != p_debug_group;
@@ -183,7 +192,7 @@ void CommandListBase::SetProgramBindings(ProgramBindings& program_bindings, Prog
     if (static_cast<bool>(apply_behavior & ProgramBindings::ApplyBehavior::RetainResources))
     {
         META_SCOPE_TASK("RetainResource");
-        RetainResource(program_bindings_base.GetBasePtr());
+        RetainResource(program_bindings_base);
     }
 }
 
@@ -210,6 +219,9 @@ void CommandListBase::Commit()
 void CommandListBase::WaitUntilCompleted(uint32_t timeout_ms)
 {
     META_FUNCTION_TASK();
+    // Batched command list sets have to be submitted to GPU before waiting for their completion on CPU
+    GetCommandQueueBase().FlushSubmits();
+
     std::unique_lock pending_state_lock(m_state_change_mutex);
     const auto is_completed = [this] { return m_state != State::Executing; };
     if (is_completed())
@@ -377,6 +389,34 @@ CommandQueue& CommandListBase::GetCommandQueue()
     return *m_command_queue_ptr;
 }
 
+void CommandListBase::ReleaseRetainedResources()
+{
+    META_FUNCTION_TASK();
+    m_command_state.retained_resources.clear();
+    EndRetentionEpoch();
+}
+
+void CommandListBase::BeginRetentionEpoch()
+{
+    META_FUNCTION_TASK();
+    if (!m_p_epoch_retainer)
+        return;
+
+    // Previous epoch is used until command list is reset, when its commands are not executed
+    EndRetentionEpoch();
+    m_retention_epoch = m_p_epoch_retainer->BeginEpochUse();
+}
+
+void CommandListBase::EndRetentionEpoch()
+{
+    META_FUNCTION_TASK();
+    if (!m_retention_epoch)
+        return;
+
+    m_p_epoch_retainer->EndEpochUse(m_retention_epoch);
+    m_retention_epoch = 0U;
+}
+
 void CommandListBase::ResetCommandState()
 {
     META_FUNCTION_TASK();
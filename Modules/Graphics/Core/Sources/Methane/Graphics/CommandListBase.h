@@ -24,6 +24,7 @@ Base implementation of the command list interface.
 #pragma once
 
 #include "ObjectBase.h"
+#include "ObjectEpochRetainer.h"
 #include "QueryBuffer.h"
 
 #include <Methane/Graphics/Program.h>
@@ -110,9 +111,27 @@ public:
     const ProgramBindingsBase* GetProgramBindingsPtr() const noexcept   { return GetCommandState().program_bindings_ptr; }
     Ptr<CommandListBase>       GetCommandListPtr()                      { return GetPtr<CommandListBase>(); }
 
-    inline void RetainResource(const Ptr<ObjectBase>& resource_ptr)     { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
-    inline void RetainResource(ObjectBase& resource)                    { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
-    inline void ReleaseRetainedResources()                              { m_command_state.retained_resources.clear(); }
+    void ReleaseRetainedResources();
+
+    inline void RetainResource(const Ptr<ObjectBase>& resource_ptr)
+    {
+        if (!resource_ptr)
+            return;
+
+        if (m_retention_epoch)
+            m_p_epoch_retainer->Retain(*resource_ptr, m_retention_epoch);
+        else
+            m_command_state.retained_resources.emplace_back(resource_ptr);
+    }
+
+    inline void RetainResource(ObjectBase& resource)
+    {
+        // With epoch retention shared pointer is not acquired here, so there are no atomic reference counter updates
+        if (m_retention_epoch)
+            m_p_epoch_retainer->Retain(resource, m_retention_epoch);
+        else
+            m_command_state.retained_resources.emplace_back(resource.GetBasePtr());
+    }
 
     template<typename T, typename = std::enable_if_t<std::is_base_of_v<ObjectBase, T>>>
     inline void RetainResources(const Ptrs<T>& resource_ptrs)
@@ -130,6 +149,7 @@ protected:
 
     void SetCommandListState(State state);
     void SetCommandListStateNoLock(State state);
+    void DisableEpochResourceRetention() noexcept { m_p_epoch_retainer = nullptr; }
     bool IsExecutingOnAnyFrame() const           { return m_state == State::Executing; }
     bool IsCommitted() const                     { return m_state == State::Committed; }
     bool IsExecuting() const                     { return m_state == State::Executing; }
@@ -150,10 +170,14 @@ private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroupBase>>;
 
     void CompleteInternal();
+    void BeginRetentionEpoch();
+    void EndRetentionEpoch();
 
     const Type                  m_type;
     Ptr<CommandQueueBase>       m_command_queue_ptr;
     CommandState                m_command_state;
+    ObjectEpochRetainer*        m_p_epoch_retainer = nullptr;
+    ObjectEpochRetainer::Epoch  m_retention_epoch = 0U;
     DebugGroupStack             m_open_debug_groups;
     CompletedCallback           m_completed_callback;
     State                       m_state = State::Pending;
@@ -56,6 +56,7 @@ public:
     [[nodiscard]] const Context& GetContext() const noexcept final;
     CommandList::Type GetCommandListType() const noexcept final { return m_command_lists_type; }
     void Execute(CommandListSet& command_lists, const CommandList::CompletedCallback& completed_callback = {}) override;
+    void FlushSubmits() override { /* command list sets are submitted to GPU on execute by default */ }
 
     // CommandQueueBase interface
     virtual TimestampQueryBuffer* GetTimestampQueryBuffer() const noexcept { return nullptr; }
@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeCommandListBase.cpp
+Base implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include "ComputeCommandListBase.h"
+#include "CommandQueueBase.h"
+#include "BufferBase.h"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+
+namespace Methane::Graphics
+{
+
+ComputeCommandListBase::ComputeCommandListBase(CommandQueueBase& command_queue)
+    : CommandListBase(command_queue, Type::Compute)
+{
+    META_FUNCTION_TASK();
+}
+
+void ComputeCommandListBase::ResetWithState(ComputeState& compute_state, DebugGroup* p_debug_group)
+{
+    META_FUNCTION_TASK();
+    CommandListBase::Reset(p_debug_group);
+    SetComputeState(compute_state);
+}
+
+void ComputeCommandListBase::SetComputeState(ComputeState& compute_state)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' SET COMPUTE STATE '{}':\n{}", magic_enum::enum_name(GetType()), GetName(), compute_state.GetName(), static_cast<std::string>(compute_state.GetSettings()));
+
+    VerifyEncodingState();
+
+    if (m_compute_state_ptr.get() == std::addressof(compute_state))
+        return;
+
+    auto& compute_state_base = static_cast<ComputeStateBase&>(compute_state);
+    compute_state_base.Apply(*this);
+
+    Ptr<ObjectBase> compute_state_object_ptr = compute_state_base.GetBasePtr();
+    m_compute_state_ptr = std::static_pointer_cast<ComputeStateBase>(compute_state_object_ptr);
+    RetainResource(compute_state_object_ptr);
+}
+
+void ComputeCommandListBase::Dispatch(const ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' DISPATCH {} thread groups", magic_enum::enum_name(GetType()), GetName(), static_cast<std::string>(thread_groups_count));
+
+    VerifyEncodingState();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_compute_state_ptr, "compute state must be set before dispatch call");
+    META_CHECK_ARG_NOT_ZERO_DESCR(thread_groups_count.GetWidth() * thread_groups_count.GetHeight() * thread_groups_count.GetDepth(),
+                                  "can not dispatch empty thread groups count");
+}
+
+void ComputeCommandListBase::DispatchIndirect(Buffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' DISPATCH INDIRECT from arguments buffer '{}' at offset {}", magic_enum::enum_name(GetType()), GetName(), arguments_buffer.GetName(), arguments_offset);
+
+    VerifyEncodingState();
+    META_CHECK_ARG_NOT_NULL_DESCR(m_compute_state_ptr, "compute state must be set before indirect dispatch call");
+
+    using namespace magic_enum::bitwise_operators;
+    META_CHECK_ARG_NAME_DESCR("arguments_buffer", static_cast<bool>(arguments_buffer.GetSettings().usage_mask & Resource::Usage::Indirect),
+                              "can not dispatch indirect with arguments from buffer '{}' which has no 'Indirect' usage", arguments_buffer.GetName());
+    META_CHECK_ARG_EQUAL_DESCR(arguments_offset % sizeof(uint32_t), 0U, "indirect dispatch arguments offset must be aligned to {} bytes", sizeof(uint32_t));
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(arguments_offset + sizeof(DispatchArguments), arguments_buffer.GetSettings().size,
+                                       "indirect dispatch arguments at offset {} are out of bounds of buffer '{}'", arguments_offset, arguments_buffer.GetName());
+
+    RetainResource(static_cast<BufferBase&>(arguments_buffer));
+}
+
+void ComputeCommandListBase::ResetCommandState()
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' reset command state", magic_enum::enum_name(GetType()), GetName());
+
+    CommandListBase::ResetCommandState();
+    m_compute_state_ptr.reset();
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,59 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeCommandListBase.h
+Base implementation of the compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandListBase.h"
+#include "ComputeStateBase.h"
+
+#include <Methane/Graphics/ComputeCommandList.h>
+
+namespace Methane::Graphics
+{
+
+class ComputeCommandListBase
+    : public ComputeCommandList
+    , public CommandListBase
+{
+public:
+    explicit ComputeCommandListBase(CommandQueueBase& command_queue);
+
+    using CommandListBase::Reset;
+
+    // ComputeCommandList interface
+    void ResetWithState(ComputeState& compute_state, DebugGroup* p_debug_group = nullptr) override;
+    void SetComputeState(ComputeState& compute_state) override;
+    void Dispatch(const ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Buffer& arguments_buffer, Data::Size arguments_offset) override;
+
+protected:
+    // CommandListBase overrides
+    void ResetCommandState() override;
+
+    const ComputeStateBase* GetComputeStatePtr() const noexcept { return m_compute_state_ptr.get(); }
+
+private:
+    Ptr<ComputeStateBase> m_compute_state_ptr;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,81 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeStateBase.cpp
+Base implementation of the compute state interface.
+
+******************************************************************************/
+
+#include "ComputeStateBase.h"
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <fmt/format.h>
+
+namespace Methane::Graphics
+{
+
+bool ComputeState::Settings::operator==(const Settings& other) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::tie(program_ptr, thread_group_size) ==
+           std::tie(other.program_ptr, other.thread_group_size);
+}
+
+bool ComputeState::Settings::operator!=(const Settings& other) const noexcept
+{
+    META_FUNCTION_TASK();
+    return !operator==(other);
+}
+
+ComputeState::Settings::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("  - Program '{}';\n  - Thread group size: {}.",
+                       program_ptr->GetName(),
+                       static_cast<std::string>(thread_group_size));
+}
+
+ComputeStateBase::ComputeStateBase(const ContextBase& context, const Settings& settings)
+    : m_context(context)
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+}
+
+void ComputeStateBase::Reset(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(settings.program_ptr, "program is not initialized in compute state settings");
+    META_CHECK_ARG_NOT_ZERO_DESCR(settings.thread_group_size.GetWidth() * settings.thread_group_size.GetHeight() * settings.thread_group_size.GetDepth(),
+                                  "thread group size of the compute state can not be empty");
+    META_CHECK_ARG_TRUE_DESCR(settings.program_ptr->GetShaderTypes() == Shader::Types{ Shader::Type::Compute },
+                              "compute state program must contain a single compute shader");
+
+    m_settings = settings;
+}
+
+Program& ComputeStateBase::GetProgram()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_settings.program_ptr);
+    return *m_settings.program_ptr;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,60 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ComputeStateBase.h
+Base implementation of the compute state interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/ComputeState.h>
+
+#include "ObjectBase.h"
+
+namespace Methane::Graphics
+{
+
+class ContextBase;
+class ComputeCommandListBase;
+
+class ComputeStateBase
+    : public ObjectBase
+    , public ComputeState
+{
+public:
+    ComputeStateBase(const ContextBase& context, const Settings& settings);
+
+    // ComputeState overrides
+    const Settings& GetSettings() const noexcept override { return m_settings; }
+    void Reset(const Settings& settings) override;
+
+    // ComputeStateBase interface
+    virtual void Apply(ComputeCommandListBase& command_list) = 0;
+
+    const ContextBase& GetContext() const noexcept { return m_context; }
+
+protected:
+    Program& GetProgram();
+
+private:
+    const ContextBase& m_context;
+    Settings           m_settings;
+};
+
+} // namespace Methane::Graphics
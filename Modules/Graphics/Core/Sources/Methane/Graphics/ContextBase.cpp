@@ -27,17 +27,21 @@ Base implementation of the context interface.
 #include "DescriptorManager.h"
 
 #include <Methane/Graphics/CommandKit.h>
+#include <Methane/Graphics/ResourceUploadBatch.h>
 #include <Methane/Instrumentation.h>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
 static const std::array<std::string, magic_enum::enum_count<CommandList::Type>()> g_default_command_kit_names = { {
     "Upload",
     "Render",
-    "Parallel Render"
+    "Parallel Render",
+    "Compute"
 } };
 
 #ifdef METHANE_LOGGING_ENABLED
@@ -48,12 +52,126 @@ static const std::array<std::string, magic_enum::enum_count<Context::WaitFor>()>
 }};
 #endif
 
+// Command kit supports up to 32 command lists: one is used by the context creating thread
+// and two ids are reserved for the fences of pre-upload and post-upload synchronization
+static constexpr CommandKit::CommandListId g_max_upload_thread_cmd_lists_count = 29U;
+
+class UploadCommandListIdPool
+{
+public:
+    static CommandKit::CommandListId AcquireForCurrentThread(const Ptr<UploadCommandListIdPool>& pool_ptr)
+    {
+        META_FUNCTION_TASK();
+        const auto [cmd_list_id, is_acquired] = pool_ptr->Acquire(std::this_thread::get_id());
+        if (is_acquired)
+        {
+            // Pool is tracked by the current thread to release its id on thread exit
+            thread_local ThreadReleaser s_thread_releaser;
+            s_thread_releaser.Track(pool_ptr);
+        }
+        return cmd_list_id;
+    }
+
+    CommandKit::CommandListId GetAllocatedIdsCount() const
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        return m_allocated_ids_count;
+    }
+
+    void Reset()
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        m_id_by_thread.clear();
+        m_free_ids.clear();
+        m_allocated_ids_count = 0U;
+    }
+
+private:
+    // Releases command list ids of the exiting thread in all pools which are still alive
+    class ThreadReleaser
+    {
+    public:
+        ThreadReleaser() = default;
+        ThreadReleaser(const ThreadReleaser&) = delete;
+        ThreadReleaser(ThreadReleaser&&) = delete;
+        ThreadReleaser& operator=(const ThreadReleaser&) = delete;
+        ThreadReleaser& operator=(ThreadReleaser&&) = delete;
+
+        ~ThreadReleaser()
+        {
+            const std::thread::id thread_id = std::this_thread::get_id();
+            for(const WeakPtr<UploadCommandListIdPool>& pool_wptr : m_pool_wptrs)
+            {
+                if (const Ptr<UploadCommandListIdPool> pool_ptr = pool_wptr.lock())
+                    pool_ptr->Release(thread_id);
+            }
+        }
+
+        void Track(const Ptr<UploadCommandListIdPool>& pool_ptr)
+        {
+            m_pool_wptrs.erase(std::remove_if(m_pool_wptrs.begin(), m_pool_wptrs.end(),
+                                              [](const WeakPtr<UploadCommandListIdPool>& pool_wptr) { return pool_wptr.expired(); }),
+                               m_pool_wptrs.end());
+            m_pool_wptrs.emplace_back(pool_ptr);
+        }
+
+    private:
+        WeakPtrs<UploadCommandListIdPool> m_pool_wptrs;
+    };
+
+    std::pair<CommandKit::CommandListId, bool> Acquire(std::thread::id thread_id)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        if (const auto thread_cmd_list_id_it = m_id_by_thread.find(thread_id);
+            thread_cmd_list_id_it != m_id_by_thread.end())
+            return { thread_cmd_list_id_it->second, false };
+
+        CommandKit::CommandListId cmd_list_id = 0U;
+        if (m_free_ids.empty())
+        {
+            META_CHECK_ARG_LESS_DESCR(m_allocated_ids_count, g_max_upload_thread_cmd_lists_count,
+                                      "no more than {} threads can upload resources simultaneously", g_max_upload_thread_cmd_lists_count);
+            cmd_list_id = ++m_allocated_ids_count;
+        }
+        else
+        {
+            cmd_list_id = m_free_ids.back();
+            m_free_ids.pop_back();
+        }
+
+        m_id_by_thread.try_emplace(thread_id, cmd_list_id);
+        return { cmd_list_id, true };
+    }
+
+    // Upload command list of the released id keeps its encoded commands, which are committed with the next resources upload
+    void Release(std::thread::id thread_id)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_mutex);
+        const auto thread_cmd_list_id_it = m_id_by_thread.find(thread_id);
+        if (thread_cmd_list_id_it == m_id_by_thread.end())
+            return;
+
+        m_free_ids.emplace_back(thread_cmd_list_id_it->second);
+        m_id_by_thread.erase(thread_cmd_list_id_it);
+    }
+
+    std::map<std::thread::id, CommandKit::CommandListId> m_id_by_thread;
+    std::vector<CommandKit::CommandListId>               m_free_ids;
+    CommandKit::CommandListId                            m_allocated_ids_count = 0U;
+    mutable TracyLockable(std::mutex,                    m_mutex)
+};
+
 ContextBase::ContextBase(DeviceBase& device, UniquePtr<DescriptorManager>&& descriptor_manager_ptr,
                          tf::Executor& parallel_executor, Type type)
     : m_type(type)
     , m_device_ptr(device.GetPtr<DeviceBase>())
     , m_descriptor_manager_ptr(std::move(descriptor_manager_ptr))
     , m_parallel_executor(parallel_executor)
+    , m_upload_cmd_list_id_pool_ptr(std::make_shared<UploadCommandListIdPool>())
 {
     META_FUNCTION_TASK();
 }
@@ -63,7 +181,11 @@ ContextBase::~ContextBase() = default;
 void ContextBase::RequestDeferredAction(DeferredAction action) const noexcept
 {
     META_FUNCTION_TASK();
-    m_requested_action = std::max(m_requested_action, action);
+    DeferredAction requested_action = m_requested_action.load();
+    while(requested_action < action && !m_requested_action.compare_exchange_weak(requested_action, action))
+    {
+        // requested action is updated by compare exchange on failure
+    }
 }
 
 void ContextBase::CompleteInitialization()
@@ -119,6 +241,34 @@ void ContextBase::Reset()
     Initialize(*device_ptr, true);
 }
 
+void ContextBase::SubmitUploadBatch(ResourceUploadBatch& upload_batch, CommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    if (upload_batch.IsEmpty())
+        return;
+
+    META_LOG("Context '{}' SUBMIT upload batch of {} resource uploads with {} bytes of data",
+             GetName(), upload_batch.GetUploadsCount(), upload_batch.GetDataSize());
+
+    // All resource updates are recorded in the upload command list grouped by destination resource
+    for(const ResourceUploadBatch::ResourceUpload& resource_upload : upload_batch.SortByDestination())
+    {
+        resource_upload.resource_ptr->SetData(resource_upload.sub_resources, target_cmd_queue);
+    }
+    upload_batch.Clear();
+
+    // Upload command list is submitted once and target command queue waits for upload completion on GPU without CPU flush,
+    // which is not needed when uploads are submitted to the target queue itself, since its commands are executed in order
+    if (ContextBase::UploadResources() &&
+        std::addressof(GetUploadCommandKit().GetQueue()) != std::addressof(target_cmd_queue))
+    {
+        GetUploadCommandKit().GetFence().FlushOnGpu(target_cmd_queue);
+    }
+
+    DeferredAction upload_action = DeferredAction::UploadResources;
+    m_requested_action.compare_exchange_strong(upload_action, DeferredAction::None);
+}
+
 void ContextBase::OnGpuWaitStart(WaitFor)
 {
     // Intentionally unimplemented
@@ -127,6 +277,8 @@ void ContextBase::OnGpuWaitStart(WaitFor)
 void ContextBase::OnGpuWaitComplete(WaitFor wait_for)
 {
     META_FUNCTION_TASK();
+    AdvanceEpochAndDeleteCompletedObjects();
+
     if (wait_for != WaitFor::ResourcesUploaded)
     {
         PerformRequestedAction();
@@ -140,11 +292,42 @@ void ContextBase::Release()
 
     m_device_ptr.reset();
 
-    m_default_command_kit_ptr_by_queue.clear();
-    for (Ptr<CommandKit>& cmd_kit_ptr : m_default_command_kit_ptrs)
-        cmd_kit_ptr.reset();
+    {
+        std::scoped_lock lock_guard(m_default_command_kits_mutex);
+        m_default_command_kit_ptr_by_queue.clear();
+        for (Ptr<CommandKit>& cmd_kit_ptr : m_default_command_kit_ptrs)
+            cmd_kit_ptr.reset();
+    }
+
+    m_upload_cmd_list_id_pool_ptr->Reset();
 
     Data::Emitter<IContextCallback>::Emit(&IContextCallback::OnContextReleased, std::ref(*this));
+
+    // Objects retained by epochs are released after all command lists are released in context release callbacks
+    m_object_epoch_retainer.ReleaseAllObjects();
+
+    // Native objects of released resources are deleted without budget limits, since GPU has already finished all work
+    m_deferred_deletion_queue.DeleteAll();
+}
+
+void ContextBase::SetDeferredDeletionBudget(const DeferredDeletionBudget& deletion_budget)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_OR_EQUAL(deletion_budget.max_duration_sec, 0.0);
+    m_deferred_deletion_budget = deletion_budget;
+}
+
+void ContextBase::AdvanceEpochAndDeleteCompletedObjects()
+{
+    META_FUNCTION_TASK();
+    m_object_epoch_retainer.AdvanceEpoch();
+
+    const size_t deleted_objects_count = m_deferred_deletion_queue.DeleteCompleted(m_object_epoch_retainer.GetCompletedEpoch(),
+                                                                                   m_deferred_deletion_budget.max_objects_count,
+                                                                                   m_deferred_deletion_budget.max_duration_sec);
+    META_UNUSED(deleted_objects_count);
+    META_LOG("Context '{}' deleted {} deferred objects, {} objects are pending deletion",
+             GetName(), deleted_objects_count, m_deferred_deletion_queue.GetPendingObjectsCount());
 }
 
 void ContextBase::Initialize(DeviceBase& device, bool is_callback_emitted)
@@ -168,6 +351,7 @@ void ContextBase::Initialize(DeviceBase& device, bool is_callback_emitted)
 CommandKit& ContextBase::GetDefaultCommandKit(CommandList::Type type) const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_default_command_kits_mutex);
     Ptr<CommandKit>& cmd_kit_ptr = m_default_command_kit_ptrs[magic_enum::enum_index(type).value()];
     if (cmd_kit_ptr)
         return *cmd_kit_ptr;
@@ -182,6 +366,7 @@ CommandKit& ContextBase::GetDefaultCommandKit(CommandList::Type type) const
 CommandKit& ContextBase::GetDefaultCommandKit(CommandQueue& cmd_queue) const
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_default_command_kits_mutex);
     Ptr<CommandKit>& cmd_kit_ptr = m_default_command_kit_ptr_by_queue[std::addressof(cmd_queue)];
     if (cmd_kit_ptr)
         return *cmd_kit_ptr;
@@ -225,6 +410,8 @@ bool ContextBase::SetName(const std::string& name)
         return false;
 
     GetDeviceBase().SetName(fmt::format("{} Device", name));
+
+    std::scoped_lock lock_guard(m_default_command_kits_mutex);
     for(const Ptr<CommandKit>& cmd_kit_ptr : m_default_command_kit_ptrs)
     {
         if (cmd_kit_ptr)
@@ -240,6 +427,7 @@ void ContextBase::ExecuteSyncCommandLists(const CommandKit& upload_cmd_kit) cons
     constexpr auto cmd_list_id = static_cast<CommandKit::CommandListId>(cmd_list_purpose);
     const std::vector<CommandKit::CommandListId> cmd_list_ids = { cmd_list_id };
 
+    std::scoped_lock lock_guard(m_default_command_kits_mutex);
     for (const auto& [cmd_queue_ptr, cmd_kit_ptr] : m_default_command_kit_ptr_by_queue)
     {
         if (cmd_kit_ptr.get() == std::addressof(upload_cmd_kit) || !cmd_kit_ptr->HasList(cmd_list_id))
@@ -276,36 +464,93 @@ void ContextBase::ExecuteSyncCommandLists(const CommandKit& upload_cmd_kit) cons
     }
 }
 
+CommandKit::CommandListId ContextBase::GetUploadCommandListId() const
+{
+    META_FUNCTION_TASK();
+    if (std::this_thread::get_id() == m_upload_main_thread_id)
+        return static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::Default);
+
+    return UploadCommandListIdPool::AcquireForCurrentThread(m_upload_cmd_list_id_pool_ptr);
+}
+
+std::vector<CommandKit::CommandListId> ContextBase::GetUploadCommandListIds() const
+{
+    META_FUNCTION_TASK();
+    std::vector<CommandKit::CommandListId> upload_cmd_list_ids{ static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::Default) };
+
+    // Released ids are also returned, because their command lists may still have commands encoded by exited threads
+    const CommandKit::CommandListId allocated_ids_count = m_upload_cmd_list_id_pool_ptr->GetAllocatedIdsCount();
+    upload_cmd_list_ids.reserve(allocated_ids_count + 1);
+    for(CommandKit::CommandListId cmd_list_id = 1U; cmd_list_id <= allocated_ids_count; ++cmd_list_id)
+    {
+        upload_cmd_list_ids.emplace_back(cmd_list_id);
+    }
+    return upload_cmd_list_ids;
+}
+
 bool ContextBase::UploadResources()
 {
     META_FUNCTION_TASK();
     const CommandKit& upload_cmd_kit = GetUploadCommandKit();
-    if (!upload_cmd_kit.HasList())
-        return false;
 
-    CommandList& upload_cmd_list = upload_cmd_kit.GetList();
-    const CommandList::State upload_cmd_state = upload_cmd_list.GetState();
-    if (upload_cmd_state == CommandList::State::Pending)
-        return false;
+    // Upload command lists encoded by all threads are committed and executed together,
+    // while encoding of new upload commands is blocked until upload command lists are submitted for execution
+    std::unique_lock upload_encoding_lock(m_upload_encoding_mutex);
 
-    if (upload_cmd_state == CommandList::State::Executing)
-        return true;
+    bool is_uploading = false;
+    std::vector<CommandKit::CommandListId> committed_cmd_list_ids;
+    for(const CommandKit::CommandListId upload_cmd_list_id : GetUploadCommandListIds())
+    {
+        if (!upload_cmd_kit.HasList(upload_cmd_list_id))
+            continue;
 
-    META_LOG("Context '{}' UPLOAD resources", GetName());
+        CommandList& upload_cmd_list = upload_cmd_kit.GetList(upload_cmd_list_id);
+        switch(upload_cmd_list.GetState())
+        {
+        case CommandList::State::Pending:
+            break;
 
-    if (upload_cmd_state == CommandList::State::Encoding)
-        upload_cmd_list.Commit();
+        case CommandList::State::Executing:
+            is_uploading = true;
+            break;
 
-    // Execute pre-upload synchronization command lists for all queues except the upload command queue
-    // and set upload command queue fence to wait for pre-upload synchronization completion in other command queues
-    ExecuteSyncCommandLists<CommandKit::CommandListPurpose::PreUploadSync>(upload_cmd_kit);
+        case CommandList::State::Encoding:
+            upload_cmd_list.Commit();
+            committed_cmd_list_ids.emplace_back(upload_cmd_list_id);
+            break;
 
-    // Execute resource upload command lists
-    upload_cmd_kit.GetQueue().Execute(upload_cmd_kit.GetListSet());
+        case CommandList::State::Committed:
+            committed_cmd_list_ids.emplace_back(upload_cmd_list_id);
+            break;
 
-    // Execute post-upload synchronization command lists for all queues except the upload command queue
-    // and set post-upload command queue fences to wait for upload command command queue completion
-    ExecuteSyncCommandLists<CommandKit::CommandListPurpose::PostUploadSync>(upload_cmd_kit);
+        default:
+            META_UNEXPECTED_ARG(upload_cmd_list.GetState());
+        }
+    }
+
+    if (committed_cmd_list_ids.empty())
+        return is_uploading;
+
+    META_LOG("Context '{}' UPLOAD resources with {} command lists", GetName(), committed_cmd_list_ids.size());
+
+    {
+        std::scoped_lock upload_sync_lock(m_upload_sync_mutex);
+
+        // Execute pre-upload synchronization command lists for all queues except the upload command queue
+        // and set upload command queue fence to wait for pre-upload synchronization completion in other command queues
+        ExecuteSyncCommandLists<CommandKit::CommandListPurpose::PreUploadSync>(upload_cmd_kit);
+    }
+
+    // Execute resource upload command lists of all threads in one batch
+    upload_cmd_kit.GetQueue().Execute(upload_cmd_kit.GetListSet(committed_cmd_list_ids));
+
+    {
+        std::scoped_lock upload_sync_lock(m_upload_sync_mutex);
+
+        // Execute post-upload synchronization command lists for all queues except the upload command queue
+        // and set post-upload command queue fences to wait for upload command command queue completion
+        ExecuteSyncCommandLists<CommandKit::CommandListPurpose::PostUploadSync>(upload_cmd_kit);
+    }
 
     return true;
 }
@@ -313,12 +558,13 @@ bool ContextBase::UploadResources()
 void ContextBase::PerformRequestedAction()
 {
     META_FUNCTION_TASK();
-    switch(m_requested_action)
+    switch(const DeferredAction requested_action = m_requested_action.load();
+           requested_action)
     {
     case DeferredAction::None:                   break;
     case DeferredAction::UploadResources:        UploadResources(); break;
     case DeferredAction::CompleteInitialization: CompleteInitialization(); break;
-    default:                                     META_UNEXPECTED_ARG(m_requested_action);
+    default:                                     META_UNEXPECTED_ARG(requested_action);
     }
     m_requested_action = DeferredAction::None;
 }
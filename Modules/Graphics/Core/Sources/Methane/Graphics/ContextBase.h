@@ -24,15 +24,23 @@ Base implementation of the context interface.
 #pragma once
 
 #include "ObjectBase.h"
+#include "ObjectEpochRetainer.h"
 
 #include <Methane/Graphics/Fence.h>
 #include <Methane/Graphics/Context.h>
 #include <Methane/Graphics/CommandKit.h>
 #include <Methane/Graphics/Native/ContextNT.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Data/DeferredDeletionQueue.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <array>
+#include <map>
 #include <string>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <atomic>
 #include <magic_enum.hpp>
 
 namespace tf
@@ -47,6 +55,7 @@ namespace Methane::Graphics
 
 class DeviceBase;
 class CommandQueueBase;
+class UploadCommandListIdPool;
 struct CommandQueue;
 struct CommandList;
 struct CommandListSet;
@@ -74,9 +83,12 @@ public:
     void              WaitForGpu(WaitFor wait_for) override;
     void              Reset(Device& device) override;
     void              Reset() override;
+    void              SubmitUploadBatch(ResourceUploadBatch& upload_batch, CommandQueue& target_cmd_queue) override;
     CommandKit&       GetDefaultCommandKit(CommandList::Type type) const final;
     CommandKit&       GetDefaultCommandKit(CommandQueue& cmd_queue) const final;
     const Device&     GetDevice() const final;
+    const DeferredDeletionBudget& GetDeferredDeletionBudget() const noexcept override { return m_deferred_deletion_budget; }
+    void              SetDeferredDeletionBudget(const DeferredDeletionBudget& deletion_budget) override;
 
     // ContextBase interface
     virtual void Initialize(DeviceBase& device, bool is_callback_emitted = true);
@@ -85,12 +97,36 @@ public:
     // Object interface
     bool SetName(const std::string& name) override;
 
-    DeferredAction     GetRequestedAction() const noexcept { return m_requested_action; }
+    DeferredAction     GetRequestedAction() const noexcept { return m_requested_action.load(); }
     Ptr<DeviceBase>    GetDeviceBasePtr() const noexcept   { return m_device_ptr; }
     DeviceBase&        GetDeviceBase();
     const DeviceBase&  GetDeviceBase() const;
     DescriptorManager& GetDescriptorManager() const;
 
+    // Object epoch retainer is used by command lists instead of retaining resources on every use with EpochResourceRetention option
+    ObjectEpochRetainer& GetObjectEpochRetainer() const noexcept { return m_object_epoch_retainer; }
+
+    // Native objects of released resources are deleted in batches after completion of the current epoch
+    Data::DeferredDeletionQueue& GetDeferredDeletionQueue() const noexcept { return m_deferred_deletion_queue; }
+
+    template<typename T>
+    void DeferDeletion(T&& native_object) const
+    {
+        m_deferred_deletion_queue.Push(m_object_epoch_retainer.GetCurrentEpoch(), std::forward<T>(native_object));
+    }
+
+    // Resources are uploaded with a separate command list of the upload command kit for each thread,
+    // so that resources can be created and initialized with data from multiple worker threads in parallel.
+    // Context creating thread uses the default upload command list with zero id,
+    // while ids of worker threads are returned to the pool on thread exit and reused by other threads.
+    CommandKit::CommandListId GetUploadCommandListId() const;
+
+    // Shared lock is held while encoding resource upload commands, which prevents upload command lists from being committed
+    [[nodiscard]] auto LockUploadEncoding() const { return std::shared_lock<SharedLockableBase(std::shared_mutex)>(m_upload_encoding_mutex); }
+
+    // Synchronization command lists of other queues are shared between uploading threads and are encoded under this lock
+    [[nodiscard]] auto LockUploadSyncCommandLists() const { return std::scoped_lock<LockableBase(std::mutex)>(m_upload_sync_mutex); }
+
 protected:
     void PerformRequestedAction();
     void SetDevice(DeviceBase& device);
@@ -100,6 +136,9 @@ protected:
     virtual void OnGpuWaitStart(WaitFor);
     virtual void OnGpuWaitComplete(WaitFor wait_for);
 
+    // Start new epoch and delete objects released in completed epochs within deferred deletion budget
+    void AdvanceEpochAndDeleteCompletedObjects();
+
 private:
     using CommandKitPtrByType = std::array<Ptr<CommandKit>, magic_enum::enum_count<CommandList::Type>()>;
     using CommandKitByQueue   = std::map<CommandQueue*, Ptr<CommandKit>>;
@@ -107,6 +146,8 @@ private:
     template<CommandKit::CommandListPurpose cmd_list_purpose>
     void ExecuteSyncCommandLists(const CommandKit& upload_cmd_kit) const;
 
+    std::vector<CommandKit::CommandListId> GetUploadCommandListIds() const;
+
     const Type                       m_type;
     Ptr<DeviceBase>                  m_device_ptr;
     UniquePtr<DescriptorManager>     m_descriptor_manager_ptr;
@@ -114,8 +155,16 @@ private:
     ObjectBase::RegistryBase         m_objects_cache;
     mutable CommandKitPtrByType      m_default_command_kit_ptrs;
     mutable CommandKitByQueue        m_default_command_kit_ptr_by_queue;
-    mutable DeferredAction           m_requested_action = DeferredAction::None;
+    mutable TracyLockable(std::recursive_mutex, m_default_command_kits_mutex)
+    mutable std::atomic<DeferredAction> m_requested_action{ DeferredAction::None };
     mutable bool                     m_is_completing_initialization = false;
+    mutable ObjectEpochRetainer      m_object_epoch_retainer;
+    DeferredDeletionBudget           m_deferred_deletion_budget;
+    mutable Data::DeferredDeletionQueue m_deferred_deletion_queue;
+    const std::thread::id            m_upload_main_thread_id = std::this_thread::get_id();
+    const Ptr<UploadCommandListIdPool> m_upload_cmd_list_id_pool_ptr;
+    mutable TracySharedLockable(std::shared_mutex, m_upload_encoding_mutex)
+    mutable TracyLockable(std::mutex, m_upload_sync_mutex)
 };
 
 } // namespace Methane::Graphics
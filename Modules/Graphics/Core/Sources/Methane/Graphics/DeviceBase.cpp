@@ -26,6 +26,9 @@ Base implementation of the device interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <sstream>
 
 namespace Methane::Graphics
@@ -59,6 +62,142 @@ Device::Capabilities& Device::Capabilities::SetBlitQueuesCount(uint32_t new_blit
     return *this;
 }
 
+Device::Capabilities& Device::Capabilities::SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept
+{
+    META_FUNCTION_TASK();
+    compute_queues_count = new_compute_queues_count;
+    return *this;
+}
+
+static double ConvertBytesToMegabytes(uint64_t size) noexcept
+{
+    return static_cast<double>(size) / (1024.0 * 1024.0);
+}
+
+void Device::MemoryTypeStatistics::AddAllocation(uint64_t size) noexcept
+{
+    META_FUNCTION_TASK();
+    allocated_size += size;
+    max_allocated_size = std::max(max_allocated_size, allocated_size);
+    allocations_count++;
+    total_allocations_count++;
+}
+
+void Device::MemoryTypeStatistics::RemoveAllocation(uint64_t size) noexcept
+{
+    META_FUNCTION_TASK();
+    assert(allocations_count > 0U && allocated_size >= size);
+    allocated_size -= size;
+    allocations_count--;
+}
+
+const Device::MemoryTypeStatistics& Device::MemoryStatistics::GetTypeStatistics(MemoryType memory_type) const noexcept
+{
+    META_FUNCTION_TASK();
+    return types[static_cast<size_t>(memory_type)];
+}
+
+uint64_t Device::MemoryStatistics::GetDeviceLocalBudget() const noexcept
+{
+    META_FUNCTION_TASK();
+    uint64_t device_local_budget = 0U;
+    for(const MemoryHeapStatistics& heap : heaps)
+    {
+        if (heap.is_device_local)
+            device_local_budget += heap.budget;
+    }
+    return device_local_budget;
+}
+
+uint64_t Device::MemoryStatistics::GetDeviceLocalUsage() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!is_budget_supported)
+        return total.allocated_size;
+
+    uint64_t device_local_usage = 0U;
+    for(const MemoryHeapStatistics& heap : heaps)
+    {
+        if (heap.is_device_local)
+            device_local_usage += heap.usage;
+    }
+    return device_local_usage;
+}
+
+Device::MemoryStatistics::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    std::stringstream ss;
+    for(size_t heap_index = 0U; heap_index < heaps.size(); ++heap_index)
+    {
+        const MemoryHeapStatistics& heap = heaps[heap_index];
+        ss << fmt::format("  - Heap {} ({}): ", heap_index, heap.is_device_local ? "device local" : "host");
+        if (is_budget_supported)
+            ss << fmt::format("{:.1f} MB used of {:.1f} MB budget, ", ConvertBytesToMegabytes(heap.usage), ConvertBytesToMegabytes(heap.budget));
+        ss << fmt::format("{:.1f} MB size;\n", ConvertBytesToMegabytes(heap.size));
+    }
+    for(size_t type_index = 0U; type_index < types.size(); ++type_index)
+    {
+        const MemoryTypeStatistics& type = types[type_index];
+        ss << fmt::format("  - {}: {:.1f} MB in {} allocations, {:.1f} MB peak, {} allocations total;\n",
+                          magic_enum::enum_name(static_cast<MemoryType>(type_index)),
+                          ConvertBytesToMegabytes(type.allocated_size), type.allocations_count,
+                          ConvertBytesToMegabytes(type.max_allocated_size), type.total_allocations_count);
+    }
+    ss << fmt::format("  - Total: {:.1f} MB in {} allocations, {:.1f} MB peak, {} allocations total.",
+                      ConvertBytesToMegabytes(total.allocated_size), total.allocations_count,
+                      ConvertBytesToMegabytes(total.max_allocated_size), total.total_allocations_count);
+    return ss.str();
+}
+
+DeviceBase::MemoryAllocation::MemoryAllocation(DeviceBase& device, MemoryType memory_type, uint64_t size)
+    : m_device_ptr(std::static_pointer_cast<DeviceBase>(device.GetBasePtr()))
+    , m_memory_type(memory_type)
+    , m_size(size)
+{
+    META_FUNCTION_TASK();
+    m_device_ptr->AddMemoryAllocation(m_memory_type, m_size);
+}
+
+DeviceBase::MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_device_ptr(std::move(other.m_device_ptr))
+    , m_memory_type(other.m_memory_type)
+    , m_size(other.m_size)
+{
+    META_FUNCTION_TASK();
+    other.m_device_ptr.reset();
+}
+
+DeviceBase::MemoryAllocation::~MemoryAllocation()
+{
+    META_FUNCTION_TASK();
+    Release();
+}
+
+DeviceBase::MemoryAllocation& DeviceBase::MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    META_FUNCTION_TASK();
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_device_ptr  = std::move(other.m_device_ptr);
+    m_memory_type = other.m_memory_type;
+    m_size        = other.m_size;
+    other.m_device_ptr.reset();
+    return *this;
+}
+
+void DeviceBase::MemoryAllocation::Release() noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_device_ptr)
+        return;
+
+    m_device_ptr->RemoveMemoryAllocation(m_memory_type, m_size);
+    m_device_ptr.reset();
+}
+
 DeviceBase::DeviceBase(const std::string& adapter_name, bool is_software_adapter, const Capabilities& capabilities)
     : m_system_ptr(static_cast<SystemBase&>(System::Get()).GetBasePtr()) // NOSONAR
     , m_adapter_name(adapter_name)
@@ -74,6 +213,49 @@ std::string DeviceBase::ToString() const
     return fmt::format("GPU \"{}\"", GetAdapterName());
 }
 
+Device::MemoryStatistics DeviceBase::GetMemoryStatistics() const
+{
+    META_FUNCTION_TASK();
+    MemoryStatistics memory_statistics;
+    {
+        std::scoped_lock lock_guard(m_memory_statistics_mutex);
+        memory_statistics.types = m_memory_type_statistics;
+        memory_statistics.total = m_memory_total_statistics;
+    }
+    memory_statistics.is_budget_supported = UpdateMemoryHeapStatistics(memory_statistics.heaps);
+    return memory_statistics;
+}
+
+void DeviceBase::CheckMemoryBudget()
+{
+    META_FUNCTION_TASK();
+    std::vector<MemoryHeapStatistics> memory_heaps;
+    if (!UpdateMemoryHeapStatistics(memory_heaps))
+        return;
+
+    std::vector<uint32_t> exceeded_heap_indices;
+    {
+        std::scoped_lock lock_guard(m_memory_statistics_mutex);
+        m_memory_budget_exceeded_by_heap.resize(memory_heaps.size(), false);
+        for(uint32_t heap_index = 0U; heap_index < static_cast<uint32_t>(memory_heaps.size()); ++heap_index)
+        {
+            // Budget exceeded event is emitted only once, when heap usage goes over the budget
+            const bool is_budget_exceeded = memory_heaps[heap_index].IsBudgetExceeded();
+            if (is_budget_exceeded && !m_memory_budget_exceeded_by_heap[heap_index])
+                exceeded_heap_indices.push_back(heap_index);
+
+            m_memory_budget_exceeded_by_heap[heap_index] = is_budget_exceeded;
+        }
+    }
+
+    for(uint32_t heap_index : exceeded_heap_indices)
+    {
+        META_LOG("WARNING: {} memory heap {} budget is exceeded: {} bytes used of {} bytes budget",
+                 ToString(), heap_index, memory_heaps[heap_index].usage, memory_heaps[heap_index].budget);
+        Data::Emitter<IDeviceCallback>::Emit(&IDeviceCallback::OnDeviceMemoryBudgetExceeded, std::ref(*this), heap_index);
+    }
+}
+
 void DeviceBase::OnRemovalRequested()
 {
     META_FUNCTION_TASK();
@@ -86,6 +268,25 @@ void DeviceBase::OnRemoved()
     Data::Emitter<IDeviceCallback>::Emit(&IDeviceCallback::OnDeviceRemoved, std::ref(*this));
 }
 
+void DeviceBase::AddMemoryAllocation(MemoryType memory_type, uint64_t size)
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_memory_statistics_mutex);
+        m_memory_type_statistics[static_cast<size_t>(memory_type)].AddAllocation(size);
+        m_memory_total_statistics.AddAllocation(size);
+    }
+    CheckMemoryBudget();
+}
+
+void DeviceBase::RemoveMemoryAllocation(MemoryType memory_type, uint64_t size) noexcept
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_memory_statistics_mutex);
+    m_memory_type_statistics[static_cast<size_t>(memory_type)].RemoveAllocation(size);
+    m_memory_total_statistics.RemoveAllocation(size);
+}
+
 System::GraphicsApi System::GetGraphicsApi() noexcept
 {
 #if defined METHANE_GFX_METAL
@@ -27,6 +27,9 @@ Base implementation of the device interface.
 
 #include <Methane/Graphics/Device.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
 
 namespace Methane::Graphics
 {
@@ -39,13 +42,38 @@ class DeviceBase
     , public Data::Emitter<IDeviceCallback>
 {
 public:
+    // Device memory allocation registered in device memory statistics for the lifetime of this object
+    class MemoryAllocation
+    {
+    public:
+        MemoryAllocation() = default;
+        MemoryAllocation(DeviceBase& device, MemoryType memory_type, uint64_t size);
+        MemoryAllocation(const MemoryAllocation&) = delete;
+        MemoryAllocation(MemoryAllocation&& other) noexcept;
+        ~MemoryAllocation();
+
+        MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+        MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+
+        void Release() noexcept;
+
+    private:
+        Ptr<DeviceBase> m_device_ptr;
+        MemoryType      m_memory_type = MemoryType::Buffer;
+        uint64_t        m_size = 0U;
+    };
+
     DeviceBase(const std::string& adapter_name, bool is_software_adapter, const Capabilities& capabilities);
 
     // Device interface
     const std::string&  GetAdapterName() const noexcept override    { return m_adapter_name; }
     bool                IsSoftwareAdapter() const noexcept override { return m_is_software_adapter; }
     const Capabilities& GetCapabilities() const noexcept override   { return m_capabilities; }
+    MemoryStatistics    GetMemoryStatistics() const override;
     std::string         ToString() const override;
+
+    // Memory budget is checked on every allocation, but can be also checked periodically to catch allocations made outside of the process
+    void CheckMemoryBudget();
     
 protected:
     friend class SystemBase;
@@ -53,12 +81,22 @@ protected:
     void OnRemovalRequested();
     void OnRemoved();
 
+    // DeviceBase interface
+    virtual bool UpdateMemoryHeapStatistics(std::vector<MemoryHeapStatistics>&) const { return false; }
+
 private:
+    void AddMemoryAllocation(MemoryType memory_type, uint64_t size);
+    void RemoveMemoryAllocation(MemoryType memory_type, uint64_t size) noexcept;
+
     // System should be released only after all its devices, so devices hold it's shared pointer
-    const Ptr<SystemBase> m_system_ptr;
-    const std::string     m_adapter_name;
-    const bool            m_is_software_adapter;
-    Capabilities          m_capabilities;
+    const Ptr<SystemBase>            m_system_ptr;
+    const std::string                m_adapter_name;
+    const bool                       m_is_software_adapter;
+    Capabilities                     m_capabilities;
+    MemoryStatistics::TypeStatistics m_memory_type_statistics;
+    MemoryTypeStatistics             m_memory_total_statistics;
+    std::vector<bool>                m_memory_budget_exceeded_by_heap;
+    mutable TracyLockable(std::mutex, m_memory_statistics_mutex)
 };
 
 class SystemBase
@@ -24,8 +24,10 @@ DirectX 12 implementation of the blit command list interface.
 #include "BlitCommandListDX.h"
 
 #include <Methane/Graphics/ContextBase.h>
+#include <Methane/Graphics/ComputeCommandList.h>
 #include <Methane/Graphics/CommandQueueBase.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
 
@@ -47,6 +49,12 @@ Ptr<BlitCommandList> BlitCommandList::Create(CommandQueue& cmd_queue)
     return std::make_shared<BlitCommandListDX>(static_cast<CommandQueueBase&>(cmd_queue));
 }
 
+Ptr<ComputeCommandList> ComputeCommandList::Create(CommandQueue&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "compute command lists are not supported by DirectX 12 backend yet");
+}
+
 BlitCommandListDX::BlitCommandListDX(CommandQueueBase& cmd_queue)
     : CommandListDX<CommandListBase>(GetBlitCommandListNativeType(cmd_queue.GetContext().GetOptions()), cmd_queue, Type::Blit)
 {
@@ -74,6 +74,18 @@ Ptr<Buffer> Buffer::CreateReadBackBuffer(const Context& context, Data::Size size
     return Graphics::CreateReadBackBuffer<ReadBackBufferDX>(context, size);
 }
 
+Ptr<Buffer> Buffer::CreateIndirectBuffer(const Context&, Data::Size, Data::Size, bool)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "indirect buffers are not supported by DirectX 12 backend yet");
+}
+
+Ptr<Buffer> Buffer::CreateStorageBuffer(const Context&, Data::Size, Data::Size, bool)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "storage buffers are not supported by DirectX 12 backend yet");
+}
+
 Data::Size Buffer::GetAlignedBufferSize(Data::Size size) noexcept
 {
     META_FUNCTION_TASK();
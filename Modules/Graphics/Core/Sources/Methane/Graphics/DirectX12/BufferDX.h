@@ -36,6 +36,8 @@ DirectX 12 implementation of the buffer interface.
 #include <fmt/format.h>
 #include <directx/d3dx12.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
@@ -108,8 +110,9 @@ public:
             );
 
             META_CHECK_ARG_NOT_NULL_DESCR(p_sub_resource_data, "failed to map buffer subresource");
-            stdext::checked_array_iterator target_data_it(p_sub_resource_data, sub_resource.GetDataSize());
-            std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_it);
+            const Data::Index data_offset = GetSubResourceDataOffset(sub_resource);
+            stdext::checked_array_iterator target_data_it(p_sub_resource_data, data_offset + sub_resource.GetDataSize());
+            std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_it + data_offset);
 
             if (sub_resource.HasDataRange())
             {
@@ -125,9 +128,25 @@ public:
         if (!is_private_storage)
             return;
 
-        // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource
+        // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource:
+        // whole resource is copied on full data update, otherwise only coalesced data ranges are copied
+        const auto upload_encoding_lock = GetContextBase().LockUploadEncoding();
         const BlitCommandListDX& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
-        upload_cmd_list.GetNativeCommandList().CopyResource(GetNativeResource(), m_cp_upload_resource.Get());
+        ID3D12GraphicsCommandList& d3d12_command_list = upload_cmd_list.GetNativeCommandList();
+        const bool has_data_ranges = std::any_of(sub_resources.begin(), sub_resources.end(),
+                                                 [](const SubResource& sub_resource) { return sub_resource.HasDataRange(); });
+        if (has_data_ranges)
+        {
+            for(const BytesRange& data_range : GetSubResourcesDataRanges(sub_resources))
+            {
+                d3d12_command_list.CopyBufferRegion(GetNativeResource(), data_range.GetStart(),
+                                                    m_cp_upload_resource.Get(), data_range.GetStart(), data_range.GetLength());
+            }
+        }
+        else
+        {
+            d3d12_command_list.CopyResource(GetNativeResource(), m_cp_upload_resource.Get());
+        }
         GetContext().RequestDeferredAction(Context::DeferredAction::UploadResources);
     }
 
@@ -68,6 +68,9 @@ static D3D12_COMMAND_LIST_TYPE GetNativeCommandListType(CommandList::Type comman
     case CommandList::Type::ParallelRender:
         return D3D12_COMMAND_LIST_TYPE_DIRECT;
 
+    case CommandList::Type::Compute:
+        return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+
     default:
         META_UNEXPECTED_ARG_RETURN(command_list_type, D3D12_COMMAND_LIST_TYPE_DIRECT);
     }
@@ -73,12 +73,18 @@ void FenceDX::Signal()
                   command_queue.GetContextDX().GetDeviceDX().GetNativeDevice().Get());
 }
 
-void FenceDX::WaitOnCpu()
+uint64_t FenceDX::GetCompletedValue() const
 {
     META_FUNCTION_TASK();
-    FenceBase::WaitOnCpu();
+    META_CHECK_ARG_NOT_NULL(m_cp_fence);
+    return m_cp_fence->GetCompletedValue();
+}
+
+void FenceDX::WaitOnCpu(uint64_t wait_value)
+{
+    META_FUNCTION_TASK();
+    FenceBase::WaitOnCpu(wait_value);
 
-    const uint64_t wait_value = GetValue();
     const uint64_t curr_value = m_cp_fence->GetCompletedValue();
     if (curr_value >= wait_value) // NOSONAR - curr_value declared outside if
         return;
@@ -88,7 +94,7 @@ void FenceDX::WaitOnCpu()
     META_CHECK_ARG_NOT_NULL(m_cp_fence);
     META_CHECK_ARG_NOT_NULL(m_event);
 
-    ThrowIfFailed(m_cp_fence->SetEventOnCompletion(GetValue(), m_event),
+    ThrowIfFailed(m_cp_fence->SetEventOnCompletion(wait_value, m_event),
                   GetCommandQueueDX().GetContextDX().GetDeviceDX().GetNativeDevice().Get());
     WaitForSingleObjectEx(m_event, INFINITE, FALSE);
 
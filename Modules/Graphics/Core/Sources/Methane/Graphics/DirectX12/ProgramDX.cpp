@@ -87,10 +87,11 @@ static D3D12_SHADER_VISIBILITY GetShaderVisibilityByType(Shader::Type shader_typ
     META_FUNCTION_TASK();
     switch (shader_type)
     {
-    case Shader::Type::All:    return D3D12_SHADER_VISIBILITY_ALL;
-    case Shader::Type::Vertex: return D3D12_SHADER_VISIBILITY_VERTEX;
-    case Shader::Type::Pixel:  return D3D12_SHADER_VISIBILITY_PIXEL;
-    default:                   META_UNEXPECTED_ARG_RETURN(shader_type, D3D12_SHADER_VISIBILITY_ALL);
+    case Shader::Type::All:     return D3D12_SHADER_VISIBILITY_ALL;
+    case Shader::Type::Vertex:  return D3D12_SHADER_VISIBILITY_VERTEX;
+    case Shader::Type::Pixel:   return D3D12_SHADER_VISIBILITY_PIXEL;
+    case Shader::Type::Compute: return D3D12_SHADER_VISIBILITY_ALL; // compute root signature arguments are always visible to all stages
+    default:                    META_UNEXPECTED_ARG_RETURN(shader_type, D3D12_SHADER_VISIBILITY_ALL);
     }
 };
 
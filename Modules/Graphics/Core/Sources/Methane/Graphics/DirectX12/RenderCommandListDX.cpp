@@ -66,6 +66,12 @@ Ptr<RenderCommandList> RenderCommandList::Create(ParallelRenderCommandList& para
     return std::make_shared<RenderCommandListDX>(static_cast<ParallelRenderCommandListBase&>(parallel_render_command_list));
 }
 
+Ptr<RenderCommandList> RenderCommandList::CreateBundle(CommandQueue&, RenderPass&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "render command bundles are not supported by DirectX 12 graphics API implementation yet");
+}
+
 Ptr<RenderCommandList> RenderCommandListBase::CreateForSynchronization(CommandQueue& cmd_queue)
 {
     META_FUNCTION_TASK();
@@ -90,7 +96,7 @@ RenderCommandListDX::RenderCommandListDX(ParallelRenderCommandListBase& parallel
     META_FUNCTION_TASK();
 }
 
-void RenderCommandListDX::ResetNative(const Ptr<RenderStateDX>& render_state_ptr)
+void RenderCommandListDX::ResetNative(RenderStateDX* p_render_state)
 {
     META_FUNCTION_TASK();
     if (!IsNativeCommitted())
@@ -99,7 +105,7 @@ void RenderCommandListDX::ResetNative(const Ptr<RenderStateDX>& render_state_ptr
     SetNativeCommitted(false);
     SetCommandListState(CommandList::State::Encoding);
 
-    ID3D12PipelineState* p_dx_initial_state = render_state_ptr ? render_state_ptr->GetNativePipelineState().Get() : nullptr;
+    ID3D12PipelineState* p_dx_initial_state = p_render_state ? p_render_state->GetNativePipelineState().Get() : nullptr;
     ID3D12CommandAllocator& dx_cmd_allocator = GetNativeCommandAllocatorRef();
     ID3D12Device* p_native_device = GetCommandQueueDX().GetContextDX().GetDeviceDX().GetNativeDevice().Get();
     ThrowIfFailed(dx_cmd_allocator.Reset(), p_native_device);
@@ -107,12 +113,12 @@ void RenderCommandListDX::ResetNative(const Ptr<RenderStateDX>& render_state_ptr
 
     BeginGpuZone();
 
-    if (!render_state_ptr)
+    if (!p_render_state)
         return;
 
     using namespace magic_enum::bitwise_operators;
     DrawingState& drawing_state = GetDrawingState();
-    drawing_state.render_state_ptr    = render_state_ptr;
+    drawing_state.render_state_ptr    = p_render_state;
     drawing_state.render_state_groups = RenderState::Groups::Program
                                       | RenderState::Groups::Rasterizer
                                       | RenderState::Groups::DepthStencil;
@@ -148,7 +154,7 @@ void RenderCommandListDX::Reset(DebugGroup* p_debug_group)
 void RenderCommandListDX::ResetWithState(RenderState& render_state, DebugGroup* p_debug_group)
 {
     META_FUNCTION_TASK();
-    ResetNative(static_cast<RenderStateBase&>(render_state).GetPtr<RenderStateDX>());
+    ResetNative(&static_cast<RenderStateDX&>(render_state));
     RenderCommandListBase::ResetWithState(render_state, p_debug_group);
     if (HasPass())
     {
@@ -234,6 +240,18 @@ void RenderCommandListDX::Draw(Primitive primitive, uint32_t vertex_count, uint3
     dx_command_list.DrawInstanced(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandListDX::DrawIndexedIndirect(Primitive, Buffer&, uint32_t, Data::Size, Buffer*, Data::Size)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_DESCR("indirect draws require command signatures, which are not supported by DirectX 12 backend yet");
+}
+
+void RenderCommandListDX::DrawIndirect(Primitive, Buffer&, uint32_t, Data::Size, Buffer*, Data::Size)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_DESCR("indirect draws require command signatures, which are not supported by DirectX 12 backend yet");
+}
+
 void RenderCommandListDX::Commit()
 {
     META_FUNCTION_TASK();
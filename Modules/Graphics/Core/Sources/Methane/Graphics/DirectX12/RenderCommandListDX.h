@@ -53,8 +53,12 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                             Buffer* p_count_buffer, Data::Size count_offset) override;
+    void DrawIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                      Buffer* p_count_buffer, Data::Size count_offset) override;
 
-    void ResetNative(const Ptr<RenderStateDX>& render_state_ptr = nullptr);
+    void ResetNative(RenderStateDX* p_render_state = nullptr);
 
 private:
     void ResetRenderPass();
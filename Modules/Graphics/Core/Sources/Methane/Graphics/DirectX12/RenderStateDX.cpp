@@ -30,6 +30,8 @@ DirectX 12 implementation of the render state interface.
 #include "TextureDX.h"
 #include "RenderCommandListDX.h"
 
+#include <Methane/Graphics/ComputeState.h>
+
 #include <Methane/Graphics/Windows/DirectXErrorHandling.h>
 #include <Methane/Platform/Windows/Utils.h>
 #include <Methane/Instrumentation.h>
@@ -286,6 +288,12 @@ Ptr<RenderState> RenderState::Create(const RenderContext& context, const RenderS
     return std::make_shared<RenderStateDX>(dynamic_cast<const RenderContextBase&>(context), state_settings);
 }
 
+Ptr<ComputeState> ComputeState::Create(const Context&, const ComputeState::Settings&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "compute pipeline state is not supported by DirectX 12 backend yet");
+}
+
 RenderStateDX::RenderStateDX(const RenderContextBase& context, const Settings& settings)
     : RenderStateBase(context, settings)
 {
@@ -65,6 +65,9 @@ D3D12_RESOURCE_BARRIER ResourceBarriersDX::GetNativeResourceBarrier(const Resour
     switch (id.GetType()) // NOSONAR
     {
     case ResourceBarrier::Type::StateTransition:
+        if (state_change.IsUnorderedAccessBarrier())
+            return CD3DX12_RESOURCE_BARRIER::UAV(dynamic_cast<const IResourceDX&>(id.GetResource()).GetNativeResource());
+
         return CD3DX12_RESOURCE_BARRIER::Transition(
             dynamic_cast<const IResourceDX&>(id.GetResource()).GetNativeResource(),
             GetNativeResourceState(state_change.GetStateBefore()),
@@ -76,44 +79,20 @@ D3D12_RESOURCE_BARRIER ResourceBarriersDX::GetNativeResourceBarrier(const Resour
     }
 }
 
-[[nodiscard]]
-static D3D12_RESOURCE_BARRIER_TYPE GetNativeBarrierType(ResourceBarrier::Type barrier_type)
+// State transition barriers are stored as native TRANSITION or UAV barriers, so both types are matched by resource
+static std::function<bool(const D3D12_RESOURCE_BARRIER&)> GetNativeResourceBarrierPredicate(const ID3D12Resource* native_resource_ptr)
 {
     META_FUNCTION_TASK();
-    switch (barrier_type) // NOSONAR
+    return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
     {
-    case ResourceBarrier::Type::StateTransition: return D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    default: META_UNEXPECTED_ARG_RETURN(barrier_type, D3D12_RESOURCE_BARRIER_TYPE_TRANSITION);
-    }
-}
-
-static std::function<bool(const D3D12_RESOURCE_BARRIER&)> GetNativeResourceBarrierPredicate(D3D12_RESOURCE_BARRIER_TYPE native_barrier_type,
-                                                                                            const ID3D12Resource* native_resource_ptr)
-{
-    META_FUNCTION_TASK();
-    switch (native_barrier_type)
-    {
-    case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-               {
-                   return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION &&
-                          native_resource_barrier.Transition.pResource == native_resource_ptr;
-               };
-    case D3D12_RESOURCE_BARRIER_TYPE_UAV:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-               {
-                   return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_UAV &&
-                          native_resource_barrier.UAV.pResource == native_resource_ptr;
-               };
-    case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
-        return [native_resource_ptr](const D3D12_RESOURCE_BARRIER& native_resource_barrier)
-               {
-                   return native_resource_barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_ALIASING &&
-                          native_resource_barrier.Aliasing.pResourceBefore == native_resource_ptr;
-               };
-    default:
-        META_UNEXPECTED_ARG_RETURN(native_barrier_type, nullptr);
-    }
+        switch (native_resource_barrier.Type)
+        {
+        case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION: return native_resource_barrier.Transition.pResource == native_resource_ptr;
+        case D3D12_RESOURCE_BARRIER_TYPE_UAV:        return native_resource_barrier.UAV.pResource == native_resource_ptr;
+        case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:   return native_resource_barrier.Aliasing.pResourceBefore == native_resource_ptr;
+        default:                                     return false;
+        }
+    };
 }
 
 Ptr<ResourceBarriers> ResourceBarriers::Create(const Set& barriers)
@@ -135,6 +114,8 @@ ResourceBarriersDX::ResourceBarriersDX(const Set& barriers)
 ResourceBarriers::AddResult ResourceBarriersDX::Add(const ResourceBarrier::Id& id, const ResourceBarrier& barrier)
 {
     META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EQUAL_DESCR(id.GetType(), ResourceBarrier::Type::AliasingTransition,
+                                   "memory aliasing barriers are not supported by DirectX 12 backend yet");
     const auto lock_guard  = ResourceBarriers::Lock();
     const AddResult result = ResourceBarriers::Add(id, barrier);
 
@@ -161,10 +142,9 @@ bool ResourceBarriersDX::Remove(const ResourceBarrier::Id& id)
     if (id.GetType() != ResourceBarrier::Type::StateTransition)
         return true;
 
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResourceDX&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
+                                                         GetNativeResourceBarrierPredicate(native_resource_ptr));
     META_CHECK_ARG_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
     m_native_resource_barriers.erase(native_resource_barrier_it);
 
@@ -188,22 +168,13 @@ void ResourceBarriersDX::AddNativeResourceBarrier(const ResourceBarrier::Id& id,
 void ResourceBarriersDX::UpdateNativeResourceBarrier(const ResourceBarrier::Id& id, const ResourceBarrier::StateChange& state_change)
 {
     META_FUNCTION_TASK();
-    const D3D12_RESOURCE_BARRIER_TYPE native_barrier_type = GetNativeBarrierType(id.GetType());
     const ID3D12Resource* native_resource_ptr = dynamic_cast<const IResourceDX&>(id.GetResource()).GetNativeResource();
     const auto native_resource_barrier_it = std::find_if(m_native_resource_barriers.begin(), m_native_resource_barriers.end(),
-                                                         GetNativeResourceBarrierPredicate(native_barrier_type, native_resource_ptr));
+                                                         GetNativeResourceBarrierPredicate(native_resource_ptr));
     META_CHECK_ARG_TRUE_DESCR(native_resource_barrier_it != m_native_resource_barriers.end(), "can not find DX resource barrier to update");
 
-    switch (native_barrier_type) // NOSONAR - do not replace switch with if
-    {
-    case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
-        native_resource_barrier_it->Transition.StateBefore = GetNativeResourceState(state_change.GetStateBefore());
-        native_resource_barrier_it->Transition.StateAfter  = GetNativeResourceState(state_change.GetStateAfter());
-        break;
-
-    default:
-        META_UNEXPECTED_ARG(native_barrier_type);
-    }
+    // Barrier is fully replaced, since state change may switch it between TRANSITION and UAV native barrier types
+    *native_resource_barrier_it = GetNativeResourceBarrier(id, state_change);
 }
 
 } // namespace Methane::Graphics
\ No newline at end of file
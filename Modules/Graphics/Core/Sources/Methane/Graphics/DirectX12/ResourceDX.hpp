@@ -166,7 +166,8 @@ protected:
     BlitCommandListDX& PrepareResourceUpload(CommandQueue& target_cmd_queue)
     {
         META_FUNCTION_TASK();
-        auto& upload_cmd_list = dynamic_cast<BlitCommandListDX&>(GetContext().GetUploadCommandKit().GetListForEncoding());
+        const ContextBase& context = GetContextBase();
+        auto& upload_cmd_list = dynamic_cast<BlitCommandListDX&>(context.GetUploadCommandKit().GetListForEncoding(context.GetUploadCommandListId()));
         upload_cmd_list.RetainResource(*this);
 
         // When upload command list has COPY type, before transitioning resource to CopyDest state prior copying,
@@ -175,6 +176,7 @@ protected:
         if (upload_cmd_list.GetNativeCommandList().GetType() == D3D12_COMMAND_LIST_TYPE_COPY &&
             SetState(State::Common, m_upload_sync_transition_barriers_ptr) && m_upload_sync_transition_barriers_ptr)
         {
+            const auto upload_sync_lock = context.LockUploadSyncCommandLists();
             CommandList& sync_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(
                 static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::PreUploadSync));
             sync_cmd_list.SetResourceBarriers(*m_upload_sync_transition_barriers_ptr);
@@ -268,6 +268,16 @@ Ptr<Texture> Texture::CreateRenderTarget(const RenderContext& render_context, co
     }
 }
 
+Ptr<Texture> Texture::CreateAliasedRenderTarget(const RenderContext&, const Settings&, const Ptr<Texture>&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "memory aliasing of render target textures is not supported by DirectX 12 backend yet");
+}
+
+bool Texture::IsMemoryAliasingSupported() noexcept
+{
+    return false;
+}
+
 Ptr<Texture> Texture::CreateFrameBuffer(const RenderContext& render_context, FrameBufferIndex frame_buffer_index)
 {
     META_FUNCTION_TASK();
@@ -284,10 +294,13 @@ Ptr<Texture> Texture::CreateDepthStencilBuffer(const RenderContext& render_conte
     return std::make_shared<DepthStencilTextureDX>(static_cast<const RenderContextBase&>(render_context), texture_settings, context_settings.clear_depth_stencil);
 }
 
-Ptr<Texture> Texture::CreateImage(const Context& render_context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped)
+Ptr<Texture> Texture::CreateImage(const Context& render_context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped,
+                                  bool is_read_back)
 {
     META_FUNCTION_TASK();
-    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, Usage::ShaderRead);
+    using namespace magic_enum::bitwise_operators;
+    const Usage    texture_usage    = Usage::ShaderRead | (is_read_back ? Usage::ReadBack : Usage::None);
+    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, texture_usage);
     return std::make_shared<ImageTextureDX>(dynamic_cast<const ContextBase&>(render_context), texture_settings, ImageTokenDX());
 }
 
@@ -504,6 +517,7 @@ void ImageTextureDX::SetData(const SubResources& sub_resources, CommandQueue& ta
     }
 
     // Upload texture subresources data to GPU via intermediate upload resource
+    const auto upload_encoding_lock = GetContextBase().LockUploadEncoding();
     const BlitCommandListDX& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
     UpdateSubresources(&upload_cmd_list.GetNativeCommandList(),
                        GetNativeResource(), m_cp_upload_resource.Get(), 0, 0,
@@ -47,7 +47,14 @@ void FenceBase::Signal()
 void FenceBase::WaitOnCpu()
 {
     META_FUNCTION_TASK();
-    META_LOG("Fence '{}' WAIT on CPU with value {}", GetName(), m_value);
+    WaitOnCpu(m_value);
+}
+
+void FenceBase::WaitOnCpu(uint64_t wait_value)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(wait_value, m_value, "fence can not be waited on CPU for the value which was not signalled yet");
+    META_LOG("Fence '{}' WAIT on CPU with value {}", GetName(), wait_value);
 }
 
 void FenceBase::WaitOnGpu(CommandQueue& wait_on_command_queue)
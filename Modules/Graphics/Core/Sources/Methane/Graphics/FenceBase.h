@@ -40,15 +40,16 @@ public:
     explicit FenceBase(CommandQueueBase& command_queue);
 
     // Fence overrides
+    uint64_t GetValue() const noexcept override { return m_value; }
     void Signal() override;
     void WaitOnCpu() override;
+    void WaitOnCpu(uint64_t wait_value) override;
     void WaitOnGpu(CommandQueue& wait_on_command_queue) override;
     void FlushOnCpu() override;
     void FlushOnGpu(CommandQueue& wait_on_command_queue) override;
 
 protected:
     CommandQueueBase& GetCommandQueue() noexcept { return m_command_queue; }
-    uint64_t          GetValue() const noexcept  { return m_value; }
 
 private:
     CommandQueueBase& m_command_queue;
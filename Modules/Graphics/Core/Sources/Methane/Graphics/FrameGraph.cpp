@@ -0,0 +1,605 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameGraph.cpp
+Frame graph of render passes with declared resource accesses, which is compiled
+to the ordered passes schedule with automatic resource barriers and aliased transient textures.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameGraph.h>
+#include <Methane/Graphics/CommandList.h>
+#include <Methane/Graphics/RenderContext.h>
+#include <Methane/Graphics/Types.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+#include <set>
+
+namespace Methane::Graphics
+{
+
+static std::vector<FrameGraph::ResourceId> GetTransientResourceIdsInFirstUseOrder(const FrameGraph::Schedule& schedule)
+{
+    META_FUNCTION_TASK();
+    std::vector<FrameGraph::ResourceId> transient_resource_ids;
+    for(FrameGraph::ResourceId resource_id = 0U; resource_id < schedule.transient_allocations.size(); ++resource_id)
+    {
+        if (schedule.transient_allocations[resource_id])
+            transient_resource_ids.push_back(resource_id);
+    }
+    std::stable_sort(transient_resource_ids.begin(), transient_resource_ids.end(),
+        [&schedule](FrameGraph::ResourceId left_id, FrameGraph::ResourceId right_id)
+        { return schedule.transient_allocations[left_id]->first_pass_index < schedule.transient_allocations[right_id]->first_pass_index; }
+    );
+    return transient_resource_ids;
+}
+
+bool FrameGraph::ResourceAccess::operator==(const ResourceAccess& other) const noexcept
+{
+    return std::tie(resource_id, state) == std::tie(other.resource_id, other.state);
+}
+
+bool FrameGraph::PassSettings::operator==(const PassSettings& other) const noexcept
+{
+    return std::tie(name, reads, writes, has_side_effects) ==
+           std::tie(other.name, other.reads, other.writes, other.has_side_effects);
+}
+
+bool FrameGraph::Barrier::operator==(const Barrier& other) const noexcept
+{
+    return std::tie(resource_id, state_before, state_after) ==
+           std::tie(other.resource_id, other.state_before, other.state_after);
+}
+
+bool FrameGraph::ResourceInfo::operator==(const ResourceInfo& other) const noexcept
+{
+    if (std::tie(name, initial_state, final_state_opt) != std::tie(other.name, other.initial_state, other.final_state_opt) ||
+        transient_settings_opt.has_value() != other.transient_settings_opt.has_value())
+        return false;
+
+    return !transient_settings_opt || *transient_settings_opt == *other.transient_settings_opt;
+}
+
+size_t FrameGraph::Schedule::GetBarriersCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(passes.begin(), passes.end(), final_barriers.size(),
+                           [](size_t barriers_count, const ScheduledPass& pass) { return barriers_count + pass.barriers.size(); });
+}
+
+Data::Size FrameGraph::Schedule::GetTransientMemorySize() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(memory_slots.begin(), memory_slots.end(), Data::Size(0U),
+                           [](Data::Size memory_size, const MemorySlot& slot) { return memory_size + slot.memory_size; });
+}
+
+Data::Size FrameGraph::Schedule::GetTransientMemorySizeWithoutAliasing() const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Size memory_size = 0U;
+    for(const Opt<TransientAllocation>& allocation_opt : transient_allocations)
+    {
+        if (allocation_opt)
+            memory_size += memory_slots[allocation_opt->memory_slot_index].memory_size;
+    }
+    return memory_size;
+}
+
+Opt<uint32_t> FrameGraph::Schedule::GetPassIndex(PassId pass_id) const noexcept
+{
+    META_FUNCTION_TASK();
+    const auto pass_it = std::find_if(passes.begin(), passes.end(),
+                                      [pass_id](const ScheduledPass& pass) { return pass.pass_id == pass_id; });
+    if (pass_it == passes.end())
+        return std::nullopt;
+
+    return static_cast<uint32_t>(std::distance(passes.begin(), pass_it));
+}
+
+FrameGraph::ResourceId FrameGraph::ImportResource(const std::string& name, ResourceState initial_state, const Opt<ResourceState>& final_state_opt)
+{
+    META_FUNCTION_TASK();
+    m_resources.push_back({ name, std::nullopt, initial_state, final_state_opt });
+    return static_cast<ResourceId>(m_resources.size() - 1);
+}
+
+FrameGraph::ResourceId FrameGraph::CreateTransientTexture(const std::string& name, const Texture::Settings& settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(settings.dimensions.GetPixelsCount(), "transient texture '{}' can not be empty", name);
+    m_resources.push_back({ name, settings, ResourceState::Undefined, std::nullopt });
+    return static_cast<ResourceId>(m_resources.size() - 1);
+}
+
+FrameGraph::PassId FrameGraph::AddPass(const PassSettings& pass_settings)
+{
+    META_FUNCTION_TASK();
+    ValidatePass(pass_settings);
+    m_passes.push_back(pass_settings);
+    return static_cast<PassId>(m_passes.size() - 1);
+}
+
+void FrameGraph::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    m_resources.clear();
+    m_passes.clear();
+}
+
+bool FrameGraph::IsCompiled() const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_is_schedule_compiled && m_resources == m_compiled_resources && m_passes == m_compiled_passes;
+}
+
+const FrameGraph::Schedule& FrameGraph::GetSchedule() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(m_is_schedule_compiled, "frame graph was not compiled");
+    return m_schedule;
+}
+
+void FrameGraph::ValidatePass(const PassSettings& pass_settings) const
+{
+    META_FUNCTION_TASK();
+    std::map<ResourceId, ResourceState> resource_states;
+    for(const ResourceAccesses* p_accesses : { &pass_settings.reads, &pass_settings.writes })
+    {
+        for(const ResourceAccess& access : *p_accesses)
+        {
+            META_CHECK_ARG_LESS_DESCR(access.resource_id, m_resources.size(),
+                                      "pass '{}' accesses resource which was not declared in frame graph", pass_settings.name);
+
+            const auto [resource_state_it, is_state_added] = resource_states.try_emplace(access.resource_id, access.state);
+            META_CHECK_ARG_TRUE_DESCR(is_state_added || resource_state_it->second == access.state,
+                                      "pass '{}' accesses resource '{}' in different states",
+                                      pass_settings.name, m_resources[access.resource_id].name);
+        }
+    }
+}
+
+const FrameGraph::Schedule& FrameGraph::Compile()
+{
+    META_FUNCTION_TASK();
+    if (IsCompiled())
+        return m_schedule;
+
+    const auto   passes_count    = static_cast<PassId>(m_passes.size());
+    const size_t resources_count = m_resources.size();
+
+    // Collect dependencies between passes in the order of declaration:
+    // producers are the passes writing resources before they are read or overwritten by the dependent pass,
+    // write-after-read dependencies are used only for ordering and do not keep the reading pass alive
+    std::vector<std::set<PassId>>    producer_pass_ids(passes_count);
+    std::vector<std::set<PassId>>    dependency_pass_ids(passes_count);
+    std::vector<Opt<PassId>>         last_writer_pass_ids(resources_count);
+    std::vector<std::vector<PassId>> reader_pass_ids(resources_count);
+    std::vector<bool>                is_pass_alive(passes_count, false);
+
+    for(PassId pass_id = 0U; pass_id < passes_count; ++pass_id)
+    {
+        const PassSettings& pass = m_passes[pass_id];
+        bool is_output_written = pass.has_side_effects;
+
+        for(const ResourceAccess& read : pass.reads)
+        {
+            if (const Opt<PassId>& writer_pass_id_opt = last_writer_pass_ids[read.resource_id]; writer_pass_id_opt)
+                producer_pass_ids[pass_id].insert(*writer_pass_id_opt);
+        }
+        for(const ResourceAccess& write : pass.writes)
+        {
+            if (const Opt<PassId>& writer_pass_id_opt = last_writer_pass_ids[write.resource_id]; writer_pass_id_opt)
+                producer_pass_ids[pass_id].insert(*writer_pass_id_opt);
+
+            for(const PassId reader_pass_id : reader_pass_ids[write.resource_id])
+            {
+                if (reader_pass_id != pass_id)
+                    dependency_pass_ids[pass_id].insert(reader_pass_id);
+            }
+            is_output_written |= !m_resources[write.resource_id].transient_settings_opt.has_value();
+        }
+
+        for(const ResourceAccess& read : pass.reads)
+        {
+            reader_pass_ids[read.resource_id].push_back(pass_id);
+        }
+        for(const ResourceAccess& write : pass.writes)
+        {
+            last_writer_pass_ids[write.resource_id] = pass_id;
+            reader_pass_ids[write.resource_id].clear();
+        }
+
+        is_pass_alive[pass_id] = is_output_written;
+    }
+
+    // Cull passes which do not contribute to imported resources and have no side effects:
+    // producers are always declared before dependent passes, so single reverse iteration is enough
+    for(PassId pass_id = passes_count; pass_id > 0U; --pass_id)
+    {
+        if (!is_pass_alive[pass_id - 1])
+            continue;
+
+        for(const PassId producer_pass_id : producer_pass_ids[pass_id - 1])
+        {
+            is_pass_alive[producer_pass_id] = true;
+        }
+        dependency_pass_ids[pass_id - 1].insert(producer_pass_ids[pass_id - 1].begin(), producer_pass_ids[pass_id - 1].end());
+    }
+
+    std::vector<uint32_t>            unresolved_dependencies_count(passes_count, 0U);
+    std::vector<std::vector<PassId>> dependent_pass_ids(passes_count);
+    std::set<PassId>                 ready_pass_ids;
+    for(PassId pass_id = 0U; pass_id < passes_count; ++pass_id)
+    {
+        if (!is_pass_alive[pass_id])
+            continue;
+
+        for(const PassId dependency_pass_id : dependency_pass_ids[pass_id])
+        {
+            if (!is_pass_alive[dependency_pass_id])
+                continue;
+
+            unresolved_dependencies_count[pass_id]++;
+            dependent_pass_ids[dependency_pass_id].push_back(pass_id);
+        }
+
+        if (!unresolved_dependencies_count[pass_id])
+            ready_pass_ids.insert(pass_id);
+    }
+
+    std::vector<ResourceState> resource_states(resources_count);
+    std::vector<bool>          is_unordered_access_written(resources_count, false);
+    for(size_t resource_index = 0; resource_index < resources_count; ++resource_index)
+    {
+        resource_states[resource_index] = m_resources[resource_index].initial_state;
+    }
+
+    // Resource barriers required before the pass: state transitions and unordered access synchronization after shader writes
+    const auto get_pass_barriers = [this, &resource_states, &is_unordered_access_written](PassId pass_id)
+    {
+        const PassSettings& pass = m_passes[pass_id];
+        Barriers barriers;
+        std::set<ResourceId> accessed_resource_ids;
+        for(const ResourceAccesses* p_accesses : { &pass.reads, &pass.writes })
+        {
+            for(const ResourceAccess& access : *p_accesses)
+            {
+                if (!accessed_resource_ids.insert(access.resource_id).second)
+                    continue;
+
+                const ResourceState resource_state = resource_states[access.resource_id];
+                if (resource_state != access.state ||
+                    (access.state == ResourceState::UnorderedAccess && is_unordered_access_written[access.resource_id]))
+                {
+                    barriers.push_back({ access.resource_id, resource_state, access.state });
+                }
+            }
+        }
+        return barriers;
+    };
+
+    // Passes are scheduled in topological order, preferring the ready pass which requires less resource barriers,
+    // so that passes reading resources in the same state are grouped together
+    Schedule schedule;
+    schedule.transient_allocations.resize(resources_count);
+    while(!ready_pass_ids.empty())
+    {
+        PassId   scheduled_pass_id = *ready_pass_ids.begin();
+        Barriers scheduled_pass_barriers = get_pass_barriers(scheduled_pass_id);
+        for(const PassId ready_pass_id : ready_pass_ids)
+        {
+            Barriers ready_pass_barriers = get_pass_barriers(ready_pass_id);
+            if (ready_pass_barriers.size() >= scheduled_pass_barriers.size())
+                continue;
+
+            scheduled_pass_id       = ready_pass_id;
+            scheduled_pass_barriers = std::move(ready_pass_barriers);
+        }
+        ready_pass_ids.erase(scheduled_pass_id);
+
+        const PassSettings& pass = m_passes[scheduled_pass_id];
+        for(const ResourceAccess& read : pass.reads)
+        {
+            resource_states[read.resource_id] = read.state;
+            is_unordered_access_written[read.resource_id] = false;
+        }
+        for(const ResourceAccess& write : pass.writes)
+        {
+            resource_states[write.resource_id] = write.state;
+            is_unordered_access_written[write.resource_id] = write.state == ResourceState::UnorderedAccess;
+        }
+
+        // Track lifetime of transient resources in the scheduled passes range
+        const auto scheduled_pass_index = static_cast<uint32_t>(schedule.passes.size());
+        for(const ResourceAccesses* p_accesses : { &pass.reads, &pass.writes })
+        {
+            for(const ResourceAccess& access : *p_accesses)
+            {
+                if (!m_resources[access.resource_id].transient_settings_opt)
+                    continue;
+
+                Opt<TransientAllocation>& allocation_opt = schedule.transient_allocations[access.resource_id];
+                if (allocation_opt)
+                    allocation_opt->last_pass_index = scheduled_pass_index;
+                else
+                    allocation_opt = TransientAllocation{ 0U, scheduled_pass_index, scheduled_pass_index };
+            }
+        }
+
+        schedule.passes.push_back({ scheduled_pass_id, std::move(scheduled_pass_barriers) });
+
+        for(const PassId dependent_pass_id : dependent_pass_ids[scheduled_pass_id])
+        {
+            if (!--unresolved_dependencies_count[dependent_pass_id])
+                ready_pass_ids.insert(dependent_pass_id);
+        }
+    }
+
+    for(ResourceId resource_id = 0U; resource_id < resources_count; ++resource_id)
+    {
+        const Opt<ResourceState>& final_state_opt = m_resources[resource_id].final_state_opt;
+        if (final_state_opt && resource_states[resource_id] != *final_state_opt)
+            schedule.final_barriers.push_back({ resource_id, resource_states[resource_id], *final_state_opt });
+    }
+
+    // Transient resources with equal texture settings and non-overlapping lifetimes are aliased in one memory slot:
+    // greedy assignment in the order of first use gives minimal number of slots for interval lifetimes
+    std::vector<uint32_t> slot_last_pass_indices;
+    for(const ResourceId resource_id : GetTransientResourceIdsInFirstUseOrder(schedule))
+    {
+        TransientAllocation& allocation = *schedule.transient_allocations[resource_id];
+        const Texture::Settings& texture_settings = *m_resources[resource_id].transient_settings_opt;
+
+        uint32_t slot_index = 0U;
+        for(; slot_index < schedule.memory_slots.size(); ++slot_index)
+        {
+            if (slot_last_pass_indices[slot_index] < allocation.first_pass_index &&
+                schedule.memory_slots[slot_index].texture_settings == texture_settings)
+                break;
+        }
+
+        if (slot_index == schedule.memory_slots.size())
+        {
+            schedule.memory_slots.push_back({ texture_settings, texture_settings.GetEstimatedMemorySize() });
+            slot_last_pass_indices.push_back(allocation.last_pass_index);
+        }
+        else
+        {
+            slot_last_pass_indices[slot_index] = allocation.last_pass_index;
+        }
+        allocation.memory_slot_index = slot_index;
+    }
+
+    META_LOG("Frame graph compiled to {} passes of {} declared with {} barriers and {} transient memory slots of {} bytes ({} bytes without aliasing)",
+             schedule.passes.size(), passes_count, schedule.GetBarriersCount(), schedule.memory_slots.size(),
+             schedule.GetTransientMemorySize(), schedule.GetTransientMemorySizeWithoutAliasing());
+
+    m_schedule             = std::move(schedule);
+    m_compiled_resources   = m_resources;
+    m_compiled_passes      = m_passes;
+    m_is_schedule_compiled = true;
+    m_compilations_count++;
+    m_pass_barriers.clear();
+    m_bound_resources.resize(resources_count, nullptr);
+
+    return m_schedule;
+}
+
+void FrameGraph::AllocateTransientTextures(const RenderContext& context)
+{
+    META_FUNCTION_TASK();
+    const Schedule& schedule = GetSchedule();
+
+    // Transient textures are acquired from the pool in the order of first use, so that textures with equal settings
+    // are reused like in memory slots of the schedule, while memory of textures with different settings may be aliased
+    std::vector<Opt<TransientTexturePool::Allocation>> pool_allocations(schedule.transient_allocations.size());
+    m_texture_pool.BeginFrame();
+    for(const ResourceId resource_id : GetTransientResourceIdsInFirstUseOrder(schedule))
+    {
+        const TransientAllocation& allocation = *schedule.transient_allocations[resource_id];
+        pool_allocations[resource_id] = m_texture_pool.Acquire(*m_compiled_resources[resource_id].transient_settings_opt,
+                                                               allocation.first_pass_index, allocation.last_pass_index);
+    }
+    m_texture_pool.AllocateTextures(context);
+
+    std::map<Texture*, std::string> texture_names;
+    std::map<uint32_t, std::vector<ResourceId>> shared_memory_resource_ids; // by memory block index in the order of first use
+    Ptrs<Texture> transient_textures(pool_allocations.size());
+    for(const ResourceId resource_id : GetTransientResourceIdsInFirstUseOrder(schedule))
+    {
+        const TransientTexturePool::Allocation& pool_allocation = *pool_allocations[resource_id];
+        const Ptr<Texture>& texture_ptr = m_texture_pool.GetTexturePtr(pool_allocation);
+        std::string& texture_name = texture_names[texture_ptr.get()];
+        texture_name += texture_name.empty() ? m_compiled_resources[resource_id].name
+                                             : fmt::format(" | {}", m_compiled_resources[resource_id].name);
+        transient_textures[resource_id] = texture_ptr;
+
+        // Textures created with their own memory, when aliasing is not possible, do not need aliasing barriers
+        if (m_texture_pool.IsMemoryShared(pool_allocation))
+            shared_memory_resource_ids[pool_allocation.memory_block_index].push_back(resource_id);
+    }
+    m_texture_pool.EndFrame();
+
+    // The same textures are acquired every frame until another schedule is compiled, so names and aliasing are updated only on change
+    if (transient_textures == m_transient_textures)
+        return;
+
+    m_transient_textures = std::move(transient_textures);
+    m_pass_barriers.clear();
+
+    // Memory is used by transient textures in the same order every frame, so the first texture in memory block
+    // is aliased after the last texture of the previous frame, while the same texture reusing memory needs no aliasing
+    m_transient_alias_ids.assign(pool_allocations.size(), std::nullopt);
+    for(const auto& [memory_block_index, resource_ids] : shared_memory_resource_ids)
+    {
+        for(size_t index = 0U; index < resource_ids.size(); ++index)
+        {
+            const ResourceId alias_id = resource_ids[(index + resource_ids.size() - 1U) % resource_ids.size()];
+            if (m_transient_textures[alias_id] != m_transient_textures[resource_ids[index]])
+                m_transient_alias_ids[resource_ids[index]] = alias_id;
+        }
+    }
+
+    for(const auto& [p_texture, texture_name] : texture_names)
+    {
+        p_texture->SetName(texture_name);
+    }
+}
+
+const Ptr<Texture>& FrameGraph::GetTransientTexturePtr(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    const Schedule& schedule = GetSchedule();
+    META_CHECK_ARG_LESS(resource_id, schedule.transient_allocations.size());
+    META_CHECK_ARG_TRUE_DESCR(schedule.transient_allocations[resource_id].has_value(), "resource '{}' is not a transient texture used by frame graph passes",
+                              m_compiled_resources[resource_id].name);
+    META_CHECK_ARG_LESS_DESCR(resource_id, m_transient_textures.size(), "transient textures of frame graph were not allocated");
+    return m_transient_textures[resource_id];
+}
+
+void FrameGraph::ReleaseResources() noexcept
+{
+    META_FUNCTION_TASK();
+    m_pass_barriers.clear();
+    m_bound_resources.clear();
+    m_transient_textures.clear();
+    m_transient_alias_ids.clear();
+    m_texture_pool.Release();
+}
+
+void FrameGraph::BindResource(ResourceId resource_id, Resource& resource)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(resource_id, m_resources.size());
+    META_CHECK_ARG_FALSE_DESCR(m_resources[resource_id].transient_settings_opt.has_value(),
+                               "transient resource '{}' can not be bound, since it is allocated by frame graph", m_resources[resource_id].name);
+    if (resource_id >= m_bound_resources.size())
+        m_bound_resources.resize(resource_id + 1, nullptr);
+
+    m_bound_resources[resource_id] = std::addressof(resource);
+}
+
+Resource& FrameGraph::GetResource(ResourceId resource_id) const
+{
+    META_FUNCTION_TASK();
+    if (m_compiled_resources[resource_id].transient_settings_opt)
+    {
+        const Ptr<Texture>& texture_ptr = GetTransientTexturePtr(resource_id);
+        META_CHECK_ARG_NOT_NULL(texture_ptr);
+        return *texture_ptr;
+    }
+
+    META_CHECK_ARG_LESS(resource_id, m_bound_resources.size());
+    Resource* p_resource = m_bound_resources[resource_id];
+    META_CHECK_ARG_NOT_NULL_DESCR(p_resource, "imported resource '{}' was not bound to frame graph", m_compiled_resources[resource_id].name);
+    return *p_resource;
+}
+
+Opt<FrameGraph::ResourceId> FrameGraph::GetTransientAliasId(ResourceId resource_id, const Opt<uint32_t>& pass_index_opt) const
+{
+    META_FUNCTION_TASK();
+    if (!pass_index_opt || resource_id >= m_transient_alias_ids.size() || !m_transient_alias_ids[resource_id])
+        return std::nullopt;
+
+    const Opt<TransientAllocation>& allocation_opt = GetSchedule().transient_allocations[resource_id];
+    return allocation_opt && allocation_opt->first_pass_index == *pass_index_opt
+         ? m_transient_alias_ids[resource_id]
+         : std::nullopt;
+}
+
+void FrameGraph::SetPassBarriers(PassId pass_id, CommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    const Schedule&     schedule       = GetSchedule();
+    const Opt<uint32_t> pass_index_opt = schedule.GetPassIndex(pass_id);
+    META_CHECK_ARG_TRUE_DESCR(pass_index_opt.has_value(), "pass '{}' was culled from frame graph schedule", m_compiled_passes[pass_id].name);
+
+    m_pass_barriers.resize(schedule.passes.size() + 1);
+    SetBarriers(schedule.passes[*pass_index_opt].barriers, pass_index_opt, m_pass_barriers[*pass_index_opt], command_list);
+}
+
+void FrameGraph::SetFinalBarriers(CommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    const Schedule& schedule = GetSchedule();
+    m_pass_barriers.resize(schedule.passes.size() + 1);
+    SetBarriers(schedule.final_barriers, std::nullopt, m_pass_barriers.back(), command_list);
+}
+
+void FrameGraph::SetBarriers(const Barriers& barriers, const Opt<uint32_t>& pass_index_opt,
+                             Ptr<Resource::Barriers>& resource_barriers_ptr, CommandList& command_list) const
+{
+    META_FUNCTION_TASK();
+    if (barriers.empty())
+        return;
+
+    if (resource_barriers_ptr)
+    {
+        // Imported resources may be bound to different resources in every frame, so barriers of the previous frame are removed
+        for(const Resource::Barrier& resource_barrier : resource_barriers_ptr->GetSet())
+        {
+            resource_barriers_ptr->Remove(resource_barrier.GetId());
+        }
+    }
+
+    bool is_barrier_added = false;
+    for(const Barrier& barrier : barriers)
+    {
+        Resource& resource = GetResource(barrier.resource_id);
+        if (barrier.IsUnorderedAccessBarrier())
+        {
+            if (!resource_barriers_ptr)
+                resource_barriers_ptr = Resource::Barriers::Create();
+
+            resource_barriers_ptr->AddUnorderedAccessBarrier(resource);
+            is_barrier_added = true;
+        }
+        else if (const Opt<ResourceId> alias_id_opt = GetTransientAliasId(barrier.resource_id, pass_index_opt);
+                 alias_id_opt)
+        {
+            // Texture aliasing memory is transitioned from undefined layout discarding its content on first use in frame,
+            // after the last access of the previous texture in aliased memory, which state is tracked while setting its barriers
+            if (!resource_barriers_ptr)
+                resource_barriers_ptr = Resource::Barriers::Create();
+
+            resource_barriers_ptr->AddAliasingTransition(resource, GetResource(*alias_id_opt).GetState(), barrier.state_after);
+            resource.SetState(barrier.state_after);
+            is_barrier_added = true;
+        }
+        else
+        {
+            // Resource state change is skipped when resource is already in required state
+            is_barrier_added |= resource.SetState(barrier.state_after, resource_barriers_ptr);
+        }
+    }
+
+    if (is_barrier_added && resource_barriers_ptr && !resource_barriers_ptr->IsEmpty())
+    {
+        command_list.SetResourceBarriers(*resource_barriers_ptr);
+    }
+}
+
+} // namespace Methane::Graphics
@@ -23,7 +23,9 @@ Metal implementation of the blit command list interface.
 
 #include "BlitCommandListMT.hh"
 
+#include <Methane/Graphics/ComputeCommandList.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
 
 namespace Methane::Graphics
 {
@@ -34,6 +36,12 @@ Ptr<BlitCommandList> BlitCommandList::Create(CommandQueue& command_queue)
     return std::make_shared<BlitCommandListMT>(static_cast<CommandQueueBase&>(command_queue));
 }
 
+Ptr<ComputeCommandList> ComputeCommandList::Create(CommandQueue&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "compute command lists are not supported by Metal backend yet");
+}
+
 BlitCommandListMT::BlitCommandListMT(CommandQueueBase& command_queue)
     : CommandListMT<id<MTLBlitCommandEncoder>, CommandListBase>(true, command_queue, CommandList::Type::Blit)
 {
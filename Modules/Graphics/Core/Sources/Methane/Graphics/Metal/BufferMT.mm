@@ -75,6 +75,18 @@ Ptr<Buffer> Buffer::CreateConstantBuffer(const Context& context, Data::Size size
     return Graphics::CreateConstantBuffer<BufferMT>(context, size, addressable, is_volatile);
 }
 
+Ptr<Buffer> Buffer::CreateIndirectBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Graphics::CreateIndirectBuffer<BufferMT>(context, size, stride, is_volatile);
+}
+
+Ptr<Buffer> Buffer::CreateStorageBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_read_back)
+{
+    META_FUNCTION_TASK();
+    return Graphics::CreateStorageBuffer<BufferMT>(context, size, stride, is_read_back);
+}
+
 Data::Size Buffer::GetAlignedBufferSize(Data::Size size) noexcept
 {
     META_FUNCTION_TASK();
@@ -144,7 +156,9 @@ void BufferMT::SetDataToPrivateBuffer(const SubResources& sub_resources)
     META_CHECK_ARG_NOT_NULL(m_mtl_buffer);
     META_CHECK_ARG_EQUAL(m_mtl_buffer.storageMode, MTLStorageModePrivate);
 
-    BlitCommandListMT& blit_command_list = dynamic_cast<BlitCommandListMT&>(GetContextBase().GetUploadCommandKit().GetListForEncoding());
+    const ContextBase& context = GetContextBase();
+    const auto upload_encoding_lock = context.LockUploadEncoding();
+    BlitCommandListMT& blit_command_list = dynamic_cast<BlitCommandListMT&>(context.GetUploadCommandKit().GetListForEncoding(context.GetUploadCommandListId()));
     blit_command_list.RetainResource(*this);
 
     const id<MTLBlitCommandEncoder>& mtl_blit_encoder = blit_command_list.GetNativeCommandEncoder();
@@ -165,7 +179,7 @@ void BufferMT::SetDataToPrivateBuffer(const SubResources& sub_resources)
         data_offset += sub_resource.GetDataSize();
     }
     
-    GetContextBase().RequestDeferredAction(Context::DeferredAction::UploadResources);
+    context.RequestDeferredAction(Context::DeferredAction::UploadResources);
 }
 
 MTLIndexType BufferMT::GetNativeIndexType() const noexcept
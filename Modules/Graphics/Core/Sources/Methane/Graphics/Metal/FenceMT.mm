@@ -61,30 +61,36 @@ void FenceMT::Signal()
     id<MTLCommandBuffer> mtl_command_buffer = [GetCommandQueueMT().GetNativeCommandQueue() commandBuffer];
     [mtl_command_buffer encodeSignalEvent:m_mtl_event value:GetValue()];
     [mtl_command_buffer commit];
-    
-    m_is_signalled = false;
 }
 
-void FenceMT::WaitOnCpu()
+uint64_t FenceMT::GetCompletedValue() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_mtl_event);
+    return m_mtl_event.signaledValue;
+}
+
+void FenceMT::WaitOnCpu(uint64_t wait_value)
 {
     META_FUNCTION_TASK();
-    FenceBase::WaitOnCpu();
+    FenceBase::WaitOnCpu(wait_value);
 
     META_CHECK_ARG_NOT_NULL(m_mtl_event);
     uint64_t signalled_value = m_mtl_event.signaledValue;
-    if (signalled_value >= GetValue())
+    if (signalled_value >= wait_value)
         return;
 
-    META_CHECK_ARG_FALSE(m_is_signalled);
     META_CHECK_ARG_NOT_NULL(m_mtl_event_listener);
+    std::unique_lock lock(m_wait_mutex);
+    m_is_signalled = false;
     [m_mtl_event notifyListener:m_mtl_event_listener
-                        atValue:GetValue()
+                        atValue:wait_value
                           block:^(id<MTLSharedEvent>, uint64_t /*value*/)
                                 {
+                                    std::scoped_lock<LockableBase(std::mutex)> signal_lock(m_wait_mutex);
                                     m_is_signalled = true;
                                     m_wait_condition_var.notify_one();
                                 }];
-    std::unique_lock lock(m_wait_mutex);
     m_wait_condition_var.wait(lock, [this]{ return m_is_signalled; });
 }
 
@@ -36,6 +36,11 @@ Metal implementation of the render command list interface.
 namespace Methane::Graphics
 {
 
+static_assert(sizeof(RenderCommandList::DrawArguments) == sizeof(MTLDrawPrimitivesIndirectArguments),
+              "Indirect draw arguments layout must be binary compatible with Metal draw primitives indirect arguments");
+static_assert(sizeof(RenderCommandList::DrawIndexedArguments) == sizeof(MTLDrawIndexedPrimitivesIndirectArguments),
+              "Indirect indexed draw arguments layout must be binary compatible with Metal draw indexed primitives indirect arguments");
+
 static MTLPrimitiveType PrimitiveTypeToMetal(RenderCommandList::Primitive primitive) noexcept
 {
     META_FUNCTION_TASK();
@@ -70,6 +75,12 @@ Ptr<RenderCommandList> RenderCommandList::Create(ParallelRenderCommandList& para
     return std::make_shared<RenderCommandListMT>(dynamic_cast<ParallelRenderCommandListMT&>(parallel_render_command_list));
 }
 
+Ptr<RenderCommandList> RenderCommandList::CreateBundle(CommandQueue&, RenderPass&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "render command bundles are not supported by Metal graphics API implementation yet");
+}
+
 Ptr<RenderCommandList> RenderCommandListBase::CreateForSynchronization(CommandQueue&)
 {
     META_FUNCTION_TASK();
@@ -228,6 +239,57 @@ void RenderCommandListMT::Draw(Primitive primitive, uint32_t vertex_count, uint3
     }
 }
 
+void RenderCommandListMT::DrawIndexedIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                              Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(p_count_buffer, !p_count_buffer, "indirect draw with count buffer is not supported by Metal");
+    RenderCommandListBase::DrawIndexedIndirect(primitive, arguments_buffer, draw_count, arguments_offset, p_count_buffer, count_offset);
+
+    const DrawingState&    drawing_state      = GetDrawingState();
+    const BufferMT&        metal_index_buffer = static_cast<const BufferMT&>(*drawing_state.index_buffer_ptr);
+    const id<MTLBuffer>&   mtl_indirect_buffer = static_cast<const BufferMT&>(arguments_buffer).GetNativeBuffer();
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+    const Data::Size       arguments_stride   = GetDrawIndirectArgumentsStride(arguments_buffer, sizeof(DrawIndexedArguments));
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    // Metal render command encoder does not support multi-draw indirect, so each draw is encoded separately
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
+                                     indexType:metal_index_buffer.GetNativeIndexType()
+                                   indexBuffer:metal_index_buffer.GetNativeBuffer()
+                             indexBufferOffset:0U
+                                indirectBuffer:mtl_indirect_buffer
+                          indirectBufferOffset:arguments_offset + draw_index * arguments_stride];
+    }
+}
+
+void RenderCommandListMT::DrawIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                       Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_DESCR(p_count_buffer, !p_count_buffer, "indirect draw with count buffer is not supported by Metal");
+    RenderCommandListBase::DrawIndirect(primitive, arguments_buffer, draw_count, arguments_offset, p_count_buffer, count_offset);
+
+    const id<MTLBuffer>&   mtl_indirect_buffer = static_cast<const BufferMT&>(arguments_buffer).GetNativeBuffer();
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+    const Data::Size       arguments_stride   = GetDrawIndirectArgumentsStride(arguments_buffer, sizeof(DrawArguments));
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    // Metal render command encoder does not support multi-draw indirect, so each draw is encoded separately
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawPrimitives:mtl_primitive_type
+                         indirectBuffer:mtl_indirect_buffer
+                   indirectBufferOffset:arguments_offset + draw_index * arguments_stride];
+    }
+}
+
 RenderPassMT& RenderCommandListMT::GetRenderPassMT()
 {
     META_FUNCTION_TASK();
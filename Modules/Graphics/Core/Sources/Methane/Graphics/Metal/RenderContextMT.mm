@@ -51,6 +51,11 @@ Ptr<RenderContext> RenderContext::Create(const Platform::AppEnvironment& env, De
     return render_context_ptr;
 }
 
+Ptr<RenderContext> RenderContext::CreateHeadless(Device&, tf::Executor&, const RenderContext::Settings&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "headless render context is not supported by Metal backend yet");
+}
+
 RenderContextMT::RenderContextMT(const Platform::AppEnvironment& env, DeviceBase& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings)
     : ContextMT<RenderContextBase>(device, parallel_executor, settings)
     , m_app_view(CreateRenderContextAppView(env, settings))
@@ -28,6 +28,8 @@ Metal implementation of the render state interface.
 #include "ShaderMT.hh"
 #include "TypesMT.hh"
 
+#include <Methane/Graphics/ComputeState.h>
+
 #include <Methane/Platform/Apple/Types.hh>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -274,6 +276,12 @@ Ptr<RenderState> RenderState::Create(const RenderContext& context, const RenderS
     return std::make_shared<RenderStateMT>(dynamic_cast<const RenderContextBase&>(context), state_settings);
 }
 
+Ptr<ComputeState> ComputeState::Create(const Context&, const ComputeState::Settings&)
+{
+    META_FUNCTION_TASK();
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "compute pipeline state is not supported by Metal backend yet");
+}
+
 RenderStateMT::RenderStateMT(const RenderContextBase& context, const Settings& settings)
     : RenderStateBase(context, settings)
 {
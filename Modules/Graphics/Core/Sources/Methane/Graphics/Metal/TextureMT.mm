@@ -82,6 +82,16 @@ Ptr<Texture> Texture::CreateRenderTarget(const RenderContext& context, const Set
     return std::make_shared<TextureMT>(dynamic_cast<const ContextBase&>(context), settings);
 }
 
+Ptr<Texture> Texture::CreateAliasedRenderTarget(const RenderContext&, const Settings&, const Ptr<Texture>&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(nullptr, "memory aliasing of render target textures is not supported by Metal backend yet");
+}
+
+bool Texture::IsMemoryAliasingSupported() noexcept
+{
+    return false;
+}
+
 Ptr<Texture> Texture::CreateFrameBuffer(const RenderContext& context, FrameBufferIndex /*frame_buffer_index*/)
 {
     META_FUNCTION_TASK();
@@ -98,10 +108,13 @@ Ptr<Texture> Texture::CreateDepthStencilBuffer(const RenderContext& context)
     return std::make_shared<TextureMT>(dynamic_cast<const RenderContextBase&>(context), texture_settings);
 }
 
-Ptr<Texture> Texture::CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped)
+Ptr<Texture> Texture::CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped,
+                                  bool is_read_back)
 {
     META_FUNCTION_TASK();
-    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, Usage::ShaderRead);
+    using namespace magic_enum::bitwise_operators;
+    const Usage    texture_usage    = Usage::ShaderRead | (is_read_back ? Usage::ReadBack : Usage::None);
+    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, texture_usage);
     return std::make_shared<TextureMT>(dynamic_cast<const ContextBase&>(context), texture_settings);
 }
 
@@ -139,7 +152,9 @@ void TextureMT::SetData(const SubResources& sub_resources, CommandQueue& target_
 
     ResourceMT::SetData(sub_resources, target_cmd_queue);
 
-    BlitCommandListMT& blit_command_list = dynamic_cast<BlitCommandListMT&>(GetContextBase().GetUploadCommandKit().GetListForEncoding());
+    const ContextBase& context = GetContextBase();
+    const auto upload_encoding_lock = context.LockUploadEncoding();
+    BlitCommandListMT& blit_command_list = dynamic_cast<BlitCommandListMT&>(context.GetUploadCommandKit().GetListForEncoding(context.GetUploadCommandListId()));
     blit_command_list.RetainResource(*this);
 
     const id<MTLBlitCommandEncoder>& mtl_blit_encoder = blit_command_list.GetNativeCommandEncoder();
@@ -185,7 +200,7 @@ void TextureMT::SetData(const SubResources& sub_resources, CommandQueue& target_
         GenerateMipLevels(blit_command_list);
     }
 
-    GetContextBase().RequestDeferredAction(Context::DeferredAction::UploadResources);
+    context.RequestDeferredAction(Context::DeferredAction::UploadResources);
 }
 
 void TextureMT::UpdateFrameBuffer()
@@ -41,6 +41,7 @@ void ObjectBase::RegistryBase::AddGraphicsObject(Object& object)
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_EMPTY_DESCR(object.GetName(), "Can not add graphics object without name to the objects registry.");
+    std::scoped_lock lock_guard(m_object_by_name_mutex);
 
     const auto [name_and_object_it, object_added] = m_object_by_name.try_emplace(object.GetName(), object.GetPtr());
     if (!object_added &&
@@ -58,6 +59,7 @@ void ObjectBase::RegistryBase::RemoveGraphicsObject(Object& object)
 
     const std::string& object_name = object.GetName();
     META_CHECK_ARG_NOT_EMPTY_DESCR(object_name, "Can not remove graphics object without name to the objects registry.");
+    std::scoped_lock lock_guard(m_object_by_name_mutex);
 
     if (m_object_by_name.erase(object_name))
     {
@@ -68,6 +70,7 @@ void ObjectBase::RegistryBase::RemoveGraphicsObject(Object& object)
 Ptr<Object> ObjectBase::RegistryBase::GetGraphicsObject(const std::string& object_name) const noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_object_by_name_mutex);
     const auto object_by_name_it = m_object_by_name.find(object_name);
     return object_by_name_it == m_object_by_name.end() ? nullptr : object_by_name_it->second.lock();
 }
@@ -75,6 +78,7 @@ Ptr<Object> ObjectBase::RegistryBase::GetGraphicsObject(const std::string& objec
 bool ObjectBase::RegistryBase::HasGraphicsObject(const std::string& object_name) const noexcept
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_object_by_name_mutex);
     const auto object_by_name_it = m_object_by_name.find(object_name);
     return object_by_name_it != m_object_by_name.end() && !object_by_name_it->second.expired();
 }
@@ -82,6 +86,7 @@ bool ObjectBase::RegistryBase::HasGraphicsObject(const std::string& object_name)
 void ObjectBase::RegistryBase::OnObjectNameChanged(Object& object, const std::string& old_name)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_object_by_name_mutex);
     const auto object_by_name_it = m_object_by_name.find(old_name);
     META_CHECK_ARG_TRUE_DESCR(object_by_name_it != m_object_by_name.end(),
                               "renamed object was not found in the objects registry by its old name '{}'", old_name);
@@ -26,8 +26,11 @@ Base implementation of the named object interface.
 #include <Methane/Graphics/Object.h>
 #include <Methane/Memory.hpp>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <map>
+#include <mutex>
+#include <atomic>
 
 namespace Methane::Graphics
 {
@@ -54,6 +57,7 @@ public:
         void OnObjectDestroyed(Object& object) override;
 
         std::map<std::string, WeakPtr<Object>, std::less<>> m_object_by_name;
+        mutable TracyLockable(std::recursive_mutex, m_object_by_name_mutex)
     };
 
     ObjectBase() = default;
@@ -77,8 +81,37 @@ public:
     std::enable_if_t<std::is_base_of_v<ObjectBase, T>, Ptr<T>> GetPtr()
     { return std::static_pointer_cast<T>(GetBasePtr()); }
 
+    // Object retention by epochs, returns true when object was not retained in any epoch before
+    inline bool RetainInEpoch(uint64_t epoch) noexcept
+    {
+        uint64_t retained_epoch = m_retained_epoch.value.load(std::memory_order_relaxed);
+        while(retained_epoch < epoch && !m_retained_epoch.value.compare_exchange_weak(retained_epoch, epoch, std::memory_order_relaxed))
+        {
+            // retained epoch is updated by compare exchange on failure
+        }
+        return !retained_epoch;
+    }
+
+    // Returns true when object is not used in any epoch after completed one and its retention was released
+    inline bool ReleaseFromEpoch(uint64_t completed_epoch) noexcept
+    {
+        uint64_t retained_epoch = m_retained_epoch.value.load(std::memory_order_relaxed);
+        return retained_epoch <= completed_epoch && m_retained_epoch.value.compare_exchange_strong(retained_epoch, 0U, std::memory_order_relaxed);
+    }
+
 private:
-    std::string m_name;
+    // Retained epoch is not copied with object, because the copy is not used by any command list yet
+    struct RetainedEpoch
+    {
+        std::atomic<uint64_t> value{ 0U };
+
+        RetainedEpoch() = default;
+        RetainedEpoch(const RetainedEpoch&) noexcept { }
+        RetainedEpoch& operator=(const RetainedEpoch&) noexcept { return *this; }
+    };
+
+    std::string   m_name;
+    RetainedEpoch m_retained_epoch;
 };
 
 } // namespace Methane::Graphics
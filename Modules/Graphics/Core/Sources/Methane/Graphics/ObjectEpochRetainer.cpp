@@ -0,0 +1,131 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ObjectEpochRetainer.cpp
+Retainer of objects used by command lists until completion of the epochs of their use:
+object shared pointer is acquired only on its first use and released when no incomplete epoch is using it.
+
+******************************************************************************/
+
+#include "ObjectEpochRetainer.h"
+
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+ObjectEpochRetainer::Epoch ObjectEpochRetainer::GetCurrentEpoch() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_epochs_mutex);
+    return m_current_epoch;
+}
+
+ObjectEpochRetainer::Epoch ObjectEpochRetainer::GetCompletedEpoch() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_epochs_mutex);
+    return (m_epoch_users_count.empty() ? m_current_epoch : m_epoch_users_count.begin()->first) - 1U;
+}
+
+size_t ObjectEpochRetainer::GetRetainedObjectsCount() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_retained_objects_mutex);
+    return m_retained_objects.size();
+}
+
+ObjectEpochRetainer::Epoch ObjectEpochRetainer::BeginEpochUse()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_epochs_mutex);
+    m_epoch_users_count[m_current_epoch]++;
+    return m_current_epoch;
+}
+
+void ObjectEpochRetainer::EndEpochUse(Epoch epoch)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_epochs_mutex);
+    const auto epoch_users_count_it = m_epoch_users_count.find(epoch);
+    META_CHECK_ARG_DESCR(epoch, epoch_users_count_it != m_epoch_users_count.end(), "epoch is not used by anyone");
+    if (!--epoch_users_count_it->second)
+        m_epoch_users_count.erase(epoch_users_count_it);
+}
+
+void ObjectEpochRetainer::AdvanceEpoch()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_epochs_mutex);
+        m_current_epoch++;
+    }
+    ReleaseCompletedObjects();
+}
+
+void ObjectEpochRetainer::ReleaseCompletedObjects()
+{
+    META_FUNCTION_TASK();
+    const Epoch completed_epoch = GetCompletedEpoch();
+    if (!completed_epoch)
+        return;
+
+    Ptrs<ObjectBase> released_objects;
+    {
+        std::scoped_lock lock_guard(m_retained_objects_mutex);
+        const auto released_objects_it = std::partition(m_retained_objects.begin(), m_retained_objects.end(),
+            [completed_epoch](const Ptr<ObjectBase>& object_ptr)
+            { return !object_ptr->ReleaseFromEpoch(completed_epoch); });
+
+        released_objects.assign(std::make_move_iterator(released_objects_it), std::make_move_iterator(m_retained_objects.end()));
+        m_retained_objects.erase(released_objects_it, m_retained_objects.end());
+    }
+
+    // Released objects are destroyed outside of the lock,
+    // because their destruction may release other objects retained by them
+    META_LOG("Object epoch retainer released {} objects used in epochs up to {}", released_objects.size(), completed_epoch);
+}
+
+void ObjectEpochRetainer::ReleaseAllObjects()
+{
+    META_FUNCTION_TASK();
+    Ptrs<ObjectBase> released_objects;
+    {
+        std::scoped_lock lock_guard(m_retained_objects_mutex);
+        std::swap(released_objects, m_retained_objects);
+    }
+
+    for(const Ptr<ObjectBase>& object_ptr : released_objects)
+    {
+        object_ptr->ReleaseFromEpoch(std::numeric_limits<Epoch>::max());
+    }
+}
+
+void ObjectEpochRetainer::AddRetainedObject(ObjectBase& object)
+{
+    META_FUNCTION_TASK();
+    Ptr<ObjectBase> object_ptr = object.GetBasePtr();
+    std::scoped_lock lock_guard(m_retained_objects_mutex);
+    m_retained_objects.emplace_back(std::move(object_ptr));
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,75 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ObjectEpochRetainer.h
+Retainer of objects used by command lists until completion of the epochs of their use:
+object shared pointer is acquired only on its first use and released when no incomplete epoch is using it.
+
+******************************************************************************/
+
+#pragma once
+
+#include "ObjectBase.h"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <map>
+#include <mutex>
+
+namespace Methane::Graphics
+{
+
+class ObjectEpochRetainer
+{
+public:
+    using Epoch = uint64_t;
+
+    [[nodiscard]] Epoch  GetCurrentEpoch() const;
+    [[nodiscard]] Epoch  GetCompletedEpoch() const;
+    [[nodiscard]] size_t GetRetainedObjectsCount() const;
+
+    // Command list uses the current epoch from reset till completion of its execution,
+    // so the epoch can not be completed until all command lists using it are completed
+    [[nodiscard]] Epoch BeginEpochUse();
+    void EndEpochUse(Epoch epoch);
+
+    // Object is retained until completion of the given epoch and all following epochs where it is used,
+    // while its shared pointer is acquired only once on the first use instead of every use in command lists
+    inline void Retain(ObjectBase& object, Epoch epoch)
+    {
+        if (object.RetainInEpoch(epoch))
+            AddRetainedObject(object);
+    }
+
+    // Start new epoch and release objects which are not used in any incomplete epoch
+    void AdvanceEpoch();
+    void ReleaseCompletedObjects();
+    void ReleaseAllObjects();
+
+private:
+    void AddRetainedObject(ObjectBase& object);
+
+    Epoch                     m_current_epoch = 1U; // zero epoch is reserved for objects which are not retained
+    std::map<Epoch, uint32_t> m_epoch_users_count;
+    mutable TracyLockable(std::mutex, m_epochs_mutex)
+    Ptrs<ObjectBase>          m_retained_objects;
+    mutable TracyLockable(std::mutex, m_retained_objects_mutex)
+};
+
+} // namespace Methane::Graphics
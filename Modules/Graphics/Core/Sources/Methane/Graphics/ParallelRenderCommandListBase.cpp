@@ -138,8 +138,8 @@ void ParallelRenderCommandListBase::SetParallelCommandListsCount(uint32_t count)
     const auto initial_count = static_cast<uint32_t>(m_parallel_command_lists.size());
     if (count < initial_count)
     {
-        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count);
-        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count);
+        m_parallel_command_lists.erase(m_parallel_command_lists.begin() + count, m_parallel_command_lists.end());
+        m_parallel_command_lists_refs.erase(m_parallel_command_lists_refs.begin() + count, m_parallel_command_lists_refs.end());
         return;
     }
 
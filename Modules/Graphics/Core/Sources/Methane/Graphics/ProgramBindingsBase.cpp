@@ -56,10 +56,12 @@ struct fmt::formatter<Methane::Graphics::Resource::View>
 namespace Methane::Graphics
 {
 
-static Resource::State GetBoundResourceTargetState(const Resource& resource, Resource::Type resource_type, bool is_constant_binding)
+static Resource::State GetBoundResourceTargetState(const Resource& resource, const ProgramBindings::ArgumentBinding::Settings& binding_settings)
 {
     META_FUNCTION_TASK();
-    switch (resource_type)
+    using namespace magic_enum::bitwise_operators;
+    const bool is_constant_binding = binding_settings.argument.IsConstant();
+    switch (binding_settings.resource_type)
     {
     case Resource::Type::Buffer:
         // FIXME: state transition of DX upload heap resources should be reworked properly and made friendly with Vulkan
@@ -73,11 +75,21 @@ static Resource::State GetBoundResourceTargetState(const Resource& resource, Res
     case Resource::Type::Texture:
         if (dynamic_cast<const Texture&>(resource).GetSettings().type == Texture::Type::DepthStencilBuffer)
             return Resource::State::DepthRead;
-        break;
+
+        // Texture with shader write usage can be also sampled, so it is bound for unordered access only to storage image arguments
+        META_CHECK_ARG_DESCR(resource.GetUsage(), !binding_settings.is_shader_writable || static_cast<bool>(resource.GetUsage() & Resource::Usage::ShaderWrite),
+                             "texture '{}' bound to shader writable argument '{}' must have shader write usage",
+                             resource.GetName(), binding_settings.argument.GetName());
+        return binding_settings.is_shader_writable ? Resource::State::UnorderedAccess : Resource::State::ShaderResource;
 
     default:
         break;
     }
+
+    // Resources written by shaders, like storage buffers of compute shaders, are bound for unordered access
+    if (static_cast<bool>(resource.GetUsage() & Resource::Usage::ShaderWrite))
+        return Resource::State::UnorderedAccess;
+
     return Resource::State::ShaderResource;
 }
 
@@ -419,7 +431,7 @@ void ProgramBindingsBase::AddTransitionResourceState(const ProgramBindings::Argu
         return;
 
     const ProgramBindings::ArgumentBinding::Settings& argument_binding_settings = argument_binding.GetSettings();
-    const Resource::State target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+    const Resource::State target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
     ResourceStates& transition_resource_states = m_transition_resource_states_by_access[argument_binding_settings.argument.GetAccessorIndex()];
     transition_resource_states.emplace_back(std::dynamic_pointer_cast<ResourceBase>(resource.GetPtr()), target_resource_state);
 }
@@ -439,7 +451,7 @@ void ProgramBindingsBase::AddTransitionResourceStates(const ProgramBindings::Arg
         if (resource.GetResourceType() == Resource::Type::Sampler)
             continue;
 
-        const Resource::State target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings.resource_type, argument_binding_settings.argument.IsConstant());
+        const Resource::State target_resource_state = GetBoundResourceTargetState(resource, argument_binding_settings);
         transition_resource_states.emplace_back(std::dynamic_pointer_cast<ResourceBase>(resource_view.GetResourcePtr()), target_resource_state);
     }
 }
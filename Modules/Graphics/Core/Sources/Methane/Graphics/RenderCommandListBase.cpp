@@ -43,11 +43,17 @@ RenderCommandListBase::RenderCommandListBase(CommandQueueBase& command_queue)
     META_FUNCTION_TASK();
 }
 
-RenderCommandListBase::RenderCommandListBase(CommandQueueBase& command_queue, RenderPassBase& pass)
+RenderCommandListBase::RenderCommandListBase(CommandQueueBase& command_queue, RenderPassBase& pass, bool is_bundle)
     : CommandListBase(command_queue, Type::Render)
+    , m_is_bundle(is_bundle)
     , m_render_pass_ptr(pass.GetPtr<RenderPassBase>())
 {
     META_FUNCTION_TASK();
+    if (m_is_bundle)
+    {
+        // Bundle is executed many times after encoding, so it retains resources for its whole lifetime
+        DisableEpochResourceRetention();
+    }
 }
 
 RenderCommandListBase::RenderCommandListBase(ParallelRenderCommandListBase& parallel_render_command_list)
@@ -86,7 +92,7 @@ void RenderCommandListBase::ResetWithState(RenderState& render_state, DebugGroup
 void RenderCommandListBase::ResetWithStateOnce(RenderState& render_state, DebugGroup* p_debug_group)
 {
     META_FUNCTION_TASK();
-    if (GetState() == State::Encoding && GetDrawingState().render_state_ptr.get() == std::addressof(render_state))
+    if (GetState() == State::Encoding && GetDrawingState().render_state_ptr == std::addressof(render_state))
     {
         META_LOG("{} Command list '{}' was already RESET with the same render state '{}'", magic_enum::enum_name(GetType()), GetName(), render_state.GetName());
         return;
@@ -103,7 +109,7 @@ void RenderCommandListBase::SetRenderState(RenderState& render_state, RenderStat
 
     VerifyEncodingState();
 
-    const bool    render_state_changed = m_drawing_state.render_state_ptr.get() != std::addressof(render_state);
+    const bool    render_state_changed = m_drawing_state.render_state_ptr != std::addressof(render_state);
     RenderState::Groups changed_states = m_drawing_state.render_state_ptr ? RenderState::Groups::None : RenderState::Groups::All;
     if (m_drawing_state.render_state_ptr && render_state_changed)
     {
@@ -116,13 +122,12 @@ void RenderCommandListBase::SetRenderState(RenderState& render_state, RenderStat
     auto& render_state_base = static_cast<RenderStateBase&>(render_state);
     render_state_base.Apply(*this, changed_states & state_groups);
 
-    Ptr<ObjectBase> render_state_object_ptr = render_state_base.GetBasePtr();
-    m_drawing_state.render_state_ptr = std::static_pointer_cast<RenderStateBase>(render_state_object_ptr);
+    m_drawing_state.render_state_ptr = &render_state_base;
     m_drawing_state.render_state_groups |= state_groups;
 
     if (render_state_changed)
     {
-        RetainResource(render_state_object_ptr);
+        RetainResource(render_state_base);
     }
 }
 
@@ -160,7 +165,7 @@ bool RenderCommandListBase::SetVertexBuffers(BufferSet& vertex_buffers, bool set
     }
 
     DrawingState&  drawing_state = GetDrawingState();
-    if (drawing_state.vertex_buffer_set_ptr.get() == std::addressof(vertex_buffers))
+    if (drawing_state.vertex_buffer_set_ptr == std::addressof(vertex_buffers))
     {
         META_LOG("{} Command list '{}' vertex buffers {} are already set up",
                  magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
@@ -169,9 +174,9 @@ bool RenderCommandListBase::SetVertexBuffers(BufferSet& vertex_buffers, bool set
 
     META_LOG("{} Command list '{}' SET VERTEX BUFFERS {}", magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
 
-    Ptr<ObjectBase> vertex_buffer_set_object_ptr = static_cast<BufferSetBase&>(vertex_buffers).GetBasePtr();
-    drawing_state.vertex_buffer_set_ptr = std::static_pointer_cast<BufferSetBase>(vertex_buffer_set_object_ptr);
-    RetainResource(vertex_buffer_set_object_ptr);
+    auto& vertex_buffer_set_base = static_cast<BufferSetBase&>(vertex_buffers);
+    drawing_state.vertex_buffer_set_ptr = &vertex_buffer_set_base;
+    RetainResource(vertex_buffer_set_base);
     return true;
 }
 
@@ -190,16 +195,16 @@ bool RenderCommandListBase::SetIndexBuffer(Buffer& index_buffer, bool set_resour
     }
 
     DrawingState& drawing_state = GetDrawingState();
-    if (drawing_state.index_buffer_ptr.get() == std::addressof(index_buffer))
+    if (drawing_state.index_buffer_ptr == std::addressof(index_buffer))
     {
         META_LOG("{} Command list '{}' index buffer {} is already set up",
                  magic_enum::enum_name(GetType()), GetName(), index_buffer.GetName());
         return false;
     }
 
-    Ptr<ObjectBase> index_buffer_object_ptr = static_cast<BufferBase&>(index_buffer).GetBasePtr();
-    drawing_state.index_buffer_ptr = std::static_pointer_cast<BufferBase>(index_buffer_object_ptr);
-    RetainResource(index_buffer_object_ptr);
+    auto& index_buffer_base = static_cast<BufferBase&>(index_buffer);
+    drawing_state.index_buffer_ptr = &index_buffer_base;
+    RetainResource(index_buffer_base);
     return true;
 }
 
@@ -213,7 +218,7 @@ void RenderCommandListBase::DrawIndexed(Primitive primitive_type, uint32_t index
     {
         const DrawingState& drawing_state = GetDrawingState();
         META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.index_buffer_ptr, "index buffer must be set before indexed draw call");
-        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.vertex_buffer_set_ptr, "vertex buffers must be set before draw call");
+        ValidateDrawInputBuffers();
 
         const uint32_t formatted_items_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
         META_CHECK_ARG_NOT_ZERO_DESCR(formatted_items_count, "can not draw with index buffer which contains no formatted vertices");
@@ -225,7 +230,9 @@ void RenderCommandListBase::DrawIndexed(Primitive primitive_type, uint32_t index
     }
 
     META_LOG("{} Command list '{}' DRAW INDEXED with vertex buffers {} and index buffer '{}' using {} primive type, {} indices from {} index and {} vertex with {} instances count from {} instance",
-             magic_enum::enum_name(GetType()), GetName(), GetDrawingState().vertex_buffer_set_ptr->GetNames(), GetDrawingState().index_buffer_ptr->GetName(),
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             GetDrawingState().index_buffer_ptr ? GetDrawingState().index_buffer_ptr->GetName() : "None",
              magic_enum::enum_name(primitive_type), index_count, start_index, start_vertex, instance_count, start_instance);
     META_UNUSED(start_instance);
 
@@ -240,13 +247,7 @@ void RenderCommandListBase::Draw(Primitive primitive_type, uint32_t vertex_count
 
     if (m_is_validation_enabled)
     {
-        const DrawingState& drawing_state = GetDrawingState();
-        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before draw call");
-        const size_t input_buffers_count = drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
-        META_CHECK_ARG_TRUE_DESCR(!input_buffers_count || drawing_state.vertex_buffer_set_ptr,
-                                 "vertex buffers must be set when program has non empty input buffer layouts");
-        META_CHECK_ARG_TRUE_DESCR(!drawing_state.vertex_buffer_set_ptr || drawing_state.vertex_buffer_set_ptr->GetCount() == input_buffers_count,
-                                  "vertex buffers count must be equal to the program input buffer layouts count");
+        ValidateDrawInputBuffers();
         META_CHECK_ARG_NOT_ZERO_DESCR(vertex_count, "can not draw zero vertices");
         META_CHECK_ARG_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
 
@@ -262,6 +263,85 @@ void RenderCommandListBase::Draw(Primitive primitive_type, uint32_t vertex_count
     UpdateDrawingState(primitive_type);
 }
 
+void RenderCommandListBase::DrawIndexedIndirect(Primitive primitive_type, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                                Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        const DrawingState& drawing_state = GetDrawingState();
+        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.index_buffer_ptr, "index buffer must be set before indexed indirect draw call");
+        ValidateDrawInputBuffers();
+        ValidateDrawIndirectBuffers(arguments_buffer, sizeof(DrawIndexedArguments), draw_count, arguments_offset, p_count_buffer, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDEXED INDIRECT with vertex buffers {} and index buffer '{}' using {} primitive type, {} draws from arguments buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             GetDrawingState().index_buffer_ptr ? GetDrawingState().index_buffer_ptr->GetName() : "None",
+             magic_enum::enum_name(primitive_type), draw_count, arguments_buffer.GetName(), arguments_offset,
+             p_count_buffer ? fmt::format(" with count from buffer '{}' at offset {}", p_count_buffer->GetName(), count_offset) : "");
+
+    RetainDrawIndirectBuffers(arguments_buffer, p_count_buffer);
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandListBase::DrawIndirect(Primitive primitive_type, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                         Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        ValidateDrawInputBuffers();
+        ValidateDrawIndirectBuffers(arguments_buffer, sizeof(DrawArguments), draw_count, arguments_offset, p_count_buffer, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDIRECT with vertex buffers {} using {} primitive type, {} draws from arguments buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             magic_enum::enum_name(primitive_type), draw_count, arguments_buffer.GetName(), arguments_offset,
+             p_count_buffer ? fmt::format(" with count from buffer '{}' at offset {}", p_count_buffer->GetName(), count_offset) : "");
+
+    RetainDrawIndirectBuffers(arguments_buffer, p_count_buffer);
+    UpdateDrawingState(primitive_type);
+}
+
+void RenderCommandListBase::ExecuteBundle(RenderCommandList& bundle)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' EXECUTE BUNDLE '{}'", magic_enum::enum_name(GetType()), GetName(), bundle.GetName());
+
+    VerifyEncodingState();
+    META_CHECK_ARG_FALSE_DESCR(m_is_bundle, "command bundle '{}' can not be executed inside of other command bundle '{}'", bundle.GetName(), GetName());
+    META_CHECK_ARG_TRUE_DESCR(bundle.IsBundle(), "render command list '{}' is not a command bundle", bundle.GetName());
+    META_CHECK_ARG_EQUAL_DESCR(bundle.GetState(), State::Committed, "command bundle '{}' must be committed before execution", bundle.GetName());
+    META_CHECK_ARG_TRUE_DESCR(m_render_pass_ptr && std::addressof(m_render_pass_ptr->GetPattern()) == std::addressof(bundle.GetRenderPass().GetPattern()),
+                              "command bundle '{}' was encoded for render pattern which is not compatible with render pass of command list '{}'",
+                              bundle.GetName(), GetName());
+
+    RetainResource(static_cast<RenderCommandListBase&>(bundle));
+
+    // Native drawing state is undefined after bundle execution, so it has to be set again before the following draws
+    GetCommandState().program_bindings_ptr = nullptr;
+    m_drawing_state.render_state_ptr = nullptr;
+    m_drawing_state.vertex_buffer_set_ptr = nullptr;
+    m_drawing_state.index_buffer_ptr = nullptr;
+    m_drawing_state.primitive_type_opt.reset();
+    m_drawing_state.view_state_ptr = nullptr;
+    m_drawing_state.render_state_groups = RenderState::Groups::None;
+}
+
+void RenderCommandListBase::Execute(const CompletedCallback& completed_callback)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_FALSE_DESCR(m_is_bundle, "command bundle '{}' can not be executed on command queue, use ExecuteBundle of render command list instead", GetName());
+    CommandListBase::Execute(completed_callback);
+}
+
 void RenderCommandListBase::ResetCommandState()
 {
     META_FUNCTION_TASK();
@@ -270,9 +350,9 @@ void RenderCommandListBase::ResetCommandState()
     CommandListBase::ResetCommandState();
 
     m_drawing_state.render_pass_attachments_ptr.clear();
-    m_drawing_state.render_state_ptr.reset();
-    m_drawing_state.vertex_buffer_set_ptr.reset();
-    m_drawing_state.index_buffer_ptr.reset();
+    m_drawing_state.render_state_ptr = nullptr;
+    m_drawing_state.vertex_buffer_set_ptr = nullptr;
+    m_drawing_state.index_buffer_ptr = nullptr;
     m_drawing_state.primitive_type_opt.reset();
     m_drawing_state.view_state_ptr = nullptr;
     m_drawing_state.render_state_groups = RenderState::Groups::None;
@@ -291,6 +371,19 @@ void RenderCommandListBase::UpdateDrawingState(Primitive primitive_type)
     drawing_state.primitive_type_opt = primitive_type;
 }
 
+void RenderCommandListBase::ValidateDrawInputBuffers() const
+{
+    META_FUNCTION_TASK();
+    // Vertex buffers are required only by programs with input buffer layouts,
+    // while vertices of programs without input layouts are generated in shaders from vertex and instance identifiers
+    META_CHECK_ARG_NOT_NULL_DESCR(m_drawing_state.render_state_ptr, "render state must be set before draw call");
+    const size_t input_buffers_count = m_drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
+    META_CHECK_ARG_TRUE_DESCR(!input_buffers_count || m_drawing_state.vertex_buffer_set_ptr,
+                              "vertex buffers must be set when program has non empty input buffer layouts");
+    META_CHECK_ARG_TRUE_DESCR(!m_drawing_state.vertex_buffer_set_ptr || m_drawing_state.vertex_buffer_set_ptr->GetCount() == input_buffers_count,
+                              "vertex buffers count must be equal to the program input buffer layouts count");
+}
+
 void RenderCommandListBase::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count) const
 {
     META_FUNCTION_TASK();
@@ -311,6 +404,53 @@ void RenderCommandListBase::ValidateDrawVertexBuffers(uint32_t draw_start_vertex
     }
 }
 
+Data::Size RenderCommandListBase::GetDrawIndirectArgumentsStride(const Buffer& arguments_buffer, Data::Size arguments_size) noexcept
+{
+    META_FUNCTION_TASK();
+    const Data::Size buffer_stride_size = arguments_buffer.GetSettings().item_stride_size;
+    return buffer_stride_size ? buffer_stride_size : arguments_size;
+}
+
+void RenderCommandListBase::ValidateDrawIndirectBuffers(const Buffer& arguments_buffer, Data::Size arguments_stride, uint32_t draw_count, Data::Size arguments_offset,
+                                                        const Buffer* p_count_buffer, Data::Size count_offset) const
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    constexpr Data::Size argument_alignment = sizeof(uint32_t);
+
+    const Buffer::Settings& arguments_settings = arguments_buffer.GetSettings();
+    META_UNUSED(arguments_settings);
+    META_CHECK_ARG_NAME_DESCR("arguments_buffer", static_cast<bool>(arguments_settings.usage_mask & Resource::Usage::Indirect),
+                              "can not draw indirect with arguments from buffer '{}' which has no 'Indirect' usage", arguments_buffer.GetName());
+    META_CHECK_ARG_NOT_ZERO_DESCR(draw_count, "can not draw indirect with zero draws count");
+    META_CHECK_ARG_EQUAL_DESCR(arguments_offset % argument_alignment, 0U, "indirect arguments offset must be aligned to {} bytes", argument_alignment);
+
+    const Data::Size arguments_stride_size = GetDrawIndirectArgumentsStride(arguments_buffer, arguments_stride);
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(arguments_stride_size, arguments_stride, "indirect arguments buffer stride is less than the arguments structure size");
+    META_CHECK_ARG_EQUAL_DESCR(arguments_stride_size % argument_alignment, 0U, "indirect arguments buffer stride must be aligned to {} bytes", argument_alignment);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(arguments_offset + arguments_stride_size * (draw_count - 1U) + arguments_stride, arguments_settings.size,
+                                       "indirect arguments of {} draws at offset {} are out of bounds of buffer '{}'",
+                                       draw_count, arguments_offset, arguments_buffer.GetName());
+    if (!p_count_buffer)
+        return;
+
+    META_CHECK_ARG_NAME_DESCR("p_count_buffer", static_cast<bool>(p_count_buffer->GetSettings().usage_mask & Resource::Usage::Indirect),
+                              "can not draw indirect with draws count from buffer '{}' which has no 'Indirect' usage", p_count_buffer->GetName());
+    META_CHECK_ARG_EQUAL_DESCR(count_offset % argument_alignment, 0U, "indirect draws count offset must be aligned to {} bytes", argument_alignment);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(count_offset + sizeof(uint32_t), p_count_buffer->GetSettings().size,
+                                       "indirect draws count at offset {} is out of bounds of buffer '{}'", count_offset, p_count_buffer->GetName());
+}
+
+void RenderCommandListBase::RetainDrawIndirectBuffers(Buffer& arguments_buffer, Buffer* p_count_buffer)
+{
+    META_FUNCTION_TASK();
+    RetainResource(static_cast<BufferBase&>(arguments_buffer));
+    if (p_count_buffer)
+    {
+        RetainResource(static_cast<BufferBase&>(*p_count_buffer));
+    }
+}
+
 RenderPassBase& RenderCommandListBase::GetPass()
 {
     META_FUNCTION_TASK();
@@ -53,11 +53,11 @@ public:
         };
 
         Ptrs<TextureBase>    render_pass_attachments_ptr;
-        Ptr<RenderStateBase> render_state_ptr;
-        Ptr<BufferSetBase>   vertex_buffer_set_ptr;
-        Ptr<BufferBase>      index_buffer_ptr;
+        RenderStateBase*     render_state_ptr      = nullptr;
+        BufferSetBase*       vertex_buffer_set_ptr = nullptr;
+        BufferBase*          index_buffer_ptr      = nullptr;
         Opt<Primitive>       primitive_type_opt;
-        ViewStateBase*       view_state_ptr      = nullptr;
+        ViewStateBase*       view_state_ptr        = nullptr;
         RenderState::Groups  render_state_groups = RenderState::Groups::None;
         Changes              changes             = Changes::None;
     };
@@ -65,7 +65,7 @@ public:
     static Ptr<RenderCommandList> CreateForSynchronization(CommandQueue& cmd_queue);
 
     explicit RenderCommandListBase(CommandQueueBase& command_queue);
-    RenderCommandListBase(CommandQueueBase& command_queue, RenderPassBase& render_pass);
+    RenderCommandListBase(CommandQueueBase& command_queue, RenderPassBase& render_pass, bool is_bundle = false);
     explicit RenderCommandListBase(ParallelRenderCommandListBase& parallel_render_command_list);
     
     using CommandListBase::Reset;
@@ -74,6 +74,7 @@ public:
     bool IsValidationEnabled() const noexcept final             { return m_is_validation_enabled; }
     void SetValidationEnabled(bool is_validation_enabled) final { m_is_validation_enabled = is_validation_enabled; }
     RenderPass& GetRenderPass() const final;
+    bool IsBundle() const noexcept final                        { return m_is_bundle; }
     void Reset(DebugGroup* p_debug_group = nullptr) override;
     void ResetWithState(RenderState& render_state, DebugGroup* p_debug_group = nullptr) override;
     void ResetWithStateOnce(RenderState& render_state, DebugGroup* p_debug_group = nullptr) final;
@@ -85,6 +86,14 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive_type, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                             Buffer* p_count_buffer, Data::Size count_offset) override;
+    void DrawIndirect(Primitive primitive_type, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                      Buffer* p_count_buffer, Data::Size count_offset) override;
+    void ExecuteBundle(RenderCommandList& bundle) override;
+
+    // CommandListBase interface
+    void Execute(const CompletedCallback& completed_callback = {}) override;
 
     bool            HasPass() const noexcept    { return !!m_render_pass_ptr; }
     RenderPassBase* GetPassPtr() const noexcept { return m_render_pass_ptr.get(); }
@@ -98,11 +107,18 @@ protected:
     const DrawingState& GetDrawingState() const { return m_drawing_state; }
     bool                IsParallel() const      { return m_is_parallel; }
 
+    static Data::Size GetDrawIndirectArgumentsStride(const Buffer& arguments_buffer, Data::Size arguments_size) noexcept;
+
     inline void UpdateDrawingState(Primitive primitive_type);
+    void ValidateDrawInputBuffers() const;
     inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
+    void ValidateDrawIndirectBuffers(const Buffer& arguments_buffer, Data::Size arguments_stride, uint32_t draw_count, Data::Size arguments_offset,
+                                     const Buffer* p_count_buffer, Data::Size count_offset) const;
+    void RetainDrawIndirectBuffers(Buffer& arguments_buffer, Buffer* p_count_buffer);
 
 private:
     const bool                             m_is_parallel = false;
+    const bool                             m_is_bundle = false;
     const Ptr<RenderPassBase>              m_render_pass_ptr;
     DrawingState                           m_drawing_state;
     bool                                   m_is_validation_enabled = true;
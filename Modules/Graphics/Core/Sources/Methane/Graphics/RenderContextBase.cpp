@@ -29,9 +29,14 @@ Base implementation of the render context interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <limits>
+
 namespace Methane::Graphics
 {
 
+// Frames in flight fence is signalled once per presented frame, so its value is equal to the count of frames submitted to GPU
+static constexpr CommandKit::CommandListId g_frames_in_flight_fence_id = std::numeric_limits<CommandKit::CommandListId>::max() - 3;
+
 RenderContext::Settings& RenderContext::Settings::SetFrameSize(FrameSize&& new_frame_size) noexcept
 {
     META_FUNCTION_TASK();
@@ -102,6 +107,20 @@ RenderContext::Settings& RenderContext::Settings::SetUnsyncMaxFps(uint32_t new_u
     return *this;
 }
 
+RenderContext::Settings& RenderContext::Settings::SetMaxFramesInFlight(uint32_t new_max_frames_in_flight) noexcept
+{
+    META_FUNCTION_TASK();
+    max_frames_in_flight = new_max_frames_in_flight;
+    return *this;
+}
+
+RenderContext::Settings& RenderContext::Settings::SetLowLatencyEnabled(bool new_low_latency_enabled) noexcept
+{
+    META_FUNCTION_TASK();
+    low_latency_enabled = new_low_latency_enabled;
+    return *this;
+}
+
 RenderContextBase::RenderContextBase(DeviceBase& device, UniquePtr<DescriptorManager>&& descriptor_manager_ptr,
                                      tf::Executor& parallel_executor, const Settings& settings)
     : ContextBase(device, std::move(descriptor_manager_ptr), parallel_executor, Type::Render)
@@ -144,9 +163,24 @@ void RenderContextBase::WaitForGpuFramePresented()
 
     OnGpuWaitStart(WaitFor::FramePresented);
     GetCurrentFrameFence().WaitOnCpu();
+    WaitForGpuFramesInFlight();
     OnGpuWaitComplete(WaitFor::FramePresented);
 }
 
+void RenderContextBase::WaitForGpuFramesInFlight()
+{
+    META_FUNCTION_TASK();
+    // Wait until GPU completes enough frames to let one more frame get in flight
+    // without exceeding the limit, which may be lower than frame buffers count
+    Fence& frames_in_flight_fence = GetFramesInFlightFence();
+    const uint64_t submitted_frames_count = frames_in_flight_fence.GetValue();
+    const uint32_t max_frames_in_flight   = GetMaxFramesInFlight();
+    if (submitted_frames_count < max_frames_in_flight)
+        return;
+
+    frames_in_flight_fence.WaitOnCpu(submitted_frames_count - max_frames_in_flight + 1);
+}
+
 void RenderContextBase::Resize(const FrameSize& frame_size)
 {
     META_FUNCTION_TASK();
@@ -171,12 +205,44 @@ void RenderContextBase::OnCpuPresentComplete(bool signal_frame_fence)
     {
         // Schedule a signal command in the queue for a currently finished frame
         GetCurrentFrameFence().Signal();
+        GetFramesInFlightFence().Signal();
     }
 
     META_CPU_FRAME_DELIMITER(m_frame_buffer_index, m_frame_index);
     META_LOG("Render context '{}' PRESENT COMPLETE frame {}", GetName(), m_frame_buffer_index);
 
+    // Every frame starts new epoch of objects retention by command lists
+    // and deletes native objects released in completed frames within deferred deletion budget
+    AdvanceEpochAndDeleteCompletedObjects();
+
     m_fps_counter.OnCpuFramePresented();
+
+    if (m_settings.low_latency_enabled && signal_frame_fence)
+    {
+        // Wait for the next frame slot right after present instead of waiting before the next frame rendering,
+        // so that the next frame input is sampled after the wait and is encoded with the minimal delay
+        META_SCOPE_TIMER("RenderContext::WaitForGpu::FramesInFlight");
+        WaitForGpuFramesInFlight();
+    }
+
+    m_fps_counter.OnCpuFrameInputSampling();
+}
+
+uint32_t RenderContextBase::GetMaxFramesInFlight() const noexcept
+{
+    META_FUNCTION_TASK();
+    // Frames in flight count can only be lowered below frame buffers count and can not exceed it, because frame buffer is not released
+    // by swap-chain until its frame is completed and frame resources of applications are indexed by frame buffer index
+    return m_settings.max_frames_in_flight
+         ? std::min(m_settings.max_frames_in_flight, m_settings.frame_buffers_count)
+         : m_settings.frame_buffers_count;
+}
+
+uint32_t RenderContextBase::GetFramesInFlightCount() const
+{
+    META_FUNCTION_TASK();
+    const Fence& frames_in_flight_fence = GetFramesInFlightFence();
+    return static_cast<uint32_t>(frames_in_flight_fence.GetValue() - frames_in_flight_fence.GetCompletedValue());
 }
 
 Fence& RenderContextBase::GetCurrentFrameFence() const
@@ -185,6 +251,12 @@ Fence& RenderContextBase::GetCurrentFrameFence() const
     return GetRenderCommandKit().GetFence(m_frame_buffer_index + 1);
 }
 
+Fence& RenderContextBase::GetFramesInFlightFence() const
+{
+    META_FUNCTION_TASK();
+    return GetRenderCommandKit().GetFence(g_frames_in_flight_fence_id);
+}
+
 Fence& RenderContextBase::GetRenderFence() const
 {
     META_FUNCTION_TASK();
@@ -50,7 +50,9 @@ public:
     const Settings&   GetSettings() const noexcept final            { return m_settings; }
     uint32_t          GetFrameBufferIndex() const noexcept final    { return m_frame_buffer_index;  }
     uint32_t          GetFrameIndex() const noexcept final          { return m_frame_index; }
+    uint32_t          GetMaxFramesInFlight() const noexcept final;
     const FpsCounter& GetFpsCounter() const noexcept final          { return m_fps_counter; }
+    FpsCounter&       GetFpsCounter() noexcept final                { return m_fps_counter; }
     bool              SetVSyncEnabled(bool vsync_enabled) override;
     bool              SetFrameBuffersCount(uint32_t frame_buffers_count) override;
     bool              SetFullScreen(bool is_full_screen) override;
@@ -61,6 +63,9 @@ public:
     // Frame buffer is in use while there are executing rendering commands contributing to this frame buffer
     bool IsFrameBufferInUse() const noexcept { return m_is_frame_buffer_in_use; }
 
+    // Frames presented on CPU which are not completed on GPU yet
+    uint32_t GetFramesInFlightCount() const;
+
 protected:
     void ResetWithSettings(const Settings& settings);
     void OnCpuPresentComplete(bool signal_frame_fence = true);
@@ -71,6 +76,7 @@ protected:
     void InvalidateFrameBuffersCount(uint32_t frame_buffers_count);
 
     Fence& GetCurrentFrameFence() const;
+    Fence& GetFramesInFlightFence() const;
     Fence& GetRenderFence() const;
 
     // ContextBase overrides
@@ -84,6 +90,7 @@ protected:
 private:
     void WaitForGpuRenderComplete();
     void WaitForGpuFramePresented();
+    void WaitForGpuFramesInFlight();
 
     Settings            m_settings;
     uint32_t            m_frame_buffer_index = 0U;
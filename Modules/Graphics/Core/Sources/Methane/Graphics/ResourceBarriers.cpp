@@ -114,10 +114,17 @@ bool ResourceBarrier::OwnerChange::operator!=(const OwnerChange& other) const no
 }
 
 ResourceBarrier::ResourceBarrier(Resource& resource, const StateChange& state_change)
-    : m_id(Type::StateTransition, resource)
+    : ResourceBarrier(Type::StateTransition, resource, state_change)
+{
+    META_FUNCTION_TASK();
+}
+
+ResourceBarrier::ResourceBarrier(Type type, Resource& resource, const StateChange& state_change)
+    : m_id(type, resource)
     , m_change(state_change)
 {
     META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EQUAL_DESCR(type, Type::OwnerTransition, "owner transition barrier can not be created with state change");
 }
 
 ResourceBarrier::ResourceBarrier(Resource& resource, const OwnerChange& owner_change)
@@ -144,8 +151,9 @@ bool ResourceBarrier::operator<(const ResourceBarrier& other) const noexcept
     META_FUNCTION_TASK();
     switch(m_id.GetType())
     {
-    case Type::StateTransition: return std::tie(m_id, m_change.state) < std::tie(other.m_id, other.m_change.state);
-    case Type::OwnerTransition: return std::tie(m_id, m_change.owner) < std::tie(other.m_id, other.m_change.owner);
+    case Type::StateTransition:
+    case Type::AliasingTransition: return std::tie(m_id, m_change.state) < std::tie(other.m_id, other.m_change.state);
+    case Type::OwnerTransition:    return std::tie(m_id, m_change.owner) < std::tie(other.m_id, other.m_change.owner);
     }
     return false;
 }
@@ -155,8 +163,9 @@ bool ResourceBarrier::operator==(const ResourceBarrier& other) const noexcept
     META_FUNCTION_TASK();
     switch(m_id.GetType())
     {
-    case Type::StateTransition: return std::tie(m_id, m_change.state) == std::tie(other.m_id, other.m_change.state);
-    case Type::OwnerTransition: return std::tie(m_id, m_change.owner) == std::tie(other.m_id, other.m_change.owner);
+    case Type::StateTransition:
+    case Type::AliasingTransition: return std::tie(m_id, m_change.state) == std::tie(other.m_id, other.m_change.state);
+    case Type::OwnerTransition:    return std::tie(m_id, m_change.owner) == std::tie(other.m_id, other.m_change.owner);
     }
     return false;
 }
@@ -170,7 +179,7 @@ bool ResourceBarrier::operator!=(const ResourceBarrier& other) const noexcept
 bool ResourceBarrier::operator==(const StateChange& other_state_change) const
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_EQUAL(m_id.GetType(), Type::StateTransition);
+    META_CHECK_ARG_NOT_EQUAL(m_id.GetType(), Type::OwnerTransition);
     return m_change.state == other_state_change;
 }
 
@@ -202,6 +211,12 @@ ResourceBarrier::operator std::string() const noexcept
                            magic_enum::enum_name(m_change.state.GetStateBefore()),
                            magic_enum::enum_name(m_change.state.GetStateAfter()));
 
+    case Type::AliasingTransition:
+        return fmt::format("Resource '{}' aliasing transition barrier after {} state of aliased memory to {} state",
+                           m_id.GetResource().GetName(),
+                           magic_enum::enum_name(m_change.state.GetStateBefore()),
+                           magic_enum::enum_name(m_change.state.GetStateAfter()));
+
     case Type::OwnerTransition:
         return fmt::format("Resource '{}' ownership transition barrier from '{}' to '{}' command queue family",
                            m_id.GetResource().GetName(),
@@ -214,7 +229,7 @@ ResourceBarrier::operator std::string() const noexcept
 const ResourceBarrier::StateChange& ResourceBarrier::GetStateChange() const
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_EQUAL(m_id.GetType(), ResourceBarrier::Type::StateTransition);
+    META_CHECK_ARG_NOT_EQUAL(m_id.GetType(), ResourceBarrier::Type::OwnerTransition);
     return m_change.state;
 }
 
@@ -237,6 +252,11 @@ void ResourceBarrier::ApplyTransition() const
         m_id.GetResource().SetState(m_change.state.GetStateAfter());
         break;
 
+    case Type::AliasingTransition:
+        // Resource content is discarded, so its current state is not checked, unlike in state transition
+        m_id.GetResource().SetState(m_change.state.GetStateAfter());
+        break;
+
     case Type::OwnerTransition:
         META_CHECK_ARG_TRUE_DESCR(m_id.GetResource().GetOwnerQueueFamily().has_value(),
                                   "can not transition resource '{}' ownership which has no existing owner queue family",
@@ -310,6 +330,12 @@ bool ResourceBarriers::HasOwnerTransition(Resource& resource, uint32_t queue_fam
            barrier_it->second == ResourceBarrier(resource, queue_family_before, queue_family_after);
 }
 
+bool ResourceBarriers::HasUnorderedAccessBarrier(Resource& resource)
+{
+    META_FUNCTION_TASK();
+    return HasStateTransition(resource, ResourceState::UnorderedAccess, ResourceState::UnorderedAccess);
+}
+
 ResourceBarriers::AddResult ResourceBarriers::AddStateTransition(Resource& resource, ResourceState before, ResourceState after)
 {
     return Add(ResourceBarrier::Id(ResourceBarrier::Type::StateTransition, resource), ResourceBarrier(resource, before, after));
@@ -320,6 +346,17 @@ ResourceBarriers::AddResult ResourceBarriers::AddOwnerTransition(Resource& resou
     return Add(ResourceBarrier::Id(ResourceBarrier::Type::OwnerTransition, resource), ResourceBarrier(resource, queue_family_before, queue_family_after));
 }
 
+ResourceBarriers::AddResult ResourceBarriers::AddUnorderedAccessBarrier(Resource& resource)
+{
+    return AddStateTransition(resource, ResourceState::UnorderedAccess, ResourceState::UnorderedAccess);
+}
+
+ResourceBarriers::AddResult ResourceBarriers::AddAliasingTransition(Resource& resource, ResourceState alias_state_before, ResourceState after)
+{
+    return Add(ResourceBarrier::Id(ResourceBarrier::Type::AliasingTransition, resource),
+               ResourceBarrier(ResourceBarrier::Type::AliasingTransition, resource, ResourceBarrier::StateChange(alias_state_before, after)));
+}
+
 bool ResourceBarriers::Remove(ResourceBarrier::Type type, Resource& resource)
 {
     return Remove(ResourceBarrier::Id(type, resource));
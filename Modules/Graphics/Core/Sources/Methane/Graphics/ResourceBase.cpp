@@ -67,11 +67,11 @@ void ResourceBase::SetData(const SubResources& sub_resources, CommandQueue&)
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_EMPTY_DESCR(sub_resources, "can not set buffer data from empty sub-resources");
 
-    Data::Size sub_resources_data_size = 0U;
+    bool has_data_ranges = false;
     for(const SubResource& sub_resource : sub_resources)
     {
         META_CHECK_ARG_NAME_DESCR("sub_resource", !sub_resource.IsEmptyOrNull(), "can not set empty subresource data to buffer");
-        sub_resources_data_size += sub_resource.GetDataSize();
+        has_data_ranges |= sub_resource.HasDataRange();
 
         if (m_sub_resource_count_constant)
         {
@@ -83,11 +83,14 @@ void ResourceBase::SetData(const SubResources& sub_resources, CommandQueue&)
         }
     }
 
+    const Data::Size sub_resources_data_extent = GetSubResourcesDataExtent(sub_resources);
     const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
     META_UNUSED(reserved_data_size);
 
-    META_CHECK_ARG_LESS_DESCR(sub_resources_data_size, reserved_data_size + 1, "can not set more data than allocated buffer size");
-    m_initialized_data_size = sub_resources_data_size;
+    META_CHECK_ARG_LESS_DESCR(sub_resources_data_extent, reserved_data_size + 1, "can not set more data than allocated buffer size");
+
+    // Partial updates of the data ranges do not shrink the previously initialized data size
+    m_initialized_data_size = has_data_ranges ? std::max(m_initialized_data_size, sub_resources_data_extent) : sub_resources_data_extent;
 
     if (!m_sub_resource_count_constant)
     {
@@ -95,11 +98,27 @@ void ResourceBase::SetData(const SubResources& sub_resources, CommandQueue&)
     }
 }
 
+Data::Size ResourceBase::GetSubResourcesDataExtent(const SubResources& sub_resources) const
+{
+    META_FUNCTION_TASK();
+    Data::Size sub_resources_data_size = 0U;
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        sub_resources_data_size += sub_resource.GetDataSize();
+    }
+    return sub_resources_data_size;
+}
+
 Resource::SubResource ResourceBase::GetData(const SubResource::Index&, const std::optional<BytesRange>&)
 {
     META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(Resource::SubResource(), "reading data is not allowed for this type of resource");
 }
 
+Resource::ReadDataFuture ResourceBase::ReadDataAsync(CommandQueue&, const SubResource::Index&, const std::optional<BytesRange>&)
+{
+    META_FUNCTION_NOT_IMPLEMENTED_RETURN_DESCR(Resource::ReadDataFuture(), "asynchronous reading data is not supported for this type of resource");
+}
+
 const Context& ResourceBase::GetContext() const noexcept
 {
     META_FUNCTION_TASK();
@@ -58,6 +58,8 @@ public:
     [[nodiscard]] Data::Size                GetSubResourceDataSize(const SubResource::Index& subresource_index = SubResource::Index()) const final;
     [[nodiscard]] SubResource               GetData(const SubResource::Index& sub_resource_index = SubResource::Index(),
                                                     const std::optional<BytesRange>& data_range = {}) override;
+    [[nodiscard]] ReadDataFuture            ReadDataAsync(CommandQueue& cmd_queue, const SubResource::Index& sub_resource_index = SubResource::Index(),
+                                                          const std::optional<BytesRange>& data_range = {}) override;
     bool SetState(State state, Ptr<Barriers>& out_barriers) final;
     bool SetState(State state) final;
     bool SetOwnerQueueFamily(uint32_t family_index) final;
@@ -77,6 +79,9 @@ protected:
 
     [[nodiscard]] virtual Data::Size CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const;
 
+    // Size of resource data written by the given sub-resources, which are stored one after another by default
+    [[nodiscard]] virtual Data::Size GetSubResourcesDataExtent(const SubResources& sub_resources) const;
+
 private:
     using SubResourceSizes = std::vector<Data::Size>;
     void FillSubresourceSizes();
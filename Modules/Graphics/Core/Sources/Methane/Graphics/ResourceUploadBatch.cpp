@@ -0,0 +1,130 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ResourceUploadBatch.cpp
+Batch of resource data updates uploaded to GPU with a single command list submission.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ResourceUploadBatch.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics
+{
+
+// Sub-resource update is superseded by the later update of the same sub-resource,
+// which covers its data range entirely or has no data range, i.e. updates the whole sub-resource
+static bool IsSubResourceSupersededBy(const SubResource& sub_resource, const SubResource& later_sub_resource)
+{
+    META_FUNCTION_TASK();
+    if (sub_resource.GetIndex() != later_sub_resource.GetIndex())
+        return false;
+
+    if (!later_sub_resource.HasDataRange())
+        return true;
+
+    return sub_resource.HasDataRange() && later_sub_resource.GetDataRange().Contains(sub_resource.GetDataRange());
+}
+
+static void MergeSubResources(SubResources& merged_sub_resources, SubResources&& sub_resources)
+{
+    META_FUNCTION_TASK();
+    for(SubResource& sub_resource : sub_resources)
+    {
+        // Only the last update of the sub-resource data range is kept, so that repeated updates are not summed up in SetData.
+        // Sub-resources are not assignable, so the superseded updates are removed by moving the rest to the new container
+        const auto is_superseded = [&sub_resource](const SubResource& merged_sub_resource)
+        { return IsSubResourceSupersededBy(merged_sub_resource, sub_resource); };
+
+        if (std::any_of(merged_sub_resources.begin(), merged_sub_resources.end(), is_superseded))
+        {
+            SubResources kept_sub_resources;
+            kept_sub_resources.reserve(merged_sub_resources.size());
+            for(SubResource& merged_sub_resource : merged_sub_resources)
+            {
+                if (!is_superseded(merged_sub_resource))
+                    kept_sub_resources.emplace_back(std::move(merged_sub_resource));
+            }
+            merged_sub_resources.swap(kept_sub_resources);
+        }
+        merged_sub_resources.emplace_back(std::move(sub_resource));
+    }
+}
+
+void ResourceUploadBatch::Add(Resource& resource, SubResources sub_resources)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(sub_resources, "can not add empty sub-resources upload of resource '{}' to the batch", resource.GetName());
+
+    Ptr<Resource> resource_ptr = std::dynamic_pointer_cast<Resource>(resource.GetPtr());
+    META_CHECK_ARG_NOT_NULL_DESCR(resource_ptr, "resource '{}' is not managed by shared pointer", resource.GetName());
+
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        m_data_size += sub_resource.GetDataSize();
+    }
+
+    m_uploads.push_back({ std::move(resource_ptr), std::move(sub_resources) });
+}
+
+void ResourceUploadBatch::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    m_uploads.clear();
+    m_data_size = 0U;
+}
+
+const ResourceUploadBatch::ResourceUploads& ResourceUploadBatch::SortByDestination()
+{
+    META_FUNCTION_TASK();
+    if (m_uploads.size() < 2)
+        return m_uploads;
+
+    // Stable sort keeps the order of uploads to the same resource, so that the latest data update wins
+    std::stable_sort(m_uploads.begin(), m_uploads.end(),
+        [](const ResourceUpload& left, const ResourceUpload& right)
+        {
+            const Resource::Type left_type  = left.resource_ptr->GetResourceType();
+            const Resource::Type right_type = right.resource_ptr->GetResourceType();
+            return left_type == right_type
+                 ? left.resource_ptr.get() < right.resource_ptr.get()
+                 : left_type < right_type;
+        }
+    );
+
+    ResourceUploads merged_uploads;
+    merged_uploads.reserve(m_uploads.size());
+    for(ResourceUpload& upload : m_uploads)
+    {
+        if (!merged_uploads.empty() && merged_uploads.back().resource_ptr == upload.resource_ptr)
+        {
+            MergeSubResources(merged_uploads.back().sub_resources, std::move(upload.sub_resources));
+            continue;
+        }
+        merged_uploads.emplace_back(std::move(upload));
+    }
+
+    m_uploads = std::move(merged_uploads);
+    return m_uploads;
+}
+
+} // namespace Methane::Graphics
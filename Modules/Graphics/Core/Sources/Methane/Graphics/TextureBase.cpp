@@ -28,6 +28,9 @@ Base implementation of the texture interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <tuple>
+
 namespace Methane::Graphics
 {
 
@@ -109,6 +112,36 @@ Texture::Settings Texture::Settings::DepthStencilBuffer(const Dimensions& dimens
     return settings;
 }
 
+Data::Size Texture::Settings::GetEstimatedMemorySize() const
+{
+    META_FUNCTION_TASK();
+    const Data::Size pixel_size  = GetPixelSize(pixel_format);
+    const bool       is_volume   = dimension_type == DimensionType::Tex3D;
+    Data::Size       mip_width   = dimensions.GetWidth();
+    Data::Size       mip_height  = dimensions.GetHeight();
+    Data::Size       mip_depth   = dimensions.GetDepth();
+    Data::Size       memory_size = 0U;
+
+    while(true)
+    {
+        memory_size += pixel_size * mip_width * mip_height * mip_depth;
+        if (!mipmapped || (mip_width == 1U && mip_height == 1U && (!is_volume || mip_depth == 1U)))
+            break;
+
+        mip_width  = std::max(mip_width  / 2U, 1U);
+        mip_height = std::max(mip_height / 2U, 1U);
+        mip_depth  = is_volume ? std::max(mip_depth / 2U, 1U) : mip_depth;
+    }
+
+    return memory_size * array_length;
+}
+
+bool Texture::Settings::operator==(const Settings& other) const noexcept
+{
+    return std::tie(type, dimension_type, usage_mask, pixel_format, dimensions, array_length, mipmapped) ==
+           std::tie(other.type, other.dimension_type, other.usage_mask, other.pixel_format, other.dimensions, other.array_length, other.mipmapped);
+}
+
 TextureBase::TextureBase(const ContextBase& context, const Settings& settings,
                          State initial_state, Opt<State> auto_transition_source_state_opt)
     : ResourceBase(context, Resource::Type::Texture, settings.usage_mask, initial_state, auto_transition_source_state_opt)
@@ -40,6 +40,8 @@ public:
 
     // Texture interface
     const Settings& GetSettings() const override { return m_settings; }
+    Data::Size      GetMemorySize() const override { return m_settings.GetEstimatedMemorySize(); }
+    bool            IsMemoryAliased() const noexcept override { return false; }
     Data::Size      GetDataSize(Data::MemoryState size_type = Data::MemoryState::Reserved) const noexcept override;
 
     static Data::Size GetRequiredMipLevelsCount(const Dimensions& dimensions);
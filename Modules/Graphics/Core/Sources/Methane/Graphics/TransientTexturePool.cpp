@@ -0,0 +1,264 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/TransientTexturePool.cpp
+Pool of transient render target textures keyed by texture settings, which are acquired
+for spans of passes within frame and alias memory of non-overlapping users.
+
+******************************************************************************/
+
+#include <Methane/Graphics/TransientTexturePool.h>
+#include <Methane/Graphics/RenderContext.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+namespace Methane::Graphics
+{
+
+bool TransientTexturePool::Allocation::operator==(const Allocation& other) const noexcept
+{
+    return std::tie(memory_block_index, texture_index) == std::tie(other.memory_block_index, other.texture_index);
+}
+
+bool TransientTexturePool::MemoryBlock::IsFreeInPassSpan(const PassSpan& pass_span) const noexcept
+{
+    return std::none_of(frame_pass_spans.begin(), frame_pass_spans.end(),
+                        [&pass_span](const PassSpan& used_span)
+                        {
+                            return used_span.first_pass_index <= pass_span.last_pass_index &&
+                                   pass_span.first_pass_index <= used_span.last_pass_index;
+                        });
+}
+
+TransientTexturePool::TransientTexturePool()
+    : TransientTexturePool(Settings{})
+{
+}
+
+TransientTexturePool::TransientTexturePool(const Settings& settings)
+    : m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.release_idle_frames_count, "transient textures should be kept for at least one idle frame");
+}
+
+void TransientTexturePool::BeginFrame()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_FALSE_DESCR(m_is_frame_begun, "transient texture pool frame was begun already and was not ended");
+    for(MemoryBlock& memory_block : m_memory_blocks)
+    {
+        memory_block.frame_pass_spans.clear();
+    }
+    m_frame_acquired_memory_size = 0U;
+    m_is_frame_begun = true;
+}
+
+TransientTexturePool::Allocation TransientTexturePool::Acquire(const Texture::Settings& texture_settings,
+                                                               PassIndex first_pass_index, PassIndex last_pass_index)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(m_is_frame_begun, "transient textures can be acquired only between frame begin and end");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(first_pass_index, last_pass_index, "invalid span of passes");
+    META_CHECK_ARG_NOT_EQUAL_DESCR(texture_settings.type, Texture::Type::FrameBuffer, "frame buffer textures can not be transient");
+
+    const PassSpan   pass_span{ first_pass_index, last_pass_index };
+    const Data::Size memory_size = texture_settings.GetEstimatedMemorySize();
+    m_frame_acquired_memory_size += memory_size;
+
+    // Texture with equal settings is reused from the memory block which is free in the span of passes
+    for(uint32_t block_index = 0U; block_index < m_memory_blocks.size(); ++block_index)
+    {
+        const MemoryBlock& memory_block = m_memory_blocks[block_index];
+        if (!memory_block.IsFreeInPassSpan(pass_span))
+            continue;
+
+        const auto texture_it = std::find_if(memory_block.textures.begin(), memory_block.textures.end(),
+                                             [&texture_settings](const PooledTexture& texture)
+                                             { return texture.settings == texture_settings; });
+        if (texture_it != memory_block.textures.end())
+            return AcquireInMemoryBlock(block_index, static_cast<uint32_t>(std::distance(memory_block.textures.begin(), texture_it)), pass_span);
+    }
+
+    // New texture aliases memory of the smallest free memory block which fits its memory size
+    if (m_settings.is_memory_aliasing_enabled)
+    {
+        Opt<uint32_t> best_block_index_opt;
+        for(uint32_t block_index = 0U; block_index < m_memory_blocks.size(); ++block_index)
+        {
+            const MemoryBlock& memory_block = m_memory_blocks[block_index];
+            if (memory_block.memory_size < memory_size || !memory_block.IsFreeInPassSpan(pass_span))
+                continue;
+
+            if (!best_block_index_opt || memory_block.memory_size < m_memory_blocks[*best_block_index_opt].memory_size)
+                best_block_index_opt = block_index;
+        }
+
+        if (best_block_index_opt)
+        {
+            std::vector<PooledTexture>& textures = m_memory_blocks[*best_block_index_opt].textures;
+            textures.push_back({ texture_settings, nullptr, m_frame_index });
+            return AcquireInMemoryBlock(*best_block_index_opt, static_cast<uint32_t>(textures.size() - 1), pass_span);
+        }
+    }
+
+    // New memory block is owned by the first texture
+    m_memory_blocks.push_back({ memory_size, { { texture_settings, nullptr, m_frame_index } }, { }, m_frame_index });
+    m_peak_memory_size = std::max(m_peak_memory_size, GetMemorySize());
+    return AcquireInMemoryBlock(static_cast<uint32_t>(m_memory_blocks.size() - 1), 0U, pass_span);
+}
+
+TransientTexturePool::Allocation TransientTexturePool::AcquireInMemoryBlock(uint32_t memory_block_index, uint32_t texture_index,
+                                                                            const PassSpan& pass_span)
+{
+    META_FUNCTION_TASK();
+    MemoryBlock& memory_block = m_memory_blocks[memory_block_index];
+    memory_block.frame_pass_spans.push_back(pass_span);
+    memory_block.last_acquired_frame_index = m_frame_index;
+    memory_block.textures[texture_index].last_acquired_frame_index = m_frame_index;
+    return Allocation{ memory_block_index, texture_index };
+}
+
+void TransientTexturePool::EndFrame()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(m_is_frame_begun, "transient texture pool frame was not begun");
+
+    // Memory blocks which were not acquired during idle frames are released with all their textures,
+    // while in the used memory blocks only idle aliasing textures are released, since the first texture owns the memory
+    const auto is_idle = [this](uint64_t last_acquired_frame_index)
+    { return m_frame_index - last_acquired_frame_index >= m_settings.release_idle_frames_count; };
+
+    m_memory_blocks.erase(std::remove_if(m_memory_blocks.begin(), m_memory_blocks.end(),
+                                         [&is_idle](const MemoryBlock& memory_block)
+                                         { return is_idle(memory_block.last_acquired_frame_index); }),
+                          m_memory_blocks.end());
+
+    for(MemoryBlock& memory_block : m_memory_blocks)
+    {
+        memory_block.textures.erase(std::remove_if(std::next(memory_block.textures.begin()), memory_block.textures.end(),
+                                                   [&is_idle](const PooledTexture& texture)
+                                                   { return is_idle(texture.last_acquired_frame_index); }),
+                                    memory_block.textures.end());
+    }
+
+    m_frame_index++;
+    m_is_frame_begun = false;
+}
+
+void TransientTexturePool::AllocateTextures(const RenderContext& context)
+{
+    META_FUNCTION_TASK();
+    for(uint32_t block_index = 0U; block_index < m_memory_blocks.size(); ++block_index)
+    {
+        MemoryBlock& memory_block = m_memory_blocks[block_index];
+        std::vector<PooledTexture>& textures = memory_block.textures;
+        for(uint32_t texture_index = 0U; texture_index < textures.size(); ++texture_index)
+        {
+            PooledTexture& texture = textures[texture_index];
+            if (texture.texture_ptr)
+                continue;
+
+            texture.texture_ptr = texture_index
+                                ? Texture::CreateAliasedRenderTarget(context, texture.settings, textures.front().texture_ptr)
+                                : Texture::CreateRenderTarget(context, texture.settings);
+            texture.texture_ptr->SetName(fmt::format("Transient Texture {}.{}", block_index, texture_index));
+
+            // Memory block size is estimated from texture settings until the owner texture reports its actual memory requirements
+            if (!texture_index)
+                memory_block.memory_size = texture.texture_ptr->GetMemorySize();
+            else if (!texture.texture_ptr->IsMemoryAliased())
+                META_LOG("WARNING: transient texture {}.{} was created with its own memory of {} bytes, since it can not alias memory block of {} bytes",
+                         block_index, texture_index, texture.texture_ptr->GetMemorySize(), memory_block.memory_size);
+        }
+    }
+    m_peak_memory_size = std::max(m_peak_memory_size, GetMemorySize());
+}
+
+const Ptr<Texture>& TransientTexturePool::GetTexturePtr(const Allocation& allocation) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(allocation.memory_block_index, m_memory_blocks.size());
+    const std::vector<PooledTexture>& textures = m_memory_blocks[allocation.memory_block_index].textures;
+    META_CHECK_ARG_LESS(allocation.texture_index, textures.size());
+    const Ptr<Texture>& texture_ptr = textures[allocation.texture_index].texture_ptr;
+    META_CHECK_ARG_NOT_NULL_DESCR(texture_ptr, "transient textures of the pool were not allocated");
+    return texture_ptr;
+}
+
+bool TransientTexturePool::IsMemoryShared(const Allocation& allocation) const
+{
+    META_FUNCTION_TASK();
+    return !allocation.texture_index || GetTexturePtr(allocation)->IsMemoryAliased();
+}
+
+void TransientTexturePool::Release() noexcept
+{
+    META_FUNCTION_TASK();
+    m_memory_blocks.clear();
+    m_is_frame_begun = false;
+    m_frame_acquired_memory_size = 0U;
+}
+
+size_t TransientTexturePool::GetTexturesCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(m_memory_blocks.begin(), m_memory_blocks.end(), size_t(0U),
+                           [](size_t textures_count, const MemoryBlock& memory_block)
+                           { return textures_count + memory_block.textures.size(); });
+}
+
+size_t TransientTexturePool::GetAliasedTexturesCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(m_memory_blocks.begin(), m_memory_blocks.end(), size_t(0U),
+                           [](size_t textures_count, const MemoryBlock& memory_block)
+                           {
+                               // Textures which are not allocated yet are going to alias memory of the block
+                               return textures_count + static_cast<size_t>(std::count_if(std::next(memory_block.textures.begin()), memory_block.textures.end(),
+                                                                                         [](const PooledTexture& texture)
+                                                                                         { return !texture.texture_ptr || texture.texture_ptr->IsMemoryAliased(); }));
+                           });
+}
+
+Data::Size TransientTexturePool::GetMemorySize() const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(m_memory_blocks.begin(), m_memory_blocks.end(), Data::Size(0U),
+                           [](Data::Size memory_size, const MemoryBlock& memory_block)
+                           {
+                               // Textures which could not alias memory of the block own memory in addition to the block
+                               return std::accumulate(std::next(memory_block.textures.begin()), memory_block.textures.end(),
+                                                      memory_size + memory_block.memory_size,
+                                                      [](Data::Size textures_memory_size, const PooledTexture& texture)
+                                                      {
+                                                          return texture.texture_ptr && !texture.texture_ptr->IsMemoryAliased()
+                                                               ? textures_memory_size + texture.texture_ptr->GetMemorySize()
+                                                               : textures_memory_size;
+                                                      });
+                           });
+}
+
+} // namespace Methane::Graphics
@@ -26,11 +26,14 @@ Vulkan implementation of the buffer interface.
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/ContextBase.h>
+#include <Methane/Graphics/CommandQueueTrackingBase.h>
 #include <Methane/Graphics/BufferFactory.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <magic_enum.hpp>
 #include <iterator>
+#include <algorithm>
+#include <limits>
 
 namespace Methane::Graphics
 {
@@ -49,37 +52,97 @@ static std::vector<vk::Buffer> GetVulkanBuffers(const Refs<Buffer>& buffer_refs)
     return vk_buffers;
 }
 
-static vk::BufferUsageFlags GetVulkanBufferUsageFlags(Buffer::Type buffer_type, Buffer::StorageMode storage_mode)
+static vk::BufferUsageFlags GetVulkanBufferUsageFlags(const Buffer::Settings& buffer_settings)
 {
     META_FUNCTION_TASK();
     vk::BufferUsageFlags vk_usage_flags;
-    switch(buffer_type)
+    switch(buffer_settings.type)
     {
     case Buffer::Type::Storage:  vk_usage_flags |= vk::BufferUsageFlagBits::eStorageBuffer; break;
     case Buffer::Type::Constant: vk_usage_flags |= vk::BufferUsageFlagBits::eUniformBuffer; break;
     case Buffer::Type::Index:    vk_usage_flags |= vk::BufferUsageFlagBits::eIndexBuffer; break;
     case Buffer::Type::Vertex:   vk_usage_flags |= vk::BufferUsageFlagBits::eVertexBuffer; break;
-        // Buffer::Type::ReadBack - unsupported
-    default: META_UNEXPECTED_ARG_DESCR(buffer_type, "Unsupported buffer type");
+    case Buffer::Type::ReadBack: return vk::BufferUsageFlagBits::eTransferDst;
+    default: META_UNEXPECTED_ARG_DESCR(buffer_settings.type, "Unsupported buffer type");
     }
 
-    if (storage_mode == Buffer::StorageMode::Private)
+    using namespace magic_enum::bitwise_operators;
+    if (static_cast<bool>(buffer_settings.usage_mask & Resource::Usage::Indirect))
+        vk_usage_flags |= vk::BufferUsageFlagBits::eIndirectBuffer;
+
+    // Buffers with read-back usage are copied to the read-back buffers to read their data on CPU
+    if (static_cast<bool>(buffer_settings.usage_mask & Resource::Usage::ReadBack))
+        vk_usage_flags |= vk::BufferUsageFlagBits::eTransferSrc;
+
+    if (buffer_settings.storage_mode == Buffer::StorageMode::Private)
         vk_usage_flags |= vk::BufferUsageFlagBits::eTransferDst;
 
     return vk_usage_flags;
 }
 
-static Resource::State GetTargetResourceStateByBufferType(Buffer::Type buffer_type)
+static vk::MemoryPropertyFlags GetHostVisibleMemoryPropertyFlags(const DeviceVK& device, const vk::MemoryRequirements& vk_memory_requirements)
+{
+    META_FUNCTION_TASK();
+    // Host coherent memory is preferred, but non-coherent host visible memory can be used with explicit flush of written data
+    const vk::MemoryPropertyFlags vk_coherent_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    return device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_coherent_memory_flags)
+         ? vk_coherent_memory_flags
+         : vk::MemoryPropertyFlags(vk::MemoryPropertyFlagBits::eHostVisible);
+}
+
+static vk::MemoryPropertyFlags GetReadBackMemoryPropertyFlags(const DeviceVK& device, const vk::MemoryRequirements& vk_memory_requirements)
+{
+    META_FUNCTION_TASK();
+    // Host cached memory is preferred for read-back, because reading from uncached memory on CPU is very slow
+    const vk::MemoryPropertyFlags vk_cached_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCached;
+    if (device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_cached_memory_flags | vk::MemoryPropertyFlagBits::eHostCoherent))
+        return vk_cached_memory_flags | vk::MemoryPropertyFlagBits::eHostCoherent;
+
+    if (device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_cached_memory_flags))
+        return vk_cached_memory_flags;
+
+    return GetHostVisibleMemoryPropertyFlags(device, vk_memory_requirements);
+}
+
+static Opt<vk::MemoryPropertyFlags> GetDirectUploadMemoryPropertyFlags(const DeviceVK& device, const vk::MemoryRequirements& vk_memory_requirements)
 {
     META_FUNCTION_TASK();
-    switch(buffer_type)
+    // Device local memory is also host visible on devices with unified memory (integrated and CPU devices)
+    // or with resizable BAR, so private resources can be written directly without staging copy,
+    // while small host visible heap of discrete GPU is left for the resources which have to be mapped
+    const vk::MemoryPropertyFlags vk_direct_memory_flags = vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eHostVisible;
+    for(const vk::MemoryPropertyFlags vk_memory_flags : { vk_direct_memory_flags | vk::MemoryPropertyFlagBits::eHostCoherent, vk_direct_memory_flags })
+    {
+        // Memory type is checked the same way as it is found on memory allocation
+        if (const Opt<uint32_t> memory_type_opt = device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk_memory_flags);
+            memory_type_opt && device.IsDirectUploadMemoryType(*memory_type_opt))
+            return vk_memory_flags;
+    }
+    return std::nullopt;
+}
+
+// Command lists executing on the target queue may use the buffer, so its memory can not be overwritten directly by CPU
+static bool IsCommandQueueExecuting(const CommandQueue& cmd_queue)
+{
+    META_FUNCTION_TASK();
+    return static_cast<bool>(dynamic_cast<const CommandQueueTrackingBase&>(cmd_queue).GetLastExecutingCommandListSet());
+}
+
+static Resource::State GetTargetResourceStateByBufferSettings(const Buffer::Settings& buffer_settings)
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    if (static_cast<bool>(buffer_settings.usage_mask & Resource::Usage::Indirect))
+        return Resource::State::IndirectArgument;
+
+    switch(buffer_settings.type)
     {
     case Buffer::Type::Storage:     return Resource::State::ShaderResource;
     case Buffer::Type::Constant:    return Resource::State::ConstantBuffer;
     case Buffer::Type::Index:       return Resource::State::IndexBuffer;
     case Buffer::Type::Vertex:      return Resource::State::VertexBuffer;
     case Buffer::Type::ReadBack:    return Resource::State::StreamOut;
-    default: META_UNEXPECTED_ARG_DESCR_RETURN(buffer_type, Resource::State::Undefined, "Unsupported buffer type");
+    default: META_UNEXPECTED_ARG_DESCR_RETURN(buffer_settings.type, Resource::State::Undefined, "Unsupported buffer type");
     }
 }
 
@@ -101,6 +164,24 @@ Ptr<Buffer> Buffer::CreateConstantBuffer(const Context& context, Data::Size size
     return Graphics::CreateConstantBuffer<BufferVK>(context, size, addressable, is_volatile);
 }
 
+Ptr<Buffer> Buffer::CreateReadBackBuffer(const Context& context, Data::Size size)
+{
+    META_FUNCTION_TASK();
+    return Graphics::CreateReadBackBuffer<BufferVK>(context, size);
+}
+
+Ptr<Buffer> Buffer::CreateIndirectBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Graphics::CreateIndirectBuffer<BufferVK>(context, size, stride, is_volatile);
+}
+
+Ptr<Buffer> Buffer::CreateStorageBuffer(const Context& context, Data::Size size, Data::Size stride, bool is_read_back)
+{
+    META_FUNCTION_TASK();
+    return Graphics::CreateStorageBuffer<BufferVK>(context, size, stride, is_read_back);
+}
+
 Data::Size Buffer::GetAlignedBufferSize(Data::Size size) noexcept
 {
     META_FUNCTION_TASK();
@@ -113,79 +194,129 @@ BufferVK::BufferVK(const ContextBase& context, const Settings& settings)
                      vk::BufferCreateInfo(
                          vk::BufferCreateFlags{},
                          settings.size,
-                         GetVulkanBufferUsageFlags(settings.type, settings.storage_mode),
+                         GetVulkanBufferUsageFlags(settings),
                          vk::SharingMode::eExclusive)))
 {
     META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    const DeviceVK& device = GetContextVK().GetDeviceVK();
     const bool is_private_storage = settings.storage_mode == Buffer::StorageMode::Private;
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_staging_memory_flags;
+    const bool is_read_back_buffer = settings.type == Buffer::Type::ReadBack;
+    const bool is_staging_upload_forced = static_cast<bool>(context.GetOptions() & Context::Options::StagingUploadOnVulkan);
+    const vk::MemoryRequirements       vk_memory_requirements = GetNativeDevice().getBufferMemoryRequirements(GetNativeResource());
+    const Opt<vk::MemoryPropertyFlags> vk_direct_upload_memory_flags_opt = is_private_storage && !is_staging_upload_forced
+                                                                         ? GetDirectUploadMemoryPropertyFlags(device, vk_memory_requirements)
+                                                                         : std::nullopt;
+    const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage
+                                                           ? vk_direct_upload_memory_flags_opt.value_or(vk::MemoryPropertyFlagBits::eDeviceLocal)
+                                                           : is_read_back_buffer
+                                                             ? GetReadBackMemoryPropertyFlags(device, vk_memory_requirements)
+                                                             : GetHostVisibleMemoryPropertyFlags(device, vk_memory_requirements);
 
     // Allocate resource primary memory
-    AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
+    AllocateResourceMemory(vk_memory_requirements, vk_memory_property_flags);
     GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
 
-    if (!is_private_storage)
+    // Managed buffers, read-back buffers and private buffers in host visible device memory
+    // are accessed directly without staging buffer and upload commands
+    if (!is_private_storage || vk_direct_upload_memory_flags_opt)
+    {
+        MapHostMemory(GetNativeDeviceMemory(), vk_memory_requirements.size, vk_memory_property_flags);
         return;
+    }
 
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-            settings.size,
-            vk::BufferUsageFlagBits::eTransferSrc,
-            vk::SharingMode::eExclusive)
-    );
-
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    InitializeStagingBuffer();
 }
 
 void BufferVK::SetData(const SubResources& sub_resources, CommandQueue& target_cmd_queue)
 {
     META_FUNCTION_TASK();
-    ResourceVK::SetData(sub_resources, target_cmd_queue);
-
     const Settings& buffer_settings = GetSettings();
     const bool is_private_storage = buffer_settings.storage_mode == Buffer::StorageMode::Private;
-    if (is_private_storage)
+
+    // Private buffer initialized directly in device memory may be read by GPU in frames in flight,
+    // so it is updated through staging buffer from now on instead of overwriting its memory without waiting for GPU
+    if (is_private_storage && !m_vk_unique_staging_buffer &&
+        GetDataSize(Data::MemoryState::Initialized) > 0U && IsCommandQueueExecuting(target_cmd_queue))
     {
-        m_vk_copy_regions.clear();
-        m_vk_copy_regions.reserve(sub_resources.size());
+        InitializeStagingBuffer();
     }
 
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
+    ResourceVK::SetData(sub_resources, target_cmd_queue);
+    const bool is_staging_upload = static_cast<bool>(m_vk_unique_staging_buffer);
+
+    // All sub-resources are validated before mapping, so that memory is not left mapped on validation error
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
+    }
 
-        // TODO: calculate memory offset by sub-resource index
-        const vk::DeviceSize sub_resource_offset = 0U;
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-        META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-        META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-        GetNativeDevice().unmapMemory(vk_device_memory);
+    Data::RawPtr p_host_data = MapHostData();
+    Data::Index written_data_start = std::numeric_limits<Data::Index>::max();
+    Data::Index written_data_end   = 0U;
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        const Data::Index data_offset = GetSubResourceDataOffset(sub_resource);
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), p_host_data + data_offset);
+        written_data_start = std::min(written_data_start, data_offset);
+        written_data_end   = std::max(written_data_end, data_offset + sub_resource.GetDataSize());
+    }
 
-        if (is_private_storage)
-        {
-            m_vk_copy_regions.emplace_back(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
-        }
+    if (!m_is_host_memory_coherent && written_data_start < written_data_end)
+    {
+        // Writes to non-coherent memory have to be flushed explicitly to become visible to the device,
+        // only the written range is flushed to avoid cache maintenance of the whole buffer memory
+        GetNativeDevice().flushMappedMemoryRanges(GetNativeMappedMemoryRange(written_data_start, written_data_end));
     }
+    UnmapHostData();
 
-    if (!is_private_storage)
+    if (!is_staging_upload)
+    {
+        if (is_private_storage)
+            CompleteDirectUpload(GetTargetResourceStateByBufferSettings(buffer_settings), target_cmd_queue);
         return;
+    }
 
     // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
+    // with minimal number of copy regions, since adjacent and overlapping data ranges are coalesced
+    const BytesRangeSet updated_data_ranges = GetSubResourcesDataRanges(sub_resources);
+    m_vk_copy_regions.clear();
+    m_vk_copy_regions.reserve(updated_data_ranges.Size());
+    for(const BytesRange& data_range : updated_data_ranges)
+    {
+        m_vk_copy_regions.emplace_back(data_range.GetStart(), data_range.GetStart(), static_cast<vk::DeviceSize>(data_range.GetLength()));
+    }
+
+    // Upload commands can be encoded from multiple threads, but not while upload command lists are being submitted
+    const auto upload_encoding_lock = GetContextBase().LockUploadEncoding();
     BlitCommandListVK& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
     upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), m_vk_copy_regions);
-    CompleteResourceUpload(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
+    CompleteResourceUpload(upload_cmd_list, GetTargetResourceStateByBufferSettings(buffer_settings), target_cmd_queue);
     GetContext().RequestDeferredAction(Context::DeferredAction::UploadResources);
 }
 
+Resource::SubResource BufferVK::GetData(const SubResource::Index& sub_resource_index, const std::optional<BytesRange>& data_range)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(GetSettings().type, Buffer::Type::ReadBack,
+                               "only read-back buffer data can be read directly, use asynchronous data reading for other buffers");
+    ValidateSubResource(sub_resource_index, data_range);
+
+    const Data::Index data_start  = data_range ? data_range->GetStart()  : 0U;
+    const Data::Index data_length = data_range ? data_range->GetLength() : GetSubResourceDataSize(sub_resource_index);
+
+    Data::ConstRawPtr p_host_data = MapHostData();
+    if (!m_is_host_memory_coherent)
+    {
+        // Device writes to non-coherent memory have to be invalidated explicitly to become visible to the host
+        GetNativeDevice().invalidateMappedMemoryRanges(GetNativeMappedMemoryRange(data_start, data_start + data_length));
+    }
+
+    Data::Bytes sub_resource_data(p_host_data + data_start, p_host_data + data_start + data_length);
+    UnmapHostData();
+    return SubResource(std::move(sub_resource_data), sub_resource_index, data_range);
+}
+
 bool BufferVK::SetName(const std::string& name)
 {
     META_FUNCTION_TASK();
@@ -199,6 +330,113 @@ bool BufferVK::SetName(const std::string& name)
     return true;
 }
 
+void BufferVK::InitializeStagingBuffer()
+{
+    META_FUNCTION_TASK();
+    if (m_p_host_data)
+    {
+        // Directly written device memory is unmapped, because buffer data is written to staging memory from now on
+        GetNativeDevice().unmapMemory(m_vk_host_memory);
+        m_p_host_data = nullptr;
+    }
+
+    // Create staging buffer and allocate staging memory
+    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
+        vk::BufferCreateInfo(vk::BufferCreateFlags{},
+            GetSettings().size,
+            vk::BufferUsageFlagBits::eTransferSrc,
+            vk::SharingMode::eExclusive)
+    );
+
+    const DeviceVK& device = GetContextVK().GetDeviceVK();
+    const vk::MemoryRequirements  vk_staging_memory_requirements = GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get());
+    const vk::MemoryPropertyFlags vk_staging_memory_flags        = GetHostVisibleMemoryPropertyFlags(device, vk_staging_memory_requirements);
+    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_staging_memory_requirements, vk_staging_memory_flags);
+    m_staging_memory_allocation = RegisterDeviceMemoryAllocation(Device::MemoryType::Staging, vk_staging_memory_requirements);
+    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    MapHostMemory(m_vk_unique_staging_memory.get(), vk_staging_memory_requirements.size, vk_staging_memory_flags);
+
+    if (const std::string& name = GetName(); !name.empty())
+    {
+        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
+    }
+}
+
+void BufferVK::CompleteDirectUpload(State target_resource_state, CommandQueue& target_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    if (GetState() == target_resource_state)
+        return;
+
+    // Host writes are visible to the device on queue submission, but resource state is transitioned to the target state
+    // with barriers encoded in upload command list, so that following usage barriers are built from the actual resource state
+    const auto upload_encoding_lock = GetContextBase().LockUploadEncoding();
+    const CommandKit& upload_cmd_kit = GetContextBase().GetUploadCommandKit();
+    auto& upload_cmd_list = dynamic_cast<BlitCommandListVK&>(upload_cmd_kit.GetListForEncoding(GetContextBase().GetUploadCommandListId()));
+    upload_cmd_list.RetainResource(*this);
+    CompleteResourceUpload(upload_cmd_list, target_resource_state, target_cmd_queue);
+    GetContext().RequestDeferredAction(Context::DeferredAction::UploadResources);
+}
+
+void BufferVK::MapHostMemory(const vk::DeviceMemory& vk_device_memory, vk::DeviceSize vk_memory_size, vk::MemoryPropertyFlags vk_memory_property_flags)
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    m_vk_host_memory = vk_device_memory;
+
+    // Host visible memory is mapped persistently for the buffer lifetime instead of mapping on every data update,
+    // memory is unmapped implicitly when freed
+    if (static_cast<bool>(GetContextBase().GetOptions() & Context::Options::TransientMappingOnVulkan))
+        m_is_host_memory_mapped_persistently = false;
+    else
+        m_p_host_data = MapNativeMemory(m_vk_host_memory);
+
+    m_vk_host_memory_size     = vk_memory_size;
+    m_vk_host_memory_size     = vk_memory_size;
+    m_is_host_memory_coherent = static_cast<bool>(vk_memory_property_flags & vk::MemoryPropertyFlagBits::eHostCoherent);
+    if (!m_is_host_memory_coherent)
+    {
+        m_vk_non_coherent_atom_size = GetContextVK().GetDeviceVK().GetNativePhysicalDevice().getProperties().limits.nonCoherentAtomSize;
+    }
+}
+
+Data::RawPtr BufferVK::MapNativeMemory(const vk::DeviceMemory& vk_device_memory) const
+{
+    META_FUNCTION_TASK();
+    Data::RawPtr p_host_data = nullptr;
+    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, 0U, VK_WHOLE_SIZE, vk::MemoryMapFlags{},
+                                                                 reinterpret_cast<void**>(&p_host_data)); // NOSONAR
+
+    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer memory");
+    META_CHECK_ARG_NOT_NULL_DESCR(p_host_data, "failed to map buffer memory");
+    return p_host_data;
+}
+
+Data::RawPtr BufferVK::MapHostData()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(m_vk_host_memory), "buffer memory is not host visible");
+    return m_is_host_memory_mapped_persistently ? m_p_host_data : MapNativeMemory(m_vk_host_memory);
+}
+
+void BufferVK::UnmapHostData()
+{
+    META_FUNCTION_TASK();
+    if (!m_is_host_memory_mapped_persistently)
+        GetNativeDevice().unmapMemory(m_vk_host_memory);
+}
+
+vk::MappedMemoryRange BufferVK::GetNativeMappedMemoryRange(Data::Index data_start, Data::Index data_end) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Flushed and invalidated ranges of non-coherent memory must be aligned to the non-coherent atom size,
+    // range end is clamped to the memory size, which is allowed to be not aligned at the end of allocation
+    const vk::DeviceSize aligned_start = (data_start / m_vk_non_coherent_atom_size) * m_vk_non_coherent_atom_size;
+    const vk::DeviceSize aligned_end   = std::min(m_vk_host_memory_size,
+                                                  ((data_end + m_vk_non_coherent_atom_size - 1U) / m_vk_non_coherent_atom_size) * m_vk_non_coherent_atom_size);
+    return vk::MappedMemoryRange(m_vk_host_memory, aligned_start, aligned_end - aligned_start);
+}
+
 Ptr<ResourceViewVK::ViewDescriptorVariant> BufferVK::CreateNativeViewDescriptor(const ResourceView::Id& view_id)
 {
     META_FUNCTION_TASK();
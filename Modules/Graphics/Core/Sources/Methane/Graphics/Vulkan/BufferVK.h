@@ -41,18 +41,37 @@ public:
 
     // Resource interface
     void SetData(const SubResources& sub_resources, CommandQueue& target_cmd_queue) override;
+    SubResource GetData(const SubResource::Index& sub_resource_index = SubResource::Index(), const std::optional<BytesRange>& data_range = {}) override;
 
     // Object interface
     bool SetName(const std::string& name) override;
 
+    bool IsStagingUpload() const noexcept { return static_cast<bool>(m_vk_unique_staging_buffer); }
+    const std::vector<vk::BufferCopy>& GetNativeCopyRegions() const noexcept { return m_vk_copy_regions; }
+
 protected:
     // ResourceVK override
     Ptr<ResourceViewVK::ViewDescriptorVariant> CreateNativeViewDescriptor(const View::Id& view_id) override;
 
 private:
-    vk::UniqueBuffer            m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory      m_vk_unique_staging_memory;
-    std::vector<vk::BufferCopy> m_vk_copy_regions;
+    void InitializeStagingBuffer();
+    void CompleteDirectUpload(State target_resource_state, CommandQueue& target_cmd_queue);
+    void MapHostMemory(const vk::DeviceMemory& vk_device_memory, vk::DeviceSize vk_memory_size, vk::MemoryPropertyFlags vk_memory_property_flags);
+    Data::RawPtr MapNativeMemory(const vk::DeviceMemory& vk_device_memory) const;
+    Data::RawPtr MapHostData();
+    void         UnmapHostData();
+    vk::MappedMemoryRange GetNativeMappedMemoryRange(Data::Index data_start, Data::Index data_end) const noexcept;
+
+    vk::UniqueBuffer             m_vk_unique_staging_buffer;
+    vk::UniqueDeviceMemory       m_vk_unique_staging_memory;
+    DeviceBase::MemoryAllocation m_staging_memory_allocation;
+    std::vector<vk::BufferCopy>  m_vk_copy_regions;
+    vk::DeviceMemory             m_vk_host_memory;
+    vk::DeviceSize               m_vk_host_memory_size = 0U;
+    vk::DeviceSize               m_vk_non_coherent_atom_size = 1U;
+    Data::RawPtr                 m_p_host_data = nullptr;
+    bool                         m_is_host_memory_coherent = true;
+    bool                         m_is_host_memory_mapped_persistently = true;
 };
 
 class BufferSetVK final : public BufferSetBase
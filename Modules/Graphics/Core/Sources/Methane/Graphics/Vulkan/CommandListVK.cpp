@@ -39,10 +39,14 @@ Vulkan command lists sequence implementation
 namespace Methane::Graphics
 {
 
-static vk::PipelineStageFlags GetFrameBufferRenderingWaitStages(const Refs<CommandList>& command_list_refs)
+static vk::PipelineStageFlags GetFrameBufferRenderingWaitStages(const CommandQueueVK& command_queue, const Refs<CommandList>& command_list_refs)
 {
     META_FUNCTION_TASK();
     vk::PipelineStageFlags wait_stages {};
+    if (const auto* render_context_ptr = dynamic_cast<const RenderContextVK*>(&command_queue.GetContextVK());
+        !render_context_ptr || render_context_ptr->IsHeadless())
+        return wait_stages; // offscreen frame buffers of headless context do not have image-available semaphores to wait for
+
     for(const Ref<CommandList>& command_list_ref : command_list_refs)
     {
         if (command_list_ref.get().GetType() != CommandList::Type::Render)
@@ -85,7 +89,7 @@ Ptr<CommandListSet> CommandListSet::Create(const Refs<CommandList>& command_list
 
 CommandListSetVK::CommandListSetVK(const Refs<CommandList>& command_list_refs, Opt<Data::Index> frame_index_opt)
     : CommandListSetBase(command_list_refs, frame_index_opt)
-    , m_vk_wait_frame_buffer_rendering_on_stages(GetFrameBufferRenderingWaitStages(command_list_refs))
+    , m_vk_wait_frame_buffer_rendering_on_stages(GetFrameBufferRenderingWaitStages(GetCommandQueueVK(), command_list_refs))
     , m_vk_device(GetCommandQueueVK().GetContextVK().GetDeviceVK().GetNativeDevice())
     , m_vk_unique_execution_completed_semaphore(m_vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo()))
     , m_vk_unique_execution_completed_fence(m_vk_device.createFenceUnique(vk::FenceCreateInfo()))
@@ -111,6 +115,19 @@ void CommandListSetVK::Execute(const CommandList::CompletedCallback& completed_c
     META_FUNCTION_TASK();
     CommandListSetBase::Execute(completed_callback);
 
+    if (CommandQueueVK& command_queue = GetCommandQueueVK();
+        command_queue.IsSubmitBatchingEnabled())
+    {
+        // Command list set is submitted later with the batch on queue flush,
+        // so wait info is copied here, because command queue resets it after execute call
+        m_vk_wait_semaphores = GetWaitSemaphores();
+        m_vk_wait_stages     = GetWaitStages();
+        m_vk_wait_values     = GetWaitValues();
+        m_vk_wait_values.resize(m_vk_wait_semaphores.size(), 0U); // wait values of binary semaphores are ignored
+        m_batch_execution_completed_value = command_queue.AddToSubmitBatch(*this);
+        return;
+    }
+
     vk::SubmitInfo submit_info(
         GetWaitSemaphores(),
         GetWaitStages(),
@@ -129,12 +146,24 @@ void CommandListSetVK::Execute(const CommandList::CompletedCallback& completed_c
 
     std::scoped_lock fence_guard(m_vk_unique_execution_completed_fence_mutex);
     m_vk_device.resetFences(GetNativeExecutionCompletedFence());
+
+    const auto queue_lock = GetCommandQueueVK().LockNativeQueue();
     GetCommandQueueVK().GetNativeQueue().submit(submit_info, GetNativeExecutionCompletedFence());
 }
 
 void CommandListSetVK::WaitUntilCompleted()
 {
     META_FUNCTION_TASK();
+    if (const CommandQueueVK& command_queue = GetCommandQueueVK();
+        command_queue.IsSubmitBatchingEnabled())
+    {
+        const vk::SemaphoreWaitInfo wait_info(vk::SemaphoreWaitFlagBits{}, 1U, &command_queue.GetNativeSubmitBatchSemaphore(), &m_batch_execution_completed_value);
+        const vk::Result batch_semaphore_wait_result = m_vk_device.waitSemaphoresKHR(wait_info, std::numeric_limits<uint64_t>::max());
+        META_CHECK_ARG_EQUAL_DESCR(batch_semaphore_wait_result, vk::Result::eSuccess, "failed to wait for batched command list set execution complete");
+        Complete();
+        return;
+    }
+
     std::scoped_lock fence_guard(m_vk_unique_execution_completed_fence_mutex);
     const vk::Result execution_completed_fence_wait_result = m_vk_device.waitForFences(
         GetNativeExecutionCompletedFence(),
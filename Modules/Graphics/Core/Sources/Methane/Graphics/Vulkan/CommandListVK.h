@@ -78,6 +78,11 @@ public:
     const vk::Semaphore&     GetNativeExecutionCompletedSemaphore() const noexcept { return m_vk_unique_execution_completed_semaphore.get(); }
     const vk::Fence&         GetNativeExecutionCompletedFence() const noexcept     { return m_vk_unique_execution_completed_fence.get(); }
 
+    // Wait semaphores are copied from command queue on execution with submit batching
+    const std::vector<vk::Semaphore>&          GetNativeWaitSemaphores() const noexcept { return m_vk_wait_semaphores; }
+    const std::vector<vk::PipelineStageFlags>& GetNativeWaitStages() const noexcept     { return m_vk_wait_stages; }
+    const std::vector<uint64_t>&               GetNativeWaitValues() const noexcept     { return m_vk_wait_values; }
+
     CommandQueueVK&       GetCommandQueueVK() noexcept;
     const CommandQueueVK& GetCommandQueueVK() const noexcept;
 
@@ -100,6 +105,7 @@ private:
     vk::UniqueSemaphore                 m_vk_unique_execution_completed_semaphore;
     vk::UniqueFence                     m_vk_unique_execution_completed_fence;
     TracyLockable(std::mutex,           m_vk_unique_execution_completed_fence_mutex)
+    uint64_t                            m_batch_execution_completed_value = 0U;
 };
 
 } // namespace Methane::Graphics
@@ -59,9 +59,18 @@ public:
     template<typename... ConstructArgs, uint32_t buffers_count = command_buffers_count,
              typename = std::enable_if_t< buffers_count != 1>>
     CommandListVK(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info, ConstructArgs&&... construct_args)
+        : CommandListVK(secondary_render_buffer_inherit_info, vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit),
+                        std::forward<ConstructArgs>(construct_args)...)
+    { }
+
+    template<typename... ConstructArgs, uint32_t buffers_count = command_buffers_count,
+             typename = std::enable_if_t< buffers_count != 1>>
+    CommandListVK(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info,
+                  vk::CommandBufferUsageFlags secondary_render_buffer_usage_flags, ConstructArgs&&... construct_args)
         : CommandListBaseT(std::forward<ConstructArgs>(construct_args)...)
         , m_vk_device(GetCommandQueueVK().GetContextVK().GetDeviceVK().GetNativeDevice()) // NOSONAR
         , m_vk_unique_command_pool(CreateVulkanCommandPool(GetCommandQueueVK().GetFamilyIndex()))
+        , m_vk_secondary_render_buffer_usage_flags(secondary_render_buffer_usage_flags)
     {
         META_FUNCTION_TASK();
         std::fill(m_vk_command_buffer_encoding_flags.begin(), m_vk_command_buffer_encoding_flags.end(), false);
@@ -167,7 +176,7 @@ public:
         m_is_native_committed = true;
     }
 
-    void SetResourceBarriers(const Resource::Barriers& resource_barriers) final
+    void SetResourceBarriers(const Resource::Barriers& resource_barriers) override
     {
         META_FUNCTION_TASK();
         CommandListBaseT::VerifyEncodingState();
@@ -283,10 +292,12 @@ protected:
         m_vk_secondary_render_buffer_inherit_info_opt = secondary_render_buffer_inherit_info;
         const size_t secondary_render_pass_index = magic_enum::enum_index(CommandBufferType::SecondaryRenderPass).value();
         const bool is_secondary_command_buffer = !m_vk_command_buffer_primary_flags[secondary_render_pass_index];
+        // Inheritance info refers to render pass object or to dynamic rendering info chained in pNext
+        const bool is_render_pass_inherited = secondary_render_buffer_inherit_info.renderPass || secondary_render_buffer_inherit_info.pNext;
         m_vk_command_buffer_begin_infos[secondary_render_pass_index] = vk::CommandBufferBeginInfo(
-            is_secondary_command_buffer && secondary_render_buffer_inherit_info.renderPass
-            ? vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eRenderPassContinue | vk::CommandBufferUsageFlagBits::eOneTimeSubmit)
-            : vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit),
+            is_secondary_command_buffer && is_render_pass_inherited
+            ? vk::CommandBufferUsageFlagBits::eRenderPassContinue | m_vk_secondary_render_buffer_usage_flags
+            : m_vk_secondary_render_buffer_usage_flags,
             &m_vk_secondary_render_buffer_inherit_info_opt.value()
         );
     }
@@ -355,6 +366,7 @@ private:
     std::array<bool, command_buffers_count>                       m_vk_command_buffer_encoding_flags;
     std::array<vk::CommandBufferBeginInfo, command_buffers_count> m_vk_command_buffer_begin_infos;
     std::optional<vk::CommandBufferInheritanceInfo>               m_vk_secondary_render_buffer_inherit_info_opt;
+    vk::CommandBufferUsageFlags                                   m_vk_secondary_render_buffer_usage_flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
     const ICommandListVK::CommandBufferType                       m_debug_group_command_buffer_type = default_command_buffer_type;
 };
 
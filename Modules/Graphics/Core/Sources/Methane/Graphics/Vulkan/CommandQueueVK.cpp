@@ -31,6 +31,9 @@ Vulkan implementation of the command queue interface.
 #include <Methane/Instrumentation.h>
 
 #include <fmt/format.h>
+#include <magic_enum.hpp>
+
+#include <array>
 
 namespace Methane::Graphics
 {
@@ -94,6 +97,20 @@ static vk::AccessFlags GetAccessFlagsByQueueFlags(vk::QueueFlags vk_queue_flags)
     return vk_access_flags;
 }
 
+static vk::UniqueSemaphore CreateSubmitBatchSemaphore(const vk::Device& vk_device, Context::Options options, CommandList::Type command_lists_type)
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    // Only render queue submits are batched, because it is flushed on every frame present,
+    // while upload and compute queues are waited by CPU right after execution
+    if (!static_cast<bool>(options & Context::Options::BatchedSubmitOnVulkan) ||
+        command_lists_type != CommandList::Type::Render)
+        return {};
+
+    vk::SemaphoreTypeCreateInfo semaphore_type_create_info(vk::SemaphoreType::eTimeline, 0U);
+    return vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo().setPNext(&semaphore_type_create_info));
+}
+
 Ptr<CommandQueue> CommandQueue::Create(const Context& context, CommandList::Type command_lists_type)
 {
     META_FUNCTION_TASK();
@@ -134,6 +151,7 @@ CommandQueueVK::CommandQueueVK(const ContextBase& context, CommandList::Type com
     , m_vk_queue(device.GetNativeDevice().getQueue(m_queue_family_index, m_queue_index))
     , m_vk_supported_stage_flags(GetPipelineStageFlagsByQueueFlags(family_properties.queueFlags))
     , m_vk_supported_access_flags(GetAccessFlagsByQueueFlags(family_properties.queueFlags))
+    , m_vk_unique_submit_batch_semaphore(CreateSubmitBatchSemaphore(device.GetNativeDevice(), context.GetOptions(), command_lists_type))
 {
     META_FUNCTION_TASK();
 }
@@ -141,6 +159,7 @@ CommandQueueVK::CommandQueueVK(const ContextBase& context, CommandList::Type com
 CommandQueueVK::~CommandQueueVK()
 {
     META_FUNCTION_TASK();
+    FlushSubmits();
     ShutdownQueueExecution();
     GetDeviceVK().GetQueueFamilyReservation(CommandQueueBase::GetCommandListType()).ReleaseQueueIndex(m_queue_index);
 }
@@ -157,6 +176,58 @@ void CommandQueueVK::Execute(CommandListSet& command_list_set, const CommandList
     m_wait_before_executing.wait_values.clear();
 }
 
+void CommandQueueVK::FlushSubmits()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock submit_batch_guard(m_submit_batch_mutex);
+    if (m_submit_batch.empty())
+        return;
+
+    META_LOG("Command queue '{}' SUBMIT batch of {} command list sets", GetName(), m_submit_batch.size());
+
+    // Reserve storage so that submit infos can reference signal semaphores and timeline values by pointers
+    const size_t submits_count = m_submit_batch.size();
+    std::vector<std::array<vk::Semaphore, 2>>    vk_signal_semaphores;
+    std::vector<std::array<uint64_t, 2>>         vk_signal_values;
+    std::vector<vk::TimelineSemaphoreSubmitInfo> vk_timeline_submit_infos;
+    std::vector<vk::SubmitInfo>                  vk_submit_infos;
+    vk_signal_semaphores.reserve(submits_count);
+    vk_signal_values.reserve(submits_count);
+    vk_timeline_submit_infos.reserve(submits_count);
+    vk_submit_infos.reserve(submits_count);
+
+    for(const BatchedSubmit& batched_submit : m_submit_batch)
+    {
+        const CommandListSetVK& command_list_set = *batched_submit.command_list_set_ptr;
+        const auto& signal_semaphores = vk_signal_semaphores.emplace_back(std::array<vk::Semaphore, 2>{
+            command_list_set.GetNativeExecutionCompletedSemaphore(), m_vk_unique_submit_batch_semaphore.get()
+        });
+        const auto& signal_values = vk_signal_values.emplace_back(std::array<uint64_t, 2>{ 0U, batched_submit.completed_value });
+        const vk::TimelineSemaphoreSubmitInfo& vk_timeline_submit_info = vk_timeline_submit_infos.emplace_back(
+            command_list_set.GetNativeWaitValues(), signal_values
+        );
+        vk_submit_infos.emplace_back(
+            command_list_set.GetNativeWaitSemaphores(),
+            command_list_set.GetNativeWaitStages(),
+            command_list_set.GetNativeCommandBuffers(),
+            signal_semaphores
+        ).setPNext(&vk_timeline_submit_info);
+    }
+
+    const auto queue_lock = LockNativeQueue();
+    m_vk_queue.submit(vk_submit_infos);
+    m_submit_batch.clear();
+}
+
+uint64_t CommandQueueVK::AddToSubmitBatch(CommandListSetVK& command_list_set)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(IsSubmitBatchingEnabled(), "submit batching is not enabled for command queue '{}'", GetName());
+    std::scoped_lock submit_batch_guard(m_submit_batch_mutex);
+    m_submit_batch.push_back({ std::static_pointer_cast<CommandListSetVK>(command_list_set.GetPtr()), ++m_submit_batch_value });
+    return m_submit_batch_value;
+}
+
 void CommandQueueVK::WaitForSemaphore(const vk::Semaphore& semaphore, vk::PipelineStageFlags stage_flags, const uint64_t* timeline_wait_value_ptr)
 {
     META_FUNCTION_TASK();
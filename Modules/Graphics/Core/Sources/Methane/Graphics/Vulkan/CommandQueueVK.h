@@ -36,6 +36,7 @@ namespace Methane::Graphics
 class DeviceVK;
 class RenderPassVK;
 class QueueFamilyReservationVK;
+class CommandListSetVK;
 struct IContextVK;
 
 class CommandQueueVK final // NOSONAR - custom destructor is required
@@ -55,6 +56,7 @@ public:
     // CommandQueue interface
     uint32_t GetFamilyIndex() const noexcept override { return m_queue_family_index; }
     void Execute(CommandListSet& command_list_set, const CommandList::CompletedCallback& completed_callback = {}) override;
+    void FlushSubmits() override;
 
     // Object interface
     bool SetName(const std::string& name) override;
@@ -68,12 +70,21 @@ public:
     const WaitInfo& GetWaitForFrameExecutionCompleted(Data::Index frame_index) const;
     void ResetWaitForFrameExecution(Data::Index frame_index);
 
+    // Command list sets are accumulated in submit batch, when Context::Options::BatchedSubmitOnVulkan is enabled,
+    // and their execution completion is signalled with increasing values of the batch timeline semaphore
+    bool     IsSubmitBatchingEnabled() const noexcept { return static_cast<bool>(m_vk_unique_submit_batch_semaphore); }
+    uint64_t AddToSubmitBatch(CommandListSetVK& command_list_set);
+    const vk::Semaphore& GetNativeSubmitBatchSemaphore() const noexcept { return m_vk_unique_submit_batch_semaphore.get(); }
+
     uint32_t GetNativeQueueFamilyIndex() const noexcept { return m_queue_family_index; }
     uint32_t GetNativeQueueIndex() const noexcept       { return m_queue_index; }
 
     vk::Queue&       GetNativeQueue() noexcept          { return m_vk_queue; }
     const vk::Queue& GetNativeQueue() const noexcept    { return m_vk_queue; }
 
+    // Native queue submit and present operations require external synchronization, since frames may be presented on the separate thread
+    [[nodiscard]] auto LockNativeQueue() const { return std::scoped_lock<LockableBase(std::mutex)>(m_vk_queue_mutex); }
+
     vk::PipelineStageFlags GetNativeSupportedStageFlags() const noexcept    { return m_vk_supported_stage_flags; }
     vk::AccessFlags        GetNativeSupportedAccessFlags() const noexcept   { return m_vk_supported_access_flags; }
 
@@ -93,15 +104,26 @@ private:
 
     using FrameWaitInfos = std::vector<WaitInfo>;
 
+    struct BatchedSubmit
+    {
+        Ptr<CommandListSetVK> command_list_set_ptr;
+        uint64_t              completed_value;
+    };
+
     const uint32_t         m_queue_family_index;
     const uint32_t         m_queue_index;
     vk::Queue              m_vk_queue;
+    mutable TracyLockable(std::mutex, m_vk_queue_mutex)
     vk::PipelineStageFlags m_vk_supported_stage_flags;
     vk::AccessFlags        m_vk_supported_access_flags;
     WaitInfo               m_wait_before_executing;
     mutable WaitInfo       m_wait_execution_completed;
     FrameWaitInfos         m_wait_frame_execution_completed;
     mutable TracyLockable(std::mutex, m_wait_frame_execution_completed_mutex)
+    vk::UniqueSemaphore        m_vk_unique_submit_batch_semaphore;
+    uint64_t                   m_submit_batch_value = 0U;
+    std::vector<BatchedSubmit> m_submit_batch;
+    TracyLockable(std::mutex,  m_submit_batch_mutex)
 };
 
 } // namespace Methane::Graphics
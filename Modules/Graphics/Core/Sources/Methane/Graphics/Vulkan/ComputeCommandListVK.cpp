@@ -0,0 +1,73 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ComputeCommandListVK.cpp
+Vulkan implementation of the compute command list interface.
+
+******************************************************************************/
+
+#include "ComputeCommandListVK.h"
+#include "CommandQueueVK.h"
+#include "BufferVK.h"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics
+{
+
+static_assert(sizeof(ComputeCommandList::DispatchArguments) == sizeof(vk::DispatchIndirectCommand),
+              "Size of DispatchArguments structure does not match Vulkan indirect dispatch command layout");
+
+Ptr<ComputeCommandList> ComputeCommandList::Create(CommandQueue& command_queue)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeCommandListVK>(static_cast<CommandQueueVK&>(command_queue));
+}
+
+ComputeCommandListVK::ComputeCommandListVK(CommandQueueVK& command_queue)
+    : CommandListVK(vk::CommandBufferLevel::ePrimary, {}, command_queue)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(command_queue.GetNativeSupportedStageFlags() & vk::PipelineStageFlagBits::eComputeShader),
+                              "command queue '{}' does not support compute commands execution", command_queue.GetName());
+}
+
+void ComputeCommandListVK::Dispatch(const ThreadGroupsCount& thread_groups_count)
+{
+    META_FUNCTION_TASK();
+    ComputeCommandListBase::Dispatch(thread_groups_count);
+    GetNativeCommandBufferDefault().dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
+}
+
+void ComputeCommandListVK::DispatchIndirect(Buffer& arguments_buffer, Data::Size arguments_offset)
+{
+    META_FUNCTION_TASK();
+    ComputeCommandListBase::DispatchIndirect(arguments_buffer, arguments_offset);
+
+    auto& vk_arguments_buffer = static_cast<BufferVK&>(arguments_buffer);
+    if (Ptr<Resource::Barriers>& buffer_setup_barriers_ptr = vk_arguments_buffer.GetSetupTransitionBarriers();
+        vk_arguments_buffer.SetState(Resource::State::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    GetNativeCommandBufferDefault().dispatchIndirect(vk_arguments_buffer.GetNativeResource(), arguments_offset);
+}
+
+} // namespace Methane::Graphics
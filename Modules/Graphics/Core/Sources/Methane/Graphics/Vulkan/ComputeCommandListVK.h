@@ -0,0 +1,48 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ComputeCommandListVK.h
+Vulkan implementation of the compute command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandListVK.hpp"
+
+#include <Methane/Graphics/ComputeCommandListBase.h>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Methane::Graphics
+{
+
+class CommandQueueVK;
+
+class ComputeCommandListVK final // NOSONAR - inheritance hierarchy is greater than 5
+    : public CommandListVK<ComputeCommandListBase, vk::PipelineBindPoint::eCompute>
+{
+public:
+    explicit ComputeCommandListVK(CommandQueueVK& command_queue);
+
+    // ComputeCommandList interface
+    void Dispatch(const ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Buffer& arguments_buffer, Data::Size arguments_offset) override;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,92 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ComputeStateVK.cpp
+Vulkan implementation of the compute state interface.
+
+******************************************************************************/
+
+#include "ComputeStateVK.h"
+#include "ComputeCommandListVK.h"
+#include "ContextVK.h"
+#include "DeviceVK.h"
+#include "ProgramVK.h"
+#include "ShaderVK.h"
+#include "UtilsVK.hpp"
+
+#include <Methane/Graphics/ContextBase.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics
+{
+
+Ptr<ComputeState> ComputeState::Create(const Context& context, const ComputeState::Settings& state_settings)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<ComputeStateVK>(dynamic_cast<const ContextBase&>(context), state_settings);
+}
+
+ComputeStateVK::ComputeStateVK(const ContextBase& context, const Settings& settings)
+    : ComputeStateBase(context, settings)
+{
+    META_FUNCTION_TASK();
+    Reset(settings);
+}
+
+void ComputeStateVK::Reset(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    ComputeStateBase::Reset(settings);
+
+    auto& program = static_cast<ProgramVK&>(GetProgram());
+    const vk::ComputePipelineCreateInfo vk_pipeline_create_info(
+        vk::PipelineCreateFlags(),
+        program.GetShaderVK(Shader::Type::Compute).GetNativeStageCreateInfo(),
+        program.GetNativePipelineLayout()
+    );
+
+    auto pipe = GetContextVK().GetDeviceVK().GetNativeDevice().createComputePipelineUnique(nullptr, vk_pipeline_create_info);
+    META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan compute pipeline creation has failed");
+    m_vk_unique_pipeline = std::move(pipe.value);
+}
+
+void ComputeStateVK::Apply(ComputeCommandListBase& compute_command_list)
+{
+    META_FUNCTION_TASK();
+    const auto& vulkan_compute_command_list = static_cast<ComputeCommandListVK&>(compute_command_list);
+    vulkan_compute_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eCompute, GetNativePipeline());
+}
+
+bool ComputeStateVK::SetName(const std::string& name)
+{
+    META_FUNCTION_TASK();
+    if (!ComputeStateBase::SetName(name))
+        return false;
+
+    SetVulkanObjectName(GetContextVK().GetDeviceVK().GetNativeDevice(), m_vk_unique_pipeline.get(), name.c_str());
+    return true;
+}
+
+const IContextVK& ComputeStateVK::GetContextVK() const noexcept
+{
+    META_FUNCTION_TASK();
+    return static_cast<const IContextVK&>(GetContext());
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,57 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ComputeStateVK.h
+Vulkan implementation of the compute state interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/ComputeStateBase.h>
+
+#include <vulkan/vulkan.hpp>
+
+namespace Methane::Graphics
+{
+
+struct IContextVK;
+
+class ComputeStateVK final : public ComputeStateBase
+{
+public:
+    ComputeStateVK(const ContextBase& context, const Settings& settings);
+
+    // ComputeState interface
+    void Reset(const Settings& settings) override;
+
+    // ComputeStateBase interface
+    void Apply(ComputeCommandListBase& compute_command_list) override;
+
+    // Object interface
+    bool SetName(const std::string& name) override;
+
+    const vk::Pipeline& GetNativePipeline() const noexcept { return m_vk_unique_pipeline.get(); }
+
+private:
+    const IContextVK& GetContextVK() const noexcept;
+
+    vk::UniquePipeline m_vk_unique_pipeline;
+};
+
+} // namespace Methane::Graphics
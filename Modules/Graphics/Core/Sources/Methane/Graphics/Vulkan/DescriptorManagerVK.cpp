@@ -108,6 +108,9 @@ vk::DescriptorPool DescriptorManagerVK::CreateDescriptorPool()
     }
     const vk::Device& vk_device = GetContextVK().GetDeviceVK().GetNativeDevice();
     m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_sets_count, pool_sizes)));
+
+    // Descriptor pool memory is managed by driver and its size is not reported, so only descriptor pool allocations are counted
+    m_descriptor_pool_allocations.emplace_back(*GetContext().GetDeviceBasePtr(), Device::MemoryType::Descriptors, 0U);
     return m_vk_descriptor_pools.back().get();
 }
 
@@ -24,6 +24,7 @@ Vulkan descriptor manager with descriptor sets allocator.
 #pragma once
 
 #include <Methane/Graphics/DescriptorManagerBase.h>
+#include <Methane/Graphics/DeviceBase.h>
 
 #include <Tracy.hpp>
 #include <magic_enum.hpp>
@@ -77,13 +78,14 @@ private:
     vk::DescriptorPool AcquireDescriptorPool();
     const IContextVK& GetContextVK() const noexcept;
 
-    uint32_t                              m_pool_sets_count;
-    PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
-    std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
-    std::vector<vk::DescriptorPool>       m_vk_used_pools;
-    std::vector<vk::DescriptorPool>       m_vk_free_pools;
-    vk::DescriptorPool                    m_vk_current_pool;
-    TracyLockable(std::mutex,             m_descriptor_pool_mutex)
+    uint32_t                                  m_pool_sets_count;
+    PoolSizeRatioByDescType                   m_pool_size_ratio_by_desc_type;
+    std::vector<vk::UniqueDescriptorPool>     m_vk_descriptor_pools;
+    std::vector<DeviceBase::MemoryAllocation> m_descriptor_pool_allocations;
+    std::vector<vk::DescriptorPool>           m_vk_used_pools;
+    std::vector<vk::DescriptorPool>           m_vk_free_pools;
+    vk::DescriptorPool                        m_vk_current_pool;
+    TracyLockable(std::mutex,                 m_descriptor_pool_mutex)
 };
 
 } // namespace Methane::Graphics
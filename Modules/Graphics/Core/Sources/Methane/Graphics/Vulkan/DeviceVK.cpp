@@ -52,6 +52,9 @@ static const std::string g_vk_validation_layer        = "VK_LAYER_KHRONOS_valida
 static const std::string g_vk_debug_utils_extension   = VK_EXT_DEBUG_UTILS_EXTENSION_NAME;
 static const std::string g_vk_validation_extension    = VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME;
 
+// Memory budget changes slowly, so it is queried from driver about once per frame even with many allocations per frame
+static constexpr std::chrono::milliseconds g_memory_budget_update_interval{ 16 };
+
 // Google extensions are used to reflect HLSL semantic names from shader input decorations,
 // and it works fine, but is not listed by Windows NVidia drivers, who knows why?
 //#ifdef __linux__
@@ -80,6 +83,21 @@ static const std::vector<std::string_view> g_present_device_extensions = {
     VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+static const std::vector<std::string_view> g_draw_indirect_count_device_extensions = {
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME
+};
+
+static const std::vector<std::string_view> g_memory_budget_device_extensions = {
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME
+};
+
+// Dynamic rendering extension depends on depth-stencil resolve and render pass 2 extensions, which are not in Vulkan 1.1 core
+static const std::vector<std::string_view> g_dynamic_rendering_device_extensions = {
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME
+};
+
 static std::vector<char const*> GetEnabledLayers(const std::vector<std::string_view>& layers)
 {
     META_FUNCTION_TASK();
@@ -292,23 +310,49 @@ static vk::UniqueInstance CreateVulkanInstance(const vk::DynamicLoader& vk_loade
     return vk_unique_instance;
 }
 
-template<bool exact_flags_matching>
-std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
-                                        vk::QueueFlags queue_flags, uint32_t queues_count,
-                                        const std::vector<uint32_t>& reserved_queues_count_per_family,
-                                        const vk::PhysicalDevice& vk_physical_device = {},
-                                        const vk::SurfaceKHR& vk_present_surface = {})
+enum class QueueFlagsMatching
+{
+    Exact,     // family queue flags are equal to the requested flags
+    Dedicated, // family supports requested operations and no operations of the wider queue types
+    Subset     // family supports requested operations among others
+};
+
+static vk::QueueFlags GetQueueFlagsExcludedFromDedicatedFamily(vk::QueueFlags queue_flags)
+{
+    META_FUNCTION_TASK();
+    // Transfer operations are supported by all graphics and compute families and compute operations are supported by graphics families,
+    // so dedicated family only lacks operations of the wider queue types, while narrower operations and sparse binding flag are ignored:
+    // async compute families usually expose compute and transfer flags, async transfer families - transfer and sparse binding flags
+    if (queue_flags & vk::QueueFlagBits::eGraphics)
+        return {};
+    if (queue_flags & vk::QueueFlagBits::eCompute)
+        return vk::QueueFlagBits::eGraphics;
+    return vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute;
+}
+
+template<QueueFlagsMatching flags_matching>
+std::optional<uint32_t> FindQueueFamilyMatching(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
+                                                vk::QueueFlags queue_flags, uint32_t queues_count,
+                                                const std::vector<uint32_t>& reserved_queues_count_per_family,
+                                                const vk::PhysicalDevice& vk_physical_device = {},
+                                                const vk::SurfaceKHR& vk_present_surface = {})
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_EQUAL(reserved_queues_count_per_family.size(), vk_queue_family_properties.size());
     for(size_t family_index = 0; family_index < vk_queue_family_properties.size(); ++family_index)
     {
         const vk::QueueFamilyProperties& vk_family_props = vk_queue_family_properties[family_index];
-        if constexpr (exact_flags_matching)
+        if constexpr (flags_matching == QueueFlagsMatching::Exact)
         {
             if (vk_family_props.queueFlags != queue_flags)
                 continue;
         }
+        else if constexpr (flags_matching == QueueFlagsMatching::Dedicated)
+        {
+            if ((vk_family_props.queueFlags & queue_flags) != queue_flags ||
+                (vk_family_props.queueFlags & GetQueueFlagsExcludedFromDedicatedFamily(queue_flags)))
+                continue;
+        }
         else
         {
             if ((vk_family_props.queueFlags & queue_flags) != queue_flags)
@@ -333,23 +377,44 @@ std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyPropert
     return {};
 }
 
-static std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
-                                               vk::QueueFlags queue_flags, uint32_t queues_count,
-                                               const std::vector<uint32_t>& reserved_queues_count_per_family,
-                                               const vk::PhysicalDevice& vk_physical_device = {},
-                                               const vk::SurfaceKHR& vk_present_surface = {})
+std::optional<uint32_t> DeviceVK::FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
+                                                  vk::QueueFlags queue_flags, uint32_t queues_count,
+                                                  const std::vector<uint32_t>& reserved_queues_count_per_family,
+                                                  const vk::PhysicalDevice& vk_physical_device,
+                                                  const vk::SurfaceKHR& vk_present_surface)
 {
     META_FUNCTION_TASK();
 
     // Try to find queue family with exact flags match
-    if (const std::optional<uint32_t> family_index = FindQueueFamily<true>(vk_queue_family_properties, queue_flags, queues_count,
-                                                                           reserved_queues_count_per_family, vk_physical_device, vk_present_surface);
+    if (const std::optional<uint32_t> family_index = FindQueueFamilyMatching<QueueFlagsMatching::Exact>(vk_queue_family_properties, queue_flags, queues_count,
+                                                                                                       reserved_queues_count_per_family, vk_physical_device, vk_present_surface);
         family_index) // NOSONAR - can not use value_or here
         return *family_index;
 
-    // If no family with exact match, find one which contains a subset of queue flags
-    return FindQueueFamily<false>(vk_queue_family_properties, queue_flags, queues_count,
-                                  reserved_queues_count_per_family, vk_physical_device, vk_present_surface);
+    // If no family with exact match, try to find dedicated family which does not support operations of the wider queue types,
+    // i.e. transfer family without graphics and compute for asynchronous blit queues
+    // or compute family without graphics (possibly with transfer) for asynchronous compute queues
+    if (const std::optional<uint32_t> family_index = FindQueueFamilyMatching<QueueFlagsMatching::Dedicated>(vk_queue_family_properties, queue_flags, queues_count,
+                                                                                                           reserved_queues_count_per_family, vk_physical_device, vk_present_surface);
+        family_index) // NOSONAR - can not use value_or here
+        return *family_index;
+
+    // If no dedicated family, find one which contains a subset of queue flags,
+    // i.e. another queue of the graphics family which also supports transfer operations
+    return FindQueueFamilyMatching<QueueFlagsMatching::Subset>(vk_queue_family_properties, queue_flags, queues_count,
+                                                               reserved_queues_count_per_family, vk_physical_device, vk_present_surface);
+}
+
+static bool IsExtensionSupportedByPhysicalDevice(const vk::PhysicalDevice& vk_physical_device, const std::vector<std::string_view>& required_extensions)
+{
+    META_FUNCTION_TASK();
+    std::set<std::string_view> extensions(required_extensions.begin(), required_extensions.end());
+    const std::vector<vk::ExtensionProperties> vk_device_extension_properties = vk_physical_device.enumerateDeviceExtensionProperties();
+    for(const vk::ExtensionProperties& vk_extension_props : vk_device_extension_properties)
+    {
+        extensions.erase(vk_extension_props.extensionName);
+    }
+    return extensions.empty();
 }
 
 static bool IsSoftwarePhysicalDevice(const vk::PhysicalDevice& vk_physical_device)
@@ -360,13 +425,22 @@ static bool IsSoftwarePhysicalDevice(const vk::PhysicalDevice& vk_physical_devic
            vk_device_type == vk::PhysicalDeviceType::eCpu;
 }
 
+static bool IsUnifiedMemoryPhysicalDevice(const vk::PhysicalDevice& vk_physical_device)
+{
+    META_FUNCTION_TASK();
+    const vk::PhysicalDeviceType vk_device_type = vk_physical_device.getProperties().deviceType;
+    return vk_device_type == vk::PhysicalDeviceType::eIntegratedGpu ||
+           vk_device_type == vk::PhysicalDeviceType::eCpu;
+}
+
 static vk::QueueFlags GetQueueFlagsByType(CommandList::Type cmd_list_type)
 {
     META_FUNCTION_TASK();
     switch(cmd_list_type)
     {
-    case CommandList::Type::Blit:   return vk::QueueFlagBits::eTransfer;
-    case CommandList::Type::Render: return vk::QueueFlagBits::eGraphics;
+    case CommandList::Type::Blit:    return vk::QueueFlagBits::eTransfer;
+    case CommandList::Type::Render:  return vk::QueueFlagBits::eGraphics;
+    case CommandList::Type::Compute: return vk::QueueFlagBits::eCompute;
     default: META_UNEXPECTED_ARG_RETURN(cmd_list_type, vk::QueueFlagBits::eGraphics);
     }
 }
@@ -435,6 +509,8 @@ Device::Features DeviceVK::GetSupportedFeatures(const vk::PhysicalDevice& vk_phy
         device_features |= Device::Features::AnisotropicFiltering;
     if (vk_device_features.imageCubeArray)
         device_features |= Device::Features::ImageCubeArray;
+    if (IsExtensionSupportedByPhysicalDevice(vk_physical_device, g_draw_indirect_count_device_extensions))
+        device_features |= Device::Features::DrawIndirectCount;
     return device_features;
 }
 
@@ -443,13 +519,15 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
                  IsSoftwarePhysicalDevice(vk_physical_device),
                  capabilities)
     , m_vk_physical_device(vk_physical_device)
+    , m_vk_memory_properties(vk_physical_device.getMemoryProperties())
     , m_vk_queue_family_properties(vk_physical_device.getQueueFamilyProperties())
+    , m_is_unified_memory(IsUnifiedMemoryPhysicalDevice(vk_physical_device))
 {
     META_FUNCTION_TASK();
 
     using namespace magic_enum::bitwise_operators;
-    if (const Device::Features device_supported_features = DeviceVK::GetSupportedFeatures(vk_physical_device);
-        !static_cast<bool>(device_supported_features & capabilities.features))
+    const Device::Features device_supported_features = DeviceVK::GetSupportedFeatures(vk_physical_device);
+    if (!static_cast<bool>(device_supported_features & capabilities.features))
         throw IncompatibleException("Supported Device features are incompatible with the required capabilities");
 
     std::vector<uint32_t> reserved_queues_count_per_family(m_vk_queue_family_properties.size(), 0U);
@@ -461,6 +539,7 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
                        capabilities.present_to_window ? vk_surface : vk::SurfaceKHR());
 
     ReserveQueueFamily(CommandList::Type::Blit, capabilities.blit_queues_count, reserved_queues_count_per_family);
+    ReserveQueueFamily(CommandList::Type::Compute, capabilities.compute_queues_count, reserved_queues_count_per_family);
 
     std::vector<vk::DeviceQueueCreateInfo> vk_queue_create_infos;
     std::set<QueueFamilyReservationVK*> unique_family_reservation_ptrs;
@@ -474,7 +553,9 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
     }
 
     std::vector<std::string_view> enabled_extension_names = g_common_device_extensions;
-    if (capabilities.present_to_window)
+    // Swap-chain extension is also enabled for headless rendering when available,
+    // because offscreen frame buffers are transitioned to the same present layout as swap-chain images
+    if (capabilities.present_to_window || IsExtensionSupported(g_present_device_extensions))
     {
         enabled_extension_names.insert(enabled_extension_names.end(), g_present_device_extensions.begin(), g_present_device_extensions.end());
     }
@@ -482,6 +563,24 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
     {
         enabled_extension_names.insert(enabled_extension_names.end(), g_render_device_extensions.begin(), g_render_device_extensions.end());
     }
+    if (static_cast<bool>(capabilities.features & device_supported_features & Device::Features::DrawIndirectCount))
+    {
+        enabled_extension_names.insert(enabled_extension_names.end(), g_draw_indirect_count_device_extensions.begin(), g_draw_indirect_count_device_extensions.end());
+        m_is_draw_indirect_count_enabled = true;
+    }
+    if (IsExtensionSupported(g_memory_budget_device_extensions))
+    {
+        // Memory budget extension is optional and used only to report memory heap budget and usage in device memory statistics
+        enabled_extension_names.insert(enabled_extension_names.end(), g_memory_budget_device_extensions.begin(), g_memory_budget_device_extensions.end());
+        m_is_memory_budget_enabled = true;
+    }
+    if (static_cast<bool>(capabilities.features & Device::Features::BasicRendering) &&
+        IsExtensionSupported(g_dynamic_rendering_device_extensions))
+    {
+        // Dynamic rendering extension is optional and used only by render contexts created with DynamicRenderingOnVulkan option
+        enabled_extension_names.insert(enabled_extension_names.end(), g_dynamic_rendering_device_extensions.begin(), g_dynamic_rendering_device_extensions.end());
+        m_is_dynamic_rendering_enabled = true;
+    }
 
     std::vector<const char*> raw_enabled_extension_names;
     std::transform(enabled_extension_names.begin(), enabled_extension_names.end(), std::back_inserter(raw_enabled_extension_names),
@@ -491,6 +590,8 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
     vk::PhysicalDeviceFeatures vk_device_features;
     vk_device_features.samplerAnisotropy = static_cast<bool>(capabilities.features & Features::AnisotropicFiltering);
     vk_device_features.imageCubeArray    = static_cast<bool>(capabilities.features & Features::ImageCubeArray);
+    vk_device_features.multiDrawIndirect = vk_physical_device.getFeatures().multiDrawIndirect;
+    m_is_multi_draw_indirect_enabled     = vk_device_features.multiDrawIndirect;
 
     // Add descriptions of enabled device features:
     vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT vk_device_dynamic_state_feature(true);
@@ -506,6 +607,13 @@ DeviceVK::DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::Surfa
     vk_device_host_query_reset_feature.setPNext(&vk_device_synchronization_2_feature);
 #endif
 
+    vk::PhysicalDeviceDynamicRenderingFeaturesKHR vk_device_dynamic_rendering_feature(true);
+    if (m_is_dynamic_rendering_enabled)
+    {
+        vk_device_dynamic_rendering_feature.setPNext(vk_device_info.pNext);
+        vk_device_info.setPNext(&vk_device_dynamic_rendering_feature);
+    }
+
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
 }
@@ -523,13 +631,7 @@ bool DeviceVK::SetName(const std::string& name)
 bool DeviceVK::IsExtensionSupported(const std::vector<std::string_view>& required_extensions) const
 {
     META_FUNCTION_TASK();
-    std::set<std::string_view> extensions(required_extensions.begin(), required_extensions.end());
-    const std::vector<vk::ExtensionProperties> vk_device_extension_properties = m_vk_physical_device.enumerateDeviceExtensionProperties();
-    for(const vk::ExtensionProperties& vk_extension_props : vk_device_extension_properties)
-    {
-        extensions.erase(vk_extension_props.extensionName);
-    }
-    return extensions.empty();
+    return IsExtensionSupportedByPhysicalDevice(m_vk_physical_device, required_extensions);
 }
 
 const QueueFamilyReservationVK* DeviceVK::GetQueueFamilyReservationPtr(CommandList::Type cmd_list_type) const noexcept
@@ -564,16 +666,73 @@ DeviceVK::SwapChainSupport DeviceVK::GetSwapChainSupportForSurface(const vk::Sur
 Opt<uint32_t> DeviceVK::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept
 {
     META_FUNCTION_TASK();
-    const vk::PhysicalDeviceMemoryProperties vk_memory_props = m_vk_physical_device.getMemoryProperties();
-    for(uint32_t type_index = 0U; type_index < vk_memory_props.memoryTypeCount; ++type_index)
+    for(uint32_t type_index = 0U; type_index < m_vk_memory_properties.memoryTypeCount; ++type_index)
     {
         if (type_filter & (1 << type_index) &&
-            (vk_memory_props.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
+            (m_vk_memory_properties.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
             return type_index;
     }
     return std::nullopt;
 }
 
+// Device local memory type is used for direct upload from CPU only on devices with unified memory (integrated and CPU devices)
+// or when it belongs to the largest device local heap (resizable BAR), but not to the small host visible heap of discrete GPU
+bool DeviceVK::IsDirectUploadMemoryType(uint32_t memory_type_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_is_unified_memory)
+        return true;
+
+    const vk::PhysicalDeviceMemoryProperties& vk_memory_props = m_vk_memory_properties;
+    if (memory_type_index >= vk_memory_props.memoryTypeCount)
+        return false;
+
+    Opt<uint32_t> largest_heap_index_opt;
+    for(uint32_t heap_index = 0U; heap_index < vk_memory_props.memoryHeapCount; ++heap_index)
+    {
+        const vk::MemoryHeap& vk_memory_heap = vk_memory_props.memoryHeaps[heap_index];
+        if ((vk_memory_heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal) &&
+            (!largest_heap_index_opt || vk_memory_heap.size > vk_memory_props.memoryHeaps[*largest_heap_index_opt].size))
+            largest_heap_index_opt = heap_index;
+    }
+    return largest_heap_index_opt == vk_memory_props.memoryTypes[memory_type_index].heapIndex;
+}
+
+bool DeviceVK::UpdateMemoryHeapStatistics(std::vector<MemoryHeapStatistics>& memory_heaps) const
+{
+    META_FUNCTION_TASK();
+    const vk::PhysicalDeviceMemoryProperties& vk_memory_props = m_vk_memory_properties;
+    memory_heaps.resize(vk_memory_props.memoryHeapCount);
+    for(uint32_t heap_index = 0U; heap_index < vk_memory_props.memoryHeapCount; ++heap_index)
+    {
+        const vk::MemoryHeap& vk_memory_heap = vk_memory_props.memoryHeaps[heap_index];
+        MemoryHeapStatistics& memory_heap    = memory_heaps[heap_index];
+        memory_heap.is_device_local = static_cast<bool>(vk_memory_heap.flags & vk::MemoryHeapFlagBits::eDeviceLocal);
+        memory_heap.size            = vk_memory_heap.size;
+        memory_heap.budget          = vk_memory_heap.size;
+        memory_heap.usage           = 0U;
+    }
+
+    if (!m_is_memory_budget_enabled)
+        return false;
+
+    std::scoped_lock lock_guard(m_memory_budget_mutex);
+    if (!m_memory_budget_update_timer_opt || m_memory_budget_update_timer_opt->GetElapsedDuration() >= g_memory_budget_update_interval)
+    {
+        const auto vk_memory_props_chain = m_vk_physical_device.getMemoryProperties2<vk::PhysicalDeviceMemoryProperties2,
+                                                                                     vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+        m_vk_memory_budget_properties = vk_memory_props_chain.get<vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+        m_memory_budget_update_timer_opt.emplace();
+    }
+
+    for(uint32_t heap_index = 0U; heap_index < vk_memory_props.memoryHeapCount; ++heap_index)
+    {
+        memory_heaps[heap_index].budget = m_vk_memory_budget_properties.heapBudget[heap_index];
+        memory_heaps[heap_index].usage  = m_vk_memory_budget_properties.heapUsage[heap_index];
+    }
+    return true;
+}
+
 const vk::QueueFamilyProperties& DeviceVK::GetNativeQueueFamilyProperties(uint32_t queue_family_index) const
 {
     META_FUNCTION_TASK();
@@ -612,8 +771,9 @@ void DeviceVK::ReserveQueueFamily(CommandList::Type cmd_list_type, uint32_t queu
             : queue_family_reservation_it->second
     );
 
-    META_LOG("Vulkan command queue family [{}] was reserved for allocating {} {} queues.",
-             *vk_queue_family_index, queues_count, magic_enum::enum_name(cmd_list_type));
+    META_LOG("Vulkan command queue family [{}] with flags {} was reserved for allocating {} {} queues{}.",
+             *vk_queue_family_index, vk::to_string(m_vk_queue_family_properties[*vk_queue_family_index].queueFlags),
+             queues_count, magic_enum::enum_name(cmd_list_type), is_new_queue_family_reservation ? "" : " in the shared family");
 }
 
 System& System::Get()
@@ -27,9 +27,13 @@ Vulkan implementation of the device interface.
 #include <Methane/Graphics/CommandQueue.h>
 #include <Methane/Data/RangeSet.hpp>
 #include <Methane/Memory.hpp>
+#include <Methane/Timer.hpp>
+#include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
 #include <map>
+#include <mutex>
+#include <optional>
 
 namespace Methane::Graphics
 {
@@ -80,6 +84,14 @@ public:
 
     static Device::Features GetSupportedFeatures(const vk::PhysicalDevice& vk_physical_device);
 
+    // Finds queue family with exact flags match first, then dedicated family without operations of the wider queue types
+    // and finally any family supporting requested operations; presentation support is checked only when surface is passed
+    static std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_family_properties,
+                                                   vk::QueueFlags queue_flags, uint32_t queues_count,
+                                                   const std::vector<uint32_t>& reserved_queues_count_per_family,
+                                                   const vk::PhysicalDevice& vk_physical_device = {},
+                                                   const vk::SurfaceKHR& vk_present_surface = {});
+
     DeviceVK(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKHR& vk_surface, const Capabilities& capabilities);
 
     // Object interface
@@ -89,11 +101,20 @@ public:
     [[nodiscard]] const QueueFamilyReservationVK& GetQueueFamilyReservation(CommandList::Type cmd_queue_type) const;
     [[nodiscard]] SwapChainSupport GetSwapChainSupportForSurface(const vk::SurfaceKHR& vk_surface) const noexcept;
     [[nodiscard]] Opt<uint32_t> FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept;
+    [[nodiscard]] bool IsDirectUploadMemoryType(uint32_t memory_type_index) const noexcept;
+    [[nodiscard]] bool IsDrawIndirectCountEnabled() const noexcept   { return m_is_draw_indirect_count_enabled; }
+    [[nodiscard]] bool IsMultiDrawIndirectEnabled() const noexcept   { return m_is_multi_draw_indirect_enabled; }
+    [[nodiscard]] bool IsMemoryBudgetEnabled() const noexcept        { return m_is_memory_budget_enabled; }
+    [[nodiscard]] bool IsDynamicRenderingEnabled() const noexcept    { return m_is_dynamic_rendering_enabled; }
 
     const vk::PhysicalDevice&        GetNativePhysicalDevice() const noexcept { return m_vk_physical_device; }
     const vk::Device&                GetNativeDevice() const noexcept         { return m_vk_unique_device.get(); }
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
 
+protected:
+    // DeviceBase overrides
+    bool UpdateMemoryHeapStatistics(std::vector<MemoryHeapStatistics>& memory_heaps) const override;
+
 private:
     using QueueFamilyReservationByType = std::map<CommandList::Type, Ptr<QueueFamilyReservationVK>>;
 
@@ -104,9 +125,21 @@ private:
     bool IsExtensionSupported(const std::vector<std::string_view>& required_extensions) const;
 
     vk::PhysicalDevice                     m_vk_physical_device;
+    vk::PhysicalDeviceMemoryProperties     m_vk_memory_properties;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
+    bool                                   m_is_draw_indirect_count_enabled = false;
+    bool                                   m_is_multi_draw_indirect_enabled = false;
+    bool                                   m_is_memory_budget_enabled = false;
+    bool                                   m_is_dynamic_rendering_enabled = false;
+    bool                                   m_is_unified_memory = false;
+
+    // Memory budget properties are queried from driver not more often than the update interval,
+    // because memory budget is checked on every allocation
+    mutable vk::PhysicalDeviceMemoryBudgetPropertiesEXT m_vk_memory_budget_properties;
+    mutable std::optional<Timer>                        m_memory_budget_update_timer_opt;
+    mutable TracyLockable(std::mutex,                   m_memory_budget_mutex)
 };
 
 class SystemVK final : public SystemBase // NOSONAR - destructor is required in this class
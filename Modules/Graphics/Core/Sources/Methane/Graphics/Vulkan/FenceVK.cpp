@@ -67,15 +67,25 @@ void FenceVK::Signal()
     vk::SubmitInfo vk_submit_info({}, {}, {}, GetNativeSemaphore());
     vk_submit_info.setPNext(&vk_semaphore_submit_info);
 
-    GetCommandQueueVK().GetNativeQueue().submit(vk_submit_info);
+    // Batched command list sets have to be submitted before fence signal to keep execution order
+    CommandQueueVK& command_queue = GetCommandQueueVK();
+    command_queue.FlushSubmits();
+
+    const auto queue_lock = command_queue.LockNativeQueue();
+    command_queue.GetNativeQueue().submit(vk_submit_info);
 }
 
-void FenceVK::WaitOnCpu()
+uint64_t FenceVK::GetCompletedValue() const
 {
     META_FUNCTION_TASK();
-    FenceBase::WaitOnCpu();
+    return m_vk_device.getSemaphoreCounterValueKHR(GetNativeSemaphore());
+}
+
+void FenceVK::WaitOnCpu(uint64_t wait_value)
+{
+    META_FUNCTION_TASK();
+    FenceBase::WaitOnCpu(wait_value);
 
-    const uint64_t wait_value = GetValue();
     const uint64_t curr_value = m_vk_device.getSemaphoreCounterValueKHR(GetNativeSemaphore());
     if (curr_value >= wait_value) // NOSONAR - curr_value declared outside if
         return;
@@ -94,8 +104,11 @@ void FenceVK::WaitOnGpu(CommandQueue& wait_on_command_queue)
     META_FUNCTION_TASK();
     FenceBase::WaitOnGpu(wait_on_command_queue);
 
+    // Commands of all stages supported by the waiting queue are blocked until fence value is signalled,
+    // so that fence can be used for cross-queue dependencies, like render commands depending on async compute results
+    auto& wait_on_command_queue_vk = static_cast<CommandQueueVK&>(wait_on_command_queue);
     const uint64_t wait_value = GetValue();
-    static_cast<CommandQueueVK&>(wait_on_command_queue).WaitForSemaphore(GetNativeSemaphore(), vk::PipelineStageFlagBits::eBottomOfPipe, &wait_value);
+    wait_on_command_queue_vk.WaitForSemaphore(GetNativeSemaphore(), wait_on_command_queue_vk.GetNativeSupportedStageFlags(), &wait_value);
 }
 
 bool FenceVK::SetName(const std::string& name)
@@ -38,8 +38,10 @@ public:
     explicit FenceVK(CommandQueueVK& command_queue);
 
     // Fence overrides
+    using FenceBase::WaitOnCpu;
+    uint64_t GetCompletedValue() const override;
     void Signal() override;
-    void WaitOnCpu() override;
+    void WaitOnCpu(uint64_t wait_value) override;
     void WaitOnGpu(CommandQueue& wait_on_command_queue) override;
 
     // Object override
@@ -0,0 +1,229 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PresentThreadVK.hpp
+Vulkan present thread performing frame presents and acquiring next images ahead of the application thread.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <Tracy.hpp>
+
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <optional>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+// Present thread performs queued frame presents and acquires next images ahead, so that application thread
+// is not blocked in driver on present and can start encoding next frame. Present and acquire operations are
+// passed as functions, and semaphore type is a template parameter, so that present thread is tested without GPU.
+template<typename SemaphoreType>
+class PresentThreadVK // NOSONAR - this class requires destructor
+{
+public:
+    struct FramePresent
+    {
+        uint32_t                   image_index;
+        std::vector<SemaphoreType> wait_semaphores;
+    };
+
+    struct AcquiredImage
+    {
+        uint32_t      image_index;
+        SemaphoreType image_available_semaphore;
+    };
+
+    using PresentImageFunction = std::function<void(const FramePresent&)>;
+    using AcquireImageFunction = std::function<AcquiredImage(const SemaphoreType& image_available_semaphore)>;
+
+    PresentThreadVK() = default;
+    PresentThreadVK(const PresentThreadVK&) = delete;
+    PresentThreadVK(PresentThreadVK&&) = delete;
+    PresentThreadVK& operator=(const PresentThreadVK&) = delete;
+    PresentThreadVK& operator=(PresentThreadVK&&) = delete;
+
+    ~PresentThreadVK()
+    {
+        // Image acquired ahead is dropped, because present thread is stopped explicitly before its semaphores are released
+        static_cast<void>(Stop());
+    }
+
+    [[nodiscard]] bool IsStarted() const noexcept { return m_thread.joinable(); }
+
+    // Acquire semaphores are used in ring order, so their count has to exceed the maximum number of images acquired at once
+    void Start(const PresentImageFunction& present_image, const AcquireImageFunction& acquire_image,
+               std::vector<SemaphoreType> acquire_semaphores, uint32_t max_acquired_images_count)
+    {
+        META_FUNCTION_TASK();
+        if (IsStarted())
+            return;
+
+        if (acquire_semaphores.empty())
+            throw std::invalid_argument("Present thread requires at least one semaphore to acquire images.");
+
+        m_present_image             = present_image;
+        m_acquire_image             = acquire_image;
+        m_acquire_semaphores        = std::move(acquire_semaphores);
+        m_max_acquired_images_count = max_acquired_images_count;
+        m_frame_presents            = {};
+        m_acquired_image_opt.reset();
+        m_acquired_images_count     = 0U;
+        m_acquire_semaphore_index   = 0U;
+        m_exception_ptr             = nullptr;
+        m_is_running                = true;
+        m_thread = std::thread(&PresentThreadVK::Run, this);
+    }
+
+    // Completes all queued frame presents and returns image acquired ahead, which was not taken by application:
+    // its semaphore is signalled by acquire operation and has to be waited before it is released or reused
+    std::optional<AcquiredImage> Stop()
+    {
+        META_FUNCTION_TASK();
+        if (!IsStarted())
+            return std::nullopt;
+
+        {
+            std::scoped_lock lock(m_mutex);
+            m_is_running = false;
+            m_condition_var.notify_all();
+        }
+
+        m_thread.join();
+        return std::exchange(m_acquired_image_opt, std::nullopt);
+    }
+
+    // Queues frame present without waiting for its completion, wait semaphores are copied to the queued present
+    void QueuePresent(FramePresent frame_present)
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock(m_mutex);
+        RethrowException();
+        m_frame_presents.push(std::move(frame_present));
+        m_condition_var.notify_all();
+    }
+
+    // Returns next image, which is usually acquired ahead on the present thread by this moment
+    AcquiredImage TakeAcquiredImage()
+    {
+        META_FUNCTION_TASK();
+        std::unique_lock lock(m_mutex);
+        m_condition_var.wait(lock, [this] { return m_acquired_image_opt.has_value() || !m_is_running; });
+        if (!m_acquired_image_opt)
+        {
+            RethrowException();
+            throw std::logic_error("Present thread has finished without acquiring next frame image.");
+        }
+
+        const AcquiredImage acquired_image = *m_acquired_image_opt;
+        m_acquired_image_opt.reset();
+        m_condition_var.notify_all();
+        return acquired_image;
+    }
+
+private:
+    void Run() noexcept
+    {
+        META_THREAD_NAME("Vulkan Present Thread");
+        try
+        {
+            std::unique_lock lock(m_mutex);
+            while(true)
+            {
+                m_condition_var.wait(lock,
+                    [this] { return !m_frame_presents.empty() || !m_is_running ||
+                                    (!m_acquired_image_opt && m_acquired_images_count < m_max_acquired_images_count); }
+                );
+
+                if (!m_frame_presents.empty())
+                {
+                    const FramePresent frame_present = std::move(m_frame_presents.front());
+                    m_frame_presents.pop();
+                    lock.unlock();
+                    {
+                        META_SCOPE_TIMER("PresentThreadVK::Present");
+                        m_present_image(frame_present);
+                    }
+                    lock.lock();
+                    if (m_acquired_images_count)
+                        m_acquired_images_count--;
+                    continue;
+                }
+
+                if (!m_is_running)
+                    break;
+
+                if (m_acquired_image_opt || m_acquired_images_count >= m_max_acquired_images_count)
+                    continue;
+
+                const SemaphoreType image_available_semaphore = m_acquire_semaphores[m_acquire_semaphore_index];
+                m_acquire_semaphore_index = (m_acquire_semaphore_index + 1) % static_cast<uint32_t>(m_acquire_semaphores.size());
+                lock.unlock();
+                AcquiredImage acquired_image{};
+                {
+                    META_SCOPE_TIMER("PresentThreadVK::AcquireNextImage");
+                    acquired_image = m_acquire_image(image_available_semaphore);
+                }
+                lock.lock();
+                m_acquired_images_count++;
+                m_acquired_image_opt = acquired_image;
+                m_condition_var.notify_all();
+            }
+        }
+        catch(...)
+        {
+            std::scoped_lock lock(m_mutex);
+            m_exception_ptr = std::current_exception();
+            m_is_running = false;
+            m_condition_var.notify_all();
+        }
+    }
+
+    void RethrowException()
+    {
+        if (m_exception_ptr)
+            std::rethrow_exception(std::exchange(m_exception_ptr, nullptr));
+    }
+
+    PresentImageFunction         m_present_image;
+    AcquireImageFunction         m_acquire_image;
+    std::vector<SemaphoreType>   m_acquire_semaphores;
+    uint32_t                     m_max_acquired_images_count = 1U;
+    uint32_t                     m_acquired_images_count = 0U;
+    uint32_t                     m_acquire_semaphore_index = 0U;
+    std::queue<FramePresent>     m_frame_presents;
+    std::optional<AcquiredImage> m_acquired_image_opt;
+    bool                         m_is_running = false;
+    std::exception_ptr           m_exception_ptr;
+    TracyLockable(std::mutex,    m_mutex)
+    std::condition_variable_any  m_condition_var;
+    std::thread                  m_thread;
+};
+
+} // namespace Methane::Graphics
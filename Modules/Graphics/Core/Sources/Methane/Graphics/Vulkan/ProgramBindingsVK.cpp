@@ -118,10 +118,12 @@ bool ProgramBindingsVK::ArgumentBindingVK::SetResourceViews(const Resource::View
     m_vk_descriptor_buffers.clear();
     m_vk_buffer_views.clear();
 
+    // Storage images are accessed by shaders in general image layout, which is selected by the shader write usage of image view
+    const Resource::Usage resource_view_usage = m_settings_vk.is_shader_writable ? Resource::Usage::ShaderWrite : Resource::Usage::ShaderRead;
     const size_t total_resources_count = resource_views.size();
     for(const Resource::View& resource_view : resource_views)
     {
-        const IResourceVK::ViewVK resource_view_vk(resource_view, Resource::Usage::ShaderRead);
+        const IResourceVK::ViewVK resource_view_vk(resource_view, resource_view_usage);
 
         if (AddDescriptor(m_vk_descriptor_images, total_resources_count, resource_view_vk.GetNativeDescriptorImageInfoPtr()))
             continue;
@@ -27,6 +27,7 @@ Vulkan implementation of the render command list interface.
 #include "RenderPassVK.h"
 #include "CommandQueueVK.h"
 #include "ContextVK.h"
+#include "DeviceVK.h"
 #include "BufferVK.h"
 
 #include <Methane/Instrumentation.h>
@@ -34,9 +35,16 @@ Vulkan implementation of the render command list interface.
 
 #include <magic_enum.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
+static_assert(sizeof(RenderCommandList::DrawArguments) == sizeof(vk::DrawIndirectCommand),
+              "Indirect draw arguments layout must be binary compatible with Vulkan draw indirect command");
+static_assert(sizeof(RenderCommandList::DrawIndexedArguments) == sizeof(vk::DrawIndexedIndirectCommand),
+              "Indirect indexed draw arguments layout must be binary compatible with Vulkan draw indexed indirect command");
+
 vk::PrimitiveTopology GetVulkanPrimitiveTopology(RenderCommandList::Primitive primitive_type)
 {
     META_FUNCTION_TASK();
@@ -66,11 +74,35 @@ static vk::IndexType GetVulkanIndexTypeByStride(Data::Size index_stride_bytes)
 static vk::CommandBufferInheritanceInfo CreateRenderCommandBufferInheritanceInfo(const RenderPassVK& render_pass) noexcept
 {
     META_FUNCTION_TASK();
-    return vk::CommandBufferInheritanceInfo(
-        render_pass.GetPatternVK().GetNativeRenderPass(),
+    const RenderPatternVK& render_pattern = render_pass.GetPatternVK();
+    vk::CommandBufferInheritanceInfo vk_inheritance_info(
+        render_pattern.GetNativeRenderPass(),
         0U, // sub-pass
         render_pass.GetNativeFrameBuffer()
     );
+    if (render_pattern.IsDynamicRendering())
+    {
+        // Secondary command buffers executed inside dynamic rendering inherit attachment formats instead of render pass
+        vk_inheritance_info.setPNext(&render_pattern.GetNativeInheritanceRenderingInfo());
+    }
+    return vk_inheritance_info;
+}
+
+static vk::CommandBufferInheritanceInfo CreateBundleCommandBufferInheritanceInfo(const RenderPassVK& render_pass) noexcept
+{
+    META_FUNCTION_TASK();
+    // Frame buffer is not specified for command bundle, so it can be executed in any render pass compatible with the render pattern
+    const RenderPatternVK& render_pattern = render_pass.GetPatternVK();
+    vk::CommandBufferInheritanceInfo vk_inheritance_info(
+        render_pattern.GetNativeRenderPass(),
+        0U, // sub-pass
+        vk::Framebuffer()
+    );
+    if (render_pattern.IsDynamicRendering())
+    {
+        vk_inheritance_info.setPNext(&render_pattern.GetNativeInheritanceRenderingInfo());
+    }
+    return vk_inheritance_info;
 }
 
 Ptr<RenderCommandList> RenderCommandList::Create(CommandQueue& command_queue, RenderPass& render_pass)
@@ -85,6 +117,12 @@ Ptr<RenderCommandList> RenderCommandList::Create(ParallelRenderCommandList& para
     return std::make_shared<RenderCommandListVK>(static_cast<ParallelRenderCommandListVK&>(parallel_render_command_list), false);
 }
 
+Ptr<RenderCommandList> RenderCommandList::CreateBundle(CommandQueue& command_queue, RenderPass& render_pass)
+{
+    META_FUNCTION_TASK();
+    return std::make_shared<RenderCommandListVK>(static_cast<CommandQueueVK&>(command_queue), static_cast<RenderPassVK&>(render_pass), true);
+}
+
 Ptr<RenderCommandList> RenderCommandListBase::CreateForSynchronization(CommandQueue& cmd_queue)
 {
     META_FUNCTION_TASK();
@@ -97,11 +135,19 @@ RenderCommandListVK::RenderCommandListVK(CommandQueueVK& command_queue)
     META_FUNCTION_TASK();
 }
 
-RenderCommandListVK::RenderCommandListVK(CommandQueueVK& command_queue, RenderPassVK& render_pass)
-    : CommandListVK(CreateRenderCommandBufferInheritanceInfo(render_pass), command_queue, render_pass)
+RenderCommandListVK::RenderCommandListVK(CommandQueueVK& command_queue, RenderPassVK& render_pass, bool is_bundle)
+    : CommandListVK(is_bundle ? CreateBundleCommandBufferInheritanceInfo(render_pass) : CreateRenderCommandBufferInheritanceInfo(render_pass),
+                    // Command bundle is encoded once and may be executed simultaneously in command lists of several frames in flight
+                    is_bundle ? vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eSimultaneousUse)
+                              : vk::CommandBufferUsageFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit),
+                    command_queue, render_pass, is_bundle)
 {
     META_FUNCTION_TASK();
-    static_cast<Data::IEmitter<IRenderPassCallback>&>(render_pass).Connect(*this);
+    if (!is_bundle)
+    {
+        // Command bundle does not depend on frame buffer, so it does not need to be updated on render pass changes
+        static_cast<Data::IEmitter<IRenderPassCallback>&>(render_pass).Connect(*this);
+    }
 }
 
 RenderCommandListVK::RenderCommandListVK(ParallelRenderCommandListVK& parallel_render_command_list, bool is_beginning_cmd_list)
@@ -114,14 +160,16 @@ RenderCommandListVK::RenderCommandListVK(ParallelRenderCommandListVK& parallel_r
 void RenderCommandListVK::Reset(DebugGroup* p_debug_group)
 {
     META_FUNCTION_TASK();
-    CommandListVK::ResetCommandState();
+    ResetCommittedBundle();
+    ResetCommandState();
     CommandListVK::Reset(p_debug_group);
 }
 
 void RenderCommandListVK::ResetWithState(RenderState& render_state, DebugGroup* p_debug_group)
 {
     META_FUNCTION_TASK();
-    CommandListVK::ResetCommandState();
+    ResetCommittedBundle();
+    ResetCommandState();
     CommandListVK::Reset(p_debug_group);
     CommandListVK::SetRenderState(render_state);
 }
@@ -172,6 +220,7 @@ void RenderCommandListVK::DrawIndexed(Primitive primitive, uint32_t index_count,
         index_count = drawing_state.index_buffer_ptr->GetFormattedItemsCount();
     }
 
+    m_has_draw_commands = true;
     RenderCommandListBase::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
 
     UpdatePrimitiveTopology(primitive);
@@ -182,18 +231,143 @@ void RenderCommandListVK::Draw(Primitive primitive, uint32_t vertex_count, uint3
                                uint32_t instance_count, uint32_t start_instance)
 {
     META_FUNCTION_TASK();
+    m_has_draw_commands = true;
     RenderCommandListBase::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 
     UpdatePrimitiveTopology(primitive);
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandListVK::DrawIndexedIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                              Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    m_has_draw_commands = true;
+    RenderCommandListBase::DrawIndexedIndirect(primitive, arguments_buffer, draw_count, arguments_offset, p_count_buffer, count_offset);
+
+    SetIndirectBuffersState(arguments_buffer, p_count_buffer);
+    UpdatePrimitiveTopology(primitive);
+
+    const vk::CommandBuffer& vk_command_buffer = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_arguments_buffer = static_cast<BufferVK&>(arguments_buffer).GetNativeResource();
+    const auto               arguments_stride = static_cast<uint32_t>(GetDrawIndirectArgumentsStride(arguments_buffer, sizeof(DrawIndexedArguments)));
+    if (p_count_buffer)
+    {
+        META_CHECK_ARG_TRUE_DESCR(GetCommandQueueVK().GetDeviceVK().IsDrawIndirectCountEnabled(),
+                                  "indirect draw with count buffer is not supported by device");
+        vk_command_buffer.drawIndexedIndirectCountKHR(vk_arguments_buffer, arguments_offset,
+                                                      static_cast<BufferVK*>(p_count_buffer)->GetNativeResource(), count_offset,
+                                                      draw_count, arguments_stride);
+        return;
+    }
+
+    if (draw_count == 1U || GetCommandQueueVK().GetDeviceVK().IsMultiDrawIndirectEnabled())
+    {
+        vk_command_buffer.drawIndexedIndirect(vk_arguments_buffer, arguments_offset, draw_count, arguments_stride);
+        return;
+    }
+
+    // Multi-draw indirect is not supported by device, so each draw is encoded separately
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        vk_command_buffer.drawIndexedIndirect(vk_arguments_buffer, arguments_offset + draw_index * arguments_stride, 1U, arguments_stride);
+    }
+}
+
+void RenderCommandListVK::DrawIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                                       Buffer* p_count_buffer, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    m_has_draw_commands = true;
+    RenderCommandListBase::DrawIndirect(primitive, arguments_buffer, draw_count, arguments_offset, p_count_buffer, count_offset);
+
+    SetIndirectBuffersState(arguments_buffer, p_count_buffer);
+    UpdatePrimitiveTopology(primitive);
+
+    const vk::CommandBuffer& vk_command_buffer = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_arguments_buffer = static_cast<BufferVK&>(arguments_buffer).GetNativeResource();
+    const auto               arguments_stride = static_cast<uint32_t>(GetDrawIndirectArgumentsStride(arguments_buffer, sizeof(DrawArguments)));
+    if (p_count_buffer)
+    {
+        META_CHECK_ARG_TRUE_DESCR(GetCommandQueueVK().GetDeviceVK().IsDrawIndirectCountEnabled(),
+                                  "indirect draw with count buffer is not supported by device");
+        vk_command_buffer.drawIndirectCountKHR(vk_arguments_buffer, arguments_offset,
+                                               static_cast<BufferVK*>(p_count_buffer)->GetNativeResource(), count_offset,
+                                               draw_count, arguments_stride);
+        return;
+    }
+
+    if (draw_count == 1U || GetCommandQueueVK().GetDeviceVK().IsMultiDrawIndirectEnabled())
+    {
+        vk_command_buffer.drawIndirect(vk_arguments_buffer, arguments_offset, draw_count, arguments_stride);
+        return;
+    }
+
+    // Multi-draw indirect is not supported by device, so each draw is encoded separately
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        vk_command_buffer.drawIndirect(vk_arguments_buffer, arguments_offset + draw_index * arguments_stride, 1U, arguments_stride);
+    }
+}
+
+void RenderCommandListVK::ExecuteBundle(RenderCommandList& bundle)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_FALSE_DESCR(IsParallel(), "command bundles can not be executed in thread command lists of parallel rendering");
+    // Command bundles are executed in render pass before all commands encoded in this command list, so preceding draws would be reordered
+    META_CHECK_ARG_FALSE_DESCR(m_has_draw_commands, "command bundle '{}' can not be executed in render command list '{}' after draw commands",
+                               bundle.GetName(), GetName());
+    RenderCommandListBase::ExecuteBundle(bundle);
+
+    auto& vk_bundle = static_cast<RenderCommandListVK&>(bundle);
+    vk_bundle.AddExecutingCommandList(*this);
+
+    Ptr<Resource::Barriers> bundle_transition_barriers_ptr;
+    for(const auto& [resource_ptr, resource_state] : vk_bundle.m_bundle_resource_states)
+    {
+        resource_ptr->SetState(resource_state, bundle_transition_barriers_ptr);
+    }
+
+    if (bundle_transition_barriers_ptr)
+    {
+        // Barriers are recorded to the primary command buffer before render pass begins
+        SetResourceBarriers(*bundle_transition_barriers_ptr);
+    }
+
+    m_vk_bundle_cmd_buffers.emplace_back(vk_bundle.GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+}
+
+void RenderCommandListVK::SetResourceBarriers(const Resource::Barriers& resource_barriers)
+{
+    META_FUNCTION_TASK();
+    if (!IsBundle())
+    {
+        CommandListVK::SetResourceBarriers(resource_barriers);
+        return;
+    }
+
+    VerifyEncodingState();
+
+    const auto lock_guard = resource_barriers.Lock();
+    for(const auto& [barrier_id, barrier] : resource_barriers.GetMap())
+    {
+        if (barrier_id.GetType() != Resource::Barrier::Type::StateTransition)
+            continue;
+
+        // Resource state is rolled back, because transition will be done by the command list executing this bundle
+        Resource& resource = barrier_id.GetResource();
+        const Resource::Barrier::StateChange& state_change = barrier.GetStateChange();
+        m_bundle_resource_states[&resource] = state_change.GetStateAfter();
+        resource.SetState(state_change.GetStateBefore());
+    }
+}
+
 void RenderCommandListVK::Commit()
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_FALSE(IsCommitted());
 
-    if (!IsParallel())
+    if (!IsParallel() && !IsBundle())
     {
         CommitCommandBuffer(CommandBufferType::SecondaryRenderPass);
 
@@ -201,7 +375,11 @@ void RenderCommandListVK::Commit()
         if (render_pass_ptr)
             render_pass_ptr->Begin(*this);
 
-        GetNativeCommandBuffer(CommandBufferType::Primary).executeCommands(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
+        const vk::CommandBuffer& vk_primary_cmd_buffer = GetNativeCommandBuffer(CommandBufferType::Primary);
+        if (!m_vk_bundle_cmd_buffers.empty())
+            vk_primary_cmd_buffer.executeCommands(m_vk_bundle_cmd_buffers);
+
+        vk_primary_cmd_buffer.executeCommands(GetNativeCommandBuffer(CommandBufferType::SecondaryRenderPass));
 
         if (render_pass_ptr)
             render_pass_ptr->End(*this);
@@ -210,6 +388,15 @@ void RenderCommandListVK::Commit()
     CommandListVK::Commit();
 }
 
+void RenderCommandListVK::ResetCommandState()
+{
+    META_FUNCTION_TASK();
+    RenderCommandListBase::ResetCommandState();
+    m_vk_bundle_cmd_buffers.clear();
+    m_bundle_resource_states.clear();
+    m_has_draw_commands = false;
+}
+
 void RenderCommandListVK::OnRenderPassUpdated(const RenderPass& render_pass)
 {
     META_FUNCTION_TASK();
@@ -229,6 +416,66 @@ void RenderCommandListVK::UpdatePrimitiveTopology(Primitive primitive)
     }
 }
 
+void RenderCommandListVK::SetIndirectBuffersState(Buffer& arguments_buffer, Buffer* p_count_buffer)
+{
+    META_FUNCTION_TASK();
+    auto& vk_arguments_buffer = static_cast<BufferVK&>(arguments_buffer);
+    if (Ptr<Resource::Barriers>& buffer_setup_barriers_ptr = vk_arguments_buffer.GetSetupTransitionBarriers();
+        vk_arguments_buffer.SetState(Resource::State::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    if (!p_count_buffer || p_count_buffer == &arguments_buffer)
+        return;
+
+    auto& vk_count_buffer = static_cast<BufferVK&>(*p_count_buffer);
+    if (Ptr<Resource::Barriers>& buffer_setup_barriers_ptr = vk_count_buffer.GetSetupTransitionBarriers();
+        vk_count_buffer.SetState(Resource::State::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+}
+
+void RenderCommandListVK::ResetCommittedBundle()
+{
+    META_FUNCTION_TASK();
+    if (!IsBundle() || !IsCommitted())
+        return;
+
+    // Secondary command buffer of the bundle can not be recorded again while primary command lists executing it are in flight,
+    // so encoding waits for their completion on GPU
+    std::scoped_lock lock_guard(m_bundle_executing_cmd_lists_mutex);
+    for(const WeakPtr<RenderCommandListVK>& executing_cmd_list_wptr : m_bundle_executing_cmd_list_wptrs)
+    {
+        if (const Ptr<RenderCommandListVK> executing_cmd_list_ptr = executing_cmd_list_wptr.lock();
+            executing_cmd_list_ptr)
+        {
+            META_CHECK_ARG_NOT_EQUAL_DESCR(executing_cmd_list_ptr->GetState(), State::Committed,
+                                           "command bundle '{}' can not be reset while it is used in committed command list '{}' pending execution",
+                                           GetName(), executing_cmd_list_ptr->GetName());
+            executing_cmd_list_ptr->WaitUntilCompleted();
+        }
+    }
+    m_bundle_executing_cmd_list_wptrs.clear();
+
+    // Command bundle is never executed on command queue, so it stays in committed state until it is reset for encoding again
+    SetCommandListState(State::Pending);
+    ReleaseRetainedResources();
+}
+
+void RenderCommandListVK::AddExecutingCommandList(RenderCommandListVK& executing_cmd_list)
+{
+    META_FUNCTION_TASK();
+    const Ptr<RenderCommandListVK> executing_cmd_list_ptr = executing_cmd_list.GetPtr<RenderCommandListVK>();
+    std::scoped_lock lock_guard(m_bundle_executing_cmd_lists_mutex);
+    m_bundle_executing_cmd_list_wptrs.erase(std::remove_if(m_bundle_executing_cmd_list_wptrs.begin(), m_bundle_executing_cmd_list_wptrs.end(),
+                                                           [&executing_cmd_list_ptr](const WeakPtr<RenderCommandListVK>& cmd_list_wptr)
+                                                           { return cmd_list_wptr.expired() || cmd_list_wptr.lock() == executing_cmd_list_ptr; }),
+                                            m_bundle_executing_cmd_list_wptrs.end());
+    m_bundle_executing_cmd_list_wptrs.emplace_back(executing_cmd_list_ptr);
+}
+
 RenderPassVK& RenderCommandListVK::GetPassVK()
 {
     META_FUNCTION_TASK();
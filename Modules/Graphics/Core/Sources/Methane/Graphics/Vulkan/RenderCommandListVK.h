@@ -30,6 +30,10 @@ Vulkan implementation of the render command list interface.
 
 #include <vulkan/vulkan.hpp>
 
+#include <map>
+#include <mutex>
+#include <vector>
+
 namespace Methane::Graphics
 {
 
@@ -44,10 +48,11 @@ class RenderCommandListVK final // NOSONAR - inheritance hierarchy is greater th
 {
 public:
     explicit RenderCommandListVK(CommandQueueVK& command_queue);
-    RenderCommandListVK(CommandQueueVK& command_queue, RenderPassVK& render_pass);
+    RenderCommandListVK(CommandQueueVK& command_queue, RenderPassVK& render_pass, bool is_bundle = false);
     explicit RenderCommandListVK(ParallelRenderCommandListVK& parallel_render_command_list, bool is_beginning_cmd_list);
 
     // CommandList interface
+    void SetResourceBarriers(const Resource::Barriers& resource_barriers) override;
     void Commit() override;
 
     // RenderCommandList interface
@@ -59,14 +64,34 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                             Buffer* p_count_buffer, Data::Size count_offset) override;
+    void DrawIndirect(Primitive primitive, Buffer& arguments_buffer, uint32_t draw_count, Data::Size arguments_offset,
+                      Buffer* p_count_buffer, Data::Size count_offset) override;
+    void ExecuteBundle(RenderCommandList& bundle) override;
+
+protected:
+    // CommandListBase overrides
+    void ResetCommandState() override;
 
 private:
     // IRenderPassCallback
     void OnRenderPassUpdated(const RenderPass& render_pass) override;
 
     void UpdatePrimitiveTopology(Primitive primitive);
+    void SetIndirectBuffersState(Buffer& arguments_buffer, Buffer* p_count_buffer);
+    void ResetCommittedBundle();
+    void AddExecutingCommandList(RenderCommandListVK& executing_cmd_list);
 
     RenderPassVK& GetPassVK();
+
+    // Command bundle does not record resource barriers, because it is executed inside render pass;
+    // instead it keeps resource states required by its commands to be set by the command lists executing it
+    std::map<Resource*, Resource::State> m_bundle_resource_states;
+    std::vector<vk::CommandBuffer>       m_vk_bundle_cmd_buffers;
+    WeakPtrs<RenderCommandListVK>        m_bundle_executing_cmd_list_wptrs; // primary command lists which executed this bundle
+    TracyLockable(std::mutex,            m_bundle_executing_cmd_lists_mutex)
+    bool                                 m_has_draw_commands = false;
 };
 
 } // namespace Methane::Graphics
@@ -35,6 +35,7 @@ Vulkan implementation of the render context interface.
 #include <fmt/format.h>
 #include <magic_enum.hpp>
 #include <sstream>
+#include <utility>
 
 namespace Methane::Graphics
 {
@@ -48,6 +49,15 @@ Ptr<RenderContext> RenderContext::Create(const Platform::AppEnvironment& env, De
     return render_context_ptr;
 }
 
+Ptr<RenderContext> RenderContext::CreateHeadless(Device& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings)
+{
+    META_FUNCTION_TASK();
+    auto& device_vk = static_cast<DeviceVK&>(device);
+    const auto render_context_ptr = std::make_shared<RenderContextVK>(device_vk, parallel_executor, settings);
+    render_context_ptr->Initialize(device_vk, true);
+    return render_context_ptr;
+}
+
 #ifndef __APPLE__
 
 RenderContextVK::RenderContextVK(const Platform::AppEnvironment& app_env, DeviceVK& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings)
@@ -60,6 +70,16 @@ RenderContextVK::RenderContextVK(const Platform::AppEnvironment& app_env, Device
 
 #endif // #ifndef __APPLE__
 
+RenderContextVK::RenderContextVK(DeviceVK& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings)
+    : ContextVK<RenderContextBase>(device, parallel_executor, settings)
+    , m_vk_device(device.GetNativeDevice())
+#ifdef __APPLE__
+    , m_metal_view(nullptr)
+#endif
+{
+    META_FUNCTION_TASK();
+}
+
 RenderContextVK::~RenderContextVK()
 {
     META_FUNCTION_TASK();
@@ -110,7 +130,13 @@ void RenderContextVK::WaitForGpu(WaitFor wait_for)
     CommandList::Type cl_type = CommandList::Type::Render;
     switch (wait_for)
     {
-    case WaitFor::RenderComplete:    m_vk_device.waitIdle(); break;
+    case WaitFor::RenderComplete:
+    {
+        // Device wait idle requires external synchronization with present on the render queue
+        const auto queue_lock = GetDefaultCommandQueueVK(CommandList::Type::Render).LockNativeQueue();
+        m_vk_device.waitIdle();
+        break;
+    }
     case WaitFor::FramePresented:    frame_buffer_index = GetFrameBufferIndex(); break;
     case WaitFor::ResourcesUploaded: cl_type = CommandList::Type::Blit; break;
     default: META_UNEXPECTED_ARG(wait_for);
@@ -143,17 +169,26 @@ void RenderContextVK::Present()
     ContextVK<RenderContextBase>::Present();
 
     auto& render_command_queue = static_cast<CommandQueueVK&>(GetRenderCommandKit().GetQueue());
+    render_command_queue.FlushSubmits();
 
     // Present frame to screen
     const uint32_t image_index = GetFrameBufferIndex();
-    const vk::PresentInfoKHR present_info(
-        render_command_queue.GetWaitForFrameExecutionCompleted(image_index).semaphores,
-        GetNativeSwapchain(), image_index
-    );
-    if (const vk::Result present_result = render_command_queue.GetNativeQueue().presentKHR(present_info);
-        present_result != vk::Result::eSuccess &&
-        present_result != vk::Result::eSuboptimalKHR)
-        throw InvalidArgumentException<vk::Result>("RenderContextVK::Present", "present_result", present_result, "failed to present frame image on screen");
+    const std::vector<vk::Semaphore>& vk_wait_semaphores = render_command_queue.GetWaitForFrameExecutionCompleted(image_index).semaphores;
+    if (IsHeadless())
+    {
+        // Offscreen frame is not presented, but semaphores of frame execution completion still have to be waited by the queue
+        // the same way as with present, so that binary semaphores are unsignaled before they are signalled again in next frames
+        WaitSemaphoresOnRenderQueue(vk_wait_semaphores);
+    }
+    else if (IsPresentThreadEnabled())
+    {
+        // Wait semaphores are copied to the queued present, because they are reset for the next frame below
+        m_present_thread.QueuePresent({ image_index, vk_wait_semaphores });
+    }
+    else
+    {
+        PresentImage(image_index, vk_wait_semaphores);
+    }
 
     render_command_queue.ResetWaitForFrameExecution(image_index);
 
@@ -204,17 +239,108 @@ const vk::Semaphore& RenderContextVK::GetNativeFrameImageAvailableSemaphore() co
 }
 
 uint32_t RenderContextVK::GetNextFrameBufferIndex()
+{
+    META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        // Offscreen frame buffers are used in ring order, since there is no swap-chain to acquire images from
+        return RenderContextBase::GetNextFrameBufferIndex();
+    }
+
+    const AcquiredImage acquired_image = IsPresentThreadEnabled()
+                                       ? m_present_thread.TakeAcquiredImage()
+                                       : AcquireNextImage(m_vk_frame_semaphores_pool[RenderContextBase::GetFrameBufferIndex()].get());
+
+    m_vk_frame_image_available_semaphores[acquired_image.image_index % m_vk_frame_image_available_semaphores.size()] = acquired_image.image_available_semaphore;
+    return acquired_image.image_index % RenderContextBase::GetSettings().frame_buffers_count;
+}
+
+RenderContextVK::AcquiredImage RenderContextVK::AcquireNextImage(const vk::Semaphore& vk_image_available_semaphore)
 {
     META_FUNCTION_TASK();
     uint32_t next_image_index = 0;
-    const vk::Semaphore& vk_image_available_semaphore = m_vk_frame_semaphores_pool[RenderContextBase::GetFrameBufferIndex()].get();
     if (const vk::Result image_acquire_result = m_vk_device.acquireNextImageKHR(GetNativeSwapchain(), std::numeric_limits<uint64_t>::max(), vk_image_available_semaphore, {}, &next_image_index);
         image_acquire_result != vk::Result::eSuccess &&
         image_acquire_result != vk::Result::eSuboptimalKHR)
-        throw InvalidArgumentException<vk::Result>("RenderContextVK::GetNextFrameBufferIndex", "image_acquire_result", image_acquire_result, "failed to acquire next image");
+        throw InvalidArgumentException<vk::Result>("RenderContextVK::AcquireNextImage", "image_acquire_result", image_acquire_result, "failed to acquire next image");
+
+    return AcquiredImage{ next_image_index, vk_image_available_semaphore };
+}
+
+void RenderContextVK::PresentImage(uint32_t image_index, const std::vector<vk::Semaphore>& vk_wait_semaphores)
+{
+    META_FUNCTION_TASK();
+    auto& render_command_queue = static_cast<CommandQueueVK&>(GetRenderCommandKit().GetQueue());
+    const vk::PresentInfoKHR present_info(vk_wait_semaphores, GetNativeSwapchain(), image_index);
+
+    const auto queue_lock = render_command_queue.LockNativeQueue();
+    if (const vk::Result present_result = render_command_queue.GetNativeQueue().presentKHR(present_info);
+        present_result != vk::Result::eSuccess &&
+        present_result != vk::Result::eSuboptimalKHR)
+        throw InvalidArgumentException<vk::Result>("RenderContextVK::PresentImage", "present_result", present_result, "failed to present frame image on screen");
+}
+
+void RenderContextVK::WaitSemaphoresOnRenderQueue(const std::vector<vk::Semaphore>& vk_wait_semaphores)
+{
+    META_FUNCTION_TASK();
+    if (vk_wait_semaphores.empty())
+        return;
+
+    auto& render_command_queue = static_cast<CommandQueueVK&>(GetRenderCommandKit().GetQueue());
+    const std::vector<vk::PipelineStageFlags> vk_wait_stages(vk_wait_semaphores.size(), vk::PipelineStageFlagBits::eAllCommands);
+    const vk::SubmitInfo submit_info(vk_wait_semaphores, vk_wait_stages);
+
+    const auto queue_lock = render_command_queue.LockNativeQueue();
+    render_command_queue.GetNativeQueue().submit(submit_info);
+}
+
+bool RenderContextVK::IsDynamicRenderingEnabled() const noexcept
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    return static_cast<bool>(GetSettings().options_mask & Context::Options::DynamicRenderingOnVulkan) &&
+           GetDeviceVK().IsDynamicRenderingEnabled();
+}
 
-    m_vk_frame_image_available_semaphores[next_image_index % m_vk_frame_image_available_semaphores.size()] = vk_image_available_semaphore;
-    return next_image_index % RenderContextBase::GetSettings().frame_buffers_count;
+bool RenderContextVK::IsPresentThreadEnabled() const noexcept
+{
+    META_FUNCTION_TASK();
+    using namespace magic_enum::bitwise_operators;
+    return !IsHeadless() && static_cast<bool>(GetSettings().options_mask & Context::Options::PresentThreadOnVulkan);
+}
+
+void RenderContextVK::StartPresentThread()
+{
+    META_FUNCTION_TASK();
+    if (!IsPresentThreadEnabled() || m_present_thread.IsStarted())
+        return;
+
+    // Pool has one extra semaphore for the image acquired ahead on present thread
+    std::vector<vk::Semaphore> vk_acquire_semaphores;
+    vk_acquire_semaphores.reserve(m_vk_frame_semaphores_pool.size());
+    for(const vk::UniqueSemaphore& vk_unique_frame_semaphore : m_vk_frame_semaphores_pool)
+    {
+        vk_acquire_semaphores.emplace_back(vk_unique_frame_semaphore.get());
+    }
+
+    m_present_thread.Start(
+        [this](const PresentThread::FramePresent& frame_present) { PresentImage(frame_present.image_index, frame_present.wait_semaphores); },
+        [this](const vk::Semaphore& vk_image_available_semaphore) { return AcquireNextImage(vk_image_available_semaphore); },
+        std::move(vk_acquire_semaphores), m_max_acquired_images_count
+    );
+}
+
+void RenderContextVK::StopPresentThread()
+{
+    META_FUNCTION_TASK();
+    // All queued frame presents are completed before the thread is finished
+    if (const std::optional<AcquiredImage> acquired_image_opt = m_present_thread.Stop();
+        acquired_image_opt)
+    {
+        // Semaphore of the image acquired ahead is signalled, but not waited by any frame,
+        // so it is waited on the queue to be unsignalled before the semaphore is destroyed on swap-chain reset
+        WaitSemaphoresOnRenderQueue({ acquired_image_opt->image_available_semaphore });
+    }
 }
 
 vk::SurfaceFormatKHR RenderContextVK::ChooseSwapSurfaceFormat(const std::vector<vk::SurfaceFormatKHR>& available_formats) const
@@ -285,6 +411,11 @@ vk::Extent2D RenderContextVK::ChooseSwapExtent(const vk::SurfaceCapabilitiesKHR&
 void RenderContextVK::InitializeNativeSwapchain()
 {
     META_FUNCTION_TASK();
+    if (IsHeadless())
+    {
+        InitializeNativeOffscreenImages();
+        return;
+    }
 
     if (const uint32_t present_queue_family_index = GetDeviceVK().GetQueueFamilyReservation(CommandList::Type::Render).GetFamilyIndex();
         !GetDeviceVK().GetNativePhysicalDevice().getSurfaceSupportKHR(present_queue_family_index, GetNativeSurface()))
@@ -297,6 +428,10 @@ void RenderContextVK::InitializeNativeSwapchain()
     const vk::PresentModeKHR         swap_present_mode   = ChooseSwapPresentMode(swap_chain_support.present_modes);
     const vk::Extent2D               swap_extent         = ChooseSwapExtent(swap_chain_support.capabilities);
 
+    // Frame buffer images are also used as copy source, when supported, to read rendered frames back to CPU
+    const vk::ImageUsageFlags swap_image_usage = vk::ImageUsageFlagBits::eColorAttachment |
+                                                 (swap_chain_support.capabilities.supportedUsageFlags & vk::ImageUsageFlagBits::eTransferSrc);
+
     uint32_t image_count = std::max(swap_chain_support.capabilities.minImageCount, GetSettings().frame_buffers_count);
     if (swap_chain_support.capabilities.maxImageCount && image_count > swap_chain_support.capabilities.maxImageCount)
     {
@@ -312,7 +447,7 @@ void RenderContextVK::InitializeNativeSwapchain()
             swap_surface_format.colorSpace,
             swap_extent,
             1,
-            vk::ImageUsageFlagBits::eColorAttachment,
+            swap_image_usage,
             vk::SharingMode::eExclusive, 0, nullptr,
             swap_chain_support.capabilities.currentTransform,
             vk::CompositeAlphaFlagBitsKHR::eOpaque,
@@ -323,24 +458,79 @@ void RenderContextVK::InitializeNativeSwapchain()
     m_vk_frame_images = m_vk_device.getSwapchainImagesKHR(GetNativeSwapchain());
     m_vk_frame_format = swap_surface_format.format;
     m_vk_frame_extent = swap_extent;
+    m_vk_frame_image_usage = swap_image_usage;
 
     if (m_vk_frame_images.size() != GetSettings().frame_buffers_count)
         InvalidateFrameBuffersCount(static_cast<uint32_t>(m_vk_frame_images.size()));
 
-    // Create frame semaphores in pool
+    // Number of images which can be acquired at once without blocking forever, which limits acquiring images ahead on present thread
+    m_max_acquired_images_count = static_cast<uint32_t>(m_vk_frame_images.size()) - swap_chain_support.capabilities.minImageCount + 1U;
+
+    // Frame semaphores are always recreated with swap-chain, because semaphores of the previous swap-chain could be left
+    // signalled by acquired images; pool has one extra semaphore for image acquired ahead on present thread
     const uint32_t frame_buffers_count = GetSettings().frame_buffers_count;
-    m_vk_frame_semaphores_pool.resize(frame_buffers_count);
-    for(vk::UniqueSemaphore& vk_unique_frame_semaphore : m_vk_frame_semaphores_pool)
+    const uint32_t frame_semaphores_count = IsPresentThreadEnabled() ? frame_buffers_count + 1U : frame_buffers_count;
+    m_vk_frame_semaphores_pool.clear();
+    m_vk_frame_semaphores_pool.reserve(frame_semaphores_count);
+    for(uint32_t frame_semaphore_index = 0U; frame_semaphore_index < frame_semaphores_count; ++frame_semaphore_index)
     {
-        if (vk_unique_frame_semaphore)
-            continue;
-
-        vk_unique_frame_semaphore = m_vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo());
+        m_vk_frame_semaphores_pool.emplace_back(m_vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo()));
     }
 
     // Image available semaphores are assigned from frame semaphores in GetNextFrameBufferIndex
     m_vk_frame_image_available_semaphores.resize(frame_buffers_count);
 
+    ResetNativeObjectNames();
+    StartPresentThread();
+
+    Data::Emitter<IRenderContextVKCallback>::Emit(&IRenderContextVKCallback::OnRenderContextVKSwapchainChanged, std::ref(*this));
+}
+
+void RenderContextVK::InitializeNativeOffscreenImages()
+{
+    META_FUNCTION_TASK();
+    const RenderContext::Settings& settings = GetSettings();
+    const vk::Format     vk_frame_format = TypeConverterVK::PixelFormatToVulkan(settings.color_format);
+    const vk::Extent2D   vk_frame_extent(settings.frame_size.GetWidth(), settings.frame_size.GetHeight());
+    const DeviceVK&      device          = GetDeviceVK();
+    const vk::ImageUsageFlags vk_frame_image_usage = vk::ImageUsageFlagBits::eColorAttachment |
+                                                     vk::ImageUsageFlagBits::eTransferSrc |
+                                                     vk::ImageUsageFlagBits::eSampled;
+
+    // Offscreen frame buffer images are used the same way as swap-chain images and can be always read back to CPU
+    m_vk_offscreen_images.reserve(settings.frame_buffers_count);
+    m_vk_offscreen_images_memory.reserve(settings.frame_buffers_count);
+    for(uint32_t frame_buffer_index = 0U; frame_buffer_index < settings.frame_buffers_count; ++frame_buffer_index)
+    {
+        vk::UniqueImage vk_unique_image = m_vk_device.createImageUnique(
+            vk::ImageCreateInfo(
+                vk::ImageCreateFlags{},
+                vk::ImageType::e2D,
+                vk_frame_format,
+                vk::Extent3D(vk_frame_extent, 1U),
+                1U, 1U,
+                vk::SampleCountFlagBits::e1,
+                vk::ImageTiling::eOptimal,
+                vk_frame_image_usage,
+                vk::SharingMode::eExclusive));
+
+        const vk::MemoryRequirements vk_memory_requirements = m_vk_device.getImageMemoryRequirements(vk_unique_image.get());
+        const Opt<uint32_t> memory_type_opt = device.FindMemoryType(vk_memory_requirements.memoryTypeBits, vk::MemoryPropertyFlagBits::eDeviceLocal);
+        if (!memory_type_opt)
+            throw Context::IncompatibleException("Device does not have memory type suitable for offscreen frame buffers.");
+
+        vk::UniqueDeviceMemory vk_unique_memory = m_vk_device.allocateMemoryUnique(vk::MemoryAllocateInfo(vk_memory_requirements.size, *memory_type_opt));
+        m_vk_device.bindImageMemory(vk_unique_image.get(), vk_unique_memory.get(), 0U);
+
+        m_vk_frame_images.emplace_back(vk_unique_image.get());
+        m_vk_offscreen_images.emplace_back(std::move(vk_unique_image));
+        m_vk_offscreen_images_memory.emplace_back(std::move(vk_unique_memory));
+    }
+
+    m_vk_frame_format = vk_frame_format;
+    m_vk_frame_extent = vk_frame_extent;
+    m_vk_frame_image_usage = vk_frame_image_usage;
+
     ResetNativeObjectNames();
 
     Data::Emitter<IRenderContextVKCallback>::Emit(&IRenderContextVKCallback::OnRenderContextVKSwapchainChanged, std::ref(*this));
@@ -349,11 +539,14 @@ void RenderContextVK::InitializeNativeSwapchain()
 void RenderContextVK::ReleaseNativeSwapchainResources()
 {
     META_FUNCTION_TASK();
+    StopPresentThread();
     WaitForGpu(WaitFor::RenderComplete);
 
     m_vk_frame_semaphores_pool.clear();
     m_vk_frame_image_available_semaphores.clear();
     m_vk_frame_images.clear();
+    m_vk_offscreen_images.clear();
+    m_vk_offscreen_images_memory.clear();
     m_vk_unique_swapchain.reset();
 }
 
@@ -372,7 +565,17 @@ void RenderContextVK::ResetNativeObjectNames() const
     if (context_name.empty())
         return;
 
-    SetVulkanObjectName(m_vk_device, m_vk_unique_surface.get(), context_name.c_str());
+    if (m_vk_unique_surface)
+    {
+        SetVulkanObjectName(m_vk_device, m_vk_unique_surface.get(), context_name.c_str());
+    }
+
+    uint32_t offscreen_image_index = 0U;
+    for (const vk::UniqueImage& vk_unique_offscreen_image : m_vk_offscreen_images)
+    {
+        const std::string offscreen_image_name = fmt::format("{} Offscreen Frame Buffer {}", GetName(), offscreen_image_index++);
+        SetVulkanObjectName(m_vk_device, vk_unique_offscreen_image.get(), offscreen_image_name.c_str());
+    }
 
     uint32_t frame_index = 0u;
     for (const vk::UniqueSemaphore& vk_unique_frame_semaphore : m_vk_frame_semaphores_pool)
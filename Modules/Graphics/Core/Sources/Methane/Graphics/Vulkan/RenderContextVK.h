@@ -24,6 +24,7 @@ Vulkan implementation of the render context interface.
 #pragma once
 
 #include "ContextVK.hpp"
+#include "PresentThreadVK.hpp"
 
 #include <Methane/Graphics/RenderContextBase.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -57,6 +58,7 @@ class RenderContextVK final // NOSONAR - this class requires destructor
 {
 public:
     RenderContextVK(const Platform::AppEnvironment& app_env, DeviceVK& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings);
+    RenderContextVK(DeviceVK& device, tf::Executor& parallel_executor, const RenderContext::Settings& settings); // headless
     ~RenderContextVK() override;
 
     // Context interface
@@ -77,10 +79,13 @@ public:
     // ObjectBase overrides
     bool SetName(const std::string& name) override;
 
+    bool                    IsHeadless() const noexcept           { return !m_vk_unique_surface; }
+    bool                    IsDynamicRenderingEnabled() const noexcept;
     const vk::SurfaceKHR&   GetNativeSurface() const noexcept     { return m_vk_unique_surface.get(); }
     const vk::SwapchainKHR& GetNativeSwapchain() const noexcept   { return m_vk_unique_swapchain.get(); }
     const vk::Extent2D&     GetNativeFrameExtent() const noexcept { return m_vk_frame_extent; }
     vk::Format              GetNativeFrameFormat() const noexcept { return m_vk_frame_format; }
+    vk::ImageUsageFlags     GetNativeFrameImageUsage() const noexcept { return m_vk_frame_image_usage; }
     const vk::Image&        GetNativeFrameImage(uint32_t frame_buffer_index) const;
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore(uint32_t frame_buffer_index) const;
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore() const;
@@ -90,10 +95,24 @@ protected:
     uint32_t GetNextFrameBufferIndex() override;
 
 private:
+    using PresentThread = PresentThreadVK<vk::Semaphore>;
+    using AcquiredImage = PresentThread::AcquiredImage;
+
+    AcquiredImage AcquireNextImage(const vk::Semaphore& vk_image_available_semaphore);
+    void PresentImage(uint32_t image_index, const std::vector<vk::Semaphore>& vk_wait_semaphores);
+    void WaitSemaphoresOnRenderQueue(const std::vector<vk::Semaphore>& vk_wait_semaphores);
+
+    // Present thread performs frame presents queued by Present() calls and acquires next images ahead,
+    // so that application thread is not blocked in driver on present and can start encoding next frame
+    bool IsPresentThreadEnabled() const noexcept;
+    void StartPresentThread();
+    void StopPresentThread();
+
     vk::SurfaceFormatKHR ChooseSwapSurfaceFormat(const std::vector<vk::SurfaceFormatKHR>& available_formats) const;
     vk::PresentModeKHR ChooseSwapPresentMode(const std::vector<vk::PresentModeKHR>& available_present_modes) const;
     vk::Extent2D ChooseSwapExtent(const vk::SurfaceCapabilitiesKHR& surface_caps) const;
     void InitializeNativeSwapchain();
+    void InitializeNativeOffscreenImages();
     void ReleaseNativeSwapchainResources();
     void ResetNativeSwapchain();
     void ResetNativeObjectNames() const;
@@ -106,10 +125,15 @@ private:
     const vk::UniqueSurfaceKHR       m_vk_unique_surface;
     vk::UniqueSwapchainKHR           m_vk_unique_swapchain;
     vk::Format                       m_vk_frame_format;
+    vk::ImageUsageFlags              m_vk_frame_image_usage;
     vk::Extent2D                     m_vk_frame_extent;
     std::vector<vk::Image>           m_vk_frame_images;
+    std::vector<vk::UniqueImage>     m_vk_offscreen_images;          // headless context only
+    std::vector<vk::UniqueDeviceMemory> m_vk_offscreen_images_memory; // headless context only
     std::vector<vk::UniqueSemaphore> m_vk_frame_semaphores_pool;
     std::vector<vk::Semaphore>       m_vk_frame_image_available_semaphores;
+    uint32_t                         m_max_acquired_images_count = 1U;
+    PresentThread                    m_present_thread;
 };
 
 } // namespace Methane::Graphics
@@ -94,16 +94,50 @@ static vk::ImageLayout GetFinalImageLayoutOfAttachment(const RenderPattern::Atta
     }
 }
 
-static vk::AttachmentDescription GetVulkanAttachmentDescription(const RenderPattern::Attachment& attachment, bool is_final_pass)
+static vk::ImageLayout GetImageLayoutOfAttachment(const RenderPattern::Attachment& attachment)
+{
+    META_FUNCTION_TASK();
+    return attachment.GetType() == RenderPattern::Attachment::Type::Color
+         ? vk::ImageLayout::eColorAttachmentOptimal
+         : vk::ImageLayout::eDepthStencilAttachmentOptimal;
+}
+
+static vk::ImageLayout GetInitialImageLayoutOfAttachment(const RenderPattern::Attachment& attachment)
 {
     META_FUNCTION_TASK();
     // FIXME: Current solution is unreliable, instead initial attachment State should be set in RenderPattern::Settings
-    const vk::ImageLayout attachment_type_layout = attachment.GetType() == RenderPattern::Attachment::Type::Color
-                                                 ? vk::ImageLayout::eColorAttachmentOptimal
-                                                 : vk::ImageLayout::eDepthStencilAttachmentOptimal;
-    const vk::ImageLayout initial_image_layout = attachment.load_action == RenderPattern::Attachment::LoadAction::Load
-                                               ? attachment_type_layout
-                                               : vk::ImageLayout::eUndefined;
+    return attachment.load_action == RenderPattern::Attachment::LoadAction::Load
+         ? GetImageLayoutOfAttachment(attachment)
+         : vk::ImageLayout::eUndefined;
+}
+
+static vk::PipelineStageFlags GetPipelineStagesOfAttachment(const RenderPattern::Attachment& attachment)
+{
+    META_FUNCTION_TASK();
+    return attachment.GetType() == RenderPattern::Attachment::Type::Color
+         ? vk::PipelineStageFlags(vk::PipelineStageFlagBits::eColorAttachmentOutput)
+         : vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests;
+}
+
+static vk::AccessFlags GetWriteAccessOfAttachment(const RenderPattern::Attachment& attachment)
+{
+    META_FUNCTION_TASK();
+    return attachment.GetType() == RenderPattern::Attachment::Type::Color
+         ? vk::AccessFlags(vk::AccessFlagBits::eColorAttachmentWrite)
+         : vk::AccessFlags(vk::AccessFlagBits::eDepthStencilAttachmentWrite);
+}
+
+static vk::AccessFlags GetReadWriteAccessOfAttachment(const RenderPattern::Attachment& attachment)
+{
+    META_FUNCTION_TASK();
+    return attachment.GetType() == RenderPattern::Attachment::Type::Color
+         ? vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite
+         : vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+}
+
+static vk::AttachmentDescription GetVulkanAttachmentDescription(const RenderPattern::Attachment& attachment, bool is_final_pass)
+{
+    META_FUNCTION_TASK();
     return vk::AttachmentDescription(
         vk::AttachmentDescriptionFlags{},
         TypeConverterVK::PixelFormatToVulkan(attachment.format),
@@ -113,11 +147,27 @@ static vk::AttachmentDescription GetVulkanAttachmentDescription(const RenderPatt
         // TODO: stencil is not supported yet
         vk::AttachmentLoadOp::eDontCare,
         vk::AttachmentStoreOp::eDontCare,
-        initial_image_layout,
+        GetInitialImageLayoutOfAttachment(attachment),
         GetFinalImageLayoutOfAttachment(attachment, is_final_pass)
     );
 }
 
+static vk::RenderingAttachmentInfoKHR GetVulkanRenderingAttachmentInfo(const RenderPattern::Attachment& attachment, const vk::ImageView& vk_image_view,
+                                                                       const vk::ClearValue& vk_clear_value)
+{
+    META_FUNCTION_TASK();
+    return vk::RenderingAttachmentInfoKHR(
+        vk_image_view,
+        GetImageLayoutOfAttachment(attachment),
+        vk::ResolveModeFlagBits::eNone,
+        vk::ImageView(),
+        vk::ImageLayout::eUndefined,
+        GetVulkanAttachmentLoadOp(attachment.load_action),
+        GetVulkanAttachmentStoreOp(attachment.store_action),
+        vk_clear_value
+    );
+}
+
 static vk::UniqueRenderPass CreateVulkanRenderPass(const vk::Device& vk_device, const RenderPattern::Settings& settings)
 {
     META_FUNCTION_TASK();
@@ -186,7 +236,9 @@ Ptr<RenderPattern> RenderPattern::Create(RenderContext& render_context, const Se
 
 RenderPatternVK::RenderPatternVK(RenderContextVK& render_context, const Settings& settings)
     : RenderPatternBase(render_context, settings)
-    , m_vk_unique_render_pass(CreateVulkanRenderPass(render_context.GetDeviceVK().GetNativeDevice(), settings))
+    , m_vk_unique_render_pass(render_context.IsDynamicRenderingEnabled()
+                              ? vk::UniqueRenderPass()
+                              : CreateVulkanRenderPass(render_context.GetDeviceVK().GetNativeDevice(), settings))
 {
     META_FUNCTION_TASK();
 
@@ -206,6 +258,11 @@ RenderPatternVK::RenderPatternVK(RenderContextVK& render_context, const Settings
             )
         );
     }
+
+    if (IsDynamicRendering())
+    {
+        InitializeDynamicRenderingInfo(settings);
+    }
 }
 
 bool RenderPatternVK::SetName(const std::string& name)
@@ -214,7 +271,10 @@ bool RenderPatternVK::SetName(const std::string& name)
     if (!RenderPatternBase::SetName(name))
         return false;
 
-    SetVulkanObjectName(GetRenderContextVK().GetDeviceVK().GetNativeDevice(), m_vk_unique_render_pass.get(), name.c_str());
+    if (m_vk_unique_render_pass)
+    {
+        SetVulkanObjectName(GetRenderContextVK().GetDeviceVK().GetNativeDevice(), m_vk_unique_render_pass.get(), name.c_str());
+    }
     return true;
 }
 
@@ -230,6 +290,40 @@ RenderContextVK& RenderPatternVK::GetRenderContextVK() noexcept
     return static_cast<RenderContextVK&>(GetRenderContextBase());
 }
 
+void RenderPatternVK::InitializeDynamicRenderingInfo(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    m_vk_color_attachment_formats.reserve(settings.color_attachments.size());
+    std::transform(settings.color_attachments.begin(), settings.color_attachments.end(), std::back_inserter(m_vk_color_attachment_formats),
+                   [](const ColorAttachment& color_attachment)
+                   { return TypeConverterVK::PixelFormatToVulkan(color_attachment.format); });
+
+    const vk::Format vk_depth_format   = settings.depth_attachment
+                                       ? TypeConverterVK::PixelFormatToVulkan(settings.depth_attachment->format)
+                                       : vk::Format::eUndefined;
+    const vk::Format vk_stencil_format = settings.stencil_attachment
+                                       ? TypeConverterVK::PixelFormatToVulkan(settings.stencil_attachment->format)
+                                       : vk::Format::eUndefined;
+    const Data::Size samples_count     = !settings.color_attachments.empty() ? settings.color_attachments.front().samples_count
+                                       : settings.depth_attachment ? settings.depth_attachment->samples_count
+                                       : 1U;
+
+    m_vk_pipeline_rendering_info = vk::PipelineRenderingCreateInfoKHR(
+        0U, // view mask
+        m_vk_color_attachment_formats,
+        vk_depth_format,
+        vk_stencil_format
+    );
+    m_vk_inheritance_rendering_info = vk::CommandBufferInheritanceRenderingInfoKHR(
+        vk::RenderingFlagsKHR{},
+        0U, // view mask
+        m_vk_color_attachment_formats,
+        vk_depth_format,
+        vk_stencil_format,
+        GetVulkanSampleCountFlag(samples_count)
+    );
+}
+
 Ptr<RenderPass> RenderPass::Create(RenderPattern& render_pattern, const Settings& settings)
 {
     META_FUNCTION_TASK();
@@ -238,10 +332,9 @@ Ptr<RenderPass> RenderPass::Create(RenderPattern& render_pattern, const Settings
 
 RenderPassVK::RenderPassVK(RenderPatternVK& render_pattern, const Settings& settings)
     : RenderPassBase(render_pattern, settings)
-    , m_vk_unique_frame_buffer(CreateNativeFrameBuffer(render_pattern.GetRenderContextVK().GetDeviceVK().GetNativeDevice(), render_pattern.GetNativeRenderPass(), settings))
-    , m_vk_pass_begin_info(CreateNativeBeginInfo(GetNativeFrameBuffer()))
 {
     META_FUNCTION_TASK();
+    UpdateNative();
     static_cast<Data::IEmitter<IRenderContextVKCallback>&>(render_pattern.GetRenderContextVK()).Connect(*this);
 }
 
@@ -261,6 +354,10 @@ void RenderPassVK::ReleaseAttachmentTextures()
 
     m_vk_unique_frame_buffer.release();
     m_vk_pass_begin_info = vk::RenderPassBeginInfo();
+    m_vk_color_attachment_infos.clear();
+    m_vk_rendering_info = vk::RenderingInfoKHR();
+    m_begin_layout_transitions.Clear();
+    m_end_layout_transitions.Clear();
 
     RenderPassBase::ReleaseAttachmentTextures();
 }
@@ -271,14 +368,30 @@ void RenderPassVK::Begin(RenderCommandListBase& command_list)
     RenderPassBase::Begin(command_list);
 
     const vk::CommandBuffer& vk_command_buffer = static_cast<const RenderCommandListVK&>(command_list).GetNativeCommandBuffer(ICommandListVK::CommandBufferType::Primary);
-    vk_command_buffer.beginRenderPass(m_vk_pass_begin_info, vk::SubpassContents::eSecondaryCommandBuffers);
+    if (GetPatternVK().IsDynamicRendering())
+    {
+        m_begin_layout_transitions.Apply(vk_command_buffer);
+        vk_command_buffer.beginRenderingKHR(m_vk_rendering_info);
+    }
+    else
+    {
+        vk_command_buffer.beginRenderPass(m_vk_pass_begin_info, vk::SubpassContents::eSecondaryCommandBuffers);
+    }
 }
 
 void RenderPassVK::End(RenderCommandListBase& command_list)
 {
     META_FUNCTION_TASK();
     const vk::CommandBuffer& vk_command_buffer = static_cast<const RenderCommandListVK&>(command_list).GetNativeCommandBuffer(ICommandListVK::CommandBufferType::Primary);
-    vk_command_buffer.endRenderPass();
+    if (GetPatternVK().IsDynamicRendering())
+    {
+        vk_command_buffer.endRenderingKHR();
+        m_end_layout_transitions.Apply(vk_command_buffer);
+    }
+    else
+    {
+        vk_command_buffer.endRenderPass();
+    }
 
     RenderPassBase::End(command_list);
 }
@@ -289,7 +402,10 @@ bool RenderPassVK::SetName(const std::string& name)
     if (!RenderPassBase::SetName(name))
         return false;
 
-    SetVulkanObjectName(GetContextVK().GetDeviceVK().GetNativeDevice(), m_vk_unique_frame_buffer.get(), name.c_str());
+    if (m_vk_unique_frame_buffer)
+    {
+        SetVulkanObjectName(GetContextVK().GetDeviceVK().GetNativeDevice(), m_vk_unique_frame_buffer.get(), name.c_str());
+    }
     return true;
 }
 
@@ -297,8 +413,7 @@ void RenderPassVK::Reset()
 {
     META_FUNCTION_TASK();
     m_vk_attachments.clear();
-    m_vk_unique_frame_buffer = CreateNativeFrameBuffer(GetContextVK().GetDeviceVK().GetNativeDevice(), GetPatternVK().GetNativeRenderPass(), GetSettings());
-    m_vk_pass_begin_info = CreateNativeBeginInfo(m_vk_unique_frame_buffer.get());
+    UpdateNative();
 
     Data::Emitter<IRenderPassCallback>::Emit(&IRenderPassCallback::OnRenderPassUpdated, *this);
 }
@@ -325,6 +440,145 @@ void RenderPassVK::OnRenderContextVKSwapchainChanged(RenderContextVK&)
     Reset();
 }
 
+void RenderPassVK::UpdateNative()
+{
+    META_FUNCTION_TASK();
+    if (GetPatternVK().IsDynamicRendering())
+    {
+        // Only attachment infos are updated on resize in case of dynamic rendering, no native objects are created
+        UpdateNativeRenderingInfo();
+        return;
+    }
+
+    m_vk_unique_frame_buffer = CreateNativeFrameBuffer(GetContextVK().GetDeviceVK().GetNativeDevice(), GetPatternVK().GetNativeRenderPass(), GetSettings());
+    m_vk_pass_begin_info = CreateNativeBeginInfo(m_vk_unique_frame_buffer.get());
+}
+
+void RenderPassVK::UpdateAttachmentViews(const Settings& settings)
+{
+    META_FUNCTION_TASK();
+    if (!m_vk_attachments.empty())
+        return;
+
+    std::transform(settings.attachments.begin(), settings.attachments.end(), std::back_inserter(m_vk_attachments),
+                   [](const Texture::View& texture_location)
+                   { return ResourceViewVK(texture_location, Resource::Usage::RenderTarget); });
+}
+
+void RenderPassVK::UpdateNativeRenderingInfo()
+{
+    META_FUNCTION_TASK();
+    const Settings&                    settings                = GetSettings();
+    const RenderPattern::Settings&     pattern_settings        = GetPatternVK().GetSettings();
+    const std::vector<vk::ClearValue>& attachment_clear_values = GetPatternVK().GetAttachmentClearValues();
+    UpdateAttachmentViews(settings);
+
+    m_vk_color_attachment_infos.clear();
+    m_begin_layout_transitions.Clear();
+    m_end_layout_transitions.Clear();
+
+    const auto add_attachment_layout_transitions = [this, &pattern_settings](const Attachment& attachment)
+    {
+        const Texture&        texture        = GetAttachmentTextureView(attachment).GetTexture();
+        const vk::ImageLayout initial_layout = GetInitialImageLayoutOfAttachment(attachment);
+        const vk::ImageLayout layout         = GetImageLayoutOfAttachment(attachment);
+        const vk::ImageLayout final_layout   = GetFinalImageLayoutOfAttachment(attachment, pattern_settings.is_final_pass);
+        if (initial_layout != layout)
+        {
+            m_begin_layout_transitions.Add(texture, initial_layout, layout,
+                                           GetPipelineStagesOfAttachment(attachment), GetWriteAccessOfAttachment(attachment),
+                                           GetPipelineStagesOfAttachment(attachment), GetReadWriteAccessOfAttachment(attachment));
+        }
+        if (final_layout != layout)
+        {
+            m_end_layout_transitions.Add(texture, layout, final_layout,
+                                         GetPipelineStagesOfAttachment(attachment), GetWriteAccessOfAttachment(attachment),
+                                         vk::PipelineStageFlagBits::eBottomOfPipe, vk::AccessFlags{});
+        }
+    };
+
+    m_vk_color_attachment_infos.reserve(pattern_settings.color_attachments.size());
+    for (size_t color_attachment_index = 0U; color_attachment_index < pattern_settings.color_attachments.size(); ++color_attachment_index)
+    {
+        const RenderPattern::ColorAttachment& color_attachment = pattern_settings.color_attachments[color_attachment_index];
+        m_vk_color_attachment_infos.emplace_back(
+            GetVulkanRenderingAttachmentInfo(color_attachment,
+                                             GetAttachmentTextureViewVK(color_attachment).GetNativeImageView(),
+                                             attachment_clear_values[color_attachment_index]));
+        add_attachment_layout_transitions(color_attachment);
+    }
+
+    const FrameSize& frame_size = settings.frame_size;
+    m_vk_rendering_info = vk::RenderingInfoKHR(
+        vk::RenderingFlagBitsKHR::eContentsSecondaryCommandBuffers,
+        vk::Rect2D(vk::Offset2D(0, 0), vk::Extent2D(frame_size.GetWidth(), frame_size.GetHeight())),
+        1U, // layer count
+        0U, // view mask
+        m_vk_color_attachment_infos
+    );
+
+    if (pattern_settings.depth_attachment)
+    {
+        m_vk_depth_attachment_info = GetVulkanRenderingAttachmentInfo(*pattern_settings.depth_attachment,
+                                                                      GetAttachmentTextureViewVK(*pattern_settings.depth_attachment).GetNativeImageView(),
+                                                                      attachment_clear_values.back());
+        m_vk_rendering_info.setPDepthAttachment(&m_vk_depth_attachment_info);
+        add_attachment_layout_transitions(*pattern_settings.depth_attachment);
+    }
+    if (pattern_settings.stencil_attachment)
+    {
+        m_vk_stencil_attachment_info = GetVulkanRenderingAttachmentInfo(*pattern_settings.stencil_attachment,
+                                                                        GetAttachmentTextureViewVK(*pattern_settings.stencil_attachment).GetNativeImageView(),
+                                                                        attachment_clear_values.back());
+        m_vk_rendering_info.setPStencilAttachment(&m_vk_stencil_attachment_info);
+        add_attachment_layout_transitions(*pattern_settings.stencil_attachment);
+    }
+}
+
+void RenderPassVK::LayoutTransitionsVK::Add(const Texture& texture, vk::ImageLayout vk_old_layout, vk::ImageLayout vk_new_layout,
+                                            vk::PipelineStageFlags vk_src_stage_flags, vk::AccessFlags vk_src_access,
+                                            vk::PipelineStageFlags vk_dst_stage_flags, vk::AccessFlags vk_dst_access)
+{
+    META_FUNCTION_TASK();
+    const auto& vk_texture = dynamic_cast<const ITextureVK&>(texture);
+    const vk::Image& vk_image = vk_texture.GetNativeImage();
+
+    // Depth and stencil attachments may refer to the same texture, which is transitioned only once
+    if (std::any_of(vk_image_barriers.begin(), vk_image_barriers.end(),
+                    [&vk_image](const vk::ImageMemoryBarrier& vk_image_barrier) { return vk_image_barrier.image == vk_image; }))
+        return;
+
+    vk_image_barriers.emplace_back(
+        vk_src_access,
+        vk_dst_access,
+        vk_old_layout,
+        vk_new_layout,
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        vk_image,
+        vk_texture.GetNativeSubresourceRange()
+    );
+    vk_src_stages |= vk_src_stage_flags;
+    vk_dst_stages |= vk_dst_stage_flags;
+}
+
+void RenderPassVK::LayoutTransitionsVK::Apply(const vk::CommandBuffer& vk_command_buffer) const
+{
+    META_FUNCTION_TASK();
+    if (vk_image_barriers.empty())
+        return;
+
+    vk_command_buffer.pipelineBarrier(vk_src_stages, vk_dst_stages, vk::DependencyFlags{}, {}, {}, vk_image_barriers);
+}
+
+void RenderPassVK::LayoutTransitionsVK::Clear()
+{
+    META_FUNCTION_TASK();
+    vk_src_stages = vk::PipelineStageFlags{};
+    vk_dst_stages = vk::PipelineStageFlags{};
+    vk_image_barriers.clear();
+}
+
 const ResourceViewVK& RenderPassVK::GetAttachmentTextureViewVK(const Attachment& attachment) const
 {
     META_FUNCTION_TASK();
@@ -349,12 +603,7 @@ vk::RenderPassBeginInfo RenderPassVK::CreateNativeBeginInfo(const vk::Framebuffe
 vk::UniqueFramebuffer RenderPassVK::CreateNativeFrameBuffer(const vk::Device& vk_device, const vk::RenderPass& vk_render_pass, const Settings& settings)
 {
     META_FUNCTION_TASK();
-    if (m_vk_attachments.empty())
-    {
-        std::transform(settings.attachments.begin(), settings.attachments.end(), std::back_inserter(m_vk_attachments),
-                       [](const Texture::View& texture_location)
-                       { return ResourceViewVK(texture_location, Resource::Usage::RenderTarget); });
-    }
+    UpdateAttachmentViews(settings);
 
     std::vector<vk::ImageView> vk_attachment_views;
     std::transform(m_vk_attachments.begin(), m_vk_attachments.end(), std::back_inserter(vk_attachment_views),
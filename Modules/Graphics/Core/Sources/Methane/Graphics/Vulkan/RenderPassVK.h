@@ -48,12 +48,24 @@ public:
     [[nodiscard]] const RenderContextVK& GetRenderContextVK() const noexcept;
     [[nodiscard]] RenderContextVK&       GetRenderContextVK() noexcept;
 
+    // Render pass object is not created when dynamic rendering is used, so pipelines and command buffers depend on attachment formats only
+    [[nodiscard]] bool IsDynamicRendering() const noexcept                                     { return !m_vk_unique_render_pass; }
+
     [[nodiscard]] const vk::RenderPass& GetNativeRenderPass() const noexcept                   { return m_vk_unique_render_pass.get(); }
     [[nodiscard]] const std::vector<vk::ClearValue>& GetAttachmentClearValues() const noexcept { return m_attachment_clear_colors; }
+    [[nodiscard]] const vk::PipelineRenderingCreateInfoKHR& GetNativePipelineRenderingCreateInfo() const noexcept
+    { return m_vk_pipeline_rendering_info; }
+    [[nodiscard]] const vk::CommandBufferInheritanceRenderingInfoKHR& GetNativeInheritanceRenderingInfo() const noexcept
+    { return m_vk_inheritance_rendering_info; }
 
 private:
+    void InitializeDynamicRenderingInfo(const Settings& settings);
+
     vk::UniqueRenderPass        m_vk_unique_render_pass;
     std::vector<vk::ClearValue> m_attachment_clear_colors;
+    std::vector<vk::Format>     m_vk_color_attachment_formats;
+    vk::PipelineRenderingCreateInfoKHR           m_vk_pipeline_rendering_info;
+    vk::CommandBufferInheritanceRenderingInfoKHR m_vk_inheritance_rendering_info;
 };
 
 class RenderPassVK final
@@ -82,9 +94,26 @@ public:
     const vk::Framebuffer& GetNativeFrameBuffer() const noexcept { return m_vk_unique_frame_buffer.get(); }
 
 private:
+    // Image layout transitions done by render pass object are done with explicit barriers in case of dynamic rendering
+    struct LayoutTransitionsVK
+    {
+        vk::PipelineStageFlags              vk_src_stages;
+        vk::PipelineStageFlags              vk_dst_stages;
+        std::vector<vk::ImageMemoryBarrier> vk_image_barriers;
+
+        void Add(const Texture& texture, vk::ImageLayout vk_old_layout, vk::ImageLayout vk_new_layout,
+                 vk::PipelineStageFlags vk_src_stage_flags, vk::AccessFlags vk_src_access,
+                 vk::PipelineStageFlags vk_dst_stage_flags, vk::AccessFlags vk_dst_access);
+        void Apply(const vk::CommandBuffer& vk_command_buffer) const;
+        void Clear();
+    };
+
     // IRenderContextVKCallback overrides
     void OnRenderContextVKSwapchainChanged(RenderContextVK&) override;
 
+    void                    UpdateNative();
+    void                    UpdateAttachmentViews(const Settings& settings);
+    void                    UpdateNativeRenderingInfo();
     const ResourceViewVK&   GetAttachmentTextureViewVK(const Attachment& attachment) const;
     vk::RenderPassBeginInfo CreateNativeBeginInfo(const vk::Framebuffer& vk_frame_buffer) const;
     vk::UniqueFramebuffer   CreateNativeFrameBuffer(const vk::Device& vk_device, const vk::RenderPass& vk_render_pass, const Settings& settings);
@@ -92,6 +121,14 @@ private:
     ResourceViewsVK         m_vk_attachments;
     vk::UniqueFramebuffer   m_vk_unique_frame_buffer;
     vk::RenderPassBeginInfo m_vk_pass_begin_info;
+
+    // Dynamic rendering state, used instead of frame buffer and render pass begin info
+    std::vector<vk::RenderingAttachmentInfoKHR> m_vk_color_attachment_infos;
+    vk::RenderingAttachmentInfoKHR              m_vk_depth_attachment_info;
+    vk::RenderingAttachmentInfoKHR              m_vk_stencil_attachment_info;
+    vk::RenderingInfoKHR                        m_vk_rendering_info;
+    LayoutTransitionsVK                         m_begin_layout_transitions;
+    LayoutTransitionsVK                         m_end_layout_transitions;
 };
 
 } // namespace Methane::Graphics
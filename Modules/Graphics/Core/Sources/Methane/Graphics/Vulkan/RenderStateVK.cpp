@@ -403,7 +403,7 @@ void RenderStateVK::Reset(const Settings& settings)
     const vk::PipelineVertexInputStateCreateInfo vk_vertex_input_state_info = program.GetNativeVertexInputStateCreateInfo();
     const std::vector<vk::PipelineShaderStageCreateInfo> vk_stages_info = program.GetNativeShaderStageCreateInfos();
 
-    const vk::GraphicsPipelineCreateInfo vk_pipeline_create_info(
+    vk::GraphicsPipelineCreateInfo vk_pipeline_create_info(
         vk::PipelineCreateFlags(),
         vk_stages_info,
         &vk_vertex_input_state_info,
@@ -418,6 +418,11 @@ void RenderStateVK::Reset(const Settings& settings)
         program.GetNativePipelineLayout(),
         render_pattern.GetNativeRenderPass()
     );
+    if (render_pattern.IsDynamicRendering())
+    {
+        // Pipeline is created against attachment formats instead of render pass, when dynamic rendering is used
+        vk_pipeline_create_info.setPNext(&render_pattern.GetNativePipelineRenderingCreateInfo());
+    }
 
     auto pipe = GetContextVK().GetDeviceVK().GetNativeDevice().createGraphicsPipelineUnique(nullptr, vk_pipeline_create_info);
     META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
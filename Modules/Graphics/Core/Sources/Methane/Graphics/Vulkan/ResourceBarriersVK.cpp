@@ -56,6 +56,13 @@ static void UpdateImageMemoryStateChangeBarrier(vk::ImageMemoryBarrier& vk_image
     vk_image_memory_barrier.setNewLayout(IResourceVK::GetNativeImageLayoutByResourceState(state_change.GetStateAfter()));
 }
 
+static void UpdateImageMemoryAliasingChangeBarrier(vk::ImageMemoryBarrier& vk_image_memory_barrier, const ResourceBarrier::StateChange& state_change)
+{
+    META_FUNCTION_TASK();
+    UpdateImageMemoryStateChangeBarrier(vk_image_memory_barrier, state_change);
+    vk_image_memory_barrier.setOldLayout(vk::ImageLayout::eUndefined);
+}
+
 static void UpdateImageMemoryOwnerChangeBarrier(vk::ImageMemoryBarrier& vk_image_memory_barrier, const ResourceBarrier::OwnerChange& owner_change)
 {
     META_FUNCTION_TASK();
@@ -115,7 +122,7 @@ bool ResourceBarriersVK::Remove(const ResourceBarrier::Id& id)
     default: META_UNEXPECTED_ARG_DESCR(resource_type, "resource type is not supported by transitions");
     }
 
-    if (barrier_type == ResourceBarrier::Type::StateTransition)
+    if (barrier_type != ResourceBarrier::Type::OwnerTransition)
     {
         UpdateStageMasks();
         static_cast<Data::IEmitter<IResourceCallback>&>(id.GetResource()).Disconnect(*this);
@@ -161,6 +168,7 @@ void ResourceBarriersVK::OnResourceReleased(Resource& resource)
 {
     META_FUNCTION_TASK();
     RemoveStateTransition(resource);
+    ResourceBarriers::Remove(ResourceBarrier::Type::AliasingTransition, resource);
 }
 
 void ResourceBarriersVK::SetResourceBarrier(const ResourceBarrier::Id& id, const ResourceBarrier& barrier, bool is_new_barrier)
@@ -201,16 +209,18 @@ void ResourceBarriersVK::SetBufferMemoryBarrier(const BufferVK& buffer, const Re
     {
         switch(barrier.GetId().GetType())
         {
-        case ResourceBarrier::Type::StateTransition: AddBufferMemoryStateChangeBarrier(buffer, barrier.GetStateChange()); break;
-        case ResourceBarrier::Type::OwnerTransition: AddBufferMemoryOwnerChangeBarrier(buffer, barrier.GetOwnerChange()); break;
+        case ResourceBarrier::Type::StateTransition:
+        case ResourceBarrier::Type::AliasingTransition: AddBufferMemoryStateChangeBarrier(buffer, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::OwnerTransition:    AddBufferMemoryOwnerChangeBarrier(buffer, barrier.GetOwnerChange()); break;
         }
     }
     else
     {
         switch (barrier.GetId().GetType())
         {
-        case ResourceBarrier::Type::StateTransition: UpdateBufferMemoryStateChangeBarrier(*vk_buffer_memory_barrier_it, barrier.GetStateChange()); break;
-        case ResourceBarrier::Type::OwnerTransition: UpdateBufferMemoryOwnerChangeBarrier(*vk_buffer_memory_barrier_it, barrier.GetOwnerChange()); break;
+        case ResourceBarrier::Type::StateTransition:
+        case ResourceBarrier::Type::AliasingTransition: UpdateBufferMemoryStateChangeBarrier(*vk_buffer_memory_barrier_it, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::OwnerTransition:    UpdateBufferMemoryOwnerChangeBarrier(*vk_buffer_memory_barrier_it, barrier.GetOwnerChange()); break;
         }
     }
 }
@@ -228,16 +238,18 @@ void ResourceBarriersVK::SetImageMemoryBarrier(const ITextureVK& texture, const
     {
         switch(barrier.GetId().GetType())
         {
-        case ResourceBarrier::Type::StateTransition: AddImageMemoryStateChangeBarrier(texture, barrier.GetStateChange()); break;
-        case ResourceBarrier::Type::OwnerTransition: AddImageMemoryOwnerChangeBarrier(texture, barrier.GetOwnerChange()); break;
+        case ResourceBarrier::Type::StateTransition:    AddImageMemoryStateChangeBarrier(texture, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::AliasingTransition: AddImageMemoryAliasingChangeBarrier(texture, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::OwnerTransition:    AddImageMemoryOwnerChangeBarrier(texture, barrier.GetOwnerChange()); break;
         }
     }
     else
     {
         switch (barrier.GetId().GetType())
         {
-        case ResourceBarrier::Type::StateTransition: UpdateImageMemoryStateChangeBarrier(*vk_image_memory_barrier_it, barrier.GetStateChange()); break;
-        case ResourceBarrier::Type::OwnerTransition: UpdateImageMemoryOwnerChangeBarrier(*vk_image_memory_barrier_it, barrier.GetOwnerChange()); break;
+        case ResourceBarrier::Type::StateTransition:    UpdateImageMemoryStateChangeBarrier(*vk_image_memory_barrier_it, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::AliasingTransition: UpdateImageMemoryAliasingChangeBarrier(*vk_image_memory_barrier_it, barrier.GetStateChange()); break;
+        case ResourceBarrier::Type::OwnerTransition:    UpdateImageMemoryOwnerChangeBarrier(*vk_image_memory_barrier_it, barrier.GetOwnerChange()); break;
         }
     }
 }
@@ -290,6 +302,22 @@ void ResourceBarriersVK::AddImageMemoryStateChangeBarrier(const ITextureVK& text
     );
 }
 
+void ResourceBarriersVK::AddImageMemoryAliasingChangeBarrier(const ITextureVK& texture, const ResourceBarrier::StateChange& state_change)
+{
+    META_FUNCTION_TASK();
+    // Image content is discarded with undefined old layout, while access of the previous resource in aliased memory is the source scope
+    m_vk_default_barrier.vk_image_memory_barriers.emplace_back(
+        IResourceVK::GetNativeAccessFlagsByResourceState(state_change.GetStateBefore()),
+        IResourceVK::GetNativeAccessFlagsByResourceState(state_change.GetStateAfter()),
+        vk::ImageLayout::eUndefined,
+        IResourceVK::GetNativeImageLayoutByResourceState(state_change.GetStateAfter()),
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        texture.GetNativeImage(),
+        texture.GetNativeSubresourceRange()
+    );
+}
+
 void ResourceBarriersVK::AddImageMemoryOwnerChangeBarrier(const ITextureVK& texture, const ResourceBarrier::OwnerChange& owner_change)
 {
     META_FUNCTION_TASK();
@@ -368,6 +396,7 @@ void ResourceBarriersVK::UpdateStageMasks(const ResourceBarrier& barrier)
     switch (barrier.GetId().GetType())
     {
     case ResourceBarrier::Type::StateTransition:
+    case ResourceBarrier::Type::AliasingTransition:
         m_vk_default_barrier.vk_src_stage_mask |= IResourceVK::GetNativePipelineStageFlagsByResourceState(barrier.GetStateChange().GetStateBefore());
         m_vk_default_barrier.vk_dst_stage_mask |= IResourceVK::GetNativePipelineStageFlagsByResourceState(barrier.GetStateChange().GetStateAfter());
         break;
@@ -27,10 +27,14 @@ Vulkan implementation of the resource objects.
 #include "SamplerVK.h"
 #include "TypesVK.h"
 #include "UtilsVK.hpp"
+#include "BlitCommandListVK.h"
 
+#include <Methane/Graphics/CommandQueue.h>
 #include <Methane/Instrumentation.h>
 #include <fmt/format.h>
 
+#include <future>
+
 namespace Methane::Graphics
 {
 
@@ -202,7 +206,8 @@ vk::PipelineStageFlags IResourceVK::GetNativePipelineStageFlagsByResourceState(R
     case ResourceState::UnorderedAccess:
     case ResourceState::ShaderResource:
         return vk::PipelineStageFlagBits::eVertexShader | // All possible shader stages
-               vk::PipelineStageFlagBits::eFragmentShader;
+               vk::PipelineStageFlagBits::eFragmentShader |
+               vk::PipelineStageFlagBits::eComputeShader;
     case ResourceState::CopyDest:
     case ResourceState::CopySource:
     case ResourceState::ResolveDest:
@@ -219,4 +224,81 @@ vk::PipelineStageFlags IResourceVK::GetNativePipelineStageFlagsByResourceState(R
     }
 }
 
+IResourceVK::ImageAspectPlanes IResourceVK::GetNativeImageAspectPlanes(PixelFormat pixel_format)
+{
+    META_FUNCTION_TASK();
+    // Depth texels of packed formats are copied to buffer with 4-bytes alignment and stencil texels are copied as 1 byte
+    switch(const vk::Format vk_format = TypeConverterVK::PixelFormatToVulkan(pixel_format); vk_format)
+    {
+    case vk::Format::eD16Unorm:         return { { vk::ImageAspectFlagBits::eDepth, 2U } };
+    case vk::Format::eX8D24UnormPack32: return { { vk::ImageAspectFlagBits::eDepth, 4U } };
+    case vk::Format::eD32Sfloat:        return { { vk::ImageAspectFlagBits::eDepth, 4U } };
+    case vk::Format::eS8Uint:           return { { vk::ImageAspectFlagBits::eStencil, 1U } };
+    case vk::Format::eD16UnormS8Uint:   return { { vk::ImageAspectFlagBits::eDepth, 2U }, { vk::ImageAspectFlagBits::eStencil, 1U } };
+    case vk::Format::eD24UnormS8Uint:   return { { vk::ImageAspectFlagBits::eDepth, 4U }, { vk::ImageAspectFlagBits::eStencil, 1U } };
+    case vk::Format::eD32SfloatS8Uint:  return { { vk::ImageAspectFlagBits::eDepth, 4U }, { vk::ImageAspectFlagBits::eStencil, 1U } };
+    default:                            return { { vk::ImageAspectFlagBits::eColor, GetPixelSize(pixel_format) } };
+    }
+}
+
+Resource::ReadDataFuture IResourceVK::ReadDataToReadBackBufferAsync(ResourceBase& resource, CommandQueue& cmd_queue, Data::Size data_size,
+                                                                    const ReadBackCommands& read_back_commands)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(data_size, "can not read empty data of resource '{}'", resource.GetName());
+
+    const Ptr<Buffer> read_back_buffer_ptr = Buffer::CreateReadBackBuffer(resource.GetContext(), data_size);
+    read_back_buffer_ptr->SetName(fmt::format("{} Read-Back Buffer", resource.GetName()));
+    auto& read_back_buffer = static_cast<BufferVK&>(*read_back_buffer_ptr);
+
+    const Ptr<BlitCommandList> read_back_cmd_list_ptr = BlitCommandList::Create(cmd_queue);
+    read_back_cmd_list_ptr->SetName(fmt::format("{} Read-Back", resource.GetName()));
+    read_back_cmd_list_ptr->Reset();
+
+    auto& read_back_cmd_list = static_cast<BlitCommandListVK&>(*read_back_cmd_list_ptr);
+    read_back_cmd_list.RetainResource(resource);
+    read_back_cmd_list.RetainResource(read_back_buffer);
+
+    Ptr<Resource::Barriers> read_back_barriers_ptr;
+    resource.SetOwnerQueueFamily(cmd_queue.GetFamilyIndex(), read_back_barriers_ptr);
+    resource.SetState(Resource::State::CopySource, read_back_barriers_ptr);
+    read_back_buffer.SetState(Resource::State::CopyDest, read_back_barriers_ptr);
+    if (read_back_barriers_ptr && !read_back_barriers_ptr->IsEmpty())
+    {
+        read_back_cmd_list.SetResourceBarriers(*read_back_barriers_ptr);
+    }
+
+    const vk::CommandBuffer& vk_command_buffer = read_back_cmd_list.GetNativeCommandBufferDefault();
+    read_back_commands(vk_command_buffer, read_back_buffer.GetNativeResource());
+
+    // Copied data has to be made visible to the host reads after command list execution is completed
+    const vk::MemoryBarrier vk_host_read_barrier(vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eHostRead);
+    vk_command_buffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost,
+                                      vk::DependencyFlags{}, vk_host_read_barrier, {}, {});
+    read_back_cmd_list.Commit();
+
+    const auto read_data_promise_ptr = std::make_shared<std::promise<SubResource>>();
+    Resource::ReadDataFuture read_data_future = read_data_promise_ptr->get_future().share();
+
+    // Completion callback is called from the command queue tracking thread, so no CPU wait for GPU is required
+    const Ptr<CommandListSet> read_back_cmd_list_set_ptr = CommandListSet::Create({ read_back_cmd_list });
+    cmd_queue.Execute(*read_back_cmd_list_set_ptr,
+        [read_data_promise_ptr, read_back_buffer_ptr](CommandList&)
+        {
+            try
+            {
+                read_data_promise_ptr->set_value(read_back_buffer_ptr->GetData());
+            }
+            catch(...)
+            {
+                read_data_promise_ptr->set_exception(std::current_exception());
+            }
+        }
+    );
+
+    // Read-back data is always awaited on CPU, so batched submits are flushed to GPU right away
+    cmd_queue.FlushSubmits();
+    return read_data_future;
+}
+
 } // using namespace Methane::Graphics
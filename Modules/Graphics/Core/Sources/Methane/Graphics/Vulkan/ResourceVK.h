@@ -29,12 +29,14 @@ Vulkan specialization of the resource interface.
 
 #include <variant>
 #include <vector>
+#include <functional>
 
 namespace Methane::Graphics
 {
 
 struct IContextVK;
 struct IResourceVK;
+class ResourceBase;
 
 class ResourceViewVK final : public ResourceView
 {
@@ -84,6 +86,15 @@ public:
     using State    = Resource::State;
     using ViewVK   = ResourceViewVK;
     using ViewsVK  = ResourceViewsVK;
+    using ReadBackCommands = std::function<void(const vk::CommandBuffer& vk_command_buffer, const vk::Buffer& vk_read_back_buffer)>;
+
+    struct ImageAspectPlane
+    {
+        vk::ImageAspectFlagBits aspect;
+        Data::Size              texel_size;
+    };
+
+    using ImageAspectPlanes = std::vector<ImageAspectPlane>;
 
     [[nodiscard]] virtual const IContextVK&       GetContextVK() const noexcept = 0;
     [[nodiscard]] virtual const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept = 0;
@@ -95,6 +106,14 @@ public:
     [[nodiscard]] static vk::AccessFlags        GetNativeAccessFlagsByResourceState(ResourceState resource_state);
     [[nodiscard]] static vk::ImageLayout        GetNativeImageLayoutByResourceState(ResourceState resource_state);
     [[nodiscard]] static vk::PipelineStageFlags GetNativePipelineStageFlagsByResourceState(ResourceState resource_state);
+
+    // Image aspects of the pixel format, which are copied to buffer memory separately: depth and stencil planes of combined formats
+    [[nodiscard]] static ImageAspectPlanes      GetNativeImageAspectPlanes(PixelFormat pixel_format);
+
+    // Encodes commands copying resource data to the new read-back buffer in a separate command list executed on the given queue,
+    // returned future is resolved with the read-back data by the command queue tracking thread, when GPU completes execution
+    [[nodiscard]] static Resource::ReadDataFuture ReadDataToReadBackBufferAsync(ResourceBase& resource, CommandQueue& cmd_queue, Data::Size data_size,
+                                                                                const ReadBackCommands& read_back_commands);
 };
 
 } // namespace Methane::Graphics
@@ -32,6 +32,7 @@ Vulkan implementation of the resource interface.
 #include <Methane/Graphics/ContextBase.h>
 #include <Methane/Graphics/ResourceBase.h>
 #include <Methane/Graphics/CommandKit.h>
+#include <Methane/Graphics/Texture.h>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
@@ -85,6 +86,15 @@ public:
             META_LOG("WARNING: Unexpected error during resource destruction: {}", e.what());
             assert(false);
         }
+
+        // Native views, resource and its memory are deleted in the order of destruction in a batch with other objects
+        // released in the current epoch, when GPU completes its execution, instead of deletion on an arbitrary thread
+        const ContextBase& context = ResourceBase::GetContextBase();
+        context.DeferDeletion(std::move(m_view_descriptor_by_view_id));
+        if constexpr (is_unique_resource)
+            context.DeferDeletion(std::move(m_vk_resource));
+        context.DeferDeletion(std::move(m_vk_unique_device_memory));
+        context.DeferDeletion(std::move(m_device_memory_allocation));
     }
 
     ResourceVK(const ResourceVK&) = delete;
@@ -136,6 +146,72 @@ public:
 
     void RestoreDescriptorViews(const DescriptorByViewId&) final { /* intentionally uninitialized */ }
 
+    // Resource override
+    Resource::ReadDataFuture ReadDataAsync(CommandQueue& cmd_queue, const SubResource::Index& sub_resource_index = SubResource::Index(),
+                                           const std::optional<BytesRange>& data_range = {}) override
+    {
+        META_FUNCTION_TASK();
+        using namespace magic_enum::bitwise_operators;
+        ResourceBase::ValidateSubResource(sub_resource_index, data_range);
+
+        const Data::Index data_start  = data_range ? data_range->GetStart()  : 0U;
+        const Data::Size  data_length = data_range ? data_range->GetLength() : ResourceBase::GetSubResourceDataSize(sub_resource_index);
+
+        if constexpr (std::is_same_v<NativeResourceType, vk::Buffer>)
+        {
+            META_CHECK_ARG_DESCR(ResourceBase::GetUsage(), static_cast<bool>(ResourceBase::GetUsage() & Usage::ReadBack),
+                                 "reading buffer data from GPU is allowed for buffers with CPU Read-back flag only");
+            return IResourceVK::ReadDataToReadBackBufferAsync(*this, cmd_queue, data_length,
+                [this, data_start, data_length](const vk::CommandBuffer& vk_command_buffer, const vk::Buffer& vk_read_back_buffer)
+                {
+                    vk_command_buffer.copyBuffer(GetNativeResource(), vk_read_back_buffer,
+                                                 vk::BufferCopy(data_start, 0U, static_cast<vk::DeviceSize>(data_length)));
+                });
+        }
+        else if constexpr (std::is_same_v<NativeResourceType, vk::Image>)
+        {
+            // Texture sub-resource is copied entirely, because memory layout of the image is implementation specific
+            const Texture::Settings& settings = ResourceBaseType::GetSettings();
+            META_CHECK_ARG_DESCR(ResourceBase::GetUsage(), settings.type == Texture::Type::FrameBuffer ||
+                                                           static_cast<bool>(ResourceBase::GetUsage() & Usage::ReadBack),
+                                 "reading texture data from GPU is allowed for frame buffers and textures with CPU Read-back flag only");
+            META_CHECK_ARG_NAME_DESCR("data_range", !data_range || (data_start == 0U && data_length == ResourceBase::GetSubResourceDataSize(sub_resource_index)),
+                                      "texture sub-resource data can be read only entirely");
+
+            const uint32_t vk_base_layer = settings.dimension_type == Texture::DimensionType::Tex3D
+                                         ? sub_resource_index.GetArrayIndex()
+                                         : sub_resource_index.GetBaseLayerIndex(ResourceBase::GetSubresourceCount());
+            const vk::Offset3D vk_image_offset(0, 0, settings.dimension_type == Texture::DimensionType::Tex3D
+                                                     ? static_cast<int32_t>(sub_resource_index.GetDepthSlice())
+                                                     : 0);
+            const vk::Extent3D vk_image_extent(std::max(1U, settings.dimensions.GetWidth()  >> sub_resource_index.GetMipLevel()),
+                                               std::max(1U, settings.dimensions.GetHeight() >> sub_resource_index.GetMipLevel()),
+                                               1U);
+
+            // Each image aspect is copied with a separate region, so depth and stencil planes of combined formats
+            // are placed one after another in the read-back data
+            std::vector<vk::BufferImageCopy> vk_copy_regions;
+            Data::Size read_back_data_size = 0U;
+            for(const IResourceVK::ImageAspectPlane& aspect_plane : IResourceVK::GetNativeImageAspectPlanes(settings.pixel_format))
+            {
+                vk_copy_regions.emplace_back(read_back_data_size, 0U, 0U,
+                                             vk::ImageSubresourceLayers(aspect_plane.aspect, sub_resource_index.GetMipLevel(), vk_base_layer, 1U),
+                                             vk_image_offset, vk_image_extent);
+                read_back_data_size += aspect_plane.texel_size * vk_image_extent.width * vk_image_extent.height;
+            }
+
+            return IResourceVK::ReadDataToReadBackBufferAsync(*this, cmd_queue, read_back_data_size,
+                [this, vk_copy_regions](const vk::CommandBuffer& vk_command_buffer, const vk::Buffer& vk_read_back_buffer)
+                {
+                    vk_command_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal, vk_read_back_buffer, vk_copy_regions);
+                });
+        }
+        else
+        {
+            return ResourceBaseType::ReadDataAsync(cmd_queue, sub_resource_index, data_range);
+        }
+    }
+
     // IResourceVK overrides
     const IContextVK& GetContextVK() const noexcept final
     {
@@ -198,6 +274,45 @@ protected:
         META_FUNCTION_TASK();
         m_vk_unique_device_memory.release();
         m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        m_vk_memory_requirements  = memory_requirements;
+        m_device_memory_allocation = RegisterDeviceMemoryAllocation(ResourceBase::GetResourceType() == Resource::Type::Texture
+                                                                    ? Device::MemoryType::Texture
+                                                                    : Device::MemoryType::Buffer,
+                                                                    memory_requirements);
+    }
+
+    // Device memory of another resource is aliased when its memory type and size are compatible with memory requirements,
+    // otherwise resource memory is allocated; resource owning aliased memory is retained while this resource is alive
+    const vk::DeviceMemory& AllocateOrAliasResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                                          const Ptr<Resource>& memory_resource_ptr, const vk::MemoryRequirements& memory_resource_requirements)
+    {
+        META_FUNCTION_TASK();
+        if (memory_resource_ptr)
+        {
+            const vk::DeviceMemory& vk_aliased_device_memory = dynamic_cast<const IResourceVK&>(*memory_resource_ptr).GetNativeDeviceMemory();
+            const Opt<uint32_t> memory_type_opt = GetContextVK().GetDeviceVK().FindMemoryType(memory_resource_requirements.memoryTypeBits, memory_property_flags);
+            if (vk_aliased_device_memory && memory_type_opt &&
+                (memory_requirements.memoryTypeBits & (1U << *memory_type_opt)) &&
+                memory_requirements.size <= memory_resource_requirements.size)
+            {
+                m_aliased_memory_resource_ptr = memory_resource_ptr;
+                m_vk_memory_requirements      = memory_requirements;
+                return vk_aliased_device_memory;
+            }
+            META_LOG("WARNING: memory requirements of resource '{}' are incompatible with memory of resource '{}', which can not be aliased",
+                     ResourceBase::GetName(), memory_resource_ptr->GetName());
+        }
+        AllocateResourceMemory(memory_requirements, memory_property_flags);
+        return m_vk_unique_device_memory.get();
+    }
+
+    const vk::MemoryRequirements& GetNativeMemoryRequirements() const noexcept { return m_vk_memory_requirements; }
+    bool IsAliasingMemory() const noexcept { return static_cast<bool>(m_aliased_memory_resource_ptr); }
+
+    DeviceBase::MemoryAllocation RegisterDeviceMemoryAllocation(Device::MemoryType memory_type, const vk::MemoryRequirements& memory_requirements) const
+    {
+        META_FUNCTION_TASK();
+        return DeviceBase::MemoryAllocation(*ResourceBase::GetContextBase().GetDeviceBasePtr(), memory_type, memory_requirements.size);
     }
 
     template<typename T = ResourceStorageType>
@@ -210,8 +325,9 @@ protected:
     BlitCommandListVK& PrepareResourceUpload(CommandQueue& target_cmd_queue)
     {
         META_FUNCTION_TASK();
-        const CommandKit& upload_cmd_kit = ResourceBase::GetContext().GetUploadCommandKit();
-        auto& upload_cmd_list = dynamic_cast<BlitCommandListVK&>(upload_cmd_kit.GetListForEncoding());
+        const ContextBase& context = ResourceBase::GetContextBase();
+        const CommandKit& upload_cmd_kit = context.GetUploadCommandKit();
+        auto& upload_cmd_list = dynamic_cast<BlitCommandListVK&>(upload_cmd_kit.GetListForEncoding(context.GetUploadCommandListId()));
         upload_cmd_list.RetainResource(*this);
 
         const bool owner_changed = SetOwnerQueueFamily(upload_cmd_kit.GetQueue().GetFamilyIndex(), m_upload_begin_transition_barriers_ptr);
@@ -226,6 +342,7 @@ protected:
         if (owner_changed && m_upload_begin_transition_barriers_ptr)
         {
             constexpr auto pre_upload_cmd_list_id = static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::PreUploadSync);
+            const auto upload_sync_lock = context.LockUploadSyncCommandLists();
             CommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(pre_upload_cmd_list_id);
             target_cmd_list.SetResourceBarriers(*m_upload_begin_transition_barriers_ptr);
         }
@@ -248,6 +365,7 @@ protected:
         if (owner_changed && upload_end_barriers_non_empty)
         {
             constexpr auto post_upload_cmd_list_id = static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::PostUploadSync);
+            const auto upload_sync_lock = ResourceBase::GetContextBase().LockUploadSyncCommandLists();
             CommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
             target_cmd_list.SetResourceBarriers(*m_upload_end_transition_barriers_ptr);
         }
@@ -260,13 +378,16 @@ protected:
 private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceViewVK::ViewDescriptorVariant>>;
 
-    vk::Device              m_vk_device;
-    vk::UniqueDeviceMemory  m_vk_unique_device_memory;
-    ResourceStorageType     m_vk_resource;
-    ViewDescriptorByViewId  m_view_descriptor_by_view_id;
-    Opt<uint32_t>           m_owner_queue_family_index_opt;
-    Ptr<Resource::Barriers> m_upload_begin_transition_barriers_ptr;
-    Ptr<Resource::Barriers> m_upload_end_transition_barriers_ptr;
+    vk::Device                   m_vk_device;
+    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    vk::MemoryRequirements       m_vk_memory_requirements;
+    DeviceBase::MemoryAllocation m_device_memory_allocation;
+    ResourceStorageType          m_vk_resource;
+    ViewDescriptorByViewId       m_view_descriptor_by_view_id;
+    Opt<uint32_t>                m_owner_queue_family_index_opt;
+    Ptr<Resource>                m_aliased_memory_resource_ptr;
+    Ptr<Resource::Barriers>      m_upload_begin_transition_barriers_ptr;
+    Ptr<Resource::Barriers>      m_upload_end_transition_barriers_ptr;
 };
 
 } // namespace Methane::Graphics
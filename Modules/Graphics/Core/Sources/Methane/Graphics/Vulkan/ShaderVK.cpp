@@ -184,7 +184,8 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
                 {
                     argument_acc,
                     resource_type,
-                    array_size
+                    array_size,
+                    vk_descriptor_type == vk::DescriptorType::eStorageImage
                 },
                 UpdateDescriptorType(vk_descriptor_type, argument_acc),
                 { std::move(byte_code_map) }
@@ -397,10 +398,11 @@ vk::ShaderStageFlagBits ShaderVK::ConvertTypeToStageFlagBits(Shader::Type shader
     META_FUNCTION_TASK();
     switch(shader_type)
     {
-    case Shader::Type::All:    return vk::ShaderStageFlagBits::eAll;
-    case Shader::Type::Vertex: return vk::ShaderStageFlagBits::eVertex;
-    case Shader::Type::Pixel:  return vk::ShaderStageFlagBits::eFragment;
-    default:                   META_UNEXPECTED_ARG_RETURN(shader_type, vk::ShaderStageFlagBits::eAll);
+    case Shader::Type::All:     return vk::ShaderStageFlagBits::eAll;
+    case Shader::Type::Vertex:  return vk::ShaderStageFlagBits::eVertex;
+    case Shader::Type::Pixel:   return vk::ShaderStageFlagBits::eFragment;
+    case Shader::Type::Compute: return vk::ShaderStageFlagBits::eCompute;
+    default:                    META_UNEXPECTED_ARG_RETURN(shader_type, vk::ShaderStageFlagBits::eAll);
     }
 }
 
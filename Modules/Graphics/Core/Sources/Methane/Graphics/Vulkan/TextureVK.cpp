@@ -30,6 +30,8 @@ Vulkan implementation of the texture interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <magic_enum.hpp>
+
 #include <algorithm>
 
 namespace Methane::Graphics
@@ -84,9 +86,27 @@ vk::ImageUsageFlags ITextureVK::GetNativeImageUsageFlags(const Texture::Settings
     if (static_cast<bool>(settings.usage_mask & Resource::Usage::ShaderRead))
         usage_flags |= vk::ImageUsageFlagBits::eSampled;
 
+    if (static_cast<bool>(settings.usage_mask & Resource::Usage::ShaderWrite))
+        usage_flags |= vk::ImageUsageFlagBits::eStorage;
+
+    // Textures with read-back usage are copied to the read-back buffers to read their data on CPU
+    if (static_cast<bool>(settings.usage_mask & Resource::Usage::ReadBack))
+        usage_flags |= vk::ImageUsageFlagBits::eTransferSrc;
+
     return usage_flags;
 }
 
+static vk::ImageAspectFlags GetNativeImageAllAspectFlags(PixelFormat pixel_format)
+{
+    META_FUNCTION_TASK();
+    vk::ImageAspectFlags vk_aspect_flags{};
+    for(const IResourceVK::ImageAspectPlane& aspect_plane : IResourceVK::GetNativeImageAspectPlanes(pixel_format))
+    {
+        vk_aspect_flags |= aspect_plane.aspect;
+    }
+    return vk_aspect_flags;
+}
+
 static vk::ImageCreateFlags GetNativeImageCreateFlags(const Texture::Settings& settings)
 {
     META_FUNCTION_TASK();
@@ -129,6 +149,14 @@ static vk::UniqueImage CreateNativeImage(const IContextVK& context, const Textur
             vk::SharingMode::eExclusive));
 }
 
+static vk::MemoryRequirements GetNativeImageMemoryRequirements(const vk::Device& vk_device, const Ptr<Texture>& texture_ptr)
+{
+    META_FUNCTION_TASK();
+    return texture_ptr
+         ? vk_device.getImageMemoryRequirements(dynamic_cast<const ITextureVK&>(*texture_ptr).GetNativeImage())
+         : vk::MemoryRequirements();
+}
+
 static vk::ImageLayout GetVulkanImageLayoutByUsage(Texture::Type texture_type, Resource::Usage usage) noexcept
 {
     META_FUNCTION_TASK();
@@ -140,14 +168,17 @@ static vk::ImageLayout GetVulkanImageLayoutByUsage(Texture::Type texture_type, R
              : vk::ImageLayout::eShaderReadOnlyOptimal;
     }
 
-    if (static_cast<bool>(usage & Resource::Usage::ShaderWrite) ||
-        static_cast<bool>(usage & Resource::Usage::RenderTarget))
+    if (static_cast<bool>(usage & Resource::Usage::RenderTarget))
     {
         return texture_type == Texture::Type::DepthStencilBuffer
              ? vk::ImageLayout::eDepthStencilAttachmentOptimal
              : vk::ImageLayout::eColorAttachmentOptimal;
     }
 
+    // Storage image is read and written by shaders in general layout of the unordered access state
+    if (static_cast<bool>(usage & Resource::Usage::ShaderWrite))
+        return vk::ImageLayout::eGeneral;
+
     return vk::ImageLayout::eUndefined;
 }
 
@@ -241,6 +272,25 @@ Ptr<Texture> Texture::CreateRenderTarget(const RenderContext& render_context, co
 
 }
 
+Ptr<Texture> Texture::CreateAliasedRenderTarget(const RenderContext& render_context, const Settings& settings, const Ptr<Texture>& memory_texture_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL_DESCR(memory_texture_ptr, "aliased render target requires texture owning device memory");
+    switch (settings.type)
+    {
+    case Texture::Type::Texture:            return std::make_shared<RenderTargetTextureVK>(dynamic_cast<const RenderContextVK&>(render_context), settings, memory_texture_ptr);
+    case Texture::Type::DepthStencilBuffer: return std::make_shared<DepthStencilTextureVK>(dynamic_cast<const RenderContextVK&>(render_context), settings,
+                                                                                           render_context.GetSettings().clear_depth_stencil, memory_texture_ptr);
+    case Texture::Type::FrameBuffer: META_UNEXPECTED_ARG_DESCR(settings.type, "frame buffer texture can not alias memory of another texture");
+    default:                         META_UNEXPECTED_ARG_RETURN(settings.type, nullptr);
+    }
+}
+
+bool Texture::IsMemoryAliasingSupported() noexcept
+{
+    return true;
+}
+
 Ptr<Texture> Texture::CreateFrameBuffer(const RenderContext& context, FrameBufferIndex frame_buffer_index)
 {
     META_FUNCTION_TASK();
@@ -257,10 +307,13 @@ Ptr<Texture> Texture::CreateDepthStencilBuffer(const RenderContext& context)
     return std::make_shared<DepthStencilTextureVK>(dynamic_cast<const RenderContextVK&>(context), texture_settings, context_settings.clear_depth_stencil);
 }
 
-Ptr<Texture> Texture::CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped)
+Ptr<Texture> Texture::CreateImage(const Context& context, const Dimensions& dimensions, const Opt<uint32_t>& array_length_opt, PixelFormat pixel_format, bool mipmapped,
+                                  bool is_read_back)
 {
     META_FUNCTION_TASK();
-    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, Usage::ShaderRead);
+    using namespace magic_enum::bitwise_operators;
+    const Usage    texture_usage    = Usage::ShaderRead | (is_read_back ? Usage::ReadBack : Usage::None);
+    const Settings texture_settings = Settings::Image(dimensions, array_length_opt, pixel_format, mipmapped, texture_usage);
     return std::make_shared<ImageTextureVK>(dynamic_cast<const RenderContextVK&>(context), texture_settings);
 }
 
@@ -284,6 +337,17 @@ void FrameBufferTextureVK::SetData(const SubResources&, CommandQueue&)
     META_FUNCTION_NOT_IMPLEMENTED_DESCR("frame-buffer textures do not support data setup");
 }
 
+Resource::ReadDataFuture FrameBufferTextureVK::ReadDataAsync(CommandQueue& cmd_queue, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    // Swap-chain images can be copied only when surface supports transfer source usage
+    META_CHECK_ARG_NAME_DESCR("frame_image_usage",
+                              static_cast<bool>(m_render_context.GetNativeFrameImageUsage() & vk::ImageUsageFlagBits::eTransferSrc),
+                              "frame-buffer {} image can not be read back, because window surface does not support transfer source usage",
+                              m_frame_buffer_index);
+    return ResourceVK::ReadDataAsync(cmd_queue, sub_resource_index, data_range);
+}
+
 vk::ImageSubresourceRange FrameBufferTextureVK::GetNativeSubresourceRange() const noexcept
 {
     META_FUNCTION_TASK();
@@ -308,9 +372,10 @@ void FrameBufferTextureVK::ResetNativeImage()
 }
 
 DepthStencilTextureVK::DepthStencilTextureVK(const RenderContextVK& render_context, const Settings& settings,
-                                             const Opt<DepthStencil>& depth_stencil_opt)
+                                             const Opt<DepthStencil>& depth_stencil_opt, const Ptr<Texture>& memory_texture_ptr)
     : ResourceVK(render_context, settings, CreateNativeImage(render_context, settings))
     , m_depth_stencil_opt(depth_stencil_opt)
+    , m_vk_image_aspect_flags(GetNativeImageAllAspectFlags(settings.pixel_format))
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_EQUAL_DESCR(settings.dimension_type, Texture::DimensionType::Tex2D, "depth-stencil texture is supported only with 2D dimensions");
@@ -318,10 +383,12 @@ DepthStencilTextureVK::DepthStencilTextureVK(const RenderContextVK& render_conte
     META_CHECK_ARG_FALSE_DESCR(settings.mipmapped, "depth-stencil texture does not support mip-map mode");
     META_CHECK_ARG_EQUAL_DESCR(settings.array_length, 1U, "depth-stencil texture does not support arrays");
 
-    // Allocate resource primary memory
+    // Allocate resource primary memory or alias memory of another texture
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(),
+                              AllocateOrAliasResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()),
+                                                            vk::MemoryPropertyFlagBits::eDeviceLocal, memory_texture_ptr,
+                                                            GetNativeImageMemoryRequirements(vk_device, memory_texture_ptr)), 0);
 }
 
 void DepthStencilTextureVK::SetData(const SubResources&, CommandQueue&)
@@ -332,8 +399,9 @@ void DepthStencilTextureVK::SetData(const SubResources&, CommandQueue&)
 vk::ImageSubresourceRange DepthStencilTextureVK::GetNativeSubresourceRange() const noexcept
 {
     META_FUNCTION_TASK();
+    // Layout transitions of combined depth-stencil images have to include both aspects
     return vk::ImageSubresourceRange(
-        vk::ImageAspectFlagBits::eDepth,
+        m_vk_image_aspect_flags,
         0U, 1U,
         0U, 1U
     );
@@ -345,14 +413,16 @@ Ptr<ResourceViewVK::ViewDescriptorVariant> DepthStencilTextureVK::CreateNativeVi
     return CreateNativeImageViewDescriptor(view_id, GetSettings(), GetSubresourceCount(), GetName(), GetNativeDevice(), GetNativeImage());
 }
 
-RenderTargetTextureVK::RenderTargetTextureVK(const RenderContextVK& render_context, const Settings& settings)
+RenderTargetTextureVK::RenderTargetTextureVK(const RenderContextVK& render_context, const Settings& settings, const Ptr<Texture>& memory_texture_ptr)
     : ResourceVK(render_context, settings, CreateNativeImage(render_context, settings))
 {
     META_FUNCTION_TASK();
-    // Allocate resource primary memory
+    // Allocate resource primary memory or alias memory of another texture
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(),
+                              AllocateOrAliasResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()),
+                                                            vk::MemoryPropertyFlagBits::eDeviceLocal, memory_texture_ptr,
+                                                            GetNativeImageMemoryRequirements(vk_device, memory_texture_ptr)), 0);
 }
 
 void RenderTargetTextureVK::SetData(const SubResources&, CommandQueue&)
@@ -397,7 +467,9 @@ ImageTextureVK::ImageTextureVK(const ContextBase& context, const Settings& setti
     );
 
     const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
+    const vk::MemoryRequirements vk_staging_memory_requirements = vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get());
+    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_staging_memory_requirements, vk_staging_memory_flags);
+    m_staging_memory_allocation = RegisterDeviceMemoryAllocation(Device::MemoryType::Staging, vk_staging_memory_requirements);
     vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
 }
 
@@ -442,6 +514,7 @@ void ImageTextureVK::SetData(const SubResources& sub_resources, CommandQueue& ta
     }
 
     // Copy buffer data from staging upload resource to the device-local GPU resource
+    const auto upload_encoding_lock = GetContextBase().LockUploadEncoding();
     BlitCommandListVK& upload_cmd_list = PrepareResourceUpload(target_cmd_queue);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
@@ -485,6 +558,7 @@ void ImageTextureVK::GenerateMipLevels(CommandQueue& target_cmd_queue, State tar
                               "texture pixel format does not support linear blitting");
 
     constexpr auto post_upload_cmd_list_id = static_cast<CommandKit::CommandListId>(CommandKit::CommandListPurpose::PostUploadSync);
+    const auto upload_sync_lock = GetContextBase().LockUploadSyncCommandLists();
     const CommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
     const vk::CommandBuffer& vk_cmd_buffer = dynamic_cast<const RenderCommandListVK&>(target_cmd_list).GetNativeCommandBufferDefault();
 
@@ -69,6 +69,7 @@ private:
 
     // Resource interface
     void SetData(const SubResources& sub_resources, CommandQueue&) override;
+    ReadDataFuture ReadDataAsync(CommandQueue& cmd_queue, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) override;
 
     const RenderContextVK& m_render_context;
     const FrameBufferIndex m_frame_buffer_index;
@@ -80,11 +81,15 @@ class DepthStencilTextureVK final // NOSONAR - inheritance hierarchy is greater
 {
 public:
     DepthStencilTextureVK(const RenderContextVK& render_context, const Settings& settings,
-                          const Opt<DepthStencil>& depth_stencil_opt);
+                          const Opt<DepthStencil>& depth_stencil_opt, const Ptr<Texture>& memory_texture_ptr = {});
 
     // Resource interface
     void SetData(const SubResources& sub_resources, CommandQueue&) override;
 
+    // Texture interface
+    Data::Size GetMemorySize() const override            { return GetNativeMemoryRequirements().size; }
+    bool       IsMemoryAliased() const noexcept override { return IsAliasingMemory(); }
+
     // ITextureVK interface
     const vk::Image& GetNativeImage() const noexcept override { return GetNativeResource(); }
     vk::ImageSubresourceRange GetNativeSubresourceRange() const noexcept override;
@@ -93,7 +98,8 @@ private:
     // ResourceVK override
     Ptr<ResourceViewVK::ViewDescriptorVariant> CreateNativeViewDescriptor(const View::Id& view_id) override;
 
-    Opt<DepthStencil>      m_depth_stencil_opt;
+    Opt<DepthStencil>          m_depth_stencil_opt;
+    const vk::ImageAspectFlags m_vk_image_aspect_flags;
 };
 
 class RenderTargetTextureVK final // NOSONAR - inheritance hierarchy is greater than 5
@@ -101,11 +107,15 @@ class RenderTargetTextureVK final // NOSONAR - inheritance hierarchy is greater
     , public ITextureVK
 {
 public:
-    RenderTargetTextureVK(const RenderContextVK& context, const Settings& settings);
+    RenderTargetTextureVK(const RenderContextVK& context, const Settings& settings, const Ptr<Texture>& memory_texture_ptr = {});
 
     // Resource interface
     void SetData(const SubResources& sub_resources, CommandQueue&) override;
 
+    // Texture interface
+    Data::Size GetMemorySize() const override            { return GetNativeMemoryRequirements().size; }
+    bool       IsMemoryAliased() const noexcept override { return IsAliasingMemory(); }
+
     // ITextureVK interface
     const vk::Image& GetNativeImage() const noexcept override { return GetNativeResource(); }
     vk::ImageSubresourceRange GetNativeSubresourceRange() const noexcept override;
@@ -140,6 +150,7 @@ private:
 
     vk::UniqueBuffer                 m_vk_unique_staging_buffer;
     vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
+    DeviceBase::MemoryAllocation     m_staging_memory_allocation;
     std::vector<vk::BufferImageCopy> m_vk_copy_regions;
 };
 
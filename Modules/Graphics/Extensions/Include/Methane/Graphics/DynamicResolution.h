@@ -0,0 +1,121 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DynamicResolution.h
+Dynamic resolution renders frame to scaled offscreen targets and upscales it to the screen with screen-quad pass.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/DynamicResolutionController.h>
+#include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/Color.hpp>
+#include <Methane/Graphics/CommandList.h>
+#include <Methane/Memory.hpp>
+
+#include <string>
+#include <deque>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+struct CommandQueue;
+struct RenderContext;
+struct RenderPattern;
+struct RenderPass;
+struct RenderCommandList;
+struct ViewState;
+struct Texture;
+class ScreenQuad;
+
+class DynamicResolution
+{
+public:
+    struct Settings
+    {
+        std::string                           name                     = "Dynamic Resolution";
+        PixelFormat                           depth_stencil_format     = PixelFormat::Unknown;
+        Opt<Color4F>                          clear_color;
+        Opt<DepthStencil>                     clear_depth_stencil;
+        DynamicResolutionController::Settings controller;
+        uint32_t                              max_pooled_targets_count = 3U;
+    };
+
+    DynamicResolution(CommandQueue& render_cmd_queue, RenderPattern& screen_render_pattern, const Settings& settings);
+
+    // Feed measured GPU frame time to controller and switch render targets when render scale step has changed
+    bool Update(double gpu_frame_time_sec);
+
+    // Update with GPU time of the scaled render pass command list measured with timestamp queries,
+    // GPU time is not available when GPU instrumentation is disabled, so render scale is not changed in this case
+    bool Update(const CommandList& scaled_render_cmd_list);
+
+    void Resize(const FrameSize& frame_size);
+    void Upscale(RenderCommandList& screen_cmd_list, CommandList::DebugGroup* p_debug_group = nullptr);
+
+    [[nodiscard]] const Settings&                    GetSettings() const noexcept   { return m_settings; }
+    [[nodiscard]] const DynamicResolutionController& GetController() const noexcept { return m_controller; }
+    [[nodiscard]] float                              GetScale() const noexcept      { return m_controller.GetScale(); }
+    [[nodiscard]] const FrameSize&                   GetRenderSize() const;
+    [[nodiscard]] RenderPattern&                     GetRenderPattern() const;
+    [[nodiscard]] ViewState&                         GetViewState() const;
+    [[nodiscard]] size_t                             GetPooledTargetsCount() const noexcept  { return m_targets.size(); }
+    [[nodiscard]] size_t                             GetRetiredTargetsCount() const noexcept { return m_retired_targets.size(); }
+
+    // Accessors of the current target resources mark it as used in the current frame,
+    // so that the target is retained on eviction until GPU completes this frame
+    [[nodiscard]] RenderPass&                        GetRenderPass();
+    [[nodiscard]] RenderCommandList&                 GetRenderCommandList();
+    [[nodiscard]] Texture&                           GetRenderTarget();
+
+private:
+    struct Target
+    {
+        FrameSize               frame_size;
+        Ptr<Texture>            color_texture_ptr;
+        Ptr<Texture>            depth_texture_ptr;
+        Ptr<RenderPass>         render_pass_ptr;
+        Ptr<ScreenQuad>         screen_quad_ptr;
+        Ptrs<RenderCommandList> render_cmd_list_ptrs; // per frame buffer
+        uint32_t                last_used_frame_index = 0U;
+    };
+
+    const Target& GetCurrentTarget() const;
+    Target&       GetCurrentTargetForFrame();
+    Target& AcquireTarget(const FrameSize& frame_size);
+    Target  CreateTarget(const FrameSize& frame_size) const;
+    void    RetireTarget(Target&& target);
+    void    ReleaseCompletedTargets();
+    bool    IsTargetUsedByGpu(const Target& target) const noexcept;
+    void    UpdateScaledFrameSize();
+
+    Settings                    m_settings;
+    DynamicResolutionController m_controller;
+    const Ptr<CommandQueue>     m_render_cmd_queue_ptr;
+    const Ptr<RenderPattern>    m_screen_render_pattern_ptr;
+    RenderContext&              m_render_context;
+    FrameSize                   m_screen_frame_size;
+    Ptr<RenderPattern>          m_render_pattern_ptr;
+    Ptr<ViewState>              m_view_state_ptr;
+    std::deque<Target>          m_targets; // pool of scaled render targets with the most recently used in front
+    std::deque<Target>          m_retired_targets; // evicted targets retained until GPU completes frames using them
+};
+
+} // namespace Methane::Graphics
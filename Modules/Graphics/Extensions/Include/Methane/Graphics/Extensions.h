@@ -25,6 +25,8 @@ Methane graphics extensions: all headers under one umbrella.
 
 #include "ImageLoader.h"
 #include "MeshBuffers.hpp"
+#include "ParallelRenderScheduler.h"
 #include "SkyBox.h"
+#include "DynamicResolution.h"
 #include "ScreenQuad.h"
 #include "ScreenQuad.h"
\ No newline at end of file
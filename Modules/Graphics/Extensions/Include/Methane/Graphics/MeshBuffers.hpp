@@ -24,6 +24,7 @@ Mesh buffers with texture extension structure.
 #pragma once
 
 #include "ImageLoader.h"
+#include "ParallelRenderScheduler.h"
 
 #include <Methane/Graphics/Buffer.h>
 #include <Methane/Graphics/Texture.h>
@@ -219,6 +220,27 @@ public:
         m_context.GetParallelExecutor().run(render_task_flow).get();
     }
 
+    // Draw instances in parallel with ranges balanced by the scheduler using encoding costs measured in previous frames
+    void DrawParallel(ParallelRenderScheduler& scheduler, const ParallelRenderCommandList& parallel_cmd_list,
+                      const Ptrs<ProgramBindings>& instance_program_bindings,
+                      ProgramBindings::ApplyBehavior bindings_apply_behavior = ProgramBindings::ApplyBehavior::AllIncremental,
+                      bool retain_bindings_once = false, bool set_resource_barriers = true)
+    {
+        META_FUNCTION_TASK();
+        scheduler.SetItemsCount(static_cast<Data::Size>(instance_program_bindings.size()));
+        scheduler.Encode(parallel_cmd_list, m_context.GetParallelExecutor(),
+            [this, &instance_program_bindings, bindings_apply_behavior, retain_bindings_once, set_resource_barriers]
+            (RenderCommandList& render_cmd_list, const ParallelRenderScheduler::ItemsRange& instances_range)
+            {
+                Draw(render_cmd_list,
+                     instance_program_bindings.begin() + instances_range.GetStart(),
+                     instance_program_bindings.begin() + instances_range.GetEnd(),
+                     bindings_apply_behavior, instances_range.GetStart(),
+                     retain_bindings_once, set_resource_barriers);
+            }
+        );
+    }
+
     [[nodiscard]] const std::string&  GetMeshName() const      { return m_mesh_name; }
     [[nodiscard]] Data::Size          GetSubsetsCount() const  { return static_cast<Data::Size>(m_mesh_subsets.size()); }
     [[nodiscard]] Data::Size          GetInstanceCount() const { return static_cast<Data::Size>(m_final_pass_instance_uniforms.size()); }
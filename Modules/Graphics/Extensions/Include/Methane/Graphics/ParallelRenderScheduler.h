@@ -0,0 +1,129 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ParallelRenderScheduler.h
+Adaptive scheduler of commands encoding with parallel render command list:
+balances items between nested command lists using per-item encoding cost estimates
+and tunes the number of nested command lists to minimize encoding time.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Data/Range.hpp>
+#include <Methane/Memory.hpp>
+
+#include <functional>
+#include <vector>
+#include <string>
+#include <thread>
+
+namespace tf // NOSONAR
+{
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+struct RenderCommandList;
+struct ParallelRenderCommandList;
+
+class ParallelRenderScheduler
+{
+public:
+    using ItemsRange     = Data::Range<Data::Index>;
+    using ItemsRanges    = std::vector<ItemsRange>;
+    using EncodeFunction = std::function<void(RenderCommandList& render_cmd_list, const ItemsRange& items_range)>;
+
+    struct Settings
+    {
+        uint32_t min_command_lists_count = 1U;
+        uint32_t max_command_lists_count = std::thread::hardware_concurrency();
+        uint32_t tuning_frames_count     = 16U;   // frames count to average encoding time for every tested count of command lists
+        double   cost_smoothing_factor   = 0.25;  // weight of the last frame timings in exponential moving average of item costs
+        double   tuning_gain_threshold   = 0.05;  // minimal relative reduction of encoding time to accept changed count of command lists
+        double   retuning_loss_threshold = 0.25;  // relative growth of encoding time which restarts tuning of command lists count
+        bool     auto_tuning_enabled     = true;
+    };
+
+    struct CommandListStatistics
+    {
+        ItemsRange items_range;
+        int32_t    worker_id                 = -1; // task executor worker which has encoded the command list in the last frame
+        double     encoding_time_sec         = 0.0;
+        double     average_encoding_time_sec = 0.0;
+    };
+
+    struct Statistics
+    {
+        uint32_t                           command_lists_count            = 0U;
+        bool                               is_tuning                      = false;
+        double                             encoding_wall_time_sec         = 0.0;
+        double                             average_encoding_wall_time_sec = 0.0;
+        double                             imbalance_ratio                = 1.0; // ratio of maximum to average command list encoding time
+        std::vector<CommandListStatistics> command_lists;
+
+        explicit operator std::string() const;
+    };
+
+    explicit ParallelRenderScheduler(const Settings& settings = {}, uint32_t initial_command_lists_count = 0U);
+
+    [[nodiscard]] const Settings&    GetSettings() const noexcept          { return m_settings; }
+    [[nodiscard]] uint32_t           GetCommandListsCount() const noexcept { return m_command_lists_count; }
+    [[nodiscard]] Data::Size         GetItemsCount() const noexcept        { return static_cast<Data::Size>(m_item_costs.size()); }
+    [[nodiscard]] const ItemsRanges& GetItemsRanges() const noexcept       { return m_items_ranges; }
+    [[nodiscard]] const Statistics&  GetStatistics() const noexcept        { return m_statistics; }
+    [[nodiscard]] Data::Index        GetCommandListIndexOfItem(Data::Index item_index) const;
+
+    void SetItemsCount(Data::Size items_count);
+
+    // Set scheduled count of nested command lists to the parallel render command list, must be called before its reset
+    void ApplyCommandListsCount(ParallelRenderCommandList& parallel_cmd_list) const;
+
+    // Encode scheduled items ranges to the nested command lists in parallel and update scheduling for the next frame
+    void Encode(const ParallelRenderCommandList& parallel_cmd_list, tf::Executor& executor, const EncodeFunction& encode_function);
+
+private:
+    void UpdateStatistics(double encoding_wall_time_sec);
+    void UpdateItemCosts();
+    void UpdateCommandListsCount(double encoding_wall_time_sec);
+    void UpdateItemsRanges();
+    void UpdateItemsRangesUniformly(Data::Size items_count);
+    void StartTuning();
+    void StopTuning();
+
+    const Settings      m_settings;
+    uint32_t            m_command_lists_count;
+    std::vector<double> m_item_costs;
+    bool                m_item_costs_measured = false;
+    ItemsRanges         m_items_ranges;
+    Statistics          m_statistics;
+
+    // Command lists count tuning state
+    bool     m_is_tuning                        = false;
+    int32_t  m_tuning_direction                 = 1;
+    uint32_t m_tuning_start_command_lists_count = 0U;
+    uint32_t m_best_command_lists_count         = 0U;
+    double   m_best_encoding_time_sec           = 0.0;
+    uint32_t m_measured_frames_count            = 0U;
+    double   m_measured_encoding_time_sec       = 0.0;
+};
+
+} // namespace Methane::Graphics
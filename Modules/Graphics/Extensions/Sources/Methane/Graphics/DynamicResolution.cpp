@@ -0,0 +1,325 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DynamicResolution.cpp
+Dynamic resolution renders frame to scaled offscreen targets and upscales it to the screen with screen-quad pass.
+
+******************************************************************************/
+
+#include <Methane/Graphics/DynamicResolution.h>
+#include <Methane/Graphics/ScreenQuad.h>
+
+#include <Methane/Graphics/RenderContext.h>
+#include <Methane/Graphics/RenderPass.h>
+#include <Methane/Graphics/RenderState.h>
+#include <Methane/Graphics/RenderCommandList.h>
+#include <Methane/Graphics/CommandQueue.h>
+#include <Methane/Graphics/Texture.h>
+#include <Methane/Data/TimeRange.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <magic_enum.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+static FrameSize GetScaledFrameSize(const FrameSize& frame_size, float scale)
+{
+    META_FUNCTION_TASK();
+    return FrameSize(std::max(1U, static_cast<uint32_t>(std::round(static_cast<float>(frame_size.GetWidth())  * scale))),
+                     std::max(1U, static_cast<uint32_t>(std::round(static_cast<float>(frame_size.GetHeight()) * scale))));
+}
+
+DynamicResolution::DynamicResolution(CommandQueue& render_cmd_queue, RenderPattern& screen_render_pattern, const Settings& settings)
+    : m_settings(settings)
+    , m_controller(settings.controller)
+    , m_render_cmd_queue_ptr(std::dynamic_pointer_cast<CommandQueue>(render_cmd_queue.GetPtr()))
+    , m_screen_render_pattern_ptr(std::dynamic_pointer_cast<RenderPattern>(screen_render_pattern.GetPtr()))
+    , m_render_context(screen_render_pattern.GetRenderContext())
+    , m_screen_frame_size(m_render_context.GetSettings().frame_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.max_pooled_targets_count, "dynamic resolution requires at least one pooled render target");
+
+    const RenderContext::Settings& context_settings = m_render_context.GetSettings();
+    using namespace magic_enum::bitwise_operators;
+
+    m_render_pattern_ptr = RenderPattern::Create(m_render_context, {
+        RenderPattern::ColorAttachments
+        {
+            RenderPattern::ColorAttachment(
+                0U, context_settings.color_format, 1U,
+                m_settings.clear_color.has_value()
+                    ? RenderPass::Attachment::LoadAction::Clear
+                    : RenderPass::Attachment::LoadAction::DontCare,
+                RenderPass::Attachment::StoreAction::Store,
+                m_settings.clear_color.value_or(Color4F()))
+        },
+        m_settings.depth_stencil_format == PixelFormat::Unknown
+            ? Opt<RenderPattern::DepthAttachment>()
+            : RenderPattern::DepthAttachment(
+                1U, m_settings.depth_stencil_format, 1U,
+                RenderPass::Attachment::LoadAction::Clear,
+                RenderPass::Attachment::StoreAction::DontCare,
+                m_settings.clear_depth_stencil ? m_settings.clear_depth_stencil->first : 1.F),
+        std::nullopt, // No stencil attachment
+        RenderPass::Access::ShaderResources | RenderPass::Access::Samplers,
+        false // intermediate render pass
+    });
+    m_render_pattern_ptr->SetName(fmt::format("{} Render Pattern", m_settings.name));
+
+    const FrameSize render_size = GetScaledFrameSize(m_screen_frame_size, m_controller.GetScale());
+    m_view_state_ptr = ViewState::Create({
+        { GetFrameViewport(render_size)    },
+        { GetFrameScissorRect(render_size) }
+    });
+
+    AcquireTarget(render_size);
+}
+
+bool DynamicResolution::Update(double gpu_frame_time_sec)
+{
+    META_FUNCTION_TASK();
+    ReleaseCompletedTargets();
+
+    if (!m_controller.OnGpuFrameTime(gpu_frame_time_sec))
+        return false;
+
+    // Render targets are switched only at discrete scale steps, previously used targets are reused from the pool
+    UpdateScaledFrameSize();
+    return true;
+}
+
+bool DynamicResolution::Update(const CommandList& scaled_render_cmd_list)
+{
+    META_FUNCTION_TASK();
+    const Data::TimeRange gpu_time_range = scaled_render_cmd_list.GetGpuTimeRange(true);
+    if (!gpu_time_range.GetLength())
+        return false;
+
+    return Update(static_cast<double>(gpu_time_range.GetLength()) / Data::g_one_sec_in_nanoseconds);
+}
+
+void DynamicResolution::Resize(const FrameSize& frame_size)
+{
+    META_FUNCTION_TASK();
+    if (m_screen_frame_size == frame_size)
+        return;
+
+    // Pooled targets are sized relative to the previous screen size, so they can not be reused anymore
+    m_screen_frame_size = frame_size;
+    while (!m_targets.empty())
+    {
+        RetireTarget(std::move(m_targets.back()));
+        m_targets.pop_back();
+    }
+    UpdateScaledFrameSize();
+}
+
+void DynamicResolution::Upscale(RenderCommandList& screen_cmd_list, CommandList::DebugGroup* p_debug_group)
+{
+    META_FUNCTION_TASK();
+    const Target& target = GetCurrentTargetForFrame();
+    META_CHECK_ARG_NOT_NULL(target.screen_quad_ptr);
+    target.screen_quad_ptr->Draw(screen_cmd_list, p_debug_group);
+}
+
+const FrameSize& DynamicResolution::GetRenderSize() const
+{
+    META_FUNCTION_TASK();
+    return GetCurrentTarget().frame_size;
+}
+
+RenderPattern& DynamicResolution::GetRenderPattern() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_render_pattern_ptr);
+    return *m_render_pattern_ptr;
+}
+
+RenderPass& DynamicResolution::GetRenderPass()
+{
+    META_FUNCTION_TASK();
+    const Target& target = GetCurrentTargetForFrame();
+    META_CHECK_ARG_NOT_NULL(target.render_pass_ptr);
+    return *target.render_pass_ptr;
+}
+
+RenderCommandList& DynamicResolution::GetRenderCommandList()
+{
+    META_FUNCTION_TASK();
+    Target& target = GetCurrentTargetForFrame();
+    const uint32_t frame_buffer_index = m_render_context.GetFrameBufferIndex();
+    if (frame_buffer_index >= target.render_cmd_list_ptrs.size())
+        target.render_cmd_list_ptrs.resize(m_render_context.GetSettings().frame_buffers_count);
+
+    Ptr<RenderCommandList>& render_cmd_list_ptr = target.render_cmd_list_ptrs[frame_buffer_index];
+    if (!render_cmd_list_ptr)
+    {
+        render_cmd_list_ptr = RenderCommandList::Create(*m_render_cmd_queue_ptr, *target.render_pass_ptr);
+        render_cmd_list_ptr->SetName(fmt::format("{} {}x{} Rendering {}", m_settings.name,
+                                                 target.frame_size.GetWidth(), target.frame_size.GetHeight(), frame_buffer_index));
+    }
+    return *render_cmd_list_ptr;
+}
+
+ViewState& DynamicResolution::GetViewState() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_view_state_ptr);
+    return *m_view_state_ptr;
+}
+
+Texture& DynamicResolution::GetRenderTarget()
+{
+    META_FUNCTION_TASK();
+    const Target& target = GetCurrentTargetForFrame();
+    META_CHECK_ARG_NOT_NULL(target.color_texture_ptr);
+    return *target.color_texture_ptr;
+}
+
+const DynamicResolution::Target& DynamicResolution::GetCurrentTarget() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(m_targets, "dynamic resolution render target is not initialized");
+    return m_targets.front();
+}
+
+DynamicResolution::Target& DynamicResolution::GetCurrentTargetForFrame()
+{
+    META_FUNCTION_TASK();
+    // Target used for encoding of the current frame is retained on eviction until GPU completes this frame
+    META_CHECK_ARG_NOT_EMPTY_DESCR(m_targets, "dynamic resolution render target is not initialized");
+    Target& target = m_targets.front();
+    target.last_used_frame_index = m_render_context.GetFrameIndex();
+    return target;
+}
+
+DynamicResolution::Target& DynamicResolution::AcquireTarget(const FrameSize& frame_size)
+{
+    META_FUNCTION_TASK();
+    const auto is_target_of_size = [&frame_size](const Target& target) { return target.frame_size == frame_size; };
+    if (const auto target_it = std::find_if(m_targets.begin(), m_targets.end(), is_target_of_size);
+        target_it != m_targets.end())
+    {
+        // Move reused target to the front of the pool, so that the least recently used target is evicted first
+        std::rotate(m_targets.begin(), target_it, std::next(target_it));
+        return m_targets.front();
+    }
+
+    if (m_targets.size() >= m_settings.max_pooled_targets_count)
+    {
+        RetireTarget(std::move(m_targets.back()));
+        m_targets.pop_back();
+    }
+
+    // Retired target of the same size is returned to the pool instead of creating the new one
+    if (const auto retired_target_it = std::find_if(m_retired_targets.begin(), m_retired_targets.end(), is_target_of_size);
+        retired_target_it != m_retired_targets.end())
+    {
+        m_targets.emplace_front(std::move(*retired_target_it));
+        m_retired_targets.erase(retired_target_it);
+        return m_targets.front();
+    }
+
+    m_targets.emplace_front(CreateTarget(frame_size));
+    return m_targets.front();
+}
+
+void DynamicResolution::RetireTarget(Target&& target)
+{
+    META_FUNCTION_TASK();
+    // Evicted target is released only after GPU completes frames using its command lists and textures
+    if (IsTargetUsedByGpu(target))
+        m_retired_targets.emplace_back(std::move(target));
+}
+
+void DynamicResolution::ReleaseCompletedTargets()
+{
+    META_FUNCTION_TASK();
+    m_retired_targets.erase(std::remove_if(m_retired_targets.begin(), m_retired_targets.end(),
+                                           [this](const Target& target) { return !IsTargetUsedByGpu(target); }),
+                            m_retired_targets.end());
+}
+
+bool DynamicResolution::IsTargetUsedByGpu(const Target& target) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Frame index is reset only after render context waits for GPU render completion,
+    // otherwise frame is completed when the number of following frames exceeds the maximum frames in flight
+    const uint32_t frame_index = m_render_context.GetFrameIndex();
+    return frame_index >= target.last_used_frame_index &&
+           frame_index - target.last_used_frame_index <= m_render_context.GetMaxFramesInFlight();
+}
+
+DynamicResolution::Target DynamicResolution::CreateTarget(const FrameSize& frame_size) const
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} creates render target of size {}x{}", m_settings.name, frame_size.GetWidth(), frame_size.GetHeight());
+    using namespace magic_enum::bitwise_operators;
+
+    Target target{ frame_size };
+    target.color_texture_ptr = Texture::CreateRenderTarget(m_render_context,
+        Texture::Settings::Image(Dimensions(frame_size), std::nullopt, m_render_context.GetSettings().color_format, false,
+                                 Texture::Usage::RenderTarget | Texture::Usage::ShaderRead));
+    target.color_texture_ptr->SetName(fmt::format("{} Color Target {}x{}", m_settings.name, frame_size.GetWidth(), frame_size.GetHeight()));
+
+    Texture::Views attachments{ Texture::View(*target.color_texture_ptr) };
+    if (m_settings.depth_stencil_format != PixelFormat::Unknown)
+    {
+        target.depth_texture_ptr = Texture::CreateRenderTarget(m_render_context,
+            Texture::Settings::DepthStencilBuffer(Dimensions(frame_size), m_settings.depth_stencil_format));
+        target.depth_texture_ptr->SetName(fmt::format("{} Depth Target {}x{}", m_settings.name, frame_size.GetWidth(), frame_size.GetHeight()));
+        attachments.emplace_back(*target.depth_texture_ptr);
+    }
+
+    target.render_pass_ptr = RenderPass::Create(*m_render_pattern_ptr, { attachments, frame_size });
+    target.render_pass_ptr->SetName(fmt::format("{} Render Pass {}x{}", m_settings.name, frame_size.GetWidth(), frame_size.GetHeight()));
+
+    // Scaled frame is upscaled to the whole screen with bilinear texture sampling in screen-quad pixel shader
+    target.screen_quad_ptr = std::make_shared<ScreenQuad>(*m_render_cmd_queue_ptr, *m_screen_render_pattern_ptr, target.color_texture_ptr,
+        ScreenQuad::Settings
+        {
+            fmt::format("{} Upscale Quad {}x{}", m_settings.name, frame_size.GetWidth(), frame_size.GetHeight()),
+            FrameRect(0, 0, m_screen_frame_size.GetWidth(), m_screen_frame_size.GetHeight()),
+            false, // alpha blending disabled
+            Color4F(1.F, 1.F, 1.F, 1.F),
+            ScreenQuad::TextureMode::RgbaFloat
+        });
+
+    return target;
+}
+
+void DynamicResolution::UpdateScaledFrameSize()
+{
+    META_FUNCTION_TASK();
+    const FrameSize render_size = GetScaledFrameSize(m_screen_frame_size, m_controller.GetScale());
+    AcquireTarget(render_size);
+
+    META_CHECK_ARG_NOT_NULL(m_view_state_ptr);
+    m_view_state_ptr->Reset({
+        { GetFrameViewport(render_size)    },
+        { GetFrameScissorRect(render_size) }
+    });
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,347 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ParallelRenderScheduler.cpp
+Adaptive scheduler of commands encoding with parallel render command list:
+balances items between nested command lists using per-item encoding cost estimates
+and tunes the number of nested command lists to minimize encoding time.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ParallelRenderScheduler.h>
+
+#include <Methane/Graphics/ParallelRenderCommandList.h>
+#include <Methane/Graphics/RenderCommandList.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Timer.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace Methane::Graphics
+{
+
+static double GetMovingAverage(double average, double value, double smoothing_factor) noexcept
+{
+    return average + smoothing_factor * (value - average);
+}
+
+ParallelRenderScheduler::Statistics::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    std::string statistics_str = fmt::format("Parallel encoding with {} command lists{}: wall time {:.3f} ms (average {:.3f} ms), imbalance ratio {:.2f}",
+                                             command_lists_count, is_tuning ? " (tuning)" : "",
+                                             encoding_wall_time_sec * 1000.0, average_encoding_wall_time_sec * 1000.0, imbalance_ratio);
+    for(size_t cmd_list_index = 0; cmd_list_index < command_lists.size(); ++cmd_list_index)
+    {
+        const CommandListStatistics& cmd_list_stats = command_lists[cmd_list_index];
+        statistics_str += fmt::format("\n  - command list {} encoded items [{}, {}) on worker {}: {:.3f} ms (average {:.3f} ms);",
+                                      cmd_list_index, cmd_list_stats.items_range.GetStart(), cmd_list_stats.items_range.GetEnd(),
+                                      cmd_list_stats.worker_id, cmd_list_stats.encoding_time_sec * 1000.0,
+                                      cmd_list_stats.average_encoding_time_sec * 1000.0);
+    }
+    return statistics_str;
+}
+
+ParallelRenderScheduler::ParallelRenderScheduler(const Settings& settings, uint32_t initial_command_lists_count)
+    : m_settings(settings)
+    , m_command_lists_count(initial_command_lists_count ? initial_command_lists_count : settings.max_command_lists_count)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.min_command_lists_count, "minimum command lists count should be positive");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(m_settings.min_command_lists_count, m_settings.max_command_lists_count,
+                                       "minimum command lists count should not be greater than maximum count");
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.tuning_frames_count, "tuning frames count should be positive");
+    META_CHECK_ARG_TRUE_DESCR(m_settings.cost_smoothing_factor > 0.0 && m_settings.cost_smoothing_factor <= 1.0,
+                              "cost smoothing factor should be in range (0, 1]");
+
+    m_command_lists_count = std::clamp(m_command_lists_count, m_settings.min_command_lists_count, m_settings.max_command_lists_count);
+    if (m_settings.auto_tuning_enabled)
+        StartTuning();
+}
+
+Data::Index ParallelRenderScheduler::GetCommandListIndexOfItem(Data::Index item_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(item_index, GetItemsCount());
+    const auto items_range_it = std::upper_bound(m_items_ranges.begin(), m_items_ranges.end(), item_index,
+                                                 [](Data::Index index, const ItemsRange& items_range)
+                                                 { return index < items_range.GetEnd(); });
+    META_CHECK_ARG_TRUE(items_range_it != m_items_ranges.end());
+    return static_cast<Data::Index>(std::distance(m_items_ranges.begin(), items_range_it));
+}
+
+void ParallelRenderScheduler::SetItemsCount(Data::Size items_count)
+{
+    META_FUNCTION_TASK();
+    if (GetItemsCount() == items_count && !m_items_ranges.empty())
+        return;
+
+    // Previously measured item costs are not relevant for the new set of items
+    m_item_costs.assign(items_count, 0.0);
+    m_item_costs_measured = false;
+    UpdateItemsRanges();
+}
+
+void ParallelRenderScheduler::ApplyCommandListsCount(ParallelRenderCommandList& parallel_cmd_list) const
+{
+    META_FUNCTION_TASK();
+    if (parallel_cmd_list.GetParallelCommandLists().size() == m_command_lists_count)
+        return;
+
+    parallel_cmd_list.SetParallelCommandListsCount(m_command_lists_count);
+}
+
+void ParallelRenderScheduler::Encode(const ParallelRenderCommandList& parallel_cmd_list, tf::Executor& executor, const EncodeFunction& encode_function)
+{
+    META_FUNCTION_TASK();
+    const Refs<RenderCommandList>& render_cmd_lists = parallel_cmd_list.GetParallelCommandLists();
+    META_CHECK_ARG_EQUAL_DESCR(render_cmd_lists.size(), m_items_ranges.size(),
+                               "parallel render command list '{}' has unexpected count of nested command lists, "
+                               "scheduled count should be applied with ApplyCommandListsCount before its reset",
+                               parallel_cmd_list.GetName());
+
+    if (m_statistics.command_lists.size() != m_items_ranges.size())
+    {
+        m_statistics.command_lists.clear();
+        m_statistics.command_lists.resize(m_items_ranges.size());
+    }
+
+    const Timer encoding_timer;
+    tf::Taskflow encoding_task_flow;
+    encoding_task_flow.for_each_index(0U, static_cast<uint32_t>(render_cmd_lists.size()), 1U,
+        [this, &render_cmd_lists, &executor, &encode_function](const uint32_t cmd_list_index)
+        {
+            const Timer cmd_list_encoding_timer;
+            encode_function(render_cmd_lists[cmd_list_index].get(), m_items_ranges[cmd_list_index]);
+
+            CommandListStatistics& cmd_list_stats = m_statistics.command_lists[cmd_list_index];
+            cmd_list_stats.encoding_time_sec = cmd_list_encoding_timer.GetElapsedSecondsD();
+            cmd_list_stats.worker_id         = static_cast<int32_t>(executor.this_worker_id());
+        }
+    );
+    executor.run(encoding_task_flow).get();
+
+    const double encoding_wall_time_sec = encoding_timer.GetElapsedSecondsD();
+    UpdateStatistics(encoding_wall_time_sec);
+    UpdateItemCosts();
+    UpdateCommandListsCount(encoding_wall_time_sec);
+    UpdateItemsRanges();
+
+    META_LOG("{}", static_cast<std::string>(m_statistics));
+}
+
+void ParallelRenderScheduler::UpdateStatistics(double encoding_wall_time_sec)
+{
+    META_FUNCTION_TASK();
+    const bool is_first_measurement = m_statistics.command_lists_count != m_items_ranges.size();
+    m_statistics.command_lists_count = static_cast<uint32_t>(m_items_ranges.size());
+    m_statistics.is_tuning = m_is_tuning;
+    m_statistics.encoding_wall_time_sec = encoding_wall_time_sec;
+    m_statistics.average_encoding_wall_time_sec = is_first_measurement
+                                                ? encoding_wall_time_sec
+                                                : GetMovingAverage(m_statistics.average_encoding_wall_time_sec, encoding_wall_time_sec, m_settings.cost_smoothing_factor);
+
+    double max_encoding_time_sec = 0.0;
+    double sum_encoding_time_sec = 0.0;
+    for(size_t cmd_list_index = 0; cmd_list_index < m_items_ranges.size(); ++cmd_list_index)
+    {
+        CommandListStatistics& cmd_list_stats = m_statistics.command_lists[cmd_list_index];
+        cmd_list_stats.items_range = m_items_ranges[cmd_list_index];
+        cmd_list_stats.average_encoding_time_sec = is_first_measurement
+                                                 ? cmd_list_stats.encoding_time_sec
+                                                 : GetMovingAverage(cmd_list_stats.average_encoding_time_sec, cmd_list_stats.encoding_time_sec, m_settings.cost_smoothing_factor);
+        max_encoding_time_sec = std::max(max_encoding_time_sec, cmd_list_stats.encoding_time_sec);
+        sum_encoding_time_sec += cmd_list_stats.encoding_time_sec;
+    }
+
+    const double average_encoding_time_sec = m_items_ranges.empty() ? 0.0 : sum_encoding_time_sec / static_cast<double>(m_items_ranges.size());
+    m_statistics.imbalance_ratio = average_encoding_time_sec > 0.0 ? max_encoding_time_sec / average_encoding_time_sec : 1.0;
+}
+
+void ParallelRenderScheduler::UpdateItemCosts()
+{
+    META_FUNCTION_TASK();
+    // Encoding time of the command list is distributed evenly between items of its range,
+    // so the cost estimates of individual items are converging over frames with different ranges partitioning
+    for(size_t cmd_list_index = 0; cmd_list_index < m_items_ranges.size(); ++cmd_list_index)
+    {
+        const ItemsRange& items_range = m_items_ranges[cmd_list_index];
+        if (!items_range.GetLength())
+            continue;
+
+        const double item_cost = m_statistics.command_lists[cmd_list_index].encoding_time_sec / static_cast<double>(items_range.GetLength());
+        for(Data::Index item_index = items_range.GetStart(); item_index < items_range.GetEnd(); ++item_index)
+        {
+            double& cost = m_item_costs[item_index];
+            cost = m_item_costs_measured ? GetMovingAverage(cost, item_cost, m_settings.cost_smoothing_factor) : item_cost;
+        }
+    }
+    m_item_costs_measured = true;
+}
+
+void ParallelRenderScheduler::UpdateCommandListsCount(double encoding_wall_time_sec)
+{
+    META_FUNCTION_TASK();
+    if (!m_settings.auto_tuning_enabled)
+        return;
+
+    m_measured_encoding_time_sec += encoding_wall_time_sec;
+    m_measured_frames_count++;
+    if (m_measured_frames_count < m_settings.tuning_frames_count)
+        return;
+
+    const double average_encoding_time_sec = m_measured_encoding_time_sec / static_cast<double>(m_measured_frames_count);
+    m_measured_encoding_time_sec = 0.0;
+    m_measured_frames_count = 0U;
+
+    if (!m_is_tuning)
+    {
+        // Restart tuning when encoding time has grown significantly since the count of command lists was settled,
+        // which happens when encoded workload or available CPU resources change
+        if (average_encoding_time_sec <= m_best_encoding_time_sec * (1.0 + m_settings.retuning_loss_threshold))
+        {
+            m_best_encoding_time_sec = std::min(m_best_encoding_time_sec, average_encoding_time_sec);
+            return;
+        }
+        StartTuning();
+    }
+
+    // Hill climbing: increase count of command lists while it reduces encoding time,
+    // then try to decrease it from the initial count if increasing did not help at all
+    if (m_best_encoding_time_sec <= 0.0 || average_encoding_time_sec < m_best_encoding_time_sec * (1.0 - m_settings.tuning_gain_threshold))
+    {
+        m_best_encoding_time_sec   = average_encoding_time_sec;
+        m_best_command_lists_count = m_command_lists_count;
+    }
+    else if (m_tuning_direction > 0 && m_best_command_lists_count == m_tuning_start_command_lists_count)
+    {
+        m_tuning_direction = -1;
+    }
+    else
+    {
+        StopTuning();
+        return;
+    }
+
+    int64_t next_command_lists_count = static_cast<int64_t>(m_best_command_lists_count) + m_tuning_direction;
+    if (next_command_lists_count > static_cast<int64_t>(m_settings.max_command_lists_count) &&
+        m_best_command_lists_count == m_tuning_start_command_lists_count)
+    {
+        m_tuning_direction = -1;
+        next_command_lists_count = static_cast<int64_t>(m_tuning_start_command_lists_count) - 1;
+    }
+
+    if (next_command_lists_count < static_cast<int64_t>(m_settings.min_command_lists_count) ||
+        next_command_lists_count > static_cast<int64_t>(m_settings.max_command_lists_count))
+    {
+        StopTuning();
+        return;
+    }
+
+    m_command_lists_count = static_cast<uint32_t>(next_command_lists_count);
+}
+
+void ParallelRenderScheduler::UpdateItemsRanges()
+{
+    META_FUNCTION_TASK();
+    const Data::Size items_count = GetItemsCount();
+    const double total_cost = std::accumulate(m_item_costs.begin(), m_item_costs.end(), 0.0);
+    if (!m_item_costs_measured || total_cost <= 0.0)
+    {
+        UpdateItemsRangesUniformly(items_count);
+        return;
+    }
+
+    // Split items by the points where cost of preceding items reaches equal fractions of the total cost,
+    // item belongs to the range where its cost midpoint is located
+    m_items_ranges.clear();
+    m_items_ranges.reserve(m_command_lists_count);
+
+    Data::Index begin_item_index = 0U;
+    double      preceding_cost   = 0.0;
+    for(uint32_t cmd_list_index = 0U; cmd_list_index < m_command_lists_count; ++cmd_list_index)
+    {
+        const Data::Size following_ranges_count = m_command_lists_count - cmd_list_index - 1U;
+        if (!following_ranges_count)
+        {
+            m_items_ranges.emplace_back(begin_item_index, items_count);
+            break;
+        }
+
+        const double target_cost = total_cost * static_cast<double>(cmd_list_index + 1U) / static_cast<double>(m_command_lists_count);
+        Data::Index end_item_index = begin_item_index;
+        while(end_item_index < items_count && preceding_cost + m_item_costs[end_item_index] / 2.0 < target_cost)
+        {
+            preceding_cost += m_item_costs[end_item_index];
+            end_item_index++;
+        }
+
+        // Every range gets at least one item while there are enough items left for the following ranges
+        const Data::Index min_end_item_index = items_count - begin_item_index > following_ranges_count ? begin_item_index + 1U : begin_item_index;
+        const Data::Index max_end_item_index = std::max(begin_item_index, items_count - std::min(items_count, following_ranges_count));
+        const Data::Index clamped_end_item_index = std::clamp(end_item_index, min_end_item_index, std::max(min_end_item_index, max_end_item_index));
+        for(; end_item_index < clamped_end_item_index; ++end_item_index)
+            preceding_cost += m_item_costs[end_item_index];
+        for(; end_item_index > clamped_end_item_index; --end_item_index)
+            preceding_cost -= m_item_costs[end_item_index - 1U];
+
+        m_items_ranges.emplace_back(begin_item_index, end_item_index);
+        begin_item_index = end_item_index;
+    }
+}
+
+void ParallelRenderScheduler::UpdateItemsRangesUniformly(Data::Size items_count)
+{
+    META_FUNCTION_TASK();
+    const Data::Size items_count_per_command_list = Data::DivCeil(items_count, m_command_lists_count);
+
+    m_items_ranges.clear();
+    m_items_ranges.reserve(m_command_lists_count);
+    for(uint32_t cmd_list_index = 0U; cmd_list_index < m_command_lists_count; ++cmd_list_index)
+    {
+        const Data::Index begin_item_index = std::min(cmd_list_index * items_count_per_command_list, items_count);
+        const Data::Index end_item_index   = std::min(begin_item_index + items_count_per_command_list, items_count);
+        m_items_ranges.emplace_back(begin_item_index, end_item_index);
+    }
+}
+
+void ParallelRenderScheduler::StartTuning()
+{
+    META_FUNCTION_TASK();
+    m_is_tuning                        = true;
+    m_tuning_direction                 = 1;
+    m_tuning_start_command_lists_count = m_command_lists_count;
+    m_best_command_lists_count         = m_command_lists_count;
+    m_best_encoding_time_sec           = 0.0;
+}
+
+void ParallelRenderScheduler::StopTuning()
+{
+    META_FUNCTION_TASK();
+    m_is_tuning           = false;
+    m_command_lists_count = m_best_command_lists_count;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,70 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DynamicResolutionController.h
+Dynamic resolution controller adjusts render scale with PID controller fed by GPU frame time.
+
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace Methane::Graphics
+{
+
+class DynamicResolutionController
+{
+public:
+    struct Settings
+    {
+        double target_gpu_frame_time_sec = 1.0 / 60.0;
+        float  min_scale                 = 0.5F;
+        float  max_scale                 = 1.F;
+        float  scale_step                = 0.125F; // render targets are resized only at discrete scale steps
+        double scale_up_headroom         = 0.1;    // part of GPU time budget reserved when predicting frame time of increased scale
+        double proportional_gain         = 0.1;
+        double integral_gain             = 0.05;
+        double derivative_gain           = 0.02;
+    };
+
+    explicit DynamicResolutionController(const Settings& settings);
+
+    // Returns true when discrete render scale was changed and render targets have to be resized
+    bool OnGpuFrameTime(double gpu_frame_time_sec);
+    void Reset() noexcept;
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept        { return m_settings; }
+    [[nodiscard]] float           GetScale() const noexcept           { return m_scale; }
+    [[nodiscard]] double          GetContinuousScale() const noexcept { return m_continuous_scale; }
+    [[nodiscard]] uint32_t        GetScaleChangesCount() const noexcept { return m_scale_changes_count; }
+
+private:
+    [[nodiscard]] float GetQuantizedScale(double scale) const noexcept;
+    bool UpdateScale(double gpu_frame_time_sec);
+
+    const Settings m_settings;
+    float          m_scale;
+    double         m_continuous_scale;
+    double         m_prev_error       = 0.0;
+    double         m_prev_prev_error  = 0.0;
+    uint32_t       m_updates_count    = 0U;
+    uint32_t       m_scale_changes_count = 0U;
+};
+
+} // namespace Methane::Graphics
@@ -23,10 +23,10 @@ FPS counter calculates frame time duration with moving average window algorithm.
 
 #pragma once
 
-#include <Methane/Timer.hpp>
+#include <Methane/Graphics/FrameLimiter.h>
 
 #include <cmath>
-#include <queue>
+#include <deque>
 
 namespace Methane::Graphics
 {
@@ -39,17 +39,21 @@ public:
     public:
         FrameTiming() = default;
         FrameTiming(const FrameTiming&) noexcept = default;
-        FrameTiming(double total_time_sec, double present_time_sec, double gpu_wait_time_sec) noexcept;
+        FrameTiming(double total_time_sec, double present_time_sec, double gpu_wait_time_sec, double input_latency_sec = 0.0, double pacing_error_sec = 0.0) noexcept;
 
         [[nodiscard]] double GetTotalTimeSec() const noexcept   { return m_total_time_sec; }
         [[nodiscard]] double GetPresentTimeSec() const noexcept { return m_present_time_sec; }
         [[nodiscard]] double GetGpuWaitTimeSec() const noexcept { return m_gpu_wait_time_sec; }
         [[nodiscard]] double GetCpuTimeSec() const noexcept     { return m_total_time_sec - m_present_time_sec - m_gpu_wait_time_sec; }
+        [[nodiscard]] double GetInputLatencySec() const noexcept{ return m_input_latency_sec; }
+        [[nodiscard]] double GetPacingErrorSec() const noexcept { return m_pacing_error_sec; }
 
         [[nodiscard]] double GetTotalTimeMSec() const noexcept  { return m_total_time_sec * 1000.0; }
         [[nodiscard]] double GetPresentTimeMSec() const noexcept{ return m_present_time_sec * 1000.0; }
         [[nodiscard]] double GetGpuWaitTimeMSec() const noexcept{ return m_gpu_wait_time_sec * 1000.0; }
         [[nodiscard]] double GetCpuTimeMSec() const noexcept    { return GetCpuTimeSec() * 1000.0; }
+        [[nodiscard]] double GetInputLatencyMSec() const noexcept { return m_input_latency_sec * 1000.0; }
+        [[nodiscard]] double GetPacingErrorMSec() const noexcept  { return m_pacing_error_sec * 1000.0; }
 
         [[nodiscard]] double GetCpuTimePercent() const noexcept { return 100.0 * GetCpuTimeSec() / GetTotalTimeSec(); }
 
@@ -63,30 +67,40 @@ public:
         double m_total_time_sec    = 0.0;
         double m_present_time_sec  = 0.0;
         double m_gpu_wait_time_sec = 0.0;
+        double m_input_latency_sec = 0.0; // time from frame input sampling start to frame present on CPU
+        double m_pacing_error_sec  = 0.0; // absolute deviation of frame start from the frame limiter deadline
     };
 
     FpsCounter() = default;
-    explicit FpsCounter(uint32_t averaged_timings_count) noexcept : m_averaged_timings_count(averaged_timings_count) { }
+    explicit FpsCounter(uint32_t averaged_timings_count, const FrameLimiter::IClock& clock = FrameLimiter::GetSystemClock()) noexcept;
 
     void Reset(uint32_t averaged_timings_count) noexcept;
-    void OnGpuFramePresentWait() noexcept    { m_present_timer.Reset(); }
-    void OnCpuFrameReadyToPresent() noexcept { m_present_timer.Reset(); }
-    void OnGpuFramePresented() noexcept      { m_present_on_gpu_wait_time_sec = m_present_timer.GetElapsedSecondsD(); }
+    void OnGpuFramePresentWait() noexcept    { m_present_start_time = m_clock_ptr->Now(); }
+    void OnCpuFrameReadyToPresent() noexcept { m_present_start_time = m_clock_ptr->Now(); }
+    void OnGpuFramePresented() noexcept      { m_present_on_gpu_wait_time_sec = GetElapsedSeconds(m_present_start_time); }
     void OnCpuFramePresented() noexcept;
+    void OnCpuFrameInputSampling() noexcept  { m_input_start_time = m_clock_ptr->Now(); }
+    void OnCpuFramePaced(double pacing_error_sec) noexcept { m_frame_pacing_error_sec = std::abs(pacing_error_sec); }
 
     [[nodiscard]] uint32_t    GetAveragedTimingsCount() const noexcept { return static_cast<uint32_t>(m_frame_timings.size()); }
     [[nodiscard]] FrameTiming GetAverageFrameTiming() const noexcept;
     [[nodiscard]] uint32_t    GetFramesPerSecond() const noexcept;
+    [[nodiscard]] double      GetMaxPacingErrorSec() const noexcept;
+    [[nodiscard]] double      GetFrameTimeJitterSec() const noexcept; // standard deviation of frame time
 
 private:
-    void ResetPresentTimer() noexcept;
+    [[nodiscard]] double GetElapsedSeconds(FrameLimiter::TimePoint start_time) const noexcept;
 
-    Timer                   m_frame_timer;
-    Timer                   m_present_timer;
+    // Frame times are measured with the frame limiter clock, which is replaced with a fake clock in unit tests
+    const FrameLimiter::IClock* m_clock_ptr = &FrameLimiter::GetSystemClock();
+    FrameLimiter::TimePoint     m_frame_start_time   = m_clock_ptr->Now();
+    FrameLimiter::TimePoint     m_present_start_time = m_frame_start_time;
+    FrameLimiter::TimePoint     m_input_start_time   = m_frame_start_time;
     double                  m_present_on_gpu_wait_time_sec = 0.0;
+    double                  m_frame_pacing_error_sec = 0.0;
     uint32_t                m_averaged_timings_count = 100;
     FrameTiming             m_frame_timings_sum;
-    std::queue<FrameTiming> m_frame_timings;
+    std::deque<FrameTiming> m_frame_timings;
 };
 
 } // namespace Methane::Graphics
@@ -0,0 +1,78 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameLimiter.h
+Frame limiter paces frames to the target frame rate with hybrid sleep and spin wait,
+where spin wait duration adapts to the measured sleep overshoot of the OS scheduler.
+
+******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace Methane::Graphics
+{
+
+class FrameLimiter
+{
+public:
+    using Clock     = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    using Duration  = Clock::duration;
+
+    // Time source of the frame limiter, which is replaced with a fake clock in unit tests
+    struct IClock
+    {
+        [[nodiscard]] virtual TimePoint Now() const = 0;
+        virtual void SleepUntil(TimePoint wake_time) = 0;
+        virtual void YieldThread() = 0;
+
+        virtual ~IClock() = default;
+    };
+
+    static IClock& GetSystemClock() noexcept;
+
+    FrameLimiter() = default;
+    explicit FrameLimiter(uint32_t target_fps, IClock& clock = GetSystemClock()) noexcept;
+
+    void SetTargetFps(uint32_t target_fps) noexcept;
+    void Reset() noexcept { m_next_frame_time_opt.reset(); }
+
+    // Blocks until the next frame deadline and returns frame pacing error in seconds:
+    // positive error means that frame was started later than the deadline
+    double WaitForNextFrame();
+
+    [[nodiscard]] uint32_t GetTargetFps() const noexcept      { return m_target_fps; }
+    [[nodiscard]] Duration GetFrameDuration() const noexcept  { return m_frame_duration; }
+    [[nodiscard]] Duration GetSpinWaitDuration() const noexcept { return m_spin_wait_duration; }
+    [[nodiscard]] bool     IsEnabled() const noexcept         { return m_target_fps > 0U; }
+
+private:
+    void UpdateSpinWaitDuration(Duration sleep_overshoot) noexcept;
+
+    IClock*                  m_clock_ptr = &GetSystemClock();
+    uint32_t                 m_target_fps = 0U;
+    Duration                 m_frame_duration { };
+    Duration                 m_spin_wait_duration { };
+    std::optional<TimePoint> m_next_frame_time_opt;
+};
+
+} // namespace Methane::Graphics
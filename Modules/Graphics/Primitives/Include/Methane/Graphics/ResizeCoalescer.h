@@ -0,0 +1,85 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ResizeCoalescer.h
+Resize coalescer merges frame resize requests to the latest size applied once per frame
+and allocates frame-size attachments with slack during live resizing.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Rect.hpp>
+#include <Methane/Memory.hpp>
+
+#include <cstdint>
+
+namespace Methane::Graphics
+{
+
+class ResizeCoalescer
+{
+public:
+    using FrameSize = Data::FrameSize;
+
+    struct Settings
+    {
+        float    slack_ratio              = 0.25F; // extra part of frame size allocated for attachments during live resizing
+        uint32_t slack_alignment          = 64U;   // attachments size allocated with slack is aligned to multiple of this value
+        uint32_t live_resize_frames_count = 30U;   // resizing is considered live until this number of frames passes without resize requests
+    };
+
+    struct Resize
+    {
+        FrameSize frame_size;
+        FrameSize attachments_size;
+        bool      is_frame_resized;
+        bool      is_attachments_reallocated;
+    };
+
+    explicit ResizeCoalescer(const FrameSize& frame_size = {});
+    ResizeCoalescer(const FrameSize& frame_size, const Settings& settings);
+
+    void Reset(const FrameSize& frame_size) noexcept;
+    void RequestResize(const FrameSize& frame_size) noexcept;
+
+    // Called once per frame, returns resize which has to be applied in this frame
+    // or nothing if both frame and attachments sizes are unchanged
+    Opt<Resize> ApplyPendingResize(bool is_live_resizing);
+
+    [[nodiscard]] const Settings&  GetSettings() const noexcept           { return m_settings; }
+    [[nodiscard]] const FrameSize& GetFrameSize() const noexcept          { return m_frame_size; }
+    [[nodiscard]] const FrameSize& GetAttachmentsSize() const noexcept    { return m_attachments_size; }
+    [[nodiscard]] bool             HasPendingResize() const noexcept      { return m_pending_frame_size_opt.has_value(); }
+    [[nodiscard]] uint32_t         GetFrameResizesCount() const noexcept  { return m_frame_resizes_count; }
+    [[nodiscard]] uint32_t         GetReallocationsCount() const noexcept { return m_reallocations_count; }
+
+private:
+    [[nodiscard]] uint32_t GetSlackDimension(uint32_t frame_dimension, uint32_t attachments_dimension) const noexcept;
+    [[nodiscard]] FrameSize GetSlackAttachmentsSize(const FrameSize& frame_size) const noexcept;
+
+    const Settings m_settings;
+    FrameSize      m_frame_size;
+    FrameSize      m_attachments_size;
+    Opt<FrameSize> m_pending_frame_size_opt;
+    uint32_t       m_frames_since_resize_request = 0U;
+    uint32_t       m_frame_resizes_count         = 0U;
+    uint32_t       m_reallocations_count         = 0U;
+};
+
+} // namespace Methane::Graphics
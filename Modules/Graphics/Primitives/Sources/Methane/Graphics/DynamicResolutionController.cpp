@@ -0,0 +1,114 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/DynamicResolutionController.cpp
+Dynamic resolution controller adjusts render scale with PID controller fed by GPU frame time.
+
+******************************************************************************/
+
+#include <Methane/Graphics/DynamicResolutionController.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+DynamicResolutionController::DynamicResolutionController(const Settings& settings)
+    : m_settings(settings)
+    , m_scale(settings.max_scale)
+    , m_continuous_scale(settings.max_scale)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_DESCR(m_settings.target_gpu_frame_time_sec, 0.0, "target GPU frame time should be positive");
+    META_CHECK_ARG_GREATER_DESCR(m_settings.min_scale, 0.F, "min render scale should be positive");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(m_settings.min_scale, m_settings.max_scale, "min render scale can not be greater than max scale");
+    META_CHECK_ARG_GREATER_DESCR(m_settings.scale_step, 0.F, "render scale step should be positive");
+}
+
+void DynamicResolutionController::Reset() noexcept
+{
+    META_FUNCTION_TASK();
+    m_scale            = m_settings.max_scale;
+    m_continuous_scale = m_settings.max_scale;
+    m_prev_error       = 0.0;
+    m_prev_prev_error  = 0.0;
+    m_updates_count    = 0U;
+}
+
+bool DynamicResolutionController::OnGpuFrameTime(double gpu_frame_time_sec)
+{
+    META_FUNCTION_TASK();
+    // Relative GPU time budget headroom: positive error allows to increase render scale, negative requires to decrease it
+    const double error = (m_settings.target_gpu_frame_time_sec - gpu_frame_time_sec) / m_settings.target_gpu_frame_time_sec;
+
+    // Incremental form of PID controller does not accumulate integral term,
+    // so clamping of the controlled scale value works as integral anti-windup
+    const double prev_error      = m_updates_count > 0U ? m_prev_error : error;
+    const double prev_prev_error = m_updates_count > 1U ? m_prev_prev_error : prev_error;
+    const double scale_delta     = m_settings.proportional_gain * (error - prev_error)
+                                 + m_settings.integral_gain     * error
+                                 + m_settings.derivative_gain   * (error - 2.0 * prev_error + prev_prev_error);
+
+    m_prev_prev_error  = prev_error;
+    m_prev_error       = error;
+    m_continuous_scale = std::clamp(m_continuous_scale + scale_delta,
+                                    static_cast<double>(m_settings.min_scale),
+                                    static_cast<double>(m_settings.max_scale));
+    m_updates_count++;
+
+    return UpdateScale(gpu_frame_time_sec);
+}
+
+float DynamicResolutionController::GetQuantizedScale(double scale) const noexcept
+{
+    META_FUNCTION_TASK();
+    // Scale steps are counted down from the max scale, so that the full resolution is always reachable;
+    // rounding to the nearest step works as hysteresis of a half step for the continuous scale value
+    const double steps_count = std::round((m_settings.max_scale - scale) / m_settings.scale_step);
+    return std::max(m_settings.min_scale, m_settings.max_scale - static_cast<float>(steps_count) * m_settings.scale_step);
+}
+
+bool DynamicResolutionController::UpdateScale(double gpu_frame_time_sec)
+{
+    META_FUNCTION_TASK();
+    const float quantized_scale = GetQuantizedScale(m_continuous_scale);
+    if (quantized_scale == m_scale)
+        return false;
+
+    if (quantized_scale > m_scale)
+    {
+        // GPU frame time is proportional to the rendered pixels count, so scale is increased only when predicted
+        // frame time fits in the budget with some headroom, which prevents oscillation between adjacent scale steps
+        const double scale_ratio = static_cast<double>(quantized_scale) / m_scale;
+        if (gpu_frame_time_sec * scale_ratio * scale_ratio > m_settings.target_gpu_frame_time_sec * (1.0 - m_settings.scale_up_headroom))
+        {
+            m_continuous_scale = std::min(m_continuous_scale, m_scale + m_settings.scale_step * 0.49);
+            return false;
+        }
+    }
+
+    META_LOG("Dynamic resolution scale changed from {} to {} with GPU frame time {} ms", m_scale, quantized_scale, gpu_frame_time_sec * 1000.0);
+    m_scale = quantized_scale;
+    m_scale_changes_count++;
+    return true;
+}
+
+} // namespace Methane::Graphics
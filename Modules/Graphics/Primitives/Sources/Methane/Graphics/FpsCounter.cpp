@@ -24,13 +24,17 @@ FPS counter calculates frame time duration with moving average window algorithm.
 #include <Methane/Graphics/FpsCounter.h>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
-FpsCounter::FrameTiming::FrameTiming(double total_time_sec, double present_time_sec, double gpu_wait_time_sec) noexcept
+FpsCounter::FrameTiming::FrameTiming(double total_time_sec, double present_time_sec, double gpu_wait_time_sec, double input_latency_sec, double pacing_error_sec) noexcept
     : m_total_time_sec(total_time_sec)
     , m_present_time_sec(present_time_sec)
     , m_gpu_wait_time_sec(gpu_wait_time_sec)
+    , m_input_latency_sec(input_latency_sec)
+    , m_pacing_error_sec(pacing_error_sec)
 {
     META_FUNCTION_TASK();
 }
@@ -41,6 +45,8 @@ FpsCounter::FrameTiming& FpsCounter::FrameTiming::operator+=(const FrameTiming&
     m_total_time_sec    += other.m_total_time_sec;
     m_present_time_sec  += other.m_present_time_sec;
     m_gpu_wait_time_sec += other.m_gpu_wait_time_sec;
+    m_input_latency_sec += other.m_input_latency_sec;
+    m_pacing_error_sec  += other.m_pacing_error_sec;
     return *this;
 }
 
@@ -50,6 +56,8 @@ FpsCounter::FrameTiming& FpsCounter::FrameTiming::operator-=(const FrameTiming&
     m_total_time_sec    -= other.m_total_time_sec;
     m_present_time_sec  -= other.m_present_time_sec;
     m_gpu_wait_time_sec -= other.m_gpu_wait_time_sec;
+    m_input_latency_sec -= other.m_input_latency_sec;
+    m_pacing_error_sec  -= other.m_pacing_error_sec;
     return *this;
 }
 
@@ -58,7 +66,9 @@ FpsCounter::FrameTiming FpsCounter::FrameTiming::operator/(double divisor) const
     META_FUNCTION_TASK();
     return FrameTiming(m_total_time_sec    / divisor,
                        m_present_time_sec  / divisor,
-                       m_gpu_wait_time_sec / divisor);
+                       m_gpu_wait_time_sec / divisor,
+                       m_input_latency_sec / divisor,
+                       m_pacing_error_sec  / divisor);
 }
 
 FpsCounter::FrameTiming FpsCounter::FrameTiming::operator*(double multiplier) const noexcept
@@ -66,21 +76,29 @@ FpsCounter::FrameTiming FpsCounter::FrameTiming::operator*(double multiplier) co
     META_FUNCTION_TASK();
     return FrameTiming(m_total_time_sec    * multiplier,
                        m_present_time_sec  * multiplier,
-                       m_gpu_wait_time_sec * multiplier);
+                       m_gpu_wait_time_sec * multiplier,
+                       m_input_latency_sec * multiplier,
+                       m_pacing_error_sec  * multiplier);
+}
+
+FpsCounter::FpsCounter(uint32_t averaged_timings_count, const FrameLimiter::IClock& clock) noexcept
+    : m_clock_ptr(&clock)
+    , m_averaged_timings_count(averaged_timings_count)
+{
+    META_FUNCTION_TASK();
 }
 
 void FpsCounter::Reset(uint32_t averaged_timings_count) noexcept
 {
     META_FUNCTION_TASK();
     m_averaged_timings_count = averaged_timings_count;
-    while (!m_frame_timings.empty())
-    {
-        m_frame_timings.pop();
-    }
+    m_frame_timings.clear();
     m_frame_timings_sum = FrameTiming();
     m_present_on_gpu_wait_time_sec = 0.0;
-    m_frame_timer.Reset();
-    m_present_timer.Reset();
+    m_frame_pacing_error_sec = 0.0;
+    m_frame_start_time   = m_clock_ptr->Now();
+    m_present_start_time = m_frame_start_time;
+    m_input_start_time   = m_frame_start_time;
 }
 
 void FpsCounter::OnCpuFramePresented() noexcept
@@ -89,17 +107,20 @@ void FpsCounter::OnCpuFramePresented() noexcept
     if (m_frame_timings.size() >= m_averaged_timings_count)
     {
         m_frame_timings_sum -= m_frame_timings.front();
-        m_frame_timings.pop();
+        m_frame_timings.pop_front();
     }
 
-    const FrameTiming frame_timing(m_frame_timer.GetElapsedSecondsD(),
-                                   m_present_timer.GetElapsedSecondsD(),
-                                   m_present_on_gpu_wait_time_sec);
+    const FrameTiming frame_timing(GetElapsedSeconds(m_frame_start_time),
+                                   GetElapsedSeconds(m_present_start_time),
+                                   m_present_on_gpu_wait_time_sec,
+                                   GetElapsedSeconds(m_input_start_time),
+                                   m_frame_pacing_error_sec);
     
     m_frame_timings_sum += frame_timing;
-    m_frame_timings.push(frame_timing);
+    m_frame_timings.push_back(frame_timing);
 
-    m_frame_timer.Reset();
+    m_frame_start_time = m_clock_ptr->Now();
+    m_frame_pacing_error_sec = 0.0;
 }
 
 FpsCounter::FrameTiming FpsCounter::GetAverageFrameTiming() const noexcept
@@ -116,4 +137,38 @@ uint32_t FpsCounter::GetFramesPerSecond() const noexcept
     return average_frame_time_sec > 0.0 ? static_cast<uint32_t>(std::round(1.0 / average_frame_time_sec)) : 0U;
 }
 
+double FpsCounter::GetMaxPacingErrorSec() const noexcept
+{
+    META_FUNCTION_TASK();
+    double max_pacing_error_sec = 0.0;
+    for(const FrameTiming& frame_timing : m_frame_timings)
+    {
+        max_pacing_error_sec = std::max(max_pacing_error_sec, frame_timing.GetPacingErrorSec());
+    }
+    return max_pacing_error_sec;
+}
+
+double FpsCounter::GetFrameTimeJitterSec() const noexcept
+{
+    META_FUNCTION_TASK();
+    const uint32_t averaged_timings_count = GetAveragedTimingsCount();
+    if (!averaged_timings_count)
+        return 0.0;
+
+    const double average_frame_time_sec = GetAverageFrameTiming().GetTotalTimeSec();
+    double frame_time_variance = 0.0;
+    for(const FrameTiming& frame_timing : m_frame_timings)
+    {
+        const double frame_time_deviation_sec = frame_timing.GetTotalTimeSec() - average_frame_time_sec;
+        frame_time_variance += frame_time_deviation_sec * frame_time_deviation_sec;
+    }
+    return std::sqrt(frame_time_variance / averaged_timings_count);
+}
+
+double FpsCounter::GetElapsedSeconds(FrameLimiter::TimePoint start_time) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::chrono::duration<double>(m_clock_ptr->Now() - start_time).count();
+}
+
 } // namespace Methane::Graphics
@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrameLimiter.cpp
+Frame limiter paces frames to the target frame rate with hybrid sleep and spin wait,
+where spin wait duration adapts to the measured sleep overshoot of the OS scheduler.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameLimiter.h>
+#include <Methane/Instrumentation.h>
+
+#include <thread>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <timeapi.h>
+#endif
+
+namespace Methane::Graphics
+{
+
+// Thread sleep can overshoot wake time by the OS scheduler quantum, which is about 15.6 ms on Windows by default,
+// so the last part of the wait before frame deadline is done with a spin loop, which duration grows up to the observed overshoot
+static constexpr FrameLimiter::Duration g_min_spin_wait_duration = std::chrono::milliseconds(2);
+
+// Spin wait duration decays slowly after the sleep overshoot drops, since single precise wake-ups do not guarantee the next ones
+static constexpr uint32_t g_spin_wait_decay_divider = 16U;
+
+class SystemClock final : public FrameLimiter::IClock
+{
+public:
+#ifdef _WIN32
+    // Default timer resolution on Windows is too coarse for frame pacing, so it is raised to 1 ms while the clock is alive
+    SystemClock() noexcept  { timeBeginPeriod(1U); }
+    ~SystemClock() override { timeEndPeriod(1U); }
+
+    SystemClock(const SystemClock&) = delete;
+    SystemClock(SystemClock&&) = delete;
+    SystemClock& operator=(const SystemClock&) = delete;
+    SystemClock& operator=(SystemClock&&) = delete;
+#endif
+
+    [[nodiscard]] FrameLimiter::TimePoint Now() const override { return FrameLimiter::Clock::now(); }
+    void SleepUntil(FrameLimiter::TimePoint wake_time) override { std::this_thread::sleep_until(wake_time); }
+    void YieldThread() override                                { std::this_thread::yield(); }
+};
+
+FrameLimiter::IClock& FrameLimiter::GetSystemClock() noexcept
+{
+    static SystemClock s_system_clock;
+    return s_system_clock;
+}
+
+FrameLimiter::FrameLimiter(uint32_t target_fps, IClock& clock) noexcept
+    : m_clock_ptr(&clock)
+{
+    META_FUNCTION_TASK();
+    SetTargetFps(target_fps);
+}
+
+void FrameLimiter::SetTargetFps(uint32_t target_fps) noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_target_fps == target_fps)
+        return;
+
+    m_target_fps         = target_fps;
+    m_frame_duration     = target_fps
+                         ? std::chrono::duration_cast<Duration>(std::chrono::duration<double>(1.0 / target_fps))
+                         : Duration::zero();
+    m_spin_wait_duration = std::min(g_min_spin_wait_duration, m_frame_duration);
+    Reset();
+}
+
+double FrameLimiter::WaitForNextFrame()
+{
+    META_FUNCTION_TASK();
+    if (!m_target_fps)
+        return 0.0;
+
+    const TimePoint current_time = m_clock_ptr->Now();
+    if (!m_next_frame_time_opt || current_time - *m_next_frame_time_opt > m_frame_duration)
+    {
+        // Start pacing from the current time on first frame or when frame is late for more than frame duration,
+        // to not render a burst of frames without waiting to catch up with the missed deadlines
+        const double frame_pacing_error_sec = m_next_frame_time_opt
+                                            ? std::chrono::duration<double>(current_time - *m_next_frame_time_opt).count()
+                                            : 0.0;
+        m_next_frame_time_opt = current_time + m_frame_duration;
+        return frame_pacing_error_sec;
+    }
+
+    const TimePoint frame_deadline = *m_next_frame_time_opt;
+    if (const TimePoint sleep_deadline = frame_deadline - m_spin_wait_duration;
+        current_time < sleep_deadline)
+    {
+        m_clock_ptr->SleepUntil(sleep_deadline);
+        UpdateSpinWaitDuration(std::max(Duration::zero(), m_clock_ptr->Now() - sleep_deadline));
+    }
+
+    while (m_clock_ptr->Now() < frame_deadline)
+    {
+        m_clock_ptr->YieldThread();
+    }
+
+    // Next deadline is calculated from the current deadline rather than from the wake time,
+    // so that pacing errors do not accumulate into frame rate drift
+    m_next_frame_time_opt = frame_deadline + m_frame_duration;
+    return std::chrono::duration<double>(m_clock_ptr->Now() - frame_deadline).count();
+}
+
+void FrameLimiter::UpdateSpinWaitDuration(Duration sleep_overshoot) noexcept
+{
+    META_FUNCTION_TASK();
+    // Spin wait covers the observed sleep overshoot with 25% margin, but never exceeds the frame duration
+    const Duration required_spin_wait_duration = std::min(std::max(sleep_overshoot + sleep_overshoot / 4, g_min_spin_wait_duration), m_frame_duration);
+    if (required_spin_wait_duration > m_spin_wait_duration)
+        m_spin_wait_duration = required_spin_wait_duration;
+    else
+        m_spin_wait_duration -= (m_spin_wait_duration - required_spin_wait_duration) / g_spin_wait_decay_divider;
+}
+
+} // namespace Methane::Graphics
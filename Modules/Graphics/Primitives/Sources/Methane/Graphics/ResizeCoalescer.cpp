@@ -0,0 +1,121 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ResizeCoalescer.cpp
+Resize coalescer merges frame resize requests to the latest size applied once per frame
+and allocates frame-size attachments with slack during live resizing.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ResizeCoalescer.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <cmath>
+
+namespace Methane::Graphics
+{
+
+ResizeCoalescer::ResizeCoalescer(const FrameSize& frame_size)
+    : ResizeCoalescer(frame_size, Settings())
+{ }
+
+ResizeCoalescer::ResizeCoalescer(const FrameSize& frame_size, const Settings& settings)
+    : m_settings(settings)
+    , m_frame_size(frame_size)
+    , m_attachments_size(frame_size)
+    , m_frames_since_resize_request(settings.live_resize_frames_count)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_GREATER_OR_EQUAL_DESCR(m_settings.slack_ratio, 0.F, "resize slack ratio can not be negative");
+    META_CHECK_ARG_NOT_ZERO_DESCR(m_settings.slack_alignment, "resize slack alignment can not be zero");
+}
+
+void ResizeCoalescer::Reset(const FrameSize& frame_size) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_size       = frame_size;
+    m_attachments_size = frame_size;
+    m_pending_frame_size_opt.reset();
+    m_frames_since_resize_request = m_settings.live_resize_frames_count;
+}
+
+void ResizeCoalescer::RequestResize(const FrameSize& frame_size) noexcept
+{
+    META_FUNCTION_TASK();
+    // Only the latest requested frame size is kept, intermediate sizes are never applied
+    m_pending_frame_size_opt = frame_size;
+    m_frames_since_resize_request = 0U;
+}
+
+Opt<ResizeCoalescer::Resize> ResizeCoalescer::ApplyPendingResize(bool is_live_resizing)
+{
+    META_FUNCTION_TASK();
+    const bool is_live = is_live_resizing || m_frames_since_resize_request < m_settings.live_resize_frames_count;
+    if (m_frames_since_resize_request < m_settings.live_resize_frames_count)
+        m_frames_since_resize_request++;
+
+    if (!m_pending_frame_size_opt && (is_live || m_attachments_size == m_frame_size))
+        return std::nullopt;
+
+    // When live resizing is over, attachments allocated with slack are shrunk to the exact frame size
+    const FrameSize frame_size       = m_pending_frame_size_opt.value_or(m_frame_size);
+    const FrameSize attachments_size = is_live ? GetSlackAttachmentsSize(frame_size) : frame_size;
+    m_pending_frame_size_opt.reset();
+
+    const Resize resize{
+        frame_size,
+        attachments_size,
+        frame_size != m_frame_size,
+        attachments_size != m_attachments_size
+    };
+    if (!resize.is_frame_resized && !resize.is_attachments_reallocated)
+        return std::nullopt;
+
+    m_frame_size       = frame_size;
+    m_attachments_size = attachments_size;
+    m_frame_resizes_count += resize.is_frame_resized ? 1U : 0U;
+    m_reallocations_count += resize.is_attachments_reallocated ? 1U : 0U;
+    return resize;
+}
+
+uint32_t ResizeCoalescer::GetSlackDimension(uint32_t frame_dimension, uint32_t attachments_dimension) const noexcept
+{
+    META_FUNCTION_TASK();
+    const auto get_aligned_dimension = [this, frame_dimension](float slack_ratio)
+    {
+        const auto slack_dimension = static_cast<uint32_t>(std::ceil(static_cast<float>(frame_dimension) * (1.F + slack_ratio)));
+        return Data::DivCeil(slack_dimension, m_settings.slack_alignment) * m_settings.slack_alignment;
+    };
+
+    // Current attachments are reused while frame fits in them and they are not too large for the frame
+    if (frame_dimension <= attachments_dimension && attachments_dimension <= get_aligned_dimension(2.F * m_settings.slack_ratio))
+        return attachments_dimension;
+
+    return get_aligned_dimension(m_settings.slack_ratio);
+}
+
+ResizeCoalescer::FrameSize ResizeCoalescer::GetSlackAttachmentsSize(const FrameSize& frame_size) const noexcept
+{
+    META_FUNCTION_TASK();
+    return FrameSize(GetSlackDimension(frame_size.GetWidth(),  m_attachments_size.GetWidth()),
+                     GetSlackDimension(frame_size.GetHeight(), m_attachments_size.GetHeight()));
+}
+
+} // namespace Methane::Graphics
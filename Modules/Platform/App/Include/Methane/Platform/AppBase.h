@@ -87,6 +87,7 @@ public:
     const Settings&         GetPlatformAppSettings() const noexcept { return m_settings; }
     const Input::State&     GetInputState() const noexcept          { return m_input_state; }
     const Data::FrameSize&  GetFrameSize() const noexcept           { return m_frame_size; }
+    bool                    IsInitialized() const noexcept          { return m_initialized; }
     bool                    IsMinimized() const noexcept            { return m_is_minimized; }
     bool                    IsResizing() const noexcept             { return m_is_resizing; }
     bool                    HasKeyboardFocus() const noexcept       { return m_has_keyboard_focus; }
@@ -93,7 +93,8 @@ private:
         GpuName,
         HelpKey,
         FrameBuffersAndApi,
-        VSync
+        VSync,
+        GpuMemory
     };
 
     using TextBlockPtrs = std::array<Ptr<Text>, magic_enum::enum_count<TextBlock>()>;
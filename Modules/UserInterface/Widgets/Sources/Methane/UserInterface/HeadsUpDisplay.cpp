@@ -27,7 +27,9 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
  ║ CPU Time %    │                                ║
  ╟───────────────┼────────────────────────────────╢
  ║ VSync ON/OFF  │ W x H       N FB      GFX API  ║
- ╚═══════════════╧════════════════════════════════╝
+ ╟───────────────┴────────────────────────────────╢
+ ║ GPU Memory: used / budget MB, peak MB, N allocs║
+ ╚════════════════════════════════════════════════╝
 
 ******************************************************************************/
 
@@ -233,6 +235,16 @@ HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const Data::Provider& font_d
                 Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
                 m_settings.on_color
             }
+        ),
+        std::make_shared<Text>(ui_context, *m_minor_font_ptr,
+            Text::SettingsUtf8
+            {
+                "GPU Memory",
+                "GPU Memory: 0000.0 / 0000.0 MB, 0000.0 MB peak, 0000 allocations",
+                UnitRect{ Units::Dots, gfx::Point2I{ }, gfx::FrameSize{ 0U, GetTextHeightInDots(ui_context, *m_minor_font_ptr) } },
+                Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
+                m_settings.text_color
+            }
         )
     })
 {
@@ -292,6 +304,17 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
     GetTextBlock(TextBlock::VSync).SetText(context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
     GetTextBlock(TextBlock::VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
 
+    const gfx::Device::MemoryStatistics memory_statistics = GetUIContext().GetRenderContext().GetDevice().GetMemoryStatistics();
+    const uint64_t memory_budget = memory_statistics.GetDeviceLocalBudget();
+    const uint64_t memory_usage  = memory_statistics.GetDeviceLocalUsage();
+    constexpr double bytes_in_megabyte = 1024.0 * 1024.0;
+    GetTextBlock(TextBlock::GpuMemory).SetText(fmt::format("GPU Memory: {:.1f}{} MB, {:.1f} MB peak, {:d} allocations",
+                                                           static_cast<double>(memory_usage) / bytes_in_megabyte,
+                                                           memory_statistics.is_budget_supported ? fmt::format(" / {:.1f}", static_cast<double>(memory_budget) / bytes_in_megabyte) : "",
+                                                           static_cast<double>(memory_statistics.total.max_allocated_size) / bytes_in_megabyte,
+                                                           memory_statistics.total.allocations_count));
+    GetTextBlock(TextBlock::GpuMemory).SetColor(memory_statistics.is_budget_supported && memory_usage > memory_budget ? m_settings.off_color : m_settings.text_color);
+
     LayoutTextBlocks();
     UpdateAllTextBlocks(render_attachment_size);
     m_update_timer.Reset();
@@ -352,6 +375,12 @@ void HeadsUpDisplay::LayoutTextBlocks()
 
     const UnitPoint right_bottom_position = position;
 
+    // Layout bottom line text block under both columns
+    const FrameSize gpu_memory_size = GetTextBlock(TextBlock::GpuMemory).GetRectInDots().size;
+    const UnitPoint gpu_memory_position(Units::Dots, text_margins_in_dots.GetWidth(),
+                                        right_bottom_position.GetY() + std::max(vsync_size.GetHeight(), frame_buffers_size.GetHeight()) + text_margins_in_dots.GetHeight());
+    GetTextBlock(TextBlock::GpuMemory).SetRelOrigin(gpu_memory_position);
+
     position.SetY(text_margins_in_dots.GetHeight());
     GetTextBlock(TextBlock::GpuName).SetRelOrigin(position);
 
@@ -363,8 +392,8 @@ void HeadsUpDisplay::LayoutTextBlocks()
         m_settings.position,
         gfx::FrameSize
         {
-            right_bottom_position.GetX() + right_column_width + text_margins_in_dots.GetWidth(),
-            right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight()
+            std::max(right_bottom_position.GetX() + right_column_width, gpu_memory_position.GetX() + gpu_memory_size.GetWidth()) + text_margins_in_dots.GetWidth(),
+            gpu_memory_position.GetY() + gpu_memory_size.GetHeight() + text_margins_in_dots.GetHeight()
         }
     });
 }
@@ -0,0 +1,196 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/DeferredDeletionQueueTest.cpp
+Unit tests of the deferred deletion queue
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <Methane/Data/DeferredDeletionQueue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <utility>
+
+using namespace Methane;
+using namespace Methane::Data;
+using Catch::Approx;
+
+// Fake clock is advanced explicitly by deleted objects, so that deletion duration does not depend on the scheduler
+class FakeClock final : public DeferredDeletionQueue::IClock
+{
+public:
+    [[nodiscard]] DeferredDeletionQueue::TimePoint Now() const override { return m_now; }
+
+    void Advance(std::chrono::microseconds duration) noexcept
+    {
+        m_now += std::chrono::duration_cast<Timer::TimeDuration>(duration);
+    }
+
+private:
+    DeferredDeletionQueue::TimePoint m_now;
+};
+
+class DeletionCounter
+{
+public:
+    explicit DeletionCounter(std::atomic<size_t>& deleted_count, FakeClock* clock_ptr = nullptr,
+                             std::chrono::microseconds deletion_duration = std::chrono::microseconds(0))
+        : m_deleted_count_ptr(&deleted_count)
+        , m_clock_ptr(clock_ptr)
+        , m_deletion_duration(deletion_duration)
+    { }
+
+    DeletionCounter(const DeletionCounter&) = delete;
+    DeletionCounter(DeletionCounter&& other) noexcept
+        : m_deleted_count_ptr(std::exchange(other.m_deleted_count_ptr, nullptr))
+        , m_clock_ptr(other.m_clock_ptr)
+        , m_deletion_duration(other.m_deletion_duration)
+    { }
+
+    ~DeletionCounter()
+    {
+        if (!m_deleted_count_ptr)
+            return;
+
+        if (m_clock_ptr)
+            m_clock_ptr->Advance(m_deletion_duration);
+
+        (*m_deleted_count_ptr)++;
+    }
+
+private:
+    std::atomic<size_t>*      m_deleted_count_ptr;
+    FakeClock*                m_clock_ptr;
+    std::chrono::microseconds m_deletion_duration;
+};
+
+TEST_CASE("Deferred deletion of completed objects", "[deferred-deletion]")
+{
+    std::atomic<size_t>   deleted_count{ 0U };
+    DeferredDeletionQueue deletion_queue;
+
+    SECTION("Objects are not deleted before completion of their epoch")
+    {
+        deletion_queue.Push(1U, DeletionCounter(deleted_count));
+        deletion_queue.Push(2U, DeletionCounter(deleted_count));
+        CHECK(deletion_queue.GetPendingObjectsCount() == 2U);
+
+        CHECK(deletion_queue.DeleteCompleted(0U) == 0U);
+        CHECK(deleted_count == 0U);
+
+        CHECK(deletion_queue.DeleteCompleted(1U) == 1U);
+        CHECK(deleted_count == 1U);
+        CHECK(deletion_queue.GetPendingObjectsCount() == 1U);
+
+        CHECK(deletion_queue.DeleteCompleted(2U) == 1U);
+        CHECK(deleted_count == 2U);
+        CHECK(deletion_queue.GetPendingObjectsCount() == 0U);
+    }
+
+    SECTION("Shared pointers are released on deletion")
+    {
+        auto object_ptr = std::make_shared<int>(1);
+        deletion_queue.Push(1U, Ptr<int>(object_ptr));
+        CHECK(object_ptr.use_count() == 2);
+
+        deletion_queue.DeleteCompleted(1U);
+        CHECK(object_ptr.use_count() == 1);
+    }
+
+    SECTION("All objects are deleted regardless of epoch")
+    {
+        for(DeferredDeletionQueue::Epoch epoch = 1U; epoch <= 10U; ++epoch)
+            deletion_queue.Push(epoch, DeletionCounter(deleted_count));
+
+        CHECK(deletion_queue.DeleteAll() == 10U);
+        CHECK(deleted_count == 10U);
+        CHECK(deletion_queue.GetStatistics().total_deleted_objects_count == 10U);
+    }
+
+    SECTION("Pending objects are deleted with queue destruction")
+    {
+        {
+            DeferredDeletionQueue local_deletion_queue;
+            local_deletion_queue.Push(1U, DeletionCounter(deleted_count));
+        }
+        CHECK(deleted_count == 1U);
+    }
+}
+
+TEST_CASE("Deferred deletion budget", "[deferred-deletion]")
+{
+    std::atomic<size_t>   deleted_count{ 0U };
+    FakeClock             clock;
+    DeferredDeletionQueue deletion_queue(clock);
+
+    SECTION("Deleted objects count does not exceed budget when churning objects every frame")
+    {
+        constexpr DeferredDeletionQueue::Epoch frames_count              = 100U;
+        constexpr uint32_t                     objects_per_frame_count   = 50U;
+        constexpr uint32_t                     max_objects_count         = 64U;
+        constexpr DeferredDeletionQueue::Epoch frames_in_flight_count    = 3U;
+
+        for(DeferredDeletionQueue::Epoch frame = 1U; frame <= frames_count; ++frame)
+        {
+            for(uint32_t object_index = 0U; object_index < objects_per_frame_count; ++object_index)
+                deletion_queue.Push(frame, DeletionCounter(deleted_count));
+
+            const DeferredDeletionQueue::Epoch completed_frame = frame > frames_in_flight_count ? frame - frames_in_flight_count : 0U;
+            const size_t deleted_in_frame_count = deletion_queue.DeleteCompleted(completed_frame, max_objects_count);
+            CHECK(deleted_in_frame_count <= max_objects_count);
+            CHECK(deleted_count <= completed_frame * objects_per_frame_count);
+            CHECK(deletion_queue.GetStatistics().deleted_objects_count == deleted_in_frame_count);
+        }
+
+        // Backlog of pending objects is drained within budget in the following frames
+        while(deletion_queue.GetPendingObjectsCount())
+            CHECK(deletion_queue.DeleteCompleted(frames_count, max_objects_count) <= max_objects_count);
+
+        CHECK(deleted_count == frames_count * objects_per_frame_count);
+        CHECK(deletion_queue.GetStatistics().total_deleted_objects_count == frames_count * objects_per_frame_count);
+    }
+
+    SECTION("Deletion duration is limited by time budget")
+    {
+        constexpr uint32_t objects_count    = 100U;
+        constexpr double   max_duration_sec = 0.005;
+        const std::chrono::microseconds deletion_duration(1000);
+
+        for(uint32_t object_index = 0U; object_index < objects_count; ++object_index)
+            deletion_queue.Push(1U, DeletionCounter(deleted_count, &clock, deletion_duration));
+
+        // Deletion stops as soon as the time budget is spent: every object deletion takes 1 ms of 5 ms budget
+        CHECK(deletion_queue.DeleteCompleted(1U, 0U, max_duration_sec) == 5U);
+        CHECK(deleted_count == 5U);
+        CHECK(deletion_queue.GetPendingObjectsCount() == objects_count - 5U);
+        CHECK(deletion_queue.GetStatistics().deletion_duration_sec == Approx(max_duration_sec));
+
+        // Remaining objects are deleted in the following frames within the same time budget
+        while(deletion_queue.GetPendingObjectsCount())
+        {
+            CHECK(deletion_queue.DeleteCompleted(1U, 0U, max_duration_sec) == 5U);
+            CHECK(deletion_queue.GetStatistics().deletion_duration_sec <= max_duration_sec);
+        }
+        CHECK(deleted_count == objects_count);
+        CHECK(deletion_queue.GetStatistics().max_deletion_duration_sec == Approx(max_duration_sec));
+    }
+}
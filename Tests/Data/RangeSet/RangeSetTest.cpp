@@ -105,6 +105,19 @@ TEST_CASE("Range set add", "[range-set]")
         const std::set<Range<uint32_t>> reference_set{ { 0, 2 }, { 4, 12 }, { 17, 20 }, { 25, 29 } };
         CHECK(range_set == reference_set);
     }
+
+    SECTION("Adding unordered adjacent ranges coalesces them")
+    {
+        RangeSet<uint32_t> range_set;
+        range_set.Add({ 64, 128 });
+        range_set.Add({ 0, 32 });
+        range_set.Add({ 256, 512 });
+        range_set.Add({ 32, 64 });
+        range_set.Add({ 128, 192 });
+
+        const std::set<Range<uint32_t>> reference_set{ { 0, 192 }, { 256, 512 } };
+        CHECK(range_set == reference_set);
+    }
 }
 
 TEST_CASE("Range set remove", "[range-set]")
@@ -0,0 +1,133 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/BufferSetDataBenchmark.cpp
+Benchmark full and partial data updates of the large private buffer and small per-frame updates of constant buffers
+with persistent and transient memory mapping on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_buffer_size        = 64U * 1024U * 1024U;
+static constexpr Data::Size g_update_range_size  = 4U * 1024U;
+static constexpr uint32_t   g_update_range_count = 64U;
+static constexpr Data::Size g_uniforms_size      = 256U;
+static constexpr uint32_t   g_uniforms_updates   = 10000U;
+static constexpr uint32_t   g_uniforms_buffers   = 16U;
+
+// Updates data of the large private vertex buffer with given sub-resources and waits for the upload completion
+static Data::Size MeasureBufferSetData(HeadlessRenderFixture& fixture, const Resource::SubResources& sub_resources,
+                                       Catch::Benchmark::Chronometer meter)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_buffer_size, sizeof(float) * 4U);
+
+    meter.measure([&]()
+    {
+        buffer_ptr->SetData(sub_resources, render_cmd_queue);
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) > 0U);
+    return buffer_ptr->GetDataSize(Data::MemoryState::Initialized);
+}
+
+TEST_CASE("Benchmark private buffer data updates", "[.][gpu][buffer][benchmark]")
+{
+    HeadlessRenderFixture fixture;
+    const Data::Bytes buffer_data(g_buffer_size, Data::Byte{ 0xC3 });
+
+    // Sparse ranges are spread evenly over the whole buffer, so that only a small part of it is uploaded
+    constexpr Data::Size update_range_stride = g_buffer_size / g_update_range_count;
+    Resource::SubResources range_sub_resources;
+    range_sub_resources.reserve(g_update_range_count);
+    for(uint32_t range_index = 0U; range_index < g_update_range_count; ++range_index)
+    {
+        const Data::Index range_start = range_index * update_range_stride;
+        range_sub_resources.emplace_back(buffer_data.data(), g_update_range_size, Resource::SubResource::Index(),
+                                         Resource::BytesRange(range_start, range_start + g_update_range_size));
+    }
+
+    BENCHMARK_ADVANCED("Full data update of 64 MB private buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBufferSetData(fixture, { { buffer_data.data(), g_buffer_size } }, meter);
+    };
+
+    BENCHMARK_ADVANCED("Update of 64 sparse 4 KB ranges in 64 MB private buffer")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBufferSetData(fixture, range_sub_resources, meter);
+    };
+}
+
+// Updates small volatile constant buffers many times per frame, the way uniforms are updated, and waits for the data to become available to GPU:
+// buffers host memory is mapped persistently by default or mapped and unmapped on every update with TransientMappingOnVulkan option
+static uint32_t MeasureConstantBuffersSetData(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::Bytes uniforms_data(g_uniforms_size, Data::Byte{ 0x5A });
+
+    std::array<Ptr<Buffer>, g_uniforms_buffers> buffers;
+    for(uint32_t buffer_index = 0U; buffer_index < g_uniforms_buffers; ++buffer_index)
+    {
+        buffers[buffer_index] = Buffer::CreateConstantBuffer(context, g_uniforms_size, false, true);
+        buffers[buffer_index]->SetName(fmt::format("Benchmark Uniforms Buffer {}", buffer_index));
+    }
+
+    uint32_t updates_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t update_index = 0U; update_index < g_uniforms_updates; ++update_index)
+        {
+            buffers[update_index % g_uniforms_buffers]->SetData({ { uniforms_data.data(), g_uniforms_size } }, render_cmd_queue);
+            updates_count++;
+        }
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(updates_count == g_uniforms_updates * meter.runs());
+    return updates_count;
+}
+
+TEST_CASE("Benchmark per-frame constant buffer data updates", "[.][gpu][buffer][benchmark]")
+{
+    BENCHMARK_ADVANCED("10000 updates of 256 B in volatile buffers with persistent mapping")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureConstantBuffersSetData(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("10000 updates of 256 B in volatile buffers mapped on every update")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureConstantBuffersSetData(Context::Options::TransientMappingOnVulkan, meter);
+    };
+}
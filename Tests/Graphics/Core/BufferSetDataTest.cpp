@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/BufferSetDataTest.cpp
+GPU tests of buffer data updates with sub-resource data ranges on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_buffer_size = 1024U;
+
+// Read-back buffer memory is mapped to host, so the data written with SetData can be checked directly with GetData
+static Data::Bytes GetBufferData(Buffer& buffer)
+{
+    const SubResource sub_resource = buffer.GetData();
+    return Data::Bytes(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr());
+}
+
+TEST_CASE("Buffer set data with sub-resource data ranges", "[.][gpu][buffer]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateReadBackBuffer(context, g_buffer_size);
+    const Data::Bytes zero_data(g_buffer_size, Data::Byte{ 0x00 });
+    buffer_ptr->SetData({ { zero_data.data(), g_buffer_size } }, render_cmd_queue);
+
+    SECTION("Data range is written at its offset")
+    {
+        const Data::Bytes range_data(64U, Data::Byte{ 0x7E });
+        buffer_ptr->SetData({ { range_data.data(), 64U, {}, BytesRange(256U, 320U) } }, render_cmd_queue);
+
+        const Data::Bytes buffer_data = GetBufferData(*buffer_ptr);
+        REQUIRE(buffer_data.size() == g_buffer_size);
+        CHECK(std::all_of(buffer_data.begin(), buffer_data.begin() + 256, [](Data::Byte byte) { return byte == Data::Byte{ 0x00 }; }));
+        CHECK(std::all_of(buffer_data.begin() + 256, buffer_data.begin() + 320, [](Data::Byte byte) { return byte == Data::Byte{ 0x7E }; }));
+        CHECK(std::all_of(buffer_data.begin() + 320, buffer_data.end(), [](Data::Byte byte) { return byte == Data::Byte{ 0x00 }; }));
+    }
+
+    SECTION("Overlapping data ranges with total size exceeding buffer size are accepted")
+    {
+        const Data::Bytes range_data(768U, Data::Byte{ 0x11 });
+        CHECK_NOTHROW(buffer_ptr->SetData({
+            { range_data.data(), 768U, {}, BytesRange(0U, 768U) },
+            { range_data.data(), 768U, {}, BytesRange(256U, 1024U) },
+        }, render_cmd_queue));
+        CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) == g_buffer_size);
+    }
+
+    SECTION("Data range past the end of buffer is rejected")
+    {
+        const Data::Bytes range_data(128U, Data::Byte{ 0x22 });
+        CHECK_THROWS(buffer_ptr->SetData({ { range_data.data(), 128U, {}, BytesRange(g_buffer_size - 64U, g_buffer_size + 64U) } }, render_cmd_queue));
+    }
+}
+
+TEST_CASE("Buffer initialized data size with sub-resource data ranges", "[.][gpu][buffer]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateReadBackBuffer(context, g_buffer_size);
+    const Data::Bytes buffer_data(g_buffer_size, Data::Byte{ 0x33 });
+
+    SECTION("Initialized size is the end of the last data range")
+    {
+        buffer_ptr->SetData({ { buffer_data.data(), 128U, {}, BytesRange(512U, 640U) } }, render_cmd_queue);
+        CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) == 640U);
+    }
+
+    SECTION("Partial update does not shrink initialized size")
+    {
+        buffer_ptr->SetData({ { buffer_data.data(), g_buffer_size } }, render_cmd_queue);
+        buffer_ptr->SetData({ { buffer_data.data(), 64U, {}, BytesRange(64U, 128U) } }, render_cmd_queue);
+        CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) == g_buffer_size);
+    }
+
+    SECTION("Full update without data ranges resets initialized size")
+    {
+        buffer_ptr->SetData({ { buffer_data.data(), g_buffer_size } }, render_cmd_queue);
+        buffer_ptr->SetData({ { buffer_data.data(), 256U } }, render_cmd_queue);
+        CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) == 256U);
+    }
+}
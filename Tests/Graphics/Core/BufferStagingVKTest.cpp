@@ -0,0 +1,153 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/BufferStagingVKTest.cpp
+GPU tests of the Vulkan private buffer data ranges uploaded with coalesced copy regions from staging buffer
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/Vulkan/BufferVK.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_buffer_size = 1024U;
+
+// Private buffer data is read back from GPU after upload commands from staging buffer are completed
+static Data::Bytes ReadBufferData(RenderContext& context, Buffer& buffer, CommandQueue& cmd_queue)
+{
+    context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    const SubResource read_data = HeadlessRenderFixture::WaitForData(buffer.ReadDataAsync(cmd_queue));
+    return Data::Bytes(read_data.GetDataPtr(), read_data.GetDataEndPtr());
+}
+
+static bool IsFilledWith(const Data::Bytes& data, Data::Index start, Data::Index end, Data::Byte value)
+{
+    return std::all_of(data.begin() + start, data.begin() + end, [value](Data::Byte byte) { return byte == value; });
+}
+
+// Tests are hidden by default, because they require GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter.
+// Staging upload is forced with context option, because private buffers are written directly on devices with unified memory like lavapipe.
+TEST_CASE("Vulkan private buffer data ranges are uploaded through staging buffer", "[.][gpu][vulkan][buffer]")
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(Context::Options::StagingUploadOnVulkan));
+    RenderContext& context          = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateStorageBuffer(context, g_buffer_size, 4U, true);
+    buffer_ptr->SetName("Staged Storage Buffer");
+    const auto& buffer_vk = dynamic_cast<const BufferVK&>(*buffer_ptr);
+    REQUIRE(buffer_vk.IsStagingUpload());
+
+    const Data::Bytes zero_data(g_buffer_size, Data::Byte{ 0x00 });
+    buffer_ptr->SetData({ { zero_data.data(), g_buffer_size } }, render_cmd_queue);
+    REQUIRE(buffer_vk.GetNativeCopyRegions().size() == 1U);
+    context.CompleteInitialization();
+
+    SECTION("Adjacent data ranges are copied with one region and disjoint range with another")
+    {
+        const Data::Bytes range_data(128U, Data::Byte{ 0x5A });
+        buffer_ptr->SetData({
+            { range_data.data(), 128U, {}, BytesRange(0U, 128U) },
+            { range_data.data(), 128U, {}, BytesRange(128U, 256U) },
+            { range_data.data(), 128U, {}, BytesRange(512U, 640U) },
+        }, render_cmd_queue);
+
+        const std::vector<vk::BufferCopy>& vk_copy_regions = buffer_vk.GetNativeCopyRegions();
+        REQUIRE(vk_copy_regions.size() == 2U);
+        CHECK(vk_copy_regions[0].srcOffset == 0U);
+        CHECK(vk_copy_regions[0].dstOffset == 0U);
+        CHECK(vk_copy_regions[0].size == 256U);
+        CHECK(vk_copy_regions[1].srcOffset == 512U);
+        CHECK(vk_copy_regions[1].dstOffset == 512U);
+        CHECK(vk_copy_regions[1].size == 128U);
+
+        const Data::Bytes buffer_data = ReadBufferData(context, *buffer_ptr, render_cmd_queue);
+        REQUIRE(buffer_data.size() == g_buffer_size);
+        CHECK(IsFilledWith(buffer_data, 0U, 256U, Data::Byte{ 0x5A }));
+        CHECK(IsFilledWith(buffer_data, 256U, 512U, Data::Byte{ 0x00 }));
+        CHECK(IsFilledWith(buffer_data, 512U, 640U, Data::Byte{ 0x5A }));
+        CHECK(IsFilledWith(buffer_data, 640U, g_buffer_size, Data::Byte{ 0x00 }));
+    }
+
+    SECTION("Overlapping data ranges are copied with one region")
+    {
+        const Data::Bytes first_data(768U, Data::Byte{ 0x11 });
+        const Data::Bytes second_data(512U, Data::Byte{ 0x22 });
+        buffer_ptr->SetData({
+            { first_data.data(),  768U, {}, BytesRange(0U, 768U) },
+            { second_data.data(), 512U, {}, BytesRange(512U, 1024U) },
+        }, render_cmd_queue);
+
+        const std::vector<vk::BufferCopy>& vk_copy_regions = buffer_vk.GetNativeCopyRegions();
+        REQUIRE(vk_copy_regions.size() == 1U);
+        CHECK(vk_copy_regions[0].srcOffset == 0U);
+        CHECK(vk_copy_regions[0].size == g_buffer_size);
+
+        // Later sub-resource overwrites the overlapping part of the earlier one in staging memory
+        const Data::Bytes buffer_data = ReadBufferData(context, *buffer_ptr, render_cmd_queue);
+        REQUIRE(buffer_data.size() == g_buffer_size);
+        CHECK(IsFilledWith(buffer_data, 0U, 512U, Data::Byte{ 0x11 }));
+        CHECK(IsFilledWith(buffer_data, 512U, g_buffer_size, Data::Byte{ 0x22 }));
+    }
+
+    SECTION("Disjoint data ranges are copied with separate regions")
+    {
+        const Data::Bytes range_data(64U, Data::Byte{ 0x33 });
+        buffer_ptr->SetData({
+            { range_data.data(), 64U, {}, BytesRange(0U, 64U) },
+            { range_data.data(), 64U, {}, BytesRange(256U, 320U) },
+            { range_data.data(), 64U, {}, BytesRange(960U, 1024U) },
+        }, render_cmd_queue);
+
+        CHECK(buffer_vk.GetNativeCopyRegions().size() == 3U);
+
+        const Data::Bytes buffer_data = ReadBufferData(context, *buffer_ptr, render_cmd_queue);
+        REQUIRE(buffer_data.size() == g_buffer_size);
+        CHECK(IsFilledWith(buffer_data, 0U, 64U, Data::Byte{ 0x33 }));
+        CHECK(IsFilledWith(buffer_data, 64U, 256U, Data::Byte{ 0x00 }));
+        CHECK(IsFilledWith(buffer_data, 256U, 320U, Data::Byte{ 0x33 }));
+        CHECK(IsFilledWith(buffer_data, 320U, 960U, Data::Byte{ 0x00 }));
+        CHECK(IsFilledWith(buffer_data, 960U, g_buffer_size, Data::Byte{ 0x33 }));
+    }
+}
+
+TEST_CASE("Vulkan private buffer written directly is transitioned to its target state", "[.][gpu][vulkan][buffer]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_buffer_size, sizeof(float) * 4U);
+    buffer_ptr->SetName("Direct Vertex Buffer");
+
+    const Data::Bytes buffer_data(g_buffer_size, Data::Byte{ 0x44 });
+    buffer_ptr->SetData({ { buffer_data.data(), g_buffer_size } }, fixture.GetRenderCommandQueue());
+    context.CompleteInitialization();
+    context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+
+    // Buffer state is changed to the vertex buffer state both with direct write and with staging copy,
+    // depending on whether device local memory is host visible on the device
+    INFO("Staging upload: " << dynamic_cast<const BufferVK&>(*buffer_ptr).IsStagingUpload());
+    CHECK(buffer_ptr->GetState() == Resource::State::VertexBuffer);
+}
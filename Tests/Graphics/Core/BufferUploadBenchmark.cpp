@@ -0,0 +1,108 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/BufferUploadBenchmark.cpp
+Benchmark upload of private buffers data on application startup and upload throughput
+with direct writes to device memory and with staging buffer copies on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_startup_buffer_size    = 64U * 1024U;
+static constexpr uint32_t   g_startup_buffers_count  = 256U;
+static constexpr Data::Size g_throughput_buffer_size = 16U * 1024U * 1024U;
+
+// Creates private vertex buffers with initial data and waits for the upload completion, like on application startup,
+// where resources are uploaded on completion of context initialization
+static size_t MeasureStartupBuffersUpload(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::Bytes buffer_data(g_startup_buffer_size, Data::Byte{ 0x5A });
+
+    Ptrs<Buffer> buffers;
+    buffers.reserve(g_startup_buffers_count * meter.runs());
+    meter.measure([&]()
+    {
+        for(uint32_t buffer_index = 0U; buffer_index < g_startup_buffers_count; ++buffer_index)
+        {
+            Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_startup_buffer_size, sizeof(float) * 4U);
+            buffer_ptr->SetData({ { buffer_data.data(), g_startup_buffer_size } }, render_cmd_queue);
+            buffers.emplace_back(std::move(buffer_ptr));
+        }
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(buffers.size() == g_startup_buffers_count * meter.runs());
+    return buffers.size();
+}
+
+// Updates data of the large private vertex buffer and waits for the upload completion
+static Data::Size MeasureBufferUploadThroughput(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::Bytes buffer_data(g_throughput_buffer_size, Data::Byte{ 0xA5 });
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_throughput_buffer_size, sizeof(float) * 4U);
+
+    meter.measure([&]()
+    {
+        buffer_ptr->SetData({ { buffer_data.data(), g_throughput_buffer_size } }, render_cmd_queue);
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    });
+
+    CHECK(buffer_ptr->GetDataSize(Data::MemoryState::Initialized) == g_throughput_buffer_size);
+    return buffer_ptr->GetDataSize(Data::MemoryState::Initialized);
+}
+
+// Private buffers are written directly to host visible device memory by default on devices with unified memory or resizable BAR,
+// while StagingUploadOnVulkan option forces upload with copy commands from staging buffers as on discrete GPU
+TEST_CASE("Benchmark private buffers upload", "[.][gpu][buffer][benchmark]")
+{
+    BENCHMARK_ADVANCED("Startup upload of 256 private buffers of 64 KB with direct writes")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStartupBuffersUpload(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("Startup upload of 256 private buffers of 64 KB with staging copies")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStartupBuffersUpload(Context::Options::StagingUploadOnVulkan, meter);
+    };
+
+    BENCHMARK_ADVANCED("Upload throughput of 16 MB private buffer with direct writes")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBufferUploadThroughput(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("Upload throughput of 16 MB private buffer with staging copies")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureBufferUploadThroughput(Context::Options::StagingUploadOnVulkan, meter);
+    };
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/CommandSubmitBenchmark.cpp
+Benchmark submit of command list sets to the render queue with and without submit batching on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/BlitCommandList.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_command_list_sets_per_frame = 16U;
+static constexpr uint32_t g_frames_per_run              = 8U;
+
+// Executes many small command list sets on the render queue every frame,
+// so that submit overhead dominates over GPU work and batched submits can be compared with immediate submits
+static uint32_t MeasureCommandListSetsSubmit(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const uint32_t frame_buffers_count = context.GetSettings().frame_buffers_count;
+
+    // Command lists are created per frame buffer to let them execute while next frames are encoded
+    std::vector<Ptrs<BlitCommandList>> frame_cmd_lists(frame_buffers_count);
+    std::vector<Ptrs<CommandListSet>>  frame_cmd_list_sets(frame_buffers_count);
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        for(uint32_t set_index = 0U; set_index < g_command_list_sets_per_frame; ++set_index)
+        {
+            const Ptr<BlitCommandList>& blit_cmd_list_ptr = frame_cmd_lists[frame_index].emplace_back(BlitCommandList::Create(render_cmd_queue));
+            blit_cmd_list_ptr->SetName(fmt::format("Submit Benchmark {} of Frame {}", set_index, frame_index));
+            frame_cmd_list_sets[frame_index].emplace_back(CommandListSet::Create({ *blit_cmd_list_ptr }, frame_index));
+        }
+    }
+
+    uint32_t rendered_frames_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t frame_index = 0U; frame_index < g_frames_per_run; ++frame_index)
+        {
+            const uint32_t frame_buffer_index = context.GetFrameBufferIndex();
+            for(uint32_t set_index = 0U; set_index < g_command_list_sets_per_frame; ++set_index)
+            {
+                BlitCommandList& blit_cmd_list = *frame_cmd_lists[frame_buffer_index][set_index];
+                blit_cmd_list.Reset();
+                blit_cmd_list.Commit();
+                render_cmd_queue.Execute(*frame_cmd_list_sets[frame_buffer_index][set_index]);
+            }
+            fixture.RenderFrame();
+            ++rendered_frames_count;
+        }
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(rendered_frames_count == g_frames_per_run * meter.runs());
+    return rendered_frames_count;
+}
+
+TEST_CASE("Benchmark command list sets submit", "[.][gpu][command-queue][benchmark]")
+{
+    BENCHMARK_ADVANCED("Immediate submit of 16 command list sets per frame")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureCommandListSetsSubmit(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("Batched submit of 16 command list sets per frame")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureCommandListSetsSubmit(Context::Options::BatchedSubmitOnVulkan, meter);
+    };
+}
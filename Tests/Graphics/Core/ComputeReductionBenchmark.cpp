@@ -0,0 +1,92 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ComputeReductionBenchmark.cpp
+Benchmark parallel reduction of large storage buffer with compute shader on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_group_size       = 64U; // Equal to GROUP_SIZE in Reduction.hlsl
+static constexpr uint32_t g_values_count     = 16U * 1024U * 1024U;
+static constexpr uint32_t g_dispatches_per_run = 4U;
+
+// Reduces input buffer values to the sums of thread groups with compute shader dispatch and waits for completion on CPU
+static uint32_t MeasureComputeReduction(HeadlessRenderFixture& fixture, Catch::Benchmark::Chronometer meter)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<ComputeState> compute_state_ptr = fixture.CreateComputeState("Reduction", "SumCS", ThreadGroupSize(g_group_size, 1U, 1U));
+
+    const std::vector<uint32_t> input_values(g_values_count, 1U);
+    const auto input_size  = static_cast<Data::Size>(g_values_count * sizeof(uint32_t));
+    const auto groups_count = g_values_count / g_group_size;
+    const Ptr<Buffer> input_buffer_ptr = Buffer::CreateStorageBuffer(context, input_size, sizeof(uint32_t));
+    input_buffer_ptr->SetName("Benchmark Reduction Input Buffer");
+    input_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(input_values.data()), input_size } }, render_cmd_queue); // NOSONAR
+    const Ptr<Buffer> output_buffer_ptr = Buffer::CreateStorageBuffer(context, groups_count * sizeof(uint32_t), sizeof(uint32_t));
+    output_buffer_ptr->SetName("Benchmark Reduction Output Buffer");
+    context.CompleteInitialization();
+
+    const Ptr<ProgramBindings> program_bindings_ptr = ProgramBindings::Create(compute_state_ptr->GetSettings().program_ptr, {
+        { { Shader::Type::Compute, "g_input"  }, { { *input_buffer_ptr  } } },
+        { { Shader::Type::Compute, "g_output" }, { { *output_buffer_ptr } } },
+    });
+
+    const Ptr<ComputeCommandList> compute_cmd_list_ptr = ComputeCommandList::Create(render_cmd_queue);
+    compute_cmd_list_ptr->SetName("Benchmark Reduction Compute");
+    const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *compute_cmd_list_ptr });
+
+    uint32_t dispatches_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t dispatch_index = 0U; dispatch_index < g_dispatches_per_run; ++dispatch_index)
+        {
+            compute_cmd_list_ptr->ResetWithState(*compute_state_ptr);
+            compute_cmd_list_ptr->SetProgramBindings(*program_bindings_ptr);
+            compute_cmd_list_ptr->Dispatch(ThreadGroupsCount(groups_count, 1U, 1U));
+            compute_cmd_list_ptr->Commit();
+            render_cmd_queue.Execute(*execute_cmd_list_set_ptr);
+            compute_cmd_list_ptr->WaitUntilCompleted();
+            dispatches_count++;
+        }
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(dispatches_count == g_dispatches_per_run * meter.runs());
+    return dispatches_count;
+}
+
+TEST_CASE("Benchmark compute reduction", "[.][gpu][compute][benchmark]")
+{
+    HeadlessRenderFixture fixture;
+
+    BENCHMARK_ADVANCED("Reduction of 16M values in thread groups of 64")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureComputeReduction(fixture, meter);
+    };
+}
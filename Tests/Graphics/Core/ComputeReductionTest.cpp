@@ -0,0 +1,215 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ComputeReductionTest.cpp
+GPU tests of compute command list dispatching parallel reduction shader on the headless render context
+and of compute work ordering with render work of another queue synchronized with fences
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/Fence.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_group_size = 64U; // Equal to GROUP_SIZE in Reduction.hlsl
+
+// Sums of input values in groups, which are expected in the output buffer
+static std::vector<uint32_t> GetGroupSums(const std::vector<uint32_t>& values)
+{
+    std::vector<uint32_t> group_sums(values.size() / g_group_size, 0U);
+    for(size_t value_index = 0U; value_index < values.size(); ++value_index)
+    {
+        group_sums[value_index / g_group_size] += values[value_index];
+    }
+    return group_sums;
+}
+
+// Updates system GPU devices with the given capabilities and restores devices with default capabilities of the headless fixture on destruction,
+// so that the devices required by one test do not leak to other tests
+class GpuDevicesCapabilitiesGuard
+{
+public:
+    explicit GpuDevicesCapabilitiesGuard(const Device::Capabilities& device_caps)
+    {
+        static_cast<void>(System::Get().UpdateGpuDevices(Device::Capabilities(device_caps).SetPresentToWindow(false)));
+    }
+
+    ~GpuDevicesCapabilitiesGuard()
+    {
+        static_cast<void>(System::Get().UpdateGpuDevices(GetDefaultCapabilities().SetPresentToWindow(false)));
+    }
+
+    GpuDevicesCapabilitiesGuard(const GpuDevicesCapabilitiesGuard&) = delete;
+    GpuDevicesCapabilitiesGuard& operator=(const GpuDevicesCapabilitiesGuard&) = delete;
+
+    static Device::Capabilities GetDefaultCapabilities()
+    {
+        return Device::Capabilities().SetFeatures(Device::Features::BasicRendering);
+    }
+};
+
+TEST_CASE("Compute command list dispatches parallel reduction", "[.][gpu][compute]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<ComputeState> compute_state_ptr = fixture.CreateComputeState("Reduction", "SumCS", ThreadGroupSize(g_group_size, 1U, 1U));
+    const Ptr<Program>&     program_ptr = compute_state_ptr->GetSettings().program_ptr;
+
+    const uint32_t groups_count = GENERATE(1U, 16U, 1024U);
+    std::vector<uint32_t> input_values(static_cast<size_t>(groups_count) * g_group_size);
+    std::iota(input_values.begin(), input_values.end(), 1U);
+    const auto input_size  = static_cast<Data::Size>(input_values.size() * sizeof(uint32_t));
+    const auto output_size = static_cast<Data::Size>(groups_count * sizeof(uint32_t));
+
+    const Ptr<Buffer> input_buffer_ptr = Buffer::CreateStorageBuffer(context, input_size, sizeof(uint32_t));
+    input_buffer_ptr->SetName("Reduction Input Buffer");
+    input_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(input_values.data()), input_size } }, render_cmd_queue); // NOSONAR
+    const Ptr<Buffer> output_buffer_ptr = Buffer::CreateStorageBuffer(context, output_size, sizeof(uint32_t), true);
+    output_buffer_ptr->SetName("Reduction Output Buffer");
+    context.CompleteInitialization();
+
+    const Ptr<ProgramBindings> program_bindings_ptr = ProgramBindings::Create(program_ptr, {
+        { { Shader::Type::Compute, "g_input"  }, { { *input_buffer_ptr  } } },
+        { { Shader::Type::Compute, "g_output" }, { { *output_buffer_ptr } } },
+    });
+
+    const Ptr<ComputeCommandList> compute_cmd_list_ptr = ComputeCommandList::Create(render_cmd_queue);
+    compute_cmd_list_ptr->SetName("Reduction Compute");
+    compute_cmd_list_ptr->ResetWithState(*compute_state_ptr);
+    compute_cmd_list_ptr->SetProgramBindings(*program_bindings_ptr);
+    compute_cmd_list_ptr->Dispatch(ThreadGroupsCount(groups_count, 1U, 1U));
+    compute_cmd_list_ptr->Commit();
+
+    const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *compute_cmd_list_ptr });
+    render_cmd_queue.Execute(*execute_cmd_list_set_ptr);
+
+    const SubResource output_data = HeadlessRenderFixture::WaitForData(output_buffer_ptr->ReadDataAsync(render_cmd_queue));
+    REQUIRE(output_data.GetDataSize() == output_size);
+
+    const auto* output_values_ptr = output_data.GetDataPtr<uint32_t>();
+    const std::vector<uint32_t> output_values(output_values_ptr, output_values_ptr + groups_count);
+    CHECK(output_values == GetGroupSums(input_values));
+}
+
+TEST_CASE("Async compute queue work is ordered with render queue work by fences", "[.][gpu][compute][command-queue]")
+{
+    const Device::Capabilities async_compute_device_caps = GpuDevicesCapabilitiesGuard::GetDefaultCapabilities().SetComputeQueuesCount(1U);
+    const GpuDevicesCapabilitiesGuard device_caps_guard(async_compute_device_caps);
+    const bool is_async_compute_supported = static_cast<bool>(System::Get().GetSoftwareGpuDevice());
+
+    // When software GPU device has no queue available for async compute, compute work is executed on the render queue,
+    // where it is ordered by submission without fence waits, so that only reduction results are checked in this case
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings(),
+                                  is_async_compute_supported ? async_compute_device_caps : GpuDevicesCapabilitiesGuard::GetDefaultCapabilities());
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    Ptr<CommandQueue> async_compute_cmd_queue_ptr;
+    if (is_async_compute_supported)
+    {
+        async_compute_cmd_queue_ptr = CommandQueue::Create(context, CommandList::Type::Compute);
+        async_compute_cmd_queue_ptr->SetName("Async Compute Queue");
+    }
+    else
+    {
+        UNSCOPED_INFO("software GPU device has no queue available for async compute, compute work is executed on the render queue");
+    }
+    CommandQueue& compute_cmd_queue = async_compute_cmd_queue_ptr ? *async_compute_cmd_queue_ptr : render_cmd_queue;
+    const Ptr<Fence> compute_fence_ptr = Fence::Create(compute_cmd_queue);
+    compute_fence_ptr->SetName("Async Compute Fence");
+    const Ptr<Fence> render_fence_ptr = Fence::Create(render_cmd_queue);
+    render_fence_ptr->SetName("Render Fence");
+    const Ptr<ComputeState> compute_state_ptr = fixture.CreateComputeState("Reduction", "SumCS", ThreadGroupSize(g_group_size, 1U, 1U));
+
+    // Every iteration reduces different input values to the same output buffer, so that the read-back on render queue
+    // gets the expected sums only when it waits for the dispatch and the next dispatch waits for the read-back
+    constexpr uint32_t iterations_count = 8U;
+    constexpr uint32_t groups_count     = 256U;
+    const auto input_size  = static_cast<Data::Size>(groups_count * g_group_size * sizeof(uint32_t));
+    const auto output_size = static_cast<Data::Size>(groups_count * sizeof(uint32_t));
+    const Ptr<Buffer> output_buffer_ptr = Buffer::CreateStorageBuffer(context, output_size, sizeof(uint32_t), true);
+    output_buffer_ptr->SetName("Reduction Output Buffer");
+
+    std::vector<std::vector<uint32_t>> iteration_input_values;
+    Ptrs<Buffer>                       input_buffers;
+    Ptrs<ProgramBindings>              program_bindings;
+    Ptrs<ComputeCommandList>           compute_cmd_lists;
+    Ptrs<CommandListSet>               execute_cmd_list_sets;
+    for(uint32_t iteration = 0U; iteration < iterations_count; ++iteration)
+    {
+        std::vector<uint32_t>& input_values = iteration_input_values.emplace_back(static_cast<size_t>(groups_count) * g_group_size);
+        std::iota(input_values.begin(), input_values.end(), iteration * 1000U);
+
+        const Ptr<Buffer>& input_buffer_ptr = input_buffers.emplace_back(Buffer::CreateStorageBuffer(context, input_size, sizeof(uint32_t)));
+        input_buffer_ptr->SetName(fmt::format("Reduction Input Buffer {}", iteration));
+        input_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(input_values.data()), input_size } }, compute_cmd_queue); // NOSONAR
+
+        program_bindings.emplace_back(ProgramBindings::Create(compute_state_ptr->GetSettings().program_ptr, {
+            { { Shader::Type::Compute, "g_input"  }, { { *input_buffer_ptr  } } },
+            { { Shader::Type::Compute, "g_output" }, { { *output_buffer_ptr } } },
+        }));
+
+        const Ptr<ComputeCommandList>& compute_cmd_list_ptr = compute_cmd_lists.emplace_back(ComputeCommandList::Create(compute_cmd_queue));
+        compute_cmd_list_ptr->SetName(fmt::format("Reduction Compute {}", iteration));
+        execute_cmd_list_sets.emplace_back(CommandListSet::Create({ *compute_cmd_list_ptr }));
+    }
+    context.CompleteInitialization();
+
+    std::vector<Resource::ReadDataFuture> read_data_futures;
+    for(uint32_t iteration = 0U; iteration < iterations_count; ++iteration)
+    {
+        // Compute queue waits for the read-back of the previous iteration results before overwriting them
+        if (iteration > 0U && async_compute_cmd_queue_ptr)
+            render_fence_ptr->WaitOnGpu(compute_cmd_queue);
+
+        ComputeCommandList& compute_cmd_list = *compute_cmd_lists[iteration];
+        compute_cmd_list.ResetWithState(*compute_state_ptr);
+        compute_cmd_list.SetProgramBindings(*program_bindings[iteration]);
+        compute_cmd_list.Dispatch(ThreadGroupsCount(groups_count, 1U, 1U));
+        compute_cmd_list.Commit();
+        compute_cmd_queue.Execute(*execute_cmd_list_sets[iteration]);
+        compute_fence_ptr->Signal();
+
+        // Render queue renders the frame interleaved with compute work and reads back results after waiting for the dispatch
+        if (async_compute_cmd_queue_ptr)
+            compute_fence_ptr->WaitOnGpu(render_cmd_queue);
+        fixture.RenderFrame();
+        read_data_futures.emplace_back(output_buffer_ptr->ReadDataAsync(render_cmd_queue));
+        render_fence_ptr->Signal();
+    }
+
+    for(uint32_t iteration = 0U; iteration < iterations_count; ++iteration)
+    {
+        const SubResource output_data = HeadlessRenderFixture::WaitForData(read_data_futures[iteration]);
+        REQUIRE(output_data.GetDataSize() == output_size);
+
+        const auto* output_values_ptr = output_data.GetDataPtr<uint32_t>();
+        const std::vector<uint32_t> output_values(output_values_ptr, output_values_ptr + groups_count);
+        CHECK(output_values == GetGroupSums(iteration_input_values[iteration]));
+    }
+    context.WaitForGpu(Context::WaitFor::RenderComplete);
+}
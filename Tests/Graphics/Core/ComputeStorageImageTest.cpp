@@ -0,0 +1,81 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ComputeStorageImageTest.cpp
+GPU test of compute command list dispatching shader writing storage image on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_thread_group_size = 8U; // Equal to numthreads in ImageFill.hlsl
+
+// Test is hidden by default, because it requires GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Compute command list writes storage image", "[.][gpu][compute]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<ComputeState> compute_state_ptr = fixture.CreateComputeState("ImageFill", "FillCS", ThreadGroupSize(g_thread_group_size, g_thread_group_size, 1U));
+
+    const uint32_t image_size = GENERATE(8U, 32U);
+    using namespace magic_enum::bitwise_operators;
+    const Ptr<Texture> image_ptr = Texture::CreateRenderTarget(context,
+        Texture::Settings::Image(Dimensions(image_size, image_size), std::nullopt, PixelFormat::RGBA8Unorm, false,
+                                 Resource::Usage::ShaderWrite | Resource::Usage::ReadBack));
+    image_ptr->SetName("Storage Image");
+    context.CompleteInitialization();
+
+    const Ptr<ProgramBindings> program_bindings_ptr = ProgramBindings::Create(compute_state_ptr->GetSettings().program_ptr, {
+        { { Shader::Type::Compute, "g_image" }, { { *image_ptr } } },
+    });
+
+    const Ptr<ComputeCommandList> compute_cmd_list_ptr = ComputeCommandList::Create(render_cmd_queue);
+    compute_cmd_list_ptr->SetName("Image Fill Compute");
+    compute_cmd_list_ptr->ResetWithState(*compute_state_ptr);
+    compute_cmd_list_ptr->SetProgramBindings(*program_bindings_ptr);
+    compute_cmd_list_ptr->Dispatch(ThreadGroupsCount(image_size / g_thread_group_size, image_size / g_thread_group_size, 1U));
+    compute_cmd_list_ptr->Commit();
+
+    const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *compute_cmd_list_ptr });
+    render_cmd_queue.Execute(*execute_cmd_list_set_ptr);
+
+    const SubResource image_data = HeadlessRenderFixture::WaitForData(image_ptr->ReadDataAsync(render_cmd_queue));
+    REQUIRE(image_data.GetDataSize() == image_size * image_size * 4U);
+
+    size_t mismatched_pixels_count = 0U;
+    const auto* image_data_ptr = image_data.GetDataPtr<uint8_t>();
+    for(uint32_t y = 0U; y < image_size; ++y)
+        for(uint32_t x = 0U; x < image_size; ++x)
+        {
+            // Storage image has RGBA8 format, unlike BGRA8 frame buffers compared with HeadlessRenderFixture::Pixel
+            const std::array<uint8_t, 4> expected_pixel{ static_cast<uint8_t>(x), static_cast<uint8_t>(y), 0U, 255U };
+            if (!std::equal(expected_pixel.begin(), expected_pixel.end(), image_data_ptr + (y * image_size + x) * 4U))
+                mismatched_pixels_count++;
+        }
+    CHECK(mismatched_pixels_count == 0U);
+}
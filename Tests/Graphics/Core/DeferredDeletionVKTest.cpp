@@ -0,0 +1,82 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/DeferredDeletionVKTest.cpp
+GPU tests of deferred deletion of native Vulkan objects of resources churned every frame
+on the headless render context within deletion budget
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/ContextBase.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t   g_churned_frames_count      = 16U;
+static constexpr uint32_t   g_buffers_per_frame_count   = 8U;
+static constexpr uint32_t   g_max_deleted_objects_count = 16U;
+static constexpr Data::Size g_buffer_size               = 256U;
+
+// Test is hidden by default, because it requires GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter.
+// Native objects of Vulkan resources are deleted with deferred deletion queue of the context in epochs advanced by presented frames.
+TEST_CASE("Vulkan resources churned every frame are deleted within deferred deletion budget", "[.][gpu][vulkan][deferred-deletion]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context          = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::DeferredDeletionQueue& deletion_queue = dynamic_cast<ContextBase&>(context).GetDeferredDeletionQueue();
+    context.SetDeferredDeletionBudget({ g_max_deleted_objects_count, 0.0 });
+
+    const std::array<Data::Byte, g_buffer_size> buffer_data{ };
+    const size_t initial_deleted_objects_count = deletion_queue.GetStatistics().total_deleted_objects_count;
+    for(uint32_t frame_index = 0U; frame_index < g_churned_frames_count; ++frame_index)
+    {
+        // Buffers are uploaded and released in the same frame, so their native objects are pushed to the queue in the current epoch
+        for(uint32_t buffer_index = 0U; buffer_index < g_buffers_per_frame_count; ++buffer_index)
+        {
+            const Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_buffer_size, sizeof(uint32_t));
+            buffer_ptr->SetName(fmt::format("Churned Buffer {} of Frame {}", buffer_index, frame_index));
+            buffer_ptr->SetData({ { buffer_data.data(), g_buffer_size } }, render_cmd_queue);
+        }
+
+        fixture.RenderFrame();
+
+        // Native objects released in the presented frame epoch are still pending, while deletion of completed epochs is limited by budget
+        const Data::DeferredDeletionQueue::Statistics statistics = deletion_queue.GetStatistics();
+        CHECK(statistics.deleted_objects_count <= g_max_deleted_objects_count);
+        CHECK(statistics.pending_objects_count > 0U);
+    }
+
+    // Backlog of pending objects is drained within budget after GPU completes all frames
+    for(uint32_t wait_index = 0U; deletion_queue.GetPendingObjectsCount() && wait_index < g_churned_frames_count * g_buffers_per_frame_count; ++wait_index)
+    {
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+        CHECK(deletion_queue.GetStatistics().deleted_objects_count <= g_max_deleted_objects_count);
+    }
+    CHECK(deletion_queue.GetPendingObjectsCount() == 0U);
+
+    // Every buffer has at least native buffer and device memory objects deleted
+    const size_t deleted_objects_count = deletion_queue.GetStatistics().total_deleted_objects_count - initial_deleted_objects_count;
+    CHECK(deleted_objects_count >= 2U * g_churned_frames_count * g_buffers_per_frame_count);
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/DeviceMemoryTest.cpp
+Unit tests of the device memory statistics and GPU tests of memory allocations tracking on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/Device.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_buffer_size = 64U * 1024U;
+static const     Dimensions g_texture_dimensions(64U, 64U);
+
+TEST_CASE("Device memory type statistics", "[device][memory]")
+{
+    Device::MemoryTypeStatistics memory_type_statistics;
+
+    SECTION("Allocations are accumulated")
+    {
+        memory_type_statistics.AddAllocation(1024U);
+        memory_type_statistics.AddAllocation(2048U);
+        CHECK(memory_type_statistics.allocated_size == 3072U);
+        CHECK(memory_type_statistics.max_allocated_size == 3072U);
+        CHECK(memory_type_statistics.allocations_count == 2U);
+        CHECK(memory_type_statistics.total_allocations_count == 2U);
+    }
+
+    SECTION("High-water mark is kept after releasing allocations")
+    {
+        memory_type_statistics.AddAllocation(1024U);
+        memory_type_statistics.AddAllocation(2048U);
+        memory_type_statistics.RemoveAllocation(2048U);
+        memory_type_statistics.AddAllocation(512U);
+        CHECK(memory_type_statistics.allocated_size == 1536U);
+        CHECK(memory_type_statistics.max_allocated_size == 3072U);
+        CHECK(memory_type_statistics.allocations_count == 2U);
+        CHECK(memory_type_statistics.total_allocations_count == 3U);
+    }
+}
+
+TEST_CASE("Device memory statistics", "[device][memory]")
+{
+    Device::MemoryStatistics memory_statistics;
+    memory_statistics.heaps = {
+        { true,  4096U, 2048U, 1024U },
+        { false, 8192U, 8192U, 512U  },
+        { true,  1024U, 512U,  1024U },
+    };
+
+    SECTION("Device local budget and usage are summed over device local heaps")
+    {
+        memory_statistics.is_budget_supported = true;
+        CHECK(memory_statistics.GetDeviceLocalBudget() == 2560U);
+        CHECK(memory_statistics.GetDeviceLocalUsage() == 2048U);
+    }
+
+    SECTION("Device local usage is equal to allocated size when budget is not supported")
+    {
+        memory_statistics.is_budget_supported = false;
+        memory_statistics.total.AddAllocation(128U);
+        CHECK(memory_statistics.GetDeviceLocalUsage() == 128U);
+    }
+
+    SECTION("Heap budget is exceeded when usage is greater than budget")
+    {
+        CHECK_FALSE(memory_statistics.heaps[0].IsBudgetExceeded());
+        CHECK_FALSE(memory_statistics.heaps[1].IsBudgetExceeded());
+        CHECK(memory_statistics.heaps[2].IsBudgetExceeded());
+    }
+
+    SECTION("Memory type statistics are returned by type")
+    {
+        memory_statistics.types[static_cast<size_t>(Device::MemoryType::Staging)].AddAllocation(256U);
+        CHECK(memory_statistics.GetTypeStatistics(Device::MemoryType::Staging).allocated_size == 256U);
+        CHECK(memory_statistics.GetTypeStatistics(Device::MemoryType::Buffer).allocated_size == 0U);
+    }
+}
+
+// Test is hidden by default, because it requires GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Software GPU device memory statistics", "[.][gpu][device][memory]")
+{
+    const Device::Capabilities device_caps = Device::Capabilities().SetFeatures(Device::Features::BasicRendering).SetPresentToWindow(false);
+    System::Get().UpdateGpuDevices(device_caps);
+
+    const Ptr<Device> device_ptr = System::Get().GetSoftwareGpuDevice();
+    REQUIRE(device_ptr);
+
+    const Device::MemoryStatistics memory_statistics = device_ptr->GetMemoryStatistics();
+    INFO(static_cast<std::string>(memory_statistics));
+    REQUIRE_FALSE(memory_statistics.heaps.empty());
+
+    for(const Device::MemoryHeapStatistics& memory_heap : memory_statistics.heaps)
+    {
+        CHECK(memory_heap.size > 0U);
+        CHECK(memory_heap.budget > 0U);
+        if (memory_statistics.is_budget_supported)
+            CHECK(memory_heap.budget <= memory_heap.size);
+    }
+
+    CHECK(memory_statistics.total.allocations_count == 0U);
+}
+
+TEST_CASE("Device memory statistics track resource allocations", "[.][gpu][device][memory]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    const Device&  device  = fixture.GetDevice();
+    const Device::MemoryStatistics initial_statistics = device.GetMemoryStatistics();
+    const Device::MemoryTypeStatistics& initial_buffer_statistics  = initial_statistics.GetTypeStatistics(Device::MemoryType::Buffer);
+    const Device::MemoryTypeStatistics& initial_texture_statistics = initial_statistics.GetTypeStatistics(Device::MemoryType::Texture);
+
+    {
+        const Ptr<Buffer>  buffer_ptr  = Buffer::CreateVertexBuffer(context, g_buffer_size, sizeof(float) * 4U);
+        const Ptr<Texture> texture_ptr = Texture::CreateImage(context, g_texture_dimensions, std::nullopt, PixelFormat::RGBA8Unorm, false);
+
+        const Device::MemoryStatistics allocated_statistics = device.GetMemoryStatistics();
+        INFO(static_cast<std::string>(allocated_statistics));
+        const Device::MemoryTypeStatistics& buffer_statistics  = allocated_statistics.GetTypeStatistics(Device::MemoryType::Buffer);
+        const Device::MemoryTypeStatistics& texture_statistics = allocated_statistics.GetTypeStatistics(Device::MemoryType::Texture);
+        CHECK(buffer_statistics.allocations_count == initial_buffer_statistics.allocations_count + 1U);
+        CHECK(buffer_statistics.total_allocations_count == initial_buffer_statistics.total_allocations_count + 1U);
+        CHECK(buffer_statistics.allocated_size >= initial_buffer_statistics.allocated_size + g_buffer_size);
+        CHECK(texture_statistics.allocations_count == initial_texture_statistics.allocations_count + 1U);
+        CHECK(texture_statistics.total_allocations_count == initial_texture_statistics.total_allocations_count + 1U);
+        CHECK(texture_statistics.allocated_size >= initial_texture_statistics.allocated_size + g_texture_dimensions.GetPixelsCount() * 4U);
+        CHECK(allocated_statistics.total.allocations_count >= initial_statistics.total.allocations_count + 2U);
+        CHECK(allocated_statistics.total.max_allocated_size >= allocated_statistics.total.allocated_size);
+    }
+
+    // Resources are not used by command lists, so their memory is released right away with their destruction,
+    // while high-water mark and total allocations count are kept
+    const Device::MemoryStatistics released_statistics = device.GetMemoryStatistics();
+    INFO(static_cast<std::string>(released_statistics));
+    CHECK(released_statistics.GetTypeStatistics(Device::MemoryType::Buffer).allocations_count == initial_buffer_statistics.allocations_count);
+    CHECK(released_statistics.GetTypeStatistics(Device::MemoryType::Buffer).allocated_size == initial_buffer_statistics.allocated_size);
+    CHECK(released_statistics.GetTypeStatistics(Device::MemoryType::Texture).allocations_count == initial_texture_statistics.allocations_count);
+    CHECK(released_statistics.GetTypeStatistics(Device::MemoryType::Texture).allocated_size == initial_texture_statistics.allocated_size);
+    CHECK(released_statistics.total.allocated_size == initial_statistics.total.allocated_size);
+    CHECK(released_statistics.total.total_allocations_count >= initial_statistics.total.total_allocations_count + 2U);
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/DynamicRenderingVKTest.cpp
+GPU tests comparing frames rendered with Vulkan render pass objects and with dynamic rendering
+by direct draws, command bundles and parallel render command lists on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/Vulkan/RenderContextVK.h>
+#include <Methane/Graphics/Vulkan/RenderPassVK.h>
+#include <Methane/Graphics/ParallelRenderCommandList.h>
+#include <Methane/Graphics/ParallelRenderScheduler.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <magic_enum.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+enum class DrawEncoding
+{
+    Direct,
+    Bundle,
+    Parallel
+};
+
+static const FrameSize      g_resized_frame_size(96U, 48U);
+static constexpr uint32_t   g_grid_size = 4U;
+static constexpr Data::Size g_grid_triangles_count = g_grid_size * g_grid_size;
+static constexpr uint32_t   g_parallel_command_lists_count = 4U;
+
+// Whole grid of triangles is drawn with vertex ranges in rows and instances in columns
+static void EncodeGridDraw(HeadlessRenderFixture& fixture, RenderCommandList& render_cmd_list)
+{
+    render_cmd_list.SetViewState(fixture.GetViewState());
+    render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, g_grid_size * 3U, 0U, g_grid_size);
+}
+
+// Renders frames with grid triangles encoded in the given way, before and after resize, and reads back the frame buffers data
+static std::vector<Data::Bytes> RenderAndReadBackFrames(Context::Options context_options, bool is_dynamic_rendering_expected, DrawEncoding draw_encoding)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& render_context = fixture.GetRenderContext();
+    const auto& render_context_vk = dynamic_cast<const RenderContextVK&>(render_context);
+    const auto& render_pattern_vk = dynamic_cast<const RenderPatternVK&>(fixture.GetRenderPattern());
+    CHECK(render_context_vk.IsDynamicRenderingEnabled() == is_dynamic_rendering_expected);
+    CHECK(render_pattern_vk.IsDynamicRendering() == is_dynamic_rendering_expected);
+
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    render_context.CompleteInitialization();
+    const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
+
+    // Bundle inherits render pass or dynamic rendering info of the render pattern, so it is executed in render passes of all frames,
+    // but it is encoded again after resize, because viewport and scissor rects are recorded in the bundle
+    const Ptr<RenderCommandList> bundle_ptr = RenderCommandList::CreateBundle(fixture.GetRenderCommandQueue(), *fixture.GetFrame(0U).screen_pass_ptr);
+    bundle_ptr->SetName("Grid Triangles Bundle");
+    const auto encode_bundle = [&fixture, &render_state_ptr, &bundle_ptr, draw_encoding]()
+    {
+        if (draw_encoding != DrawEncoding::Bundle)
+            return;
+
+        bundle_ptr->ResetWithState(*render_state_ptr);
+        EncodeGridDraw(fixture, *bundle_ptr);
+        bundle_ptr->Commit();
+    };
+
+    // Parallel render command lists are executed in secondary command buffers of the frame render passes
+    Ptrs<ParallelRenderCommandList> parallel_cmd_lists;
+    Ptrs<CommandListSet>            parallel_cmd_list_sets;
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        const Ptr<ParallelRenderCommandList>& parallel_cmd_list_ptr = parallel_cmd_lists.emplace_back(
+            ParallelRenderCommandList::Create(fixture.GetRenderCommandQueue(), *fixture.GetFrame(frame_index).screen_pass_ptr));
+        parallel_cmd_list_ptr->SetName(fmt::format("Grid Triangles Parallel Render {}", frame_index));
+        parallel_cmd_list_sets.emplace_back(CommandListSet::Create({ *parallel_cmd_list_ptr }, frame_index));
+    }
+
+    ParallelRenderScheduler::Settings scheduler_settings;
+    scheduler_settings.max_command_lists_count = g_parallel_command_lists_count;
+    scheduler_settings.auto_tuning_enabled     = false;
+    ParallelRenderScheduler scheduler(scheduler_settings, g_parallel_command_lists_count);
+    scheduler.SetItemsCount(g_grid_triangles_count);
+
+    const auto render_frame = [&]() -> uint32_t
+    {
+        switch(draw_encoding)
+        {
+        case DrawEncoding::Direct:
+            return fixture.RenderFrame([&](RenderCommandList& render_cmd_list)
+            {
+                render_cmd_list.SetRenderState(*render_state_ptr);
+                EncodeGridDraw(fixture, render_cmd_list);
+            });
+
+        case DrawEncoding::Bundle:
+            return fixture.RenderFrame([&bundle_ptr](RenderCommandList& render_cmd_list)
+            {
+                render_cmd_list.ExecuteBundle(*bundle_ptr);
+            });
+
+        case DrawEncoding::Parallel:
+        {
+            // Each grid triangle is drawn separately, so that triangles are distributed between parallel command lists
+            const uint32_t frame_buffer_index = render_context.GetFrameBufferIndex();
+            ParallelRenderCommandList& parallel_cmd_list = *parallel_cmd_lists[frame_buffer_index];
+            parallel_cmd_list.ResetWithState(*render_state_ptr);
+            parallel_cmd_list.SetViewState(fixture.GetViewState());
+            scheduler.Encode(parallel_cmd_list, render_context.GetParallelExecutor(),
+                [](RenderCommandList& render_cmd_list, const ParallelRenderScheduler::ItemsRange& items_range)
+                {
+                    for(Data::Index triangle_index = items_range.GetStart(); triangle_index < items_range.GetEnd(); ++triangle_index)
+                    {
+                        render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, 3U, (triangle_index % g_grid_size) * 3U,
+                                             1U, triangle_index / g_grid_size);
+                    }
+                });
+            parallel_cmd_list.Commit();
+            fixture.GetRenderCommandQueue().Execute(*parallel_cmd_list_sets[frame_buffer_index]);
+            render_context.Present();
+            return frame_buffer_index;
+        }
+
+        default:
+            META_UNEXPECTED_ARG_RETURN(draw_encoding, 0U);
+        }
+    };
+
+    std::vector<Data::Bytes> frames_data;
+    const auto read_back_frame = [&fixture, &frames_data](uint32_t frame_buffer_index)
+    {
+        const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+        frames_data.emplace_back(frame_data.GetDataPtr(), frame_data.GetDataEndPtr());
+    };
+
+    encode_bundle();
+    read_back_frame(render_frame());
+
+    // Resize recreates frame buffers, which are bound to render passes differently with and without dynamic rendering
+    fixture.Resize(g_resized_frame_size);
+    encode_bundle();
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        read_back_frame(render_frame());
+    }
+    return frames_data;
+}
+
+TEST_CASE("Vulkan dynamic rendering produces the same frames as render pass objects", "[.][gpu][render-pass]")
+{
+    // Reference frames are rendered with direct draws in render pass objects
+    const std::vector<Data::Bytes> reference_frames_data = RenderAndReadBackFrames(Context::Options::None, false, DrawEncoding::Direct);
+    REQUIRE(reference_frames_data.size() == HeadlessRenderFixture::GetDefaultContextSettings().frame_buffers_count + 1U);
+    CHECK(reference_frames_data.front().size() == HeadlessRenderFixture::GetDefaultContextSettings().frame_size.GetPixelsCount() * 4U);
+    CHECK(reference_frames_data.back().size() == g_resized_frame_size.GetPixelsCount() * 4U);
+    for(const Data::Bytes& frame_data : reference_frames_data)
+    {
+        CHECK(HeadlessRenderFixture::CountPixelsNotEqual(SubResource(frame_data.data(), static_cast<Data::Size>(frame_data.size())),
+                                                         HeadlessRenderFixture::Pixel{ 0U, 255U, 0U, 255U }) > 0U);
+    }
+
+    const bool         is_dynamic_rendering = GENERATE(false, true);
+    const DrawEncoding draw_encoding        = GENERATE(DrawEncoding::Direct, DrawEncoding::Bundle, DrawEncoding::Parallel);
+    INFO("Dynamic rendering: " << is_dynamic_rendering << ", draw encoding: " << magic_enum::enum_name(draw_encoding));
+
+    const std::vector<Data::Bytes> frames_data = RenderAndReadBackFrames(is_dynamic_rendering ? Context::Options::DynamicRenderingOnVulkan
+                                                                                              : Context::Options::None,
+                                                                         is_dynamic_rendering, draw_encoding);
+    REQUIRE(frames_data.size() == reference_frames_data.size());
+    for(size_t frame_index = 0U; frame_index < frames_data.size(); ++frame_index)
+    {
+        CHECK(frames_data[frame_index] == reference_frames_data[frame_index]);
+    }
+}
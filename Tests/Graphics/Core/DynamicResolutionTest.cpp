@@ -0,0 +1,133 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/DynamicResolutionTest.cpp
+GPU tests of dynamic resolution render targets pool reuse, retirement of evicted targets
+and upscaling of the scaled frame to the screen on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/DynamicResolution.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tuple>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static const HeadlessRenderFixture::Pixel g_scaled_clear_pixel{ 0U, 0U, 255U, 255U }; // red color in BGRA format
+
+// Controller changes render scale by exactly one step per update: GPU time twice as long as the target decreases the scale,
+// zero GPU time increases it, while GPU time equal to the target keeps the scale unchanged
+static DynamicResolution::Settings GetSteppedDynamicResolutionSettings()
+{
+    DynamicResolution::Settings settings;
+    settings.name                                 = "Test Dynamic Resolution";
+    settings.clear_color                          = Color4F(1.F, 0.F, 0.F, 1.F);
+    settings.max_pooled_targets_count             = 2U;
+    settings.controller.target_gpu_frame_time_sec = 1.0;
+    settings.controller.min_scale                 = 0.5F;
+    settings.controller.max_scale                 = 1.F;
+    settings.controller.scale_step                = 0.25F;
+    settings.controller.proportional_gain         = 0.0;
+    settings.controller.integral_gain             = 0.25;
+    settings.controller.derivative_gain           = 0.0;
+    return settings;
+}
+
+// Renders scaled frame clearing the current dynamic resolution target and upscales it to the screen frame buffer,
+// returns index of the rendered frame buffer
+static uint32_t RenderScaledFrame(HeadlessRenderFixture& fixture, DynamicResolution& dynamic_resolution)
+{
+    RenderCommandList& scaled_cmd_list = dynamic_resolution.GetRenderCommandList();
+    scaled_cmd_list.Reset();
+    scaled_cmd_list.Commit();
+    const Ptr<CommandListSet> scaled_cmd_list_set_ptr = CommandListSet::Create({ scaled_cmd_list }, fixture.GetRenderContext().GetFrameBufferIndex());
+    fixture.GetRenderCommandQueue().Execute(*scaled_cmd_list_set_ptr);
+
+    return fixture.RenderFrame([&dynamic_resolution](RenderCommandList& screen_cmd_list)
+    {
+        dynamic_resolution.Upscale(screen_cmd_list);
+    });
+}
+
+// Test is hidden by default, because it requires GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Dynamic resolution reuses, retires and upscales scaled render targets", "[.][gpu][dynamic-resolution]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    DynamicResolution dynamic_resolution(fixture.GetRenderCommandQueue(), fixture.GetRenderPattern(), GetSteppedDynamicResolutionSettings());
+
+    const auto check_upscaled_frame = [&fixture, &dynamic_resolution](const FrameSize& expected_render_size)
+    {
+        CHECK(dynamic_resolution.GetRenderSize() == expected_render_size);
+        const uint32_t frame_buffer_index = RenderScaledFrame(fixture, dynamic_resolution);
+        const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+        CHECK(HeadlessRenderFixture::CountPixelsNotEqual(frame_data, g_scaled_clear_pixel) == 0U);
+    };
+
+    // Full resolution target is created on construction
+    CHECK(dynamic_resolution.GetScale() == 1.F);
+    CHECK(dynamic_resolution.GetPooledTargetsCount() == 1U);
+    const Texture* full_target_ptr = &dynamic_resolution.GetRenderTarget();
+    check_upscaled_frame(FrameSize(64U, 64U));
+
+    // Scaled down target is added to the pool
+    CHECK(dynamic_resolution.Update(2.0));
+    CHECK(dynamic_resolution.GetScale() == 0.75F);
+    CHECK(dynamic_resolution.GetPooledTargetsCount() == 2U);
+    CHECK(dynamic_resolution.GetRetiredTargetsCount() == 0U);
+    const Texture* three_quarter_target_ptr = &dynamic_resolution.GetRenderTarget();
+    CHECK(three_quarter_target_ptr != full_target_ptr);
+    check_upscaled_frame(FrameSize(48U, 48U));
+
+    // Least recently used full resolution target is evicted from the full pool and retired while GPU may still render its frame
+    CHECK(dynamic_resolution.Update(2.0));
+    CHECK(dynamic_resolution.GetScale() == 0.5F);
+    CHECK(dynamic_resolution.GetPooledTargetsCount() == 2U);
+    CHECK(dynamic_resolution.GetRetiredTargetsCount() == 1U);
+    check_upscaled_frame(FrameSize(32U, 32U));
+
+    // Pooled target is reused when scale is increased back
+    CHECK(dynamic_resolution.Update(0.0));
+    CHECK(dynamic_resolution.GetScale() == 0.75F);
+    CHECK(&dynamic_resolution.GetRenderTarget() == three_quarter_target_ptr);
+    CHECK(dynamic_resolution.GetRetiredTargetsCount() == 1U);
+    check_upscaled_frame(FrameSize(48U, 48U));
+
+    // Retired target is returned to the pool instead of creating the new one, while the evicted half resolution target is retired
+    CHECK(dynamic_resolution.Update(0.0));
+    CHECK(dynamic_resolution.GetScale() == 1.F);
+    CHECK(&dynamic_resolution.GetRenderTarget() == full_target_ptr);
+    CHECK(dynamic_resolution.GetPooledTargetsCount() == 2U);
+    CHECK(dynamic_resolution.GetRetiredTargetsCount() == 1U);
+    check_upscaled_frame(FrameSize(64U, 64U));
+
+    // Retired target is released when GPU completes all frames in flight which could use it
+    for(uint32_t frame_index = 0U; frame_index <= context.GetMaxFramesInFlight(); ++frame_index)
+    {
+        CHECK_FALSE(dynamic_resolution.Update(1.0));
+        std::ignore = RenderScaledFrame(fixture, dynamic_resolution);
+    }
+    CHECK_FALSE(dynamic_resolution.Update(1.0));
+    CHECK(dynamic_resolution.GetRetiredTargetsCount() == 0U);
+    CHECK(dynamic_resolution.GetPooledTargetsCount() == 2U);
+}
@@ -0,0 +1,224 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/FrameGraphTest.cpp
+Frame graph compilation unit tests checking passes schedule, barriers count and transient memory aliasing
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameGraph.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <magic_enum.hpp>
+
+#include <tuple>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace magic_enum::bitwise_operators;
+
+using State = ResourceState;
+
+static const Texture::Settings g_shadow_map_settings = Texture::Settings::DepthStencilBuffer(Dimensions(1024U, 1024U), PixelFormat::Depth32Float,
+                                                                                             Texture::Usage::RenderTarget | Texture::Usage::ShaderRead);
+static const Texture::Settings g_color_settings = Texture::Settings::Image(Dimensions(640U, 480U), std::nullopt, PixelFormat::RGBA8Unorm, false,
+                                                                           Texture::Usage::RenderTarget | Texture::Usage::ShaderRead);
+
+static std::vector<FrameGraph::PassId> GetScheduledPassIds(const FrameGraph::Schedule& schedule)
+{
+    std::vector<FrameGraph::PassId> pass_ids;
+    for(const FrameGraph::ScheduledPass& pass : schedule.passes)
+    {
+        pass_ids.push_back(pass.pass_id);
+    }
+    return pass_ids;
+}
+
+TEST_CASE("Frame graph of shadow cube tutorial passes", "[frame-graph]")
+{
+    FrameGraph frame_graph;
+    const FrameGraph::ResourceId shadow_map_id = frame_graph.CreateTransientTexture("Shadow Map", g_shadow_map_settings);
+
+    SECTION("Shadow and final passes are scheduled with minimal barriers")
+    {
+        const FrameGraph::ResourceId screen_id      = frame_graph.ImportResource("Screen", State::Present);
+        const FrameGraph::PassId     shadow_pass_id = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, State::DepthWrite } } });
+        const FrameGraph::PassId     final_pass_id  = frame_graph.AddPass({ "Final Pass", { { shadow_map_id, State::ShaderResource } }, { { screen_id, State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(GetScheduledPassIds(schedule) == std::vector<FrameGraph::PassId>{ shadow_pass_id, final_pass_id });
+        CHECK(schedule.passes[0].barriers == FrameGraph::Barriers{ { shadow_map_id, State::Undefined, State::DepthWrite } });
+        CHECK(schedule.passes[1].barriers == FrameGraph::Barriers{
+            { shadow_map_id, State::DepthWrite, State::ShaderResource },
+            { screen_id,     State::Present,    State::RenderTarget }
+        });
+        CHECK(schedule.final_barriers.empty());
+        CHECK(schedule.GetBarriersCount() == 3U);
+    }
+
+    SECTION("Final state of imported resource adds final barrier")
+    {
+        const FrameGraph::ResourceId screen_id = frame_graph.ImportResource("Screen", State::Present, State::Present);
+        std::ignore = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, State::DepthWrite } } });
+        std::ignore = frame_graph.AddPass({ "Final Pass", { { shadow_map_id, State::ShaderResource } }, { { screen_id, State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(schedule.final_barriers == FrameGraph::Barriers{ { screen_id, State::RenderTarget, State::Present } });
+        CHECK(schedule.GetBarriersCount() == 4U);
+    }
+
+    SECTION("Shadow pass is culled when its output is not used")
+    {
+        const FrameGraph::ResourceId screen_id      = frame_graph.ImportResource("Screen", State::Present);
+        std::ignore = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, State::DepthWrite } } });
+        const FrameGraph::PassId     final_pass_id  = frame_graph.AddPass({ "Final Pass", { }, { { screen_id, State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(GetScheduledPassIds(schedule) == std::vector<FrameGraph::PassId>{ final_pass_id });
+        CHECK(schedule.memory_slots.empty());
+        CHECK(schedule.GetBarriersCount() == 1U);
+    }
+}
+
+TEST_CASE("Frame graph barriers", "[frame-graph]")
+{
+    FrameGraph frame_graph;
+    const FrameGraph::ResourceId texture_id = frame_graph.ImportResource("Texture", State::ShaderResource);
+    std::vector<FrameGraph::ResourceId> output_ids;
+    for(uint32_t output_index = 0U; output_index < 3U; ++output_index)
+    {
+        output_ids.push_back(frame_graph.ImportResource("Output", State::RenderTarget));
+    }
+
+    SECTION("Reads in the same state require no barriers")
+    {
+        for(const FrameGraph::ResourceId output_id : output_ids)
+        {
+            std::ignore = frame_graph.AddPass({ "Read Pass", { { texture_id, State::ShaderResource } }, { { output_id, State::RenderTarget } } });
+        }
+        CHECK(frame_graph.Compile().GetBarriersCount() == 0U);
+    }
+
+    SECTION("Independent passes reading in the same state are grouped together")
+    {
+        const FrameGraph::PassId first_pass_id  = frame_graph.AddPass({ "Shader Read 1", { { texture_id, State::ShaderResource } }, { { output_ids[0], State::RenderTarget } } });
+        const FrameGraph::PassId copy_pass_id   = frame_graph.AddPass({ "Copy Read",     { { texture_id, State::CopySource } },     { { output_ids[1], State::RenderTarget } } });
+        const FrameGraph::PassId second_pass_id = frame_graph.AddPass({ "Shader Read 2", { { texture_id, State::ShaderResource } }, { { output_ids[2], State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(GetScheduledPassIds(schedule) == std::vector<FrameGraph::PassId>{ first_pass_id, second_pass_id, copy_pass_id });
+        CHECK(schedule.GetBarriersCount() == 1U);
+    }
+
+    SECTION("Dependent passes keep declaration order")
+    {
+        const FrameGraph::PassId write_pass_id = frame_graph.AddPass({ "Write", { }, { { texture_id, State::RenderTarget } } });
+        const FrameGraph::PassId read_pass_id  = frame_graph.AddPass({ "Read", { { texture_id, State::ShaderResource } }, { { output_ids[0], State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(GetScheduledPassIds(schedule) == std::vector<FrameGraph::PassId>{ write_pass_id, read_pass_id });
+        CHECK(schedule.GetBarriersCount() == 2U);
+    }
+
+    SECTION("Consecutive unordered access writes are synchronized")
+    {
+        const FrameGraph::ResourceId buffer_id = frame_graph.ImportResource("Buffer", State::UnorderedAccess);
+        std::ignore = frame_graph.AddPass({ "Compute 1", { }, { { buffer_id, State::UnorderedAccess } } });
+        std::ignore = frame_graph.AddPass({ "Compute 2", { { buffer_id, State::UnorderedAccess } }, { { buffer_id, State::UnorderedAccess } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        REQUIRE(schedule.passes.size() == 2U);
+        CHECK(schedule.passes[0].barriers.empty());
+        REQUIRE(schedule.passes[1].barriers.size() == 1U);
+        CHECK(schedule.passes[1].barriers[0].IsUnorderedAccessBarrier());
+    }
+}
+
+TEST_CASE("Frame graph transient memory aliasing", "[frame-graph]")
+{
+    FrameGraph frame_graph;
+    const FrameGraph::ResourceId screen_id = frame_graph.ImportResource("Screen", State::Present);
+    const uint32_t color_memory_size = 640U * 480U * 4U;
+
+    SECTION("Transient textures with non-overlapping lifetimes share memory")
+    {
+        const FrameGraph::ResourceId first_id  = frame_graph.CreateTransientTexture("Color 1", g_color_settings);
+        const FrameGraph::ResourceId second_id = frame_graph.CreateTransientTexture("Color 2", g_color_settings);
+        const FrameGraph::ResourceId third_id  = frame_graph.CreateTransientTexture("Color 3", g_color_settings);
+        std::ignore = frame_graph.AddPass({ "Pass 1", { }, { { first_id, State::RenderTarget } } });
+        std::ignore = frame_graph.AddPass({ "Pass 2", { { first_id,  State::ShaderResource } }, { { second_id, State::RenderTarget } } });
+        std::ignore = frame_graph.AddPass({ "Pass 3", { { second_id, State::ShaderResource } }, { { third_id,  State::RenderTarget } } });
+        std::ignore = frame_graph.AddPass({ "Pass 4", { { third_id,  State::ShaderResource } }, { { screen_id, State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        REQUIRE(schedule.memory_slots.size() == 2U);
+        CHECK(schedule.transient_allocations[first_id]->memory_slot_index == schedule.transient_allocations[third_id]->memory_slot_index);
+        CHECK(schedule.transient_allocations[first_id]->memory_slot_index != schedule.transient_allocations[second_id]->memory_slot_index);
+        CHECK(schedule.GetTransientMemorySizeWithoutAliasing() == 3U * color_memory_size);
+        CHECK(schedule.GetTransientMemorySize() == 2U * color_memory_size);
+    }
+
+    SECTION("Transient textures with different settings are not aliased")
+    {
+        const FrameGraph::ResourceId shadow_map_id = frame_graph.CreateTransientTexture("Shadow Map", g_shadow_map_settings);
+        const FrameGraph::ResourceId color_id      = frame_graph.CreateTransientTexture("Color", g_color_settings);
+        std::ignore = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, State::DepthWrite } } });
+        std::ignore = frame_graph.AddPass({ "Color Pass", { { shadow_map_id, State::ShaderResource } }, { { color_id, State::RenderTarget } } });
+        std::ignore = frame_graph.AddPass({ "Final Pass", { { color_id, State::ShaderResource } }, { { screen_id, State::RenderTarget } } });
+
+        const FrameGraph::Schedule& schedule = frame_graph.Compile();
+        CHECK(schedule.memory_slots.size() == 2U);
+        CHECK(schedule.GetTransientMemorySize() == 1024U * 1024U * 4U + color_memory_size);
+        CHECK(schedule.GetTransientMemorySize() == schedule.GetTransientMemorySizeWithoutAliasing());
+    }
+}
+
+TEST_CASE("Frame graph compiled schedule reuse", "[frame-graph]")
+{
+    FrameGraph frame_graph;
+    const auto declare_topology = [&frame_graph]()
+    {
+        const FrameGraph::ResourceId shadow_map_id = frame_graph.CreateTransientTexture("Shadow Map", g_shadow_map_settings);
+        const FrameGraph::ResourceId screen_id     = frame_graph.ImportResource("Screen", State::Present);
+        std::ignore = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, State::DepthWrite } } });
+        std::ignore = frame_graph.AddPass({ "Final Pass", { { shadow_map_id, State::ShaderResource } }, { { screen_id, State::RenderTarget } } });
+    };
+
+    declare_topology();
+    std::ignore = frame_graph.Compile();
+    REQUIRE(frame_graph.GetCompilationsCount() == 1U);
+
+    SECTION("Same topology declared again is not recompiled")
+    {
+        frame_graph.Clear();
+        declare_topology();
+        CHECK(frame_graph.IsCompiled());
+        std::ignore = frame_graph.Compile();
+        CHECK(frame_graph.GetCompilationsCount() == 1U);
+    }
+
+    SECTION("Changed topology is recompiled")
+    {
+        const FrameGraph::ResourceId overlay_id = frame_graph.ImportResource("Overlay", State::ShaderResource);
+        std::ignore = frame_graph.AddPass({ "Overlay Pass", { { overlay_id, State::ShaderResource } }, { { 1U, State::RenderTarget } } });
+        CHECK_FALSE(frame_graph.IsCompiled());
+        CHECK(frame_graph.Compile().passes.size() == 3U);
+        CHECK(frame_graph.GetCompilationsCount() == 2U);
+    }
+}
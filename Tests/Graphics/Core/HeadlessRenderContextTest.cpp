@@ -0,0 +1,164 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/HeadlessRenderContextTest.cpp
+GPU tests of the headless render context rendering frames without window and reading them back
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/RenderContextBase.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+// Clear color of the default fixture settings in BGRA8 pixel format
+static const HeadlessRenderFixture::Pixel g_clear_pixel{ 0U, 255U, 0U, 255U };
+
+// Tests are hidden by default, because they require GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Headless render context renders and reads back frames", "[.][gpu][render-context]")
+{
+    HeadlessRenderFixture fixture;
+    const RenderContext::Settings& context_settings = fixture.GetRenderContext().GetSettings();
+    const Data::Size frame_data_size = context_settings.frame_size.GetPixelsCount() * static_cast<Data::Size>(g_clear_pixel.size());
+
+    SECTION("Frame buffers are used in ring order")
+    {
+        for(uint32_t frame_index = 0U; frame_index < context_settings.frame_buffers_count * 2U; ++frame_index)
+        {
+            CHECK(fixture.RenderFrame() == frame_index % context_settings.frame_buffers_count);
+        }
+    }
+
+    SECTION("Presented frame buffer is read back with clear color")
+    {
+        const uint32_t frame_buffer_index = fixture.RenderFrame();
+        const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+        REQUIRE(frame_data.GetDataSize() == frame_data_size);
+        CHECK(HeadlessRenderFixture::CountPixelsNotEqual(frame_data, g_clear_pixel) == 0U);
+    }
+
+    SECTION("All frame buffers are read back after rendering frames in flight")
+    {
+        for(uint32_t frame_index = 0U; frame_index < context_settings.frame_buffers_count; ++frame_index)
+        {
+            fixture.RenderFrame();
+        }
+        for(uint32_t frame_buffer_index = 0U; frame_buffer_index < context_settings.frame_buffers_count; ++frame_buffer_index)
+        {
+            const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+            REQUIRE(frame_data.GetDataSize() == frame_data_size);
+            CHECK(HeadlessRenderFixture::CountPixelsNotEqual(frame_data, g_clear_pixel) == 0U);
+        }
+    }
+}
+
+TEST_CASE("Headless render context with batched submits reads back frames without present", "[.][gpu][render-context]")
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(Context::Options::BatchedSubmitOnVulkan));
+    const RenderContext::Settings& context_settings = fixture.GetRenderContext().GetSettings();
+    const Data::Size frame_data_size = context_settings.frame_size.GetPixelsCount() * static_cast<Data::Size>(g_clear_pixel.size());
+
+    SECTION("Read-back is not blocked by submit batch waiting for present")
+    {
+        const uint32_t frame_buffer_index = fixture.GetRenderContext().GetFrameBufferIndex();
+        HeadlessRenderFixture::Frame& frame = fixture.GetFrame(frame_buffer_index);
+        frame.render_cmd_list_ptr->Reset();
+        frame.render_cmd_list_ptr->Commit();
+        fixture.GetRenderCommandQueue().Execute(*frame.execute_cmd_list_set_ptr);
+
+        const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+        REQUIRE(frame_data.GetDataSize() == frame_data_size);
+        CHECK(HeadlessRenderFixture::CountPixelsNotEqual(frame_data, g_clear_pixel) == 0U);
+    }
+
+    SECTION("Command list completion wait is not blocked by submit batch")
+    {
+        HeadlessRenderFixture::Frame& frame = fixture.GetCurrentFrame();
+        frame.render_cmd_list_ptr->Reset();
+        frame.render_cmd_list_ptr->Commit();
+        fixture.GetRenderCommandQueue().Execute(*frame.execute_cmd_list_set_ptr);
+        frame.render_cmd_list_ptr->WaitUntilCompleted(static_cast<uint32_t>(std::chrono::milliseconds(HeadlessRenderFixture::s_gpu_timeout).count()));
+        CHECK(frame.render_cmd_list_ptr->GetState() != CommandList::State::Executing);
+    }
+}
+
+TEST_CASE("Headless render context limits frames in flight by frame buffers count", "[.][gpu][render-context]")
+{
+    const auto [max_frames_in_flight, expected_max_frames_in_flight] = GENERATE(table<uint32_t, uint32_t>({
+        { 0U, 3U }, // not limited by settings
+        { 1U, 1U },
+        { 2U, 2U },
+        { 3U, 3U },
+        { 5U, 3U }, // clamped to frame buffers count
+    }));
+
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetMaxFramesInFlight(max_frames_in_flight));
+    REQUIRE(fixture.GetRenderContext().GetSettings().frame_buffers_count == 3U);
+    CHECK(fixture.GetRenderContext().GetMaxFramesInFlight() == expected_max_frames_in_flight);
+}
+
+TEST_CASE("Headless render context renders frames with limited frames in flight", "[.][gpu][render-context]")
+{
+    const uint32_t max_frames_in_flight = GENERATE(1U, 2U);
+    const bool     low_latency_enabled  = GENERATE(false, true);
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings()
+                                      .SetMaxFramesInFlight(max_frames_in_flight)
+                                      .SetLowLatencyEnabled(low_latency_enabled));
+    auto& context = dynamic_cast<RenderContextBase&>(fixture.GetRenderContext());
+    const RenderContext::Settings& context_settings = context.GetSettings();
+    const Data::Size frame_data_size = context_settings.frame_size.GetPixelsCount() * static_cast<Data::Size>(g_clear_pixel.size());
+    REQUIRE(context.GetMaxFramesInFlight() == max_frames_in_flight);
+
+    // Frames in flight wait, either before the next frame or right after present in low-latency mode,
+    // must neither deadlock nor break the ring order of frame buffers.
+    // Frame presented wait is done before every frame the same way as in graphics application
+    uint32_t max_frames_in_flight_count = 0U;
+    for(uint32_t frame_index = 0U; frame_index < context_settings.frame_buffers_count * 3U; ++frame_index)
+    {
+        context.WaitForGpu(Context::WaitFor::FramePresented);
+        CHECK(context.GetFramesInFlightCount() < max_frames_in_flight);
+        CHECK(fixture.RenderFrame() == frame_index % context_settings.frame_buffers_count);
+
+        const uint32_t frames_in_flight_count = context.GetFramesInFlightCount();
+        CHECK(frames_in_flight_count <= (low_latency_enabled ? max_frames_in_flight - 1U : max_frames_in_flight));
+        max_frames_in_flight_count = std::max(max_frames_in_flight_count, frames_in_flight_count);
+    }
+    UNSCOPED_INFO("Maximum observed frames in flight count: " << max_frames_in_flight_count);
+    for(uint32_t frame_buffer_index = 0U; frame_buffer_index < context_settings.frame_buffers_count; ++frame_buffer_index)
+    {
+        const SubResource frame_data = fixture.ReadFrameBuffer(frame_buffer_index);
+        REQUIRE(frame_data.GetDataSize() == frame_data_size);
+        CHECK(HeadlessRenderFixture::CountPixelsNotEqual(frame_data, g_clear_pixel) == 0U);
+    }
+
+    // Input latency is measured from frame input sampling to frame present, which includes the frame presented wait,
+    // while in low-latency mode frames in flight wait is done right after present, before input sampling
+    const FpsCounter& fps_counter = context.GetFpsCounter();
+    REQUIRE(fps_counter.GetAveragedTimingsCount() > 0U);
+    const FpsCounter::FrameTiming average_frame_timing = fps_counter.GetAverageFrameTiming();
+    CHECK(average_frame_timing.GetInputLatencySec() > 0.0);
+    CHECK(average_frame_timing.GetInputLatencySec() >= average_frame_timing.GetGpuWaitTimeSec());
+    CHECK(average_frame_timing.GetInputLatencySec() <= average_frame_timing.GetTotalTimeSec());
+}
@@ -0,0 +1,277 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/HeadlessRenderFixture.hpp
+Headless render context fixture used by GPU tests running on software device (lavapipe) without window
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Core.h>
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+class HeadlessRenderFixture
+{
+public:
+    using Pixel = std::array<uint8_t, 4>;
+    using EncodeCommands = std::function<void(RenderCommandList&)>;
+
+    struct Frame
+    {
+        Ptr<Texture>           screen_texture_ptr;
+        Ptr<RenderPass>        screen_pass_ptr;
+        Ptr<RenderCommandList> render_cmd_list_ptr;
+        Ptr<CommandListSet>    execute_cmd_list_set_ptr;
+    };
+
+    static constexpr std::chrono::seconds s_gpu_timeout{ 30 };
+
+    static RenderContext::Settings GetDefaultContextSettings()
+    {
+        return RenderContext::Settings()
+            .SetFrameSize(FrameSize(64U, 64U))
+            .SetColorFormat(PixelFormat::BGRA8Unorm)
+            .SetClearColor(Color4F(0.F, 1.F, 0.F, 1.F))
+            .SetFrameBuffersCount(3U)
+            .SetVSyncEnabled(false);
+    }
+
+    explicit HeadlessRenderFixture(const RenderContext::Settings& context_settings = GetDefaultContextSettings(),
+                                   const Device::Capabilities& device_caps = Device::Capabilities().SetFeatures(Device::Features::BasicRendering))
+    {
+        META_FUNCTION_TASK();
+        // Headless context renders to offscreen frame buffers, so device is selected without presentation to window capability
+        static_cast<void>(System::Get().UpdateGpuDevices(Device::Capabilities(device_caps).SetPresentToWindow(false)));
+        m_device_ptr = System::Get().GetSoftwareGpuDevice();
+        META_CHECK_ARG_NOT_NULL_DESCR(m_device_ptr, "software GPU device is required to run GPU tests");
+
+        m_context_ptr = RenderContext::CreateHeadless(*m_device_ptr, m_parallel_executor, context_settings);
+        m_context_ptr->SetName("Headless Render Context");
+
+        const RenderContext::Settings& settings = m_context_ptr->GetSettings();
+        m_render_pattern_ptr = RenderPattern::Create(*m_context_ptr, {
+            RenderPattern::ColorAttachments
+            {
+                RenderPattern::ColorAttachment(
+                    0U, settings.color_format, 1U,
+                    settings.clear_color.has_value()
+                        ? RenderPass::Attachment::LoadAction::Clear
+                        : RenderPass::Attachment::LoadAction::DontCare,
+                    RenderPass::Attachment::StoreAction::Store,
+                    settings.clear_color.value_or(Color4F()))
+            },
+            std::nullopt, // No depth attachment
+            std::nullopt, // No stencil attachment
+            RenderPass::Access::None,
+            true // final render pass
+        });
+        m_render_pattern_ptr->SetName("Headless Render Pattern");
+        m_view_state_ptr = ViewState::Create({
+            { GetFrameViewport(settings.frame_size)    },
+            { GetFrameScissorRect(settings.frame_size) }
+        });
+
+        CommandQueue& render_cmd_queue = GetRenderCommandQueue();
+        for(uint32_t frame_index = 0U; frame_index < settings.frame_buffers_count; ++frame_index)
+        {
+            Frame frame;
+            frame.screen_texture_ptr = Texture::CreateFrameBuffer(*m_context_ptr, frame_index);
+            frame.screen_texture_ptr->SetName(fmt::format("Frame Buffer {}", frame_index));
+            frame.screen_pass_ptr = RenderPass::Create(*m_render_pattern_ptr, { { Texture::View(*frame.screen_texture_ptr) }, settings.frame_size });
+            frame.render_cmd_list_ptr = RenderCommandList::Create(render_cmd_queue, *frame.screen_pass_ptr);
+            frame.render_cmd_list_ptr->SetName(fmt::format("Headless Render {}", frame_index));
+            frame.execute_cmd_list_set_ptr = CommandListSet::Create({ *frame.render_cmd_list_ptr }, frame_index);
+            m_frames.emplace_back(std::move(frame));
+        }
+
+        m_context_ptr->CompleteInitialization();
+    }
+
+    ~HeadlessRenderFixture()
+    {
+        META_FUNCTION_TASK();
+        m_context_ptr->WaitForGpu(Context::WaitFor::RenderComplete);
+    }
+
+    HeadlessRenderFixture(const HeadlessRenderFixture&) = delete;
+    HeadlessRenderFixture(HeadlessRenderFixture&&) = delete;
+    HeadlessRenderFixture& operator=(const HeadlessRenderFixture&) = delete;
+    HeadlessRenderFixture& operator=(HeadlessRenderFixture&&) = delete;
+
+    [[nodiscard]] Device&        GetDevice() const noexcept             { return *m_device_ptr; }
+    [[nodiscard]] RenderContext& GetRenderContext() const noexcept      { return *m_context_ptr; }
+    [[nodiscard]] RenderPattern& GetRenderPattern() const noexcept      { return *m_render_pattern_ptr; }
+    [[nodiscard]] const Ptr<RenderPattern>& GetRenderPatternPtr() const noexcept { return m_render_pattern_ptr; }
+    [[nodiscard]] ViewState&     GetViewState() const noexcept          { return *m_view_state_ptr; }
+    [[nodiscard]] CommandQueue&  GetRenderCommandQueue() const          { return m_context_ptr->GetRenderCommandKit().GetQueue(); }
+    [[nodiscard]] Frame&         GetFrame(uint32_t frame_buffer_index)  { return m_frames.at(frame_buffer_index); }
+    [[nodiscard]] Frame&         GetCurrentFrame()                      { return GetFrame(m_context_ptr->GetFrameBufferIndex()); }
+
+    // Creates render state of the headless render pattern with program of vertex and pixel shaders without input buffers,
+    // shaders are loaded from the test resources
+    Ptr<RenderState> CreateRenderState(const std::string& shaders_file_name, const std::string& vertex_function_name,
+                                       const std::string& pixel_function_name) const
+    {
+        META_FUNCTION_TASK();
+        RenderState::Settings state_settings
+        {
+            Program::Create(*m_context_ptr,
+                Program::Settings
+                {
+                    Program::Shaders
+                    {
+                        Shader::CreateVertex(*m_context_ptr, { Data::ShaderProvider::Get(), { shaders_file_name, vertex_function_name } }),
+                        Shader::CreatePixel(*m_context_ptr,  { Data::ShaderProvider::Get(), { shaders_file_name, pixel_function_name } }),
+                    },
+                    Program::InputBufferLayouts{ },
+                    Program::ArgumentAccessors{ },
+                    m_render_pattern_ptr->GetAttachmentFormats()
+                }
+            ),
+            m_render_pattern_ptr
+        };
+        state_settings.rasterizer.cull_mode = RenderState::Rasterizer::CullMode::None;
+
+        Ptr<RenderState> render_state_ptr = RenderState::Create(*m_context_ptr, state_settings);
+        render_state_ptr->SetName(fmt::format("{} Render State", shaders_file_name));
+        return render_state_ptr;
+    }
+
+    // Creates compute state with program of the compute shader loaded from the test resources
+    Ptr<ComputeState> CreateComputeState(const std::string& shaders_file_name, const std::string& compute_function_name,
+                                         const ThreadGroupSize& thread_group_size) const
+    {
+        META_FUNCTION_TASK();
+        Ptr<ComputeState> compute_state_ptr = ComputeState::Create(*m_context_ptr,
+            ComputeState::Settings
+            {
+                Program::Create(*m_context_ptr,
+                    Program::Settings
+                    {
+                        Program::Shaders
+                        {
+                            Shader::Create(Shader::Type::Compute, *m_context_ptr, { Data::ShaderProvider::Get(), { shaders_file_name, compute_function_name } }),
+                        },
+                        Program::InputBufferLayouts{ },
+                        Program::ArgumentAccessors{ },
+                        AttachmentFormats{ }
+                    }
+                ),
+                thread_group_size
+            }
+        );
+        compute_state_ptr->SetName(fmt::format("{} Compute State", shaders_file_name));
+        return compute_state_ptr;
+    }
+
+    // Renders and presents current frame with render pass clearing frame buffer and optional commands encoded inside the render pass,
+    // returns index of the rendered frame buffer
+    uint32_t RenderFrame(const EncodeCommands& encode_commands = {})
+    {
+        META_FUNCTION_TASK();
+        const uint32_t frame_buffer_index = m_context_ptr->GetFrameBufferIndex();
+        const Frame& frame = GetFrame(frame_buffer_index);
+        frame.render_cmd_list_ptr->Reset();
+        if (encode_commands)
+            encode_commands(*frame.render_cmd_list_ptr);
+        frame.render_cmd_list_ptr->Commit();
+
+        GetRenderCommandQueue().Execute(*frame.execute_cmd_list_set_ptr);
+        m_context_ptr->Present();
+        return frame_buffer_index;
+    }
+
+    // Resizes render context and recreates frame buffer textures with updated screen render passes, the same way as graphics application does
+    void Resize(const FrameSize& frame_size)
+    {
+        META_FUNCTION_TASK();
+        m_context_ptr->WaitForGpu(Context::WaitFor::RenderComplete);
+        for(Frame& frame : m_frames)
+        {
+            frame.screen_pass_ptr->ReleaseAttachmentTextures();
+            frame.screen_texture_ptr.reset();
+        }
+
+        m_context_ptr->Resize(frame_size);
+        m_view_state_ptr->SetViewports({ GetFrameViewport(frame_size) });
+        m_view_state_ptr->SetScissorRects({ GetFrameScissorRect(frame_size) });
+
+        for(uint32_t frame_index = 0U; frame_index < static_cast<uint32_t>(m_frames.size()); ++frame_index)
+        {
+            Frame& frame = m_frames[frame_index];
+            frame.screen_texture_ptr = Texture::CreateFrameBuffer(*m_context_ptr, frame_index);
+            frame.screen_texture_ptr->SetName(fmt::format("Frame Buffer {}", frame_index));
+            frame.screen_pass_ptr->Update({ { Texture::View(*frame.screen_texture_ptr) }, frame_size });
+        }
+    }
+
+    // Reads back frame buffer data asynchronously on the render queue and waits for read-back completion with timeout
+    SubResource ReadFrameBuffer(uint32_t frame_buffer_index)
+    {
+        META_FUNCTION_TASK();
+        return WaitForData(GetFrame(frame_buffer_index).screen_texture_ptr->ReadDataAsync(GetRenderCommandQueue()));
+    }
+
+    static SubResource WaitForData(const Resource::ReadDataFuture& read_data_future)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_TRUE_DESCR(read_data_future.wait_for(s_gpu_timeout) == std::future_status::ready,
+                                  "resource data read-back was not completed by GPU in time");
+        return read_data_future.get();
+    }
+
+    // Returns number of pixels in BGRA8 frame data which are not equal to the expected pixel
+    static size_t CountPixelsNotEqual(const SubResource& frame_data, const Pixel& expected_pixel)
+    {
+        META_FUNCTION_TASK();
+        size_t mismatched_pixels_count = 0U;
+        const auto* frame_data_ptr = frame_data.GetDataPtr<uint8_t>();
+        for(Data::Size pixel_offset = 0U; pixel_offset + expected_pixel.size() <= frame_data.GetDataSize(); pixel_offset += expected_pixel.size())
+        {
+            if (!std::equal(expected_pixel.begin(), expected_pixel.end(), frame_data_ptr + pixel_offset))
+                mismatched_pixels_count++;
+        }
+        return mismatched_pixels_count;
+    }
+
+private:
+    tf::Executor        m_parallel_executor;
+    Ptr<Device>         m_device_ptr;
+    Ptr<RenderContext>  m_context_ptr;
+    Ptr<RenderPattern>  m_render_pattern_ptr;
+    Ptr<ViewState>      m_view_state_ptr;
+    std::vector<Frame>  m_frames;
+};
+
+} // namespace Methane::Graphics
@@ -0,0 +1,107 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/IndirectDrawBenchmark.cpp
+Benchmark encoding and submission of many draws with direct draw calls and with multi-draw indirect on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_draws_per_frame = 4096U;
+static constexpr uint32_t g_frames_per_run  = 8U;
+
+enum class DrawSubmission
+{
+    Direct,
+    Indirect
+};
+
+// Renders frames with many small draws of grid triangles, so that CPU overhead of draws encoding dominates over GPU work
+static uint32_t MeasureDrawsSubmission(DrawSubmission draw_submission, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+
+    std::vector<RenderCommandList::DrawArguments> draw_arguments;
+    draw_arguments.reserve(g_draws_per_frame);
+    for(uint32_t draw_index = 0U; draw_index < g_draws_per_frame; ++draw_index)
+    {
+        draw_arguments.push_back({ 3U, 1U, (draw_index % 4U) * 3U, 0U });
+    }
+
+    const auto arguments_size = static_cast<Data::Size>(draw_arguments.size() * sizeof(RenderCommandList::DrawArguments));
+    const Ptr<Buffer> arguments_buffer_ptr = Buffer::CreateIndirectBuffer(context, arguments_size, sizeof(RenderCommandList::DrawArguments));
+    arguments_buffer_ptr->SetName("Benchmark Indirect Arguments Buffer");
+    arguments_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(draw_arguments.data()), arguments_size } }, // NOSONAR
+                                  fixture.GetRenderCommandQueue());
+    context.CompleteInitialization();
+
+    const HeadlessRenderFixture::EncodeCommands encode_draws = [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        render_cmd_list.SetViewState(fixture.GetViewState());
+        if (draw_submission == DrawSubmission::Indirect)
+        {
+            render_cmd_list.DrawIndirect(RenderCommandList::Primitive::Triangle, *arguments_buffer_ptr, g_draws_per_frame);
+            return;
+        }
+        for(const RenderCommandList::DrawArguments& args : draw_arguments)
+        {
+            render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, args.vertex_count, args.start_vertex,
+                                 args.instance_count, args.start_instance);
+        }
+    };
+
+    uint32_t rendered_frames_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t frame_index = 0U; frame_index < g_frames_per_run; ++frame_index)
+        {
+            fixture.RenderFrame(encode_draws);
+            rendered_frames_count++;
+        }
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(rendered_frames_count == g_frames_per_run * meter.runs());
+    return rendered_frames_count;
+}
+
+TEST_CASE("Benchmark draws submission", "[.][gpu][render-command-list][benchmark]")
+{
+    BENCHMARK_ADVANCED("4096 direct draws per frame")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureDrawsSubmission(DrawSubmission::Direct, meter);
+    };
+
+    BENCHMARK_ADVANCED("4096 draws per frame with multi-draw indirect")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureDrawsSubmission(DrawSubmission::Indirect, meter);
+    };
+}
@@ -0,0 +1,191 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/IndirectDrawTest.cpp
+GPU tests comparing frames rendered with indirect draws and with equivalent direct draws on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <magic_enum.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using DrawArguments        = RenderCommandList::DrawArguments;
+using DrawIndexedArguments = RenderCommandList::DrawIndexedArguments;
+
+// Grid triangles are selected by vertex ranges in rows and by instance ranges in columns
+static const std::vector<DrawArguments> g_draw_arguments{
+    { 3U, 4U, 0U, 0U },
+    { 6U, 2U, 3U, 0U },
+    { 3U, 1U, 9U, 0U },
+};
+
+// Indices are reversed by triangles, so that index ranges select different grid rows than the same vertex ranges
+static const std::vector<uint32_t> g_indices{ 9U, 10U, 11U, 6U, 7U, 8U, 3U, 4U, 5U, 0U, 1U, 2U };
+static const std::vector<DrawIndexedArguments> g_draw_indexed_arguments{
+    { 3U, 4U, 0U, 0, 0U },
+    { 6U, 1U, 3U, 0, 0U },
+    { 3U, 3U, 9U, 0, 0U },
+};
+
+template<typename ArgumentsType>
+static Ptr<Buffer> CreateIndirectArgumentsBuffer(HeadlessRenderFixture& fixture, const std::vector<ArgumentsType>& arguments)
+{
+    const auto arguments_size = static_cast<Data::Size>(arguments.size() * sizeof(ArgumentsType));
+    Ptr<Buffer> arguments_buffer_ptr = Buffer::CreateIndirectBuffer(fixture.GetRenderContext(), arguments_size, sizeof(ArgumentsType));
+    arguments_buffer_ptr->SetName("Indirect Arguments Buffer");
+    arguments_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(arguments.data()), arguments_size } }, // NOSONAR
+                                  fixture.GetRenderCommandQueue());
+    return arguments_buffer_ptr;
+}
+
+static Data::Bytes RenderAndReadBackFrame(HeadlessRenderFixture& fixture, const HeadlessRenderFixture::EncodeCommands& encode_commands)
+{
+    const SubResource frame_data = fixture.ReadFrameBuffer(fixture.RenderFrame(encode_commands));
+    return Data::Bytes(frame_data.GetDataPtr(), frame_data.GetDataEndPtr());
+}
+
+// Counts pixels covered by triangles, which differ from the clear color of the default fixture settings
+static size_t CountCoveredPixels(const Data::Bytes& frame_data)
+{
+    return HeadlessRenderFixture::CountPixelsNotEqual(SubResource(frame_data.data(), static_cast<Data::Size>(frame_data.size())),
+                                                      HeadlessRenderFixture::Pixel{ 0U, 255U, 0U, 255U });
+}
+
+TEST_CASE("Indirect draws render the same frames as direct draws", "[.][gpu][render-command-list]")
+{
+    HeadlessRenderFixture fixture;
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    const size_t frame_pixels_count = fixture.GetRenderContext().GetSettings().frame_size.GetPixelsCount();
+
+    SECTION("Non-indexed indirect draws")
+    {
+        const Ptr<Buffer> arguments_buffer_ptr = CreateIndirectArgumentsBuffer(fixture, g_draw_arguments);
+        fixture.GetRenderContext().CompleteInitialization();
+
+        const Data::Bytes direct_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+        {
+            render_cmd_list.SetRenderState(*render_state_ptr);
+            render_cmd_list.SetViewState(fixture.GetViewState());
+            for(const DrawArguments& args : g_draw_arguments)
+            {
+                render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, args.vertex_count, args.start_vertex,
+                                     args.instance_count, args.start_instance);
+            }
+        });
+
+        const Data::Bytes indirect_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+        {
+            render_cmd_list.SetRenderState(*render_state_ptr);
+            render_cmd_list.SetViewState(fixture.GetViewState());
+            render_cmd_list.DrawIndirect(RenderCommandList::Primitive::Triangle, *arguments_buffer_ptr,
+                                         static_cast<uint32_t>(g_draw_arguments.size()));
+        });
+
+        CHECK(CountCoveredPixels(direct_frame_data) > 0U);
+        CHECK(CountCoveredPixels(direct_frame_data) < frame_pixels_count);
+        CHECK(indirect_frame_data == direct_frame_data);
+    }
+
+    SECTION("Indexed indirect draws")
+    {
+        const auto indices_size = static_cast<Data::Size>(g_indices.size() * sizeof(uint32_t));
+        const Ptr<Buffer> index_buffer_ptr = Buffer::CreateIndexBuffer(fixture.GetRenderContext(), indices_size, PixelFormat::R32Uint);
+        index_buffer_ptr->SetName("Grid Index Buffer");
+        index_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(g_indices.data()), indices_size } }, // NOSONAR
+                                  fixture.GetRenderCommandQueue());
+        const Ptr<Buffer> arguments_buffer_ptr = CreateIndirectArgumentsBuffer(fixture, g_draw_indexed_arguments);
+        fixture.GetRenderContext().CompleteInitialization();
+
+        const Data::Bytes direct_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+        {
+            render_cmd_list.SetRenderState(*render_state_ptr);
+            render_cmd_list.SetViewState(fixture.GetViewState());
+            render_cmd_list.SetIndexBuffer(*index_buffer_ptr);
+            for(const DrawIndexedArguments& args : g_draw_indexed_arguments)
+            {
+                render_cmd_list.DrawIndexed(RenderCommandList::Primitive::Triangle, args.index_count, args.start_index,
+                                            static_cast<uint32_t>(args.start_vertex), args.instance_count, args.start_instance);
+            }
+        });
+
+        const Data::Bytes indirect_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+        {
+            render_cmd_list.SetRenderState(*render_state_ptr);
+            render_cmd_list.SetViewState(fixture.GetViewState());
+            render_cmd_list.SetIndexBuffer(*index_buffer_ptr);
+            render_cmd_list.DrawIndexedIndirect(RenderCommandList::Primitive::Triangle, *arguments_buffer_ptr,
+                                                static_cast<uint32_t>(g_draw_indexed_arguments.size()));
+        });
+
+        CHECK(CountCoveredPixels(direct_frame_data) > 0U);
+        CHECK(CountCoveredPixels(direct_frame_data) < frame_pixels_count);
+        CHECK(indirect_frame_data == direct_frame_data);
+    }
+}
+
+TEST_CASE("Indirect draws with count buffer render only the counted draws", "[.][gpu][render-command-list]")
+{
+    using namespace magic_enum::bitwise_operators;
+
+    // Draws count is read from the count buffer only when the feature is enabled on device creation,
+    // software Vulkan device (lavapipe) supports it with Vulkan 1.2 features
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings(),
+                                  Device::Capabilities().SetFeatures(Device::Features::BasicRendering | Device::Features::DrawIndirectCount));
+    REQUIRE(static_cast<bool>(fixture.GetDevice().GetCapabilities().features & Device::Features::DrawIndirectCount));
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+
+    // Count buffer limits the draws to the first arguments, while the maximum draws count covers all of them
+    const uint32_t counted_draws_count = GENERATE(1U, 2U);
+    const Ptr<Buffer> arguments_buffer_ptr = CreateIndirectArgumentsBuffer(fixture, g_draw_arguments);
+    const Ptr<Buffer> count_buffer_ptr = Buffer::CreateIndirectBuffer(fixture.GetRenderContext(), sizeof(uint32_t), sizeof(uint32_t));
+    count_buffer_ptr->SetName("Indirect Draws Count Buffer");
+    count_buffer_ptr->SetData({ { reinterpret_cast<Data::ConstRawPtr>(&counted_draws_count), sizeof(uint32_t) } }, // NOSONAR
+                              fixture.GetRenderCommandQueue());
+    fixture.GetRenderContext().CompleteInitialization();
+
+    const Data::Bytes direct_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        render_cmd_list.SetViewState(fixture.GetViewState());
+        for(uint32_t draw_index = 0U; draw_index < counted_draws_count; ++draw_index)
+        {
+            const DrawArguments& args = g_draw_arguments[draw_index];
+            render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, args.vertex_count, args.start_vertex,
+                                 args.instance_count, args.start_instance);
+        }
+    });
+
+    const Data::Bytes indirect_count_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        render_cmd_list.SetViewState(fixture.GetViewState());
+        render_cmd_list.DrawIndirect(RenderCommandList::Primitive::Triangle, *arguments_buffer_ptr,
+                                     static_cast<uint32_t>(g_draw_arguments.size()), 0U, count_buffer_ptr.get());
+    });
+
+    CHECK(CountCoveredPixels(direct_frame_data) > 0U);
+    CHECK(indirect_count_frame_data == direct_frame_data);
+}
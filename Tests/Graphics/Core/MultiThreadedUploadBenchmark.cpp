@@ -0,0 +1,109 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/MultiThreadedUploadBenchmark.cpp
+Benchmark scaling of resources upload with the number of worker threads on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <thread>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_data_size       = 4U * 1024U;
+static const     Dimensions g_texture_dims(32U, 32U); // RGBA8 texture of the same data size as the buffer
+static constexpr uint32_t   g_resources_count = 2048U;
+
+// Creates the same number of private buffers and image textures with initial data split between worker threads
+// and waits for upload completion: textures are always uploaded through the staging buffers with per-thread upload command lists
+static size_t MeasureResourcesUploadOnThreads(HeadlessRenderFixture& fixture, uint32_t threads_count, Catch::Benchmark::Chronometer meter)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::Bytes resource_data(g_data_size, Data::Byte{ 0xC3 });
+    const uint32_t resources_per_thread = g_resources_count / threads_count / 2U;
+
+    std::vector<Ptrs<Resource>> thread_resources(threads_count);
+    meter.measure([&]()
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count);
+        for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            threads.emplace_back([&, thread_index]()
+            {
+                for(uint32_t resource_index = 0U; resource_index < resources_per_thread; ++resource_index)
+                {
+                    Ptr<Buffer> buffer_ptr = Buffer::CreateVertexBuffer(context, g_data_size, sizeof(float) * 4U);
+                    buffer_ptr->SetData({ { resource_data.data(), g_data_size } }, render_cmd_queue);
+                    thread_resources[thread_index].emplace_back(std::move(buffer_ptr));
+
+                    Ptr<Texture> texture_ptr = Texture::CreateImage(context, g_texture_dims, std::nullopt, PixelFormat::RGBA8Unorm, false);
+                    texture_ptr->SetData({ { resource_data.data(), g_data_size } }, render_cmd_queue);
+                    thread_resources[thread_index].emplace_back(std::move(texture_ptr));
+                }
+            });
+        }
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+    });
+
+    // Prevent code removal by optimizer
+    size_t resources_count = 0U;
+    for(const Ptrs<Resource>& resources : thread_resources)
+    {
+        resources_count += resources.size();
+    }
+    CHECK(resources_count == static_cast<size_t>(resources_per_thread) * 2U * threads_count * meter.runs());
+    return resources_count;
+}
+
+TEST_CASE("Benchmark multi-threaded resources upload scaling", "[.][gpu][upload][multi-threading][benchmark]")
+{
+    HeadlessRenderFixture fixture;
+
+    BENCHMARK_ADVANCED("Upload of 1024 buffers and 1024 textures of 4 KB from 1 thread")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureResourcesUploadOnThreads(fixture, 1U, meter);
+    };
+
+    BENCHMARK_ADVANCED("Upload of 1024 buffers and 1024 textures of 4 KB from 2 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureResourcesUploadOnThreads(fixture, 2U, meter);
+    };
+
+    BENCHMARK_ADVANCED("Upload of 1024 buffers and 1024 textures of 4 KB from 4 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureResourcesUploadOnThreads(fixture, 4U, meter);
+    };
+
+    BENCHMARK_ADVANCED("Upload of 1024 buffers and 1024 textures of 4 KB from 8 threads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureResourcesUploadOnThreads(fixture, 8U, meter);
+    };
+}
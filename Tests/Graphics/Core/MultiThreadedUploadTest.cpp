@@ -0,0 +1,233 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/MultiThreadedUploadTest.cpp
+GPU tests of resources creation and upload from multiple threads on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <iterator>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t   g_values_count    = 64U; // Equal to GROUP_SIZE in Reduction.hlsl
+static constexpr Data::Size g_data_size       = g_values_count * sizeof(uint32_t);
+static const     Dimensions g_texture_dims(8U, 8U); // RGBA8 texture of the same data size as the buffer
+static constexpr uint32_t   g_read_back_step  = 125U;
+
+// Resources created on one worker thread: private buffers are written directly on software devices,
+// while image textures are always uploaded with per-thread upload command lists through the staging buffers
+struct ThreadResources
+{
+    Ptrs<Buffer>          buffers;
+    Ptrs<Texture>         textures;
+    Ptrs<ProgramBindings> program_bindings;
+    Ptr<Buffer>           output_buffer_ptr;
+};
+
+// Unique data of every resource, so that mixed up uploads between threads are detected by read-back
+static std::vector<uint32_t> GetResourceValues(uint32_t thread_index, uint32_t resource_index, uint32_t resource_kind)
+{
+    std::vector<uint32_t> values(g_values_count);
+    std::iota(values.begin(), values.end(), ((thread_index * 0x1000U + resource_index) * 2U + resource_kind) * g_values_count);
+    return values;
+}
+
+static SubResource GetResourceData(const std::vector<uint32_t>& values)
+{
+    return SubResource(reinterpret_cast<Data::ConstRawPtr>(values.data()), g_data_size); // NOSONAR
+}
+
+// Creates read-back storage buffers, image textures and compute program bindings of storage buffers with initial data
+// on the given number of worker threads, thread index offset makes resource data unique between waves of threads
+static std::vector<ThreadResources> CreateResourcesOnThreads(HeadlessRenderFixture& fixture, const ComputeState& compute_state,
+                                                             uint32_t threads_count, uint32_t resources_per_thread,
+                                                             uint32_t first_thread_index = 0U)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<Program>& program_ptr = compute_state.GetSettings().program_ptr;
+
+    std::vector<ThreadResources> thread_resources(threads_count);
+    std::vector<std::thread>     threads;
+    threads.reserve(threads_count);
+    for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        threads.emplace_back([&, thread_index]()
+        {
+            ThreadResources& resources = thread_resources[thread_index];
+            const uint32_t data_thread_index = first_thread_index + thread_index;
+            resources.buffers.reserve(resources_per_thread);
+            resources.textures.reserve(resources_per_thread);
+            resources.program_bindings.reserve(resources_per_thread);
+            resources.output_buffer_ptr = Buffer::CreateStorageBuffer(context, sizeof(uint32_t), sizeof(uint32_t), true);
+
+            for(uint32_t resource_index = 0U; resource_index < resources_per_thread; ++resource_index)
+            {
+                Ptr<Buffer> buffer_ptr = Buffer::CreateStorageBuffer(context, g_data_size, sizeof(uint32_t), true);
+                buffer_ptr->SetData({ GetResourceData(GetResourceValues(data_thread_index, resource_index, 0U)) }, render_cmd_queue);
+
+                Ptr<Texture> texture_ptr = Texture::CreateImage(context, g_texture_dims, std::nullopt, PixelFormat::RGBA8Unorm, false, true);
+                texture_ptr->SetData({ GetResourceData(GetResourceValues(data_thread_index, resource_index, 1U)) }, render_cmd_queue);
+
+                resources.program_bindings.emplace_back(ProgramBindings::Create(program_ptr, {
+                    { { Shader::Type::Compute, "g_input"  }, { { *buffer_ptr } } },
+                    { { Shader::Type::Compute, "g_output" }, { { *resources.output_buffer_ptr } } },
+                }));
+                resources.buffers.emplace_back(std::move(buffer_ptr));
+                resources.textures.emplace_back(std::move(texture_ptr));
+            }
+        });
+    }
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return thread_resources;
+}
+
+template<typename ResourceType>
+static size_t CountNotInitializedResources(const Ptrs<ResourceType>& resources)
+{
+    return static_cast<size_t>(std::count_if(resources.begin(), resources.end(),
+        [](const Ptr<ResourceType>& resource_ptr) { return resource_ptr->GetDataSize(Data::MemoryState::Initialized) != g_data_size; }));
+}
+
+static size_t CountNotInitializedResources(const std::vector<ThreadResources>& thread_resources)
+{
+    size_t not_initialized_count = 0U;
+    for(const ThreadResources& resources : thread_resources)
+    {
+        not_initialized_count += CountNotInitializedResources(resources.buffers) + CountNotInitializedResources(resources.textures);
+    }
+    return not_initialized_count;
+}
+
+static bool IsResourceDataEqual(Resource& resource, CommandQueue& cmd_queue, const std::vector<uint32_t>& expected_values)
+{
+    const SubResource read_data = HeadlessRenderFixture::WaitForData(resource.ReadDataAsync(cmd_queue));
+    return read_data.GetDataSize() == g_data_size &&
+           std::equal(expected_values.begin(), expected_values.end(), read_data.GetDataPtr<uint32_t>());
+}
+
+// Reads back every N-th buffer and texture of each thread and compares its data with uploaded values,
+// returns number of resources with mismatched data
+static size_t CountMismatchedReadBackResources(HeadlessRenderFixture& fixture, const std::vector<ThreadResources>& thread_resources)
+{
+    CommandQueue& render_cmd_queue = fixture.GetRenderCommandQueue();
+    size_t mismatched_resources_count = 0U;
+    for(uint32_t thread_index = 0U; thread_index < static_cast<uint32_t>(thread_resources.size()); ++thread_index)
+    {
+        const ThreadResources& resources = thread_resources[thread_index];
+        for(uint32_t resource_index = 0U; resource_index < static_cast<uint32_t>(resources.buffers.size()); resource_index += g_read_back_step)
+        {
+            if (!IsResourceDataEqual(*resources.buffers[resource_index], render_cmd_queue, GetResourceValues(thread_index, resource_index, 0U)))
+                mismatched_resources_count++;
+            if (!IsResourceDataEqual(*resources.textures[resource_index], render_cmd_queue, GetResourceValues(thread_index, resource_index, 1U)))
+                mismatched_resources_count++;
+        }
+    }
+    return mismatched_resources_count;
+}
+
+// Dispatches reduction with the last program bindings created by each thread and compares the output with the sum
+// of values uploaded to the bound input buffer, returns number of threads with mismatched sums
+static size_t CountMismatchedProgramBindingSums(HeadlessRenderFixture& fixture, const ComputeState& compute_state,
+                                                const std::vector<ThreadResources>& thread_resources)
+{
+    CommandQueue& render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<ComputeCommandList> compute_cmd_list_ptr = ComputeCommandList::Create(render_cmd_queue);
+    compute_cmd_list_ptr->SetName("Multi-Threaded Bindings Reduction");
+
+    size_t mismatched_sums_count = 0U;
+    for(uint32_t thread_index = 0U; thread_index < static_cast<uint32_t>(thread_resources.size()); ++thread_index)
+    {
+        const ThreadResources& resources = thread_resources[thread_index];
+        const auto resource_index = static_cast<uint32_t>(resources.program_bindings.size() - 1U);
+        compute_cmd_list_ptr->ResetWithState(compute_state);
+        compute_cmd_list_ptr->SetProgramBindings(*resources.program_bindings.back());
+        compute_cmd_list_ptr->Dispatch(ThreadGroupsCount(1U, 1U, 1U));
+        compute_cmd_list_ptr->Commit();
+        const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *compute_cmd_list_ptr });
+        render_cmd_queue.Execute(*execute_cmd_list_set_ptr);
+
+        const std::vector<uint32_t> input_values = GetResourceValues(thread_index, resource_index, 0U);
+        const SubResource output_data = HeadlessRenderFixture::WaitForData(resources.output_buffer_ptr->ReadDataAsync(render_cmd_queue));
+        if (output_data.GetDataSize() != sizeof(uint32_t) ||
+            *output_data.GetDataPtr<uint32_t>() != std::accumulate(input_values.begin(), input_values.end(), 0U))
+            mismatched_sums_count++;
+    }
+    return mismatched_sums_count;
+}
+
+static size_t GetResourcesCount(const std::vector<ThreadResources>& thread_resources)
+{
+    size_t resources_count = 0U;
+    for(const ThreadResources& resources : thread_resources)
+    {
+        resources_count += resources.buffers.size() + resources.textures.size();
+    }
+    return resources_count;
+}
+
+// Tests are hidden by default, because they require GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Resources are created and uploaded from multiple threads", "[.][gpu][upload][multi-threading]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    const Ptr<ComputeState> compute_state_ptr = fixture.CreateComputeState("Reduction", "SumCS", ThreadGroupSize(g_values_count, 1U, 1U));
+
+    SECTION("10000 buffers and textures are uploaded from 8 threads")
+    {
+        const std::vector<ThreadResources> thread_resources = CreateResourcesOnThreads(fixture, *compute_state_ptr, 8U, 625U);
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+
+        REQUIRE(GetResourcesCount(thread_resources) == 10000U);
+        CHECK(CountNotInitializedResources(thread_resources) == 0U);
+        CHECK(CountMismatchedReadBackResources(fixture, thread_resources) == 0U);
+        CHECK(CountMismatchedProgramBindingSums(fixture, *compute_state_ptr, thread_resources) == 0U);
+    }
+
+    SECTION("Upload command lists of exited threads are reused by new threads")
+    {
+        // Total number of threads exceeds command lists limit of the upload command kit,
+        // texture uploads go through the per-thread upload command lists on every device
+        std::vector<ThreadResources> thread_resources;
+        for(uint32_t wave_index = 0U; wave_index < 8U; ++wave_index)
+        {
+            std::vector<ThreadResources> wave_resources = CreateResourcesOnThreads(fixture, *compute_state_ptr, 8U, 16U, wave_index * 8U);
+            std::move(wave_resources.begin(), wave_resources.end(), std::back_inserter(thread_resources));
+        }
+        context.CompleteInitialization();
+        context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+
+        REQUIRE(GetResourcesCount(thread_resources) == 8U * 8U * 16U * 2U);
+        CHECK(CountNotInitializedResources(thread_resources) == 0U);
+        CHECK(CountMismatchedReadBackResources(fixture, thread_resources) == 0U);
+        CHECK(CountMismatchedProgramBindingSums(fixture, *compute_state_ptr, thread_resources) == 0U);
+    }
+}
@@ -0,0 +1,85 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ParallelRenderCommandListTest.cpp
+GPU tests of parallel render command list nested command lists count changed by the parallel render scheduler
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/ParallelRenderCommandList.h>
+#include <Methane/Graphics/ParallelRenderScheduler.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <atomic>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_initial_command_lists_count = 8U;
+static constexpr Data::Size g_items_count = 64U;
+
+TEST_CASE("Parallel render command lists count is changed by the scheduler", "[.][gpu][render-command-list]")
+{
+    HeadlessRenderFixture fixture;
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    fixture.GetRenderContext().CompleteInitialization();
+
+    const Ptr<ParallelRenderCommandList> parallel_cmd_list_ptr = ParallelRenderCommandList::Create(fixture.GetRenderCommandQueue(),
+                                                                                                   *fixture.GetCurrentFrame().screen_pass_ptr);
+    parallel_cmd_list_ptr->SetName("Parallel Render");
+    parallel_cmd_list_ptr->SetParallelCommandListsCount(g_initial_command_lists_count);
+    REQUIRE(parallel_cmd_list_ptr->GetParallelCommandLists().size() == g_initial_command_lists_count);
+
+    // Initial count of nested command lists is shrunk by one or many command lists, kept or grown by the scheduler
+    const uint32_t scheduled_command_lists_count = GENERATE(1U, 3U, 7U, 8U, 12U);
+    ParallelRenderScheduler::Settings scheduler_settings;
+    scheduler_settings.max_command_lists_count = 16U;
+    scheduler_settings.auto_tuning_enabled     = false;
+    ParallelRenderScheduler scheduler(scheduler_settings, scheduled_command_lists_count);
+    scheduler.SetItemsCount(g_items_count);
+    REQUIRE(scheduler.GetCommandListsCount() == scheduled_command_lists_count);
+
+    scheduler.ApplyCommandListsCount(*parallel_cmd_list_ptr);
+    CHECK(parallel_cmd_list_ptr->GetParallelCommandLists().size() == scheduler.GetCommandListsCount());
+
+    // All nested command lists are encoded, committed and executed, so that they are consistent with the list references
+    std::atomic<Data::Size> encoded_items_count{ 0U };
+    parallel_cmd_list_ptr->ResetWithState(*render_state_ptr);
+    parallel_cmd_list_ptr->SetViewState(fixture.GetViewState());
+    scheduler.Encode(*parallel_cmd_list_ptr, fixture.GetRenderContext().GetParallelExecutor(),
+        [&encoded_items_count](RenderCommandList& render_cmd_list, const ParallelRenderScheduler::ItemsRange& items_range)
+        {
+            for(Data::Index item_index = items_range.GetStart(); item_index < items_range.GetEnd(); ++item_index)
+            {
+                render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, 3U, (item_index % 4U) * 3U);
+            }
+            encoded_items_count += items_range.GetLength();
+        });
+    parallel_cmd_list_ptr->Commit();
+
+    const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *parallel_cmd_list_ptr });
+    fixture.GetRenderCommandQueue().Execute(*execute_cmd_list_set_ptr);
+    parallel_cmd_list_ptr->WaitUntilCompleted(static_cast<uint32_t>(std::chrono::milliseconds(HeadlessRenderFixture::s_gpu_timeout).count()));
+
+    CHECK(encoded_items_count == g_items_count);
+    CHECK(parallel_cmd_list_ptr->GetParallelCommandLists().size() == scheduler.GetCommandListsCount());
+}
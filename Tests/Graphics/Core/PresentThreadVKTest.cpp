@@ -0,0 +1,225 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/PresentThreadVKTest.cpp
+Unit tests of the Vulkan present thread frame pacing with slow fake present and without GPU device
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/PresentThreadVK.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+// Semaphores are replaced with integer identifiers, since present thread does not use GPU objects directly
+using FakePresentThread = PresentThreadVK<int>;
+
+static constexpr std::chrono::seconds g_wait_timeout{ 10 };
+
+// Fake swap-chain with slow present, which is blocked until presents are allowed by test,
+// and with acquire operation counting the number of images acquired at once
+class FakeSwapchain
+{
+public:
+    explicit FakeSwapchain(uint32_t images_count) : m_images_count(images_count) { }
+
+    void Present(const FakePresentThread::FramePresent& frame_present)
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition_var.wait(lock, [this] { return m_allowed_presents_count > 0U; });
+        m_allowed_presents_count--;
+        if (m_acquired_images_count)
+            m_acquired_images_count--;
+        m_presented_images.emplace_back(frame_present.image_index);
+        m_condition_var.notify_all();
+    }
+
+    FakePresentThread::AcquiredImage Acquire(const int& image_available_semaphore)
+    {
+        std::scoped_lock lock(m_mutex);
+        if (m_is_acquire_failing)
+            throw std::runtime_error("Swap-chain is out of date.");
+
+        m_acquired_images_count++;
+        m_max_acquired_images_count = std::max(m_max_acquired_images_count, m_acquired_images_count);
+        m_acquire_semaphores.emplace_back(image_available_semaphore);
+        m_condition_var.notify_all();
+        return { m_next_image_index++ % m_images_count, image_available_semaphore };
+    }
+
+    void AllowPresents(uint32_t presents_count)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_allowed_presents_count += presents_count;
+        m_condition_var.notify_all();
+    }
+
+    [[nodiscard]] bool WaitForPresentedCount(size_t presented_count)
+    {
+        std::unique_lock lock(m_mutex);
+        return m_condition_var.wait_for(lock, g_wait_timeout, [this, presented_count] { return m_presented_images.size() >= presented_count; });
+    }
+
+    [[nodiscard]] bool WaitForAcquiredCount(size_t acquired_count)
+    {
+        std::unique_lock lock(m_mutex);
+        return m_condition_var.wait_for(lock, g_wait_timeout, [this, acquired_count] { return m_acquire_semaphores.size() >= acquired_count; });
+    }
+
+    void SetAcquireFailing(bool is_acquire_failing)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_is_acquire_failing = is_acquire_failing;
+    }
+
+    void StartPresentThread(FakePresentThread& present_thread, uint32_t max_acquired_images_count)
+    {
+        std::vector<int> acquire_semaphores(m_images_count + 1U);
+        for(uint32_t semaphore_index = 0U; semaphore_index < acquire_semaphores.size(); ++semaphore_index)
+        {
+            acquire_semaphores[semaphore_index] = static_cast<int>(semaphore_index);
+        }
+        present_thread.Start(
+            [this](const FakePresentThread::FramePresent& frame_present) { Present(frame_present); },
+            [this](const int& image_available_semaphore) { return Acquire(image_available_semaphore); },
+            std::move(acquire_semaphores), max_acquired_images_count
+        );
+    }
+
+    [[nodiscard]] std::vector<uint32_t> GetPresentedImages() const   { std::scoped_lock lock(m_mutex); return m_presented_images; }
+    [[nodiscard]] std::vector<int>      GetAcquireSemaphores() const { std::scoped_lock lock(m_mutex); return m_acquire_semaphores; }
+    [[nodiscard]] uint32_t              GetAcquiredImagesCount() const    { std::scoped_lock lock(m_mutex); return m_acquired_images_count; }
+    [[nodiscard]] uint32_t              GetMaxAcquiredImagesCount() const { std::scoped_lock lock(m_mutex); return m_max_acquired_images_count; }
+
+private:
+    const uint32_t          m_images_count;
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_condition_var;
+    uint32_t                m_allowed_presents_count = 0U;
+    uint32_t                m_next_image_index = 0U;
+    uint32_t                m_acquired_images_count = 0U;
+    uint32_t                m_max_acquired_images_count = 0U;
+    bool                    m_is_acquire_failing = false;
+    std::vector<uint32_t>   m_presented_images;
+    std::vector<int>        m_acquire_semaphores;
+};
+
+TEST_CASE("Vulkan present thread with slow present", "[vulkan][present-thread]")
+{
+    constexpr uint32_t images_count = 3U;
+    FakeSwapchain      swapchain(images_count);
+    FakePresentThread  present_thread;
+
+    SECTION("Frame presents are queued without waiting for slow present")
+    {
+        swapchain.StartPresentThread(present_thread, images_count);
+        const FakePresentThread::AcquiredImage acquired_image = present_thread.TakeAcquiredImage();
+        const std::vector<uint32_t> queued_images{ acquired_image.image_index, 1U, 2U };
+        for(const uint32_t image_index : queued_images)
+        {
+            present_thread.QueuePresent({ image_index, { acquired_image.image_available_semaphore } });
+        }
+
+        // All presents are queued, while none of them is completed yet
+        CHECK(swapchain.GetPresentedImages().empty());
+
+        swapchain.AllowPresents(static_cast<uint32_t>(queued_images.size()));
+        REQUIRE(swapchain.WaitForPresentedCount(queued_images.size()));
+        CHECK(swapchain.GetPresentedImages() == queued_images);
+    }
+
+    SECTION("Application frames are paced by presents with limited images acquired ahead")
+    {
+        constexpr uint32_t frames_count = 30U;
+        constexpr uint32_t max_acquired_images_count = 2U;
+        swapchain.StartPresentThread(present_thread, max_acquired_images_count);
+
+        for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            // Present of the previous frame is completed only when the next frame is started, like slow present blocked in driver
+            if (frame_index > 0U)
+                swapchain.AllowPresents(1U);
+
+            const FakePresentThread::AcquiredImage acquired_image = present_thread.TakeAcquiredImage();
+            CHECK(frame_index - static_cast<uint32_t>(swapchain.GetPresentedImages().size()) < max_acquired_images_count);
+            present_thread.QueuePresent({ acquired_image.image_index, { acquired_image.image_available_semaphore } });
+        }
+        swapchain.AllowPresents(1U);
+
+        REQUIRE(swapchain.WaitForPresentedCount(frames_count));
+        CHECK(swapchain.GetMaxAcquiredImagesCount() <= max_acquired_images_count);
+    }
+
+    SECTION("Acquire semaphores are used in ring order")
+    {
+        swapchain.StartPresentThread(present_thread, 1U);
+        swapchain.AllowPresents(100U);
+        for(uint32_t frame_index = 0U; frame_index < images_count * 3U; ++frame_index)
+        {
+            const FakePresentThread::AcquiredImage acquired_image = present_thread.TakeAcquiredImage();
+            CHECK(acquired_image.image_available_semaphore == static_cast<int>(frame_index % (images_count + 1U)));
+            present_thread.QueuePresent({ acquired_image.image_index, { acquired_image.image_available_semaphore } });
+        }
+    }
+
+    SECTION("Stop completes queued presents and returns image acquired ahead")
+    {
+        swapchain.StartPresentThread(present_thread, images_count);
+        swapchain.AllowPresents(1U);
+        const FakePresentThread::AcquiredImage acquired_image = present_thread.TakeAcquiredImage();
+        present_thread.QueuePresent({ acquired_image.image_index, { acquired_image.image_available_semaphore } });
+        REQUIRE(swapchain.WaitForAcquiredCount(2U));
+
+        const std::optional<FakePresentThread::AcquiredImage> acquired_ahead_image_opt = present_thread.Stop();
+        CHECK_FALSE(present_thread.IsStarted());
+        CHECK(swapchain.GetPresentedImages().size() == 1U);
+        REQUIRE(acquired_ahead_image_opt.has_value());
+        CHECK(acquired_ahead_image_opt->image_available_semaphore == 1);
+    }
+
+    SECTION("Present thread is restarted with new semaphores after stop")
+    {
+        swapchain.StartPresentThread(present_thread, 1U);
+        swapchain.AllowPresents(100U);
+        present_thread.QueuePresent({ present_thread.TakeAcquiredImage().image_index, {} });
+        static_cast<void>(present_thread.Stop());
+
+        present_thread.Start(
+            [&swapchain](const FakePresentThread::FramePresent& frame_present) { swapchain.Present(frame_present); },
+            [&swapchain](const int& image_available_semaphore) { return swapchain.Acquire(image_available_semaphore); },
+            { 10, 11 }, 1U
+        );
+        CHECK(present_thread.TakeAcquiredImage().image_available_semaphore == 10);
+    }
+
+    SECTION("Acquire error is rethrown on application thread")
+    {
+        swapchain.SetAcquireFailing(true);
+        swapchain.StartPresentThread(present_thread, 1U);
+        CHECK_THROWS_AS(present_thread.TakeAcquiredImage(), std::runtime_error);
+    }
+}
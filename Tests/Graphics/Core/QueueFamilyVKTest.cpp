@@ -0,0 +1,143 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/QueueFamilyVKTest.cpp
+Unit tests of the Vulkan queue family selection over synthetic queue family properties without GPU device
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/DeviceVK.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr vk::QueueFlags g_graphics_family_flags = vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute | vk::QueueFlagBits::eTransfer;
+static constexpr vk::QueueFlags g_compute_family_flags  = vk::QueueFlagBits::eCompute  | vk::QueueFlagBits::eTransfer;
+static constexpr vk::QueueFlags g_transfer_family_flags = vk::QueueFlagBits::eTransfer | vk::QueueFlagBits::eSparseBinding;
+
+static std::vector<vk::QueueFamilyProperties> CreateQueueFamilies(const std::vector<vk::QueueFlags>& families_flags, uint32_t queues_count = 2U)
+{
+    std::vector<vk::QueueFamilyProperties> vk_queue_families;
+    for(const vk::QueueFlags& family_flags : families_flags)
+    {
+        vk::QueueFamilyProperties& vk_queue_family = vk_queue_families.emplace_back(family_flags, queues_count);
+        vk_queue_family.timestampValidBits = 64U;
+    }
+    return vk_queue_families;
+}
+
+static std::optional<uint32_t> FindQueueFamily(const std::vector<vk::QueueFamilyProperties>& vk_queue_families, vk::QueueFlags queue_flags,
+                                               uint32_t queues_count = 1U, std::vector<uint32_t> reserved_queues_count_per_family = {})
+{
+    reserved_queues_count_per_family.resize(vk_queue_families.size(), 0U);
+    return DeviceVK::FindQueueFamily(vk_queue_families, queue_flags, queues_count, reserved_queues_count_per_family);
+}
+
+TEST_CASE("Vulkan compute queue family selection", "[vulkan][queue-family]")
+{
+    SECTION("Async compute family with transfer flag is preferred over graphics family")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags, g_transfer_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute) == 1U);
+    }
+
+    SECTION("Async compute family with sparse binding flag is preferred over graphics family")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags | vk::QueueFlagBits::eSparseBinding });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute) == 1U);
+    }
+
+    SECTION("Compute-only family is preferred over async compute family with transfer flag")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags, vk::QueueFlagBits::eCompute });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute) == 2U);
+    }
+
+    SECTION("Graphics family is selected when there is no async compute family")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_transfer_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute) == 0U);
+    }
+
+    SECTION("Graphics family is selected when async compute family queues are all reserved")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute, 1U, { 0U, 2U }) == 0U);
+    }
+
+    SECTION("No family is selected when compute is not supported")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ vk::QueueFlagBits::eGraphics, g_transfer_family_flags });
+        CHECK_FALSE(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eCompute).has_value());
+    }
+}
+
+TEST_CASE("Vulkan graphics queue family selection", "[vulkan][queue-family]")
+{
+    const auto vk_queue_families = CreateQueueFamilies({ g_compute_family_flags, g_graphics_family_flags, g_transfer_family_flags });
+    CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eGraphics) == 1U);
+}
+
+TEST_CASE("Vulkan transfer queue family selection", "[vulkan][queue-family]")
+{
+    SECTION("Transfer family with sparse binding flag is preferred over graphics and async compute families")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags, g_transfer_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer) == 2U);
+    }
+
+    SECTION("Transfer-only family is preferred over transfer family with sparse binding flag")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_transfer_family_flags, vk::QueueFlagBits::eTransfer });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer) == 2U);
+    }
+
+    SECTION("Transfer family with protected flag is selected as dedicated family")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, vk::QueueFlagBits::eTransfer | vk::QueueFlagBits::eProtected });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer) == 1U);
+    }
+
+    SECTION("Another queue of graphics family is selected when there is no dedicated transfer family")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer, 1U, { 1U, 0U }) == 0U);
+    }
+
+    SECTION("Another queue of graphics family is selected when dedicated transfer family queues are all reserved")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_transfer_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer, 1U, { 1U, 2U }) == 0U);
+    }
+
+    SECTION("Async compute family is selected when graphics family queues are all reserved")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_compute_family_flags });
+        CHECK(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer, 1U, { 2U, 0U }) == 1U);
+    }
+
+    SECTION("No family is selected when queues of all transfer capable families are reserved")
+    {
+        const auto vk_queue_families = CreateQueueFamilies({ g_graphics_family_flags, g_transfer_family_flags });
+        CHECK_FALSE(FindQueueFamily(vk_queue_families, vk::QueueFlagBits::eTransfer, 1U, { 2U, 2U }).has_value());
+    }
+}
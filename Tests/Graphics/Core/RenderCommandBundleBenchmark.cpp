@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/RenderCommandBundleBenchmark.cpp
+Benchmark per-frame CPU time of many static draws encoded directly and executed from the command bundle on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_draws_per_frame = 10000U;
+static constexpr uint32_t g_frames_per_run  = 8U;
+
+enum class DrawEncoding
+{
+    Direct,
+    Bundle
+};
+
+static void EncodeStaticDraws(HeadlessRenderFixture& fixture, RenderState& render_state, RenderCommandList& render_cmd_list)
+{
+    render_cmd_list.SetRenderState(render_state);
+    render_cmd_list.SetViewState(fixture.GetViewState());
+    for(uint32_t draw_index = 0U; draw_index < g_draws_per_frame; ++draw_index)
+    {
+        render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, 3U, (draw_index % 4U) * 3U);
+    }
+}
+
+// Renders frames with many small static draws of grid triangles, which are either encoded in every frame
+// or encoded once to the command bundle executed in every frame
+static uint32_t MeasureStaticDraws(DrawEncoding draw_encoding, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    context.CompleteInitialization();
+
+    Ptr<RenderCommandList> bundle_ptr;
+    if (draw_encoding == DrawEncoding::Bundle)
+    {
+        bundle_ptr = RenderCommandList::CreateBundle(fixture.GetRenderCommandQueue(), *fixture.GetFrame(0U).screen_pass_ptr);
+        bundle_ptr->SetName("Benchmark Static Draws Bundle");
+        bundle_ptr->Reset();
+        EncodeStaticDraws(fixture, *render_state_ptr, *bundle_ptr);
+        bundle_ptr->Commit();
+    }
+
+    const HeadlessRenderFixture::EncodeCommands encode_draws = [&](RenderCommandList& render_cmd_list)
+    {
+        if (bundle_ptr)
+            render_cmd_list.ExecuteBundle(*bundle_ptr);
+        else
+            EncodeStaticDraws(fixture, *render_state_ptr, render_cmd_list);
+    };
+
+    uint32_t rendered_frames_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t frame_index = 0U; frame_index < g_frames_per_run; ++frame_index)
+        {
+            fixture.RenderFrame(encode_draws);
+            rendered_frames_count++;
+        }
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(rendered_frames_count == g_frames_per_run * meter.runs());
+    return rendered_frames_count;
+}
+
+TEST_CASE("Benchmark static draws with command bundles", "[.][gpu][render-command-list][benchmark]")
+{
+    BENCHMARK_ADVANCED("10000 static draws encoded in every frame")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStaticDraws(DrawEncoding::Direct, meter);
+    };
+
+    BENCHMARK_ADVANCED("10000 static draws executed from command bundle")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStaticDraws(DrawEncoding::Bundle, meter);
+    };
+}
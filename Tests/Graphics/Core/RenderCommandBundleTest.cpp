@@ -0,0 +1,143 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/RenderCommandBundleTest.cpp
+GPU tests comparing frames rendered with command bundles and with equivalent direct draws on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using DrawArguments = RenderCommandList::DrawArguments;
+
+// Grid triangles are selected by vertex ranges in rows and by instance ranges in columns
+static const std::vector<DrawArguments> g_draw_arguments{
+    { 3U, 4U, 0U, 0U },
+    { 6U, 2U, 3U, 0U },
+    { 3U, 1U, 9U, 0U },
+};
+
+static void EncodeGridDraws(HeadlessRenderFixture& fixture, RenderCommandList& render_cmd_list)
+{
+    render_cmd_list.SetViewState(fixture.GetViewState());
+    for(const DrawArguments& args : g_draw_arguments)
+    {
+        render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, args.vertex_count, args.start_vertex,
+                             args.instance_count, args.start_instance);
+    }
+}
+
+static Data::Bytes RenderAndReadBackFrame(HeadlessRenderFixture& fixture, const HeadlessRenderFixture::EncodeCommands& encode_commands)
+{
+    const SubResource frame_data = fixture.ReadFrameBuffer(fixture.RenderFrame(encode_commands));
+    return Data::Bytes(frame_data.GetDataPtr(), frame_data.GetDataEndPtr());
+}
+
+TEST_CASE("Command bundles render the same frames as direct draws", "[.][gpu][render-command-list]")
+{
+    HeadlessRenderFixture fixture;
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    fixture.GetRenderContext().CompleteInitialization();
+
+    const Data::Bytes direct_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        EncodeGridDraws(fixture, render_cmd_list);
+    });
+    CHECK(HeadlessRenderFixture::CountPixelsNotEqual(SubResource(direct_frame_data.data(), static_cast<Data::Size>(direct_frame_data.size())),
+                                                     HeadlessRenderFixture::Pixel{ 0U, 255U, 0U, 255U }) > 0U);
+
+    // Bundle is encoded once with the render pass of the first frame and executed in render passes of all frames
+    const Ptr<RenderCommandList> bundle_ptr = RenderCommandList::CreateBundle(fixture.GetRenderCommandQueue(), *fixture.GetFrame(0U).screen_pass_ptr);
+    bundle_ptr->SetName("Grid Triangles Bundle");
+    REQUIRE(bundle_ptr->IsBundle());
+    bundle_ptr->ResetWithState(*render_state_ptr);
+    EncodeGridDraws(fixture, *bundle_ptr);
+    bundle_ptr->Commit();
+
+    const uint32_t frame_buffers_count = fixture.GetRenderContext().GetSettings().frame_buffers_count;
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        const Data::Bytes bundle_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+        {
+            render_cmd_list.ExecuteBundle(*bundle_ptr);
+        });
+        CHECK(bundle_frame_data == direct_frame_data);
+    }
+}
+
+TEST_CASE("Command bundle is encoded again while frame executing it is in flight", "[.][gpu][render-command-list]")
+{
+    HeadlessRenderFixture fixture;
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    fixture.GetRenderContext().CompleteInitialization();
+
+    const DrawArguments& first_draw_args = g_draw_arguments.front();
+    const auto encode_first_grid_draw = [&first_draw_args](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, first_draw_args.vertex_count, first_draw_args.start_vertex,
+                             first_draw_args.instance_count, first_draw_args.start_instance);
+    };
+
+    const Data::Bytes all_draws_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        EncodeGridDraws(fixture, render_cmd_list);
+    });
+    const Data::Bytes first_draw_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        render_cmd_list.SetViewState(fixture.GetViewState());
+        encode_first_grid_draw(render_cmd_list);
+    });
+    REQUIRE(all_draws_frame_data != first_draw_frame_data);
+
+    const Ptr<RenderCommandList> bundle_ptr = RenderCommandList::CreateBundle(fixture.GetRenderCommandQueue(), *fixture.GetFrame(0U).screen_pass_ptr);
+    bundle_ptr->SetName("Grid Triangles Bundle");
+    bundle_ptr->ResetWithState(*render_state_ptr);
+    EncodeGridDraws(fixture, *bundle_ptr);
+    bundle_ptr->Commit();
+
+    // Frame executing the bundle is not waited for, so the bundle is reset while the frame may still be executed on GPU
+    const uint32_t all_draws_frame_buffer_index = fixture.RenderFrame([&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.ExecuteBundle(*bundle_ptr);
+    });
+
+    bundle_ptr->ResetWithState(*render_state_ptr);
+    bundle_ptr->SetViewState(fixture.GetViewState());
+    encode_first_grid_draw(*bundle_ptr);
+    bundle_ptr->Commit();
+
+    const Data::Bytes updated_bundle_frame_data = RenderAndReadBackFrame(fixture, [&](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.ExecuteBundle(*bundle_ptr);
+    });
+    CHECK(updated_bundle_frame_data == first_draw_frame_data);
+
+    // Frame rendered before encoding the bundle again has all draws of the original bundle
+    const SubResource in_flight_frame_data = fixture.ReadFrameBuffer(all_draws_frame_buffer_index);
+    CHECK(Data::Bytes(in_flight_frame_data.GetDataPtr(), in_flight_frame_data.GetDataEndPtr()) == all_draws_frame_data);
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/RenderPassResizeBenchmark.cpp
+Benchmark frame buffers resize with Vulkan render pass objects and with dynamic rendering on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static const std::array<FrameSize, 2> g_frame_sizes{ FrameSize(64U, 64U), FrameSize(96U, 48U) };
+static constexpr uint32_t g_resizes_per_run = 8U;
+
+// Resizes render context with all frame buffers and screen render passes and renders one frame after every resize,
+// so that native render pass and frame buffer objects recreation can be compared with dynamic rendering info updates
+static uint32_t MeasureRenderPassResize(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+
+    uint32_t resizes_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t resize_index = 0U; resize_index < g_resizes_per_run; ++resize_index)
+        {
+            fixture.Resize(g_frame_sizes[++resizes_count % g_frame_sizes.size()]);
+            fixture.RenderFrame();
+        }
+        fixture.GetRenderContext().WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(resizes_count == g_resizes_per_run * meter.runs());
+    return resizes_count;
+}
+
+TEST_CASE("Benchmark render pass resize", "[.][gpu][render-pass][benchmark]")
+{
+    BENCHMARK_ADVANCED("Resize with render pass and frame buffer objects")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRenderPassResize(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("Resize with dynamic rendering")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRenderPassResize(Context::Options::DynamicRenderingOnVulkan, meter);
+    };
+}
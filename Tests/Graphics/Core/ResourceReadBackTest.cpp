@@ -0,0 +1,135 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ResourceReadBackTest.cpp
+GPU tests of asynchronous buffer and texture data read-back on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <magic_enum.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Data::Size g_buffer_size = 512U;
+static constexpr Depth      g_clear_depth = 0.25F;
+
+// Counts 32-bit float depth values in read-back data which are not equal to the expected depth
+static size_t CountDepthValuesNotEqual(const SubResource& depth_data, Depth expected_depth)
+{
+    size_t mismatched_values_count = 0U;
+    for(Data::Size value_offset = 0U; value_offset + sizeof(Depth) <= depth_data.GetDataSize(); value_offset += sizeof(Depth))
+    {
+        Depth depth_value = 0.F;
+        std::memcpy(&depth_value, depth_data.GetDataPtr() + value_offset, sizeof(Depth));
+        if (depth_value != expected_depth)
+            mismatched_values_count++;
+    }
+    return mismatched_values_count;
+}
+
+TEST_CASE("Buffer data is read back asynchronously", "[.][gpu][read-back]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+
+    Data::Bytes buffer_data(g_buffer_size);
+    for(Data::Size byte_index = 0U; byte_index < g_buffer_size; ++byte_index)
+    {
+        buffer_data[byte_index] = static_cast<Data::Byte>(byte_index % 251U);
+    }
+
+    const Ptr<Buffer> buffer_ptr = Buffer::CreateReadBackBuffer(context, g_buffer_size);
+    buffer_ptr->SetData({ { buffer_data.data(), g_buffer_size } }, render_cmd_queue);
+
+    SECTION("Whole buffer data is read back")
+    {
+        const SubResource read_data = HeadlessRenderFixture::WaitForData(buffer_ptr->ReadDataAsync(render_cmd_queue));
+        REQUIRE(read_data.GetDataSize() == g_buffer_size);
+        CHECK(std::equal(buffer_data.begin(), buffer_data.end(), read_data.GetDataPtr()));
+    }
+
+    SECTION("Buffer data range is read back")
+    {
+        const BytesRange data_range(128U, 320U);
+        const SubResource read_data = HeadlessRenderFixture::WaitForData(buffer_ptr->ReadDataAsync(render_cmd_queue, {}, data_range));
+        REQUIRE(read_data.GetDataSize() == data_range.GetLength());
+        CHECK(std::equal(buffer_data.begin() + data_range.GetStart(), buffer_data.begin() + data_range.GetEnd(), read_data.GetDataPtr()));
+    }
+}
+
+TEST_CASE("Depth buffer is read back after render pass", "[.][gpu][read-back]")
+{
+    using namespace magic_enum::bitwise_operators;
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings()
+                                      .SetDepthStencilFormat(PixelFormat::Depth32Float)
+                                      .SetClearDepthStencil(DepthStencil(g_clear_depth, 0U)));
+    RenderContext& context = fixture.GetRenderContext();
+    const RenderContext::Settings& context_settings = context.GetSettings();
+
+    // Depth buffer is cleared and stored by the render pass and then copied to the read-back buffer
+    const Ptr<Texture> depth_texture_ptr = Texture::CreateRenderTarget(context,
+        Texture::Settings::DepthStencilBuffer(Dimensions(context_settings.frame_size), context_settings.depth_stencil_format,
+                                              Resource::Usage::RenderTarget | Resource::Usage::ReadBack));
+    depth_texture_ptr->SetName("Read-Back Depth Buffer");
+
+    const Ptr<RenderPattern> render_pattern_ptr = RenderPattern::Create(context, {
+        RenderPattern::ColorAttachments
+        {
+            RenderPattern::ColorAttachment(
+                0U, context_settings.color_format, 1U,
+                RenderPass::Attachment::LoadAction::Clear,
+                RenderPass::Attachment::StoreAction::Store,
+                *context_settings.clear_color)
+        },
+        RenderPattern::DepthAttachment(
+            1U, context_settings.depth_stencil_format, 1U,
+            RenderPass::Attachment::LoadAction::Clear,
+            RenderPass::Attachment::StoreAction::Store,
+            g_clear_depth),
+        std::nullopt, // No stencil attachment
+        RenderPass::Access::None,
+        false // intermediate render pass
+    });
+    render_pattern_ptr->SetName("Depth Read-Back Render Pattern");
+
+    HeadlessRenderFixture::Frame& frame = fixture.GetCurrentFrame();
+    const Ptr<RenderPass> render_pass_ptr = RenderPass::Create(*render_pattern_ptr, {
+        { Texture::View(*frame.screen_texture_ptr), Texture::View(*depth_texture_ptr) },
+        context_settings.frame_size
+    });
+    CommandQueue& render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<RenderCommandList> render_cmd_list_ptr = RenderCommandList::Create(render_cmd_queue, *render_pass_ptr);
+    render_cmd_list_ptr->SetName("Depth Read-Back Render");
+    render_cmd_list_ptr->Reset();
+    render_cmd_list_ptr->Commit();
+
+    const Ptr<CommandListSet> execute_cmd_list_set_ptr = CommandListSet::Create({ *render_cmd_list_ptr });
+    render_cmd_queue.Execute(*execute_cmd_list_set_ptr);
+
+    const SubResource depth_data = HeadlessRenderFixture::WaitForData(depth_texture_ptr->ReadDataAsync(render_cmd_queue));
+    REQUIRE(depth_data.GetDataSize() == context_settings.frame_size.GetPixelsCount() * sizeof(Depth));
+    CHECK(CountDepthValuesNotEqual(depth_data, g_clear_depth) == 0U);
+}
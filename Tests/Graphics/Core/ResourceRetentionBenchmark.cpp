@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ResourceRetentionBenchmark.cpp
+Benchmark multi-threaded encoding of draws with resource retention per use and per epoch on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/ParallelRenderCommandList.h>
+#include <Methane/Graphics/ParallelRenderScheduler.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t g_encode_threads_count = 4U;
+static constexpr uint32_t g_draws_per_thread     = 2048U;
+static constexpr uint32_t g_frames_per_run       = 4U;
+static const std::array<uint32_t, 12> g_indices{ 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U };
+
+// Encodes draws on several threads with index buffers switched on every draw, so that resources are retained on every draw
+// with the default retention and only once per epoch with the EpochResourceRetention context option.
+// Command lists, scheduler and worker threads of the context parallel executor are set up before measurement.
+static uint32_t MeasureParallelDrawsEncoding(Context::Options context_options, Catch::Benchmark::Chronometer meter)
+{
+    HeadlessRenderFixture fixture(HeadlessRenderFixture::GetDefaultContextSettings().SetOptionsMask(context_options));
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    const uint32_t frame_buffers_count = context.GetSettings().frame_buffers_count;
+
+    const auto indices_size = static_cast<Data::Size>(g_indices.size() * sizeof(uint32_t));
+    std::array<Ptr<Buffer>, 2> index_buffers;
+    for(size_t buffer_index = 0U; buffer_index < index_buffers.size(); ++buffer_index)
+    {
+        index_buffers[buffer_index] = Buffer::CreateIndexBuffer(context, indices_size, PixelFormat::R32Uint);
+        index_buffers[buffer_index]->SetName(fmt::format("Benchmark Index Buffer {}", buffer_index));
+        index_buffers[buffer_index]->SetData({ { reinterpret_cast<Data::ConstRawPtr>(g_indices.data()), indices_size } }, // NOSONAR
+                                             render_cmd_queue);
+    }
+    context.CompleteInitialization();
+
+    // Parallel command lists are created per frame buffer to let them execute while next frames are encoded
+    Ptrs<ParallelRenderCommandList> parallel_cmd_lists;
+    Ptrs<CommandListSet>            execute_cmd_list_sets;
+    for(uint32_t frame_index = 0U; frame_index < frame_buffers_count; ++frame_index)
+    {
+        const Ptr<ParallelRenderCommandList>& parallel_cmd_list_ptr = parallel_cmd_lists.emplace_back(
+            ParallelRenderCommandList::Create(render_cmd_queue, *fixture.GetFrame(frame_index).screen_pass_ptr));
+        parallel_cmd_list_ptr->SetName(fmt::format("Benchmark Parallel Render {}", frame_index));
+        parallel_cmd_list_ptr->SetParallelCommandListsCount(g_encode_threads_count);
+        parallel_cmd_list_ptr->SetValidationEnabled(false);
+        execute_cmd_list_sets.emplace_back(CommandListSet::Create({ *parallel_cmd_list_ptr }, frame_index));
+    }
+
+    ParallelRenderScheduler::Settings scheduler_settings;
+    scheduler_settings.max_command_lists_count = g_encode_threads_count;
+    scheduler_settings.auto_tuning_enabled     = false;
+    ParallelRenderScheduler scheduler(scheduler_settings, g_encode_threads_count);
+    scheduler.SetItemsCount(g_encode_threads_count * g_draws_per_thread);
+
+    tf::Executor& parallel_executor = context.GetParallelExecutor();
+    const ParallelRenderScheduler::EncodeFunction encode_draws =
+        [&index_buffers](RenderCommandList& render_cmd_list, const ParallelRenderScheduler::ItemsRange& items_range)
+        {
+            for(Data::Index draw_index = items_range.GetStart(); draw_index < items_range.GetEnd(); ++draw_index)
+            {
+                render_cmd_list.SetIndexBuffer(*index_buffers[draw_index % index_buffers.size()]);
+                render_cmd_list.DrawIndexed(RenderCommandList::Primitive::Triangle, 3U, (draw_index % 4U) * 3U);
+            }
+        };
+
+    uint32_t rendered_frames_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t frame_index = 0U; frame_index < g_frames_per_run; ++frame_index)
+        {
+            const uint32_t frame_buffer_index = context.GetFrameBufferIndex();
+            ParallelRenderCommandList& parallel_cmd_list = *parallel_cmd_lists[frame_buffer_index];
+            parallel_cmd_list.ResetWithState(*render_state_ptr);
+            parallel_cmd_list.SetViewState(fixture.GetViewState());
+            scheduler.Encode(parallel_cmd_list, parallel_executor, encode_draws);
+            parallel_cmd_list.Commit();
+            render_cmd_queue.Execute(*execute_cmd_list_sets[frame_buffer_index]);
+            context.Present();
+            rendered_frames_count++;
+        }
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(rendered_frames_count == g_frames_per_run * meter.runs());
+    return rendered_frames_count;
+}
+
+TEST_CASE("Benchmark resource retention in parallel draws encoding", "[.][gpu][render-command-list][multi-threading][benchmark]")
+{
+    BENCHMARK_ADVANCED("4 threads encoding 2048 draws each with resources retained per use")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelDrawsEncoding(Context::Options::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("4 threads encoding 2048 draws each with resources retained per epoch")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureParallelDrawsEncoding(Context::Options::EpochResourceRetention, meter);
+    };
+}
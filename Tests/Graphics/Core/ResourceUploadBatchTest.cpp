@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/ResourceUploadBatchTest.cpp
+Unit tests of the resource upload batch checking merge of the repeated sub-resource updates
+
+******************************************************************************/
+
+#include <Methane/Graphics/ResourceUploadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <exception>
+#include <memory>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+// Resource stub, which is only used as an upload destination, so that the batch can be tested without GPU device
+class FakeResource final
+    : public Resource
+    , public std::enable_shared_from_this<FakeResource>
+{
+public:
+    explicit FakeResource(Type type) : m_type(type) { }
+
+    // Object interface
+    bool SetName(const std::string& name) override           { m_name = name; return true; }
+    const std::string& GetName() const noexcept override     { return m_name; }
+    Ptr<Object>        GetPtr() override                     { return shared_from_this(); }
+
+    // Resource interface
+    bool SetState(State) override                                           { return false; }
+    bool SetState(State, Ptr<Barriers>&) override                           { return false; }
+    bool SetOwnerQueueFamily(uint32_t) override                             { return false; }
+    bool SetOwnerQueueFamily(uint32_t, Ptr<Barriers>&) override             { return false; }
+    void SetData(const SubResources&, CommandQueue&) override               { }
+    void RestoreDescriptorViews(const DescriptorByViewId&) override         { }
+    SubResource    GetData(const SubResource::Index&, const BytesRangeOpt&) override                      { return {}; }
+    ReadDataFuture ReadDataAsync(CommandQueue&, const SubResource::Index&, const BytesRangeOpt&) override { return {}; }
+    Data::Size                GetDataSize(Data::MemoryState) const noexcept override       { return 0U; }
+    Data::Size                GetSubResourceDataSize(const SubResource::Index&) const override { return 0U; }
+    const SubResource::Count& GetSubresourceCount() const noexcept override                { return m_sub_resource_count; }
+    Type                      GetResourceType() const noexcept override                    { return m_type; }
+    State                     GetState() const noexcept override                           { return State::Undefined; }
+    Usage                     GetUsage() const noexcept override                           { return Usage::None; }
+    const DescriptorByViewId& GetDescriptorByViewId() const noexcept override              { return m_descriptor_by_view_id; }
+    const Context&            GetContext() const noexcept override                         { std::terminate(); } // context is not used by upload batch
+    const Opt<uint32_t>&      GetOwnerQueueFamily() const noexcept override                { return m_owner_queue_family; }
+
+    // IEmitter interfaces
+    void Connect(Data::Receiver<IObjectCallback>&) override      { }
+    void Disconnect(Data::Receiver<IObjectCallback>&) override   { }
+    void Connect(Data::Receiver<IResourceCallback>&) override    { }
+    void Disconnect(Data::Receiver<IResourceCallback>&) override { }
+
+private:
+    const Type         m_type;
+    std::string        m_name;
+    SubResource::Count m_sub_resource_count;
+    DescriptorByViewId m_descriptor_by_view_id;
+    Opt<uint32_t>      m_owner_queue_family;
+};
+
+static SubResource CreateSubResource(uint8_t value, Data::Size size, const SubResource::Index& index = {}, const BytesRangeOpt& data_range = {})
+{
+    return SubResource(Data::Bytes(size, static_cast<std::byte>(value)), index, data_range);
+}
+
+TEST_CASE("Resource upload batch merge of the sub-resource updates", "[resource][upload]")
+{
+    const auto buffer_ptr  = std::make_shared<FakeResource>(Resource::Type::Buffer);
+    const auto texture_ptr = std::make_shared<FakeResource>(Resource::Type::Texture);
+    ResourceUploadBatch upload_batch;
+
+    SECTION("Duplicate full updates of the resource are collapsed to the latest one")
+    {
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(1U, 256U) });
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(2U, 256U) });
+        CHECK(upload_batch.GetDataSize() == 512U);
+
+        const ResourceUploadBatch::ResourceUploads& uploads = upload_batch.SortByDestination();
+        REQUIRE(uploads.size() == 1U);
+        REQUIRE(uploads[0].sub_resources.size() == 1U);
+        CHECK(uploads[0].sub_resources[0].GetDataSize() == 256U);
+        CHECK(uploads[0].sub_resources[0].GetDataPtr()[0] == static_cast<std::byte>(2U));
+    }
+
+    SECTION("Full update supersedes previous data range updates of the same sub-resource")
+    {
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(1U, 64U, {}, BytesRange(0U, 64U)) });
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(2U, 256U) });
+
+        const ResourceUploadBatch::ResourceUploads& uploads = upload_batch.SortByDestination();
+        REQUIRE(uploads.size() == 1U);
+        REQUIRE(uploads[0].sub_resources.size() == 1U);
+        CHECK_FALSE(uploads[0].sub_resources[0].HasDataRange());
+    }
+
+    SECTION("Disjoint data range updates of the same sub-resource are kept")
+    {
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(1U, 64U, {}, BytesRange(0U, 64U)) });
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(2U, 64U, {}, BytesRange(64U, 128U)) });
+        upload_batch.Add(*buffer_ptr, { CreateSubResource(3U, 64U, {}, BytesRange(0U, 64U)) });
+
+        const ResourceUploadBatch::ResourceUploads& uploads = upload_batch.SortByDestination();
+        REQUIRE(uploads.size() == 1U);
+        REQUIRE(uploads[0].sub_resources.size() == 2U);
+        CHECK(uploads[0].sub_resources[0].GetDataRange() == BytesRange(64U, 128U));
+        CHECK(uploads[0].sub_resources[1].GetDataRange() == BytesRange(0U, 64U));
+        CHECK(uploads[0].sub_resources[1].GetDataPtr()[0] == static_cast<std::byte>(3U));
+    }
+
+    SECTION("Updates of different sub-resources are kept")
+    {
+        upload_batch.Add(*texture_ptr, { CreateSubResource(1U, 16U, SubResource::Index(0U, 0U, 0U)) });
+        upload_batch.Add(*texture_ptr, { CreateSubResource(2U, 4U,  SubResource::Index(0U, 0U, 1U)) });
+
+        const ResourceUploadBatch::ResourceUploads& uploads = upload_batch.SortByDestination();
+        REQUIRE(uploads.size() == 1U);
+        CHECK(uploads[0].sub_resources.size() == 2U);
+    }
+
+    SECTION("Uploads are sorted by destination resource type")
+    {
+        upload_batch.Add(*texture_ptr, { CreateSubResource(1U, 16U) });
+        upload_batch.Add(*buffer_ptr,  { CreateSubResource(2U, 16U) });
+
+        const ResourceUploadBatch::ResourceUploads& uploads = upload_batch.SortByDestination();
+        REQUIRE(uploads.size() == 2U);
+        CHECK(uploads[0].resource_ptr == buffer_ptr);
+        CHECK(uploads[1].resource_ptr == texture_ptr);
+    }
+}
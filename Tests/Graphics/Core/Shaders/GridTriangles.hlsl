@@ -0,0 +1,54 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/Shaders/GridTriangles.hlsl
+Shaders of colored triangles placed in the screen grid cells by vertex and instance identifiers, used by GPU tests without vertex buffers
+
+******************************************************************************/
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float4 color    : COLOR;
+};
+
+static const uint g_grid_size = 4;
+
+// Every 3 vertices make a triangle in the grid row selected by vertex identifier and in the grid column selected by instance identifier
+PSInput GridTriangleVS(uint vertex_id : SV_VertexID, uint instance_id : SV_InstanceID)
+{
+    const float2 corners[3] = {
+        { 0.F, 0.F },
+        { 1.F, 0.F },
+        { 0.F, 1.F },
+    };
+
+    const uint   cell_row    = (vertex_id / 3) % g_grid_size;
+    const uint   cell_column = instance_id % g_grid_size;
+    const float2 grid_pos    = (float2(cell_column, cell_row) + corners[vertex_id % 3]) / g_grid_size;
+
+    PSInput output;
+    output.position = float4(grid_pos.x * 2.F - 1.F, 1.F - grid_pos.y * 2.F, 0.F, 1.F);
+    output.color    = float4(float(cell_column + 1) / g_grid_size, float(cell_row + 1) / g_grid_size, 0.5F, 1.F);
+    return output;
+}
+
+float4 GridTrianglePS(PSInput input) : SV_TARGET
+{
+    return input.color;
+}
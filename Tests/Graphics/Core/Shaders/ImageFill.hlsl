@@ -0,0 +1,33 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/Shaders/ImageFill.hlsl
+Compute shader filling storage image with pixel coordinates
+
+******************************************************************************/
+
+// Storage image format is declared for Vulkan, so that it can be written without shaderStorageImageWriteWithoutFormat device feature
+[[vk::image_format("rgba8")]]
+RWTexture2D<float4> g_image : register(u0);
+
+// Every thread writes its pixel coordinates to red and green channels of the storage image
+[numthreads(8, 8, 1)]
+void FillCS(uint3 dispatch_thread_id : SV_DispatchThreadID)
+{
+    g_image[dispatch_thread_id.xy] = float4(dispatch_thread_id.x / 255.0, dispatch_thread_id.y / 255.0, 0.0, 1.0);
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/Shaders/Reduction.hlsl
+Compute shader summing input values in thread groups with parallel reduction in group shared memory
+
+******************************************************************************/
+
+#define GROUP_SIZE 64
+
+StructuredBuffer<uint>   g_input  : register(t0);
+RWStructuredBuffer<uint> g_output : register(u0);
+
+groupshared uint g_partial_sums[GROUP_SIZE];
+
+// Every thread group writes the sum of its GROUP_SIZE input values to the output element with the group index
+[numthreads(GROUP_SIZE, 1, 1)]
+void SumCS(uint3 group_id : SV_GroupID, uint3 dispatch_thread_id : SV_DispatchThreadID, uint thread_index : SV_GroupIndex)
+{
+    g_partial_sums[thread_index] = g_input[dispatch_thread_id.x];
+    GroupMemoryBarrierWithGroupSync();
+
+    for(uint stride = GROUP_SIZE / 2; stride > 0; stride >>= 1)
+    {
+        if (thread_index < stride)
+        {
+            g_partial_sums[thread_index] += g_partial_sums[thread_index + stride];
+        }
+        GroupMemoryBarrierWithGroupSync();
+    }
+
+    if (thread_index == 0)
+    {
+        g_output[group_id.x] = g_partial_sums[0];
+    }
+}
@@ -0,0 +1,123 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/StreamingFrameTimeBenchmark.cpp
+Benchmark frame time while texture data is streamed every frame on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/ResourceUploadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static const     Dimensions g_streamed_texture_dimensions(256U, 256U);
+static constexpr Data::Size g_streamed_texture_data_size = 256U * 256U * 4U;
+static constexpr uint32_t   g_streamed_textures_count    = 8U; // 2 MB of texture data is streamed every frame
+static constexpr uint32_t   g_frames_per_run             = 8U;
+
+enum class Streaming
+{
+    None,
+    UploadBatch, // render queue waits for upload completion on GPU
+    CpuFlush     // CPU waits for upload completion before rendering
+};
+
+// Renders frames with grid triangles, while texture data is streamed every frame with the given uploads synchronization
+static uint32_t MeasureFrameTimeUnderStreaming(HeadlessRenderFixture& fixture, Streaming streaming, Catch::Benchmark::Chronometer meter)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Ptr<RenderState> render_state_ptr = fixture.CreateRenderState("GridTriangles", "GridTriangleVS", "GridTrianglePS");
+    const Data::Bytes texture_data(g_streamed_texture_data_size, Data::Byte{ 0x96 });
+
+    Ptrs<Texture> streamed_textures;
+    for(uint32_t texture_index = 0U; texture_index < g_streamed_textures_count; ++texture_index)
+    {
+        const Ptr<Texture>& texture_ptr = streamed_textures.emplace_back(
+            Texture::CreateImage(context, g_streamed_texture_dimensions, std::nullopt, PixelFormat::RGBA8Unorm, false));
+        texture_ptr->SetName(fmt::format("Streamed Texture {}", texture_index));
+    }
+    context.CompleteInitialization();
+
+    const HeadlessRenderFixture::EncodeCommands encode_grid_draws = [&render_state_ptr, &fixture](RenderCommandList& render_cmd_list)
+    {
+        render_cmd_list.SetRenderState(*render_state_ptr);
+        render_cmd_list.SetViewState(fixture.GetViewState());
+        render_cmd_list.Draw(RenderCommandList::Primitive::Triangle, 12U, 0U, 0U, 4U);
+    };
+
+    ResourceUploadBatch upload_batch;
+    uint32_t rendered_frames_count = 0U;
+    meter.measure([&]()
+    {
+        for(uint32_t frame_index = 0U; frame_index < g_frames_per_run; ++frame_index)
+        {
+            switch(streaming)
+            {
+            case Streaming::None:
+                break;
+
+            case Streaming::UploadBatch:
+                for(const Ptr<Texture>& texture_ptr : streamed_textures)
+                    upload_batch.Add(*texture_ptr, { { texture_data.data(), g_streamed_texture_data_size } });
+                context.SubmitUploadBatch(upload_batch, render_cmd_queue);
+                break;
+
+            case Streaming::CpuFlush:
+                for(const Ptr<Texture>& texture_ptr : streamed_textures)
+                    texture_ptr->SetData({ { texture_data.data(), g_streamed_texture_data_size } }, render_cmd_queue);
+                context.WaitForGpu(Context::WaitFor::ResourcesUploaded);
+                break;
+            }
+
+            fixture.RenderFrame(encode_grid_draws);
+            rendered_frames_count++;
+        }
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(rendered_frames_count == g_frames_per_run * meter.runs());
+    return rendered_frames_count;
+}
+
+TEST_CASE("Benchmark frame time under texture streaming", "[.][gpu][upload][benchmark]")
+{
+    HeadlessRenderFixture fixture;
+
+    BENCHMARK_ADVANCED("8 frames without streaming")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureFrameTimeUnderStreaming(fixture, Streaming::None, meter);
+    };
+
+    BENCHMARK_ADVANCED("8 frames streaming 2 MB per frame with GPU wait for uploads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureFrameTimeUnderStreaming(fixture, Streaming::UploadBatch, meter);
+    };
+
+    BENCHMARK_ADVANCED("8 frames streaming 2 MB per frame with CPU wait for uploads")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureFrameTimeUnderStreaming(fixture, Streaming::CpuFlush, meter);
+    };
+}
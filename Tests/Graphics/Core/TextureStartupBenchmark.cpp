@@ -0,0 +1,89 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/TextureStartupBenchmark.cpp
+Benchmark startup load of textures with data set per texture and with resource upload batch on the headless render context
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/ResourceUploadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr uint32_t   g_startup_textures_count = 1000U;
+static const     Dimensions g_texture_dimensions(64U, 64U);
+static constexpr Data::Size g_texture_data_size      = 64U * 64U * 4U;
+
+// Creates image textures with initial data and renders the first frame, like on application startup,
+// with texture data either set one by one and uploaded on context initialization completion, or submitted in upload batch
+// which is waited by render queue on GPU without CPU flush
+static size_t MeasureStartupTexturesLoad(HeadlessRenderFixture& fixture, bool use_upload_batch, Catch::Benchmark::Chronometer meter)
+{
+    RenderContext& context = fixture.GetRenderContext();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const Data::Bytes texture_data(g_texture_data_size, Data::Byte{ 0x7E });
+
+    Ptrs<Texture> textures;
+    textures.reserve(g_startup_textures_count * meter.runs());
+    meter.measure([&]()
+    {
+        ResourceUploadBatch upload_batch;
+        for(uint32_t texture_index = 0U; texture_index < g_startup_textures_count; ++texture_index)
+        {
+            Ptr<Texture> texture_ptr = Texture::CreateImage(context, g_texture_dimensions, std::nullopt, PixelFormat::RGBA8Unorm, false);
+            if (use_upload_batch)
+                upload_batch.Add(*texture_ptr, { { texture_data.data(), g_texture_data_size } });
+            else
+                texture_ptr->SetData({ { texture_data.data(), g_texture_data_size } }, render_cmd_queue);
+            textures.emplace_back(std::move(texture_ptr));
+        }
+
+        if (use_upload_batch)
+            context.SubmitUploadBatch(upload_batch, render_cmd_queue);
+        else
+            context.CompleteInitialization();
+
+        fixture.RenderFrame();
+        context.WaitForGpu(Context::WaitFor::RenderComplete);
+    });
+
+    // Prevent code removal by optimizer
+    CHECK(textures.size() == g_startup_textures_count * meter.runs());
+    return textures.size();
+}
+
+TEST_CASE("Benchmark startup load of textures", "[.][gpu][texture][upload][benchmark]")
+{
+    HeadlessRenderFixture fixture;
+
+    BENCHMARK_ADVANCED("Startup load of 1000 textures of 16 KB with data set per texture")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStartupTexturesLoad(fixture, false, meter);
+    };
+
+    BENCHMARK_ADVANCED("Startup load of 1000 textures of 16 KB with upload batch")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureStartupTexturesLoad(fixture, true, meter);
+    };
+}
@@ -0,0 +1,81 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/TransferQueueVKTest.cpp
+GPU tests of the resources upload on the Vulkan transfer queue with render queue waiting for upload completion
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/Vulkan/DeviceVK.h>
+#include <Methane/Graphics/ResourceUploadBatch.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static const     Dimensions g_texture_dimensions(32U, 32U);
+static constexpr Data::Size g_texture_data_size = 32U * 32U * 4U;
+static constexpr uint32_t   g_streamed_frames_count = 6U;
+
+// Tests are hidden by default, because they require GPU device, for example software Vulkan device (lavapipe) to run with "[gpu]" tag filter
+TEST_CASE("Vulkan resources are uploaded on the transfer queue", "[.][gpu][vulkan][upload]")
+{
+    HeadlessRenderFixture fixture;
+    RenderContext& context          = fixture.GetRenderContext();
+    CommandQueue&  upload_cmd_queue = context.GetUploadCommandKit().GetQueue();
+    CommandQueue&  render_cmd_queue = fixture.GetRenderCommandQueue();
+    const auto&    device_vk        = dynamic_cast<const DeviceVK&>(fixture.GetDevice());
+
+    SECTION("Upload queue is created in the reserved blit queue family with transfer support")
+    {
+        // Lavapipe exposes a single queue family, so the upload queue falls back to the graphics family
+        const QueueFamilyReservationVK& blit_family_reservation = device_vk.GetQueueFamilyReservation(CommandList::Type::Blit);
+        const vk::QueueFlags upload_family_flags = device_vk.GetNativeQueueFamilyProperties(upload_cmd_queue.GetFamilyIndex()).queueFlags;
+        INFO("Upload queue family " << upload_cmd_queue.GetFamilyIndex() << ", render queue family " << render_cmd_queue.GetFamilyIndex()
+                                    << ", dedicated transfer family: " << !(upload_family_flags & vk::QueueFlagBits::eGraphics));
+        CHECK(upload_cmd_queue.GetCommandListType() == CommandList::Type::Blit);
+        CHECK(upload_cmd_queue.GetFamilyIndex() == blit_family_reservation.GetFamilyIndex());
+        CHECK(static_cast<bool>(upload_family_flags & vk::QueueFlagBits::eTransfer));
+    }
+
+    SECTION("Texture data streamed on the upload queue is read back on the render queue waiting for upload on GPU")
+    {
+        const Ptr<Texture> texture_ptr = Texture::CreateImage(context, g_texture_dimensions, std::nullopt, PixelFormat::RGBA8Unorm, false, true);
+        texture_ptr->SetName("Streamed Texture");
+        context.CompleteInitialization();
+
+        ResourceUploadBatch upload_batch;
+        for(uint32_t frame_index = 0U; frame_index < g_streamed_frames_count; ++frame_index)
+        {
+            // Texture data is changed every frame and uploaded while frames are rendered without CPU wait for upload completion
+            const Data::Bytes texture_data(g_texture_data_size, static_cast<Data::Byte>(frame_index + 1U));
+            upload_batch.Add(*texture_ptr, { { texture_data.data(), g_texture_data_size } });
+            context.SubmitUploadBatch(upload_batch, render_cmd_queue);
+            fixture.RenderFrame();
+
+            const SubResource read_data = HeadlessRenderFixture::WaitForData(texture_ptr->ReadDataAsync(render_cmd_queue));
+            REQUIRE(read_data.GetDataSize() == g_texture_data_size);
+            CHECK(std::equal(texture_data.begin(), texture_data.end(), read_data.GetDataPtr()));
+        }
+    }
+}
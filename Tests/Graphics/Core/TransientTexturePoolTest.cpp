@@ -0,0 +1,302 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Core/TransientTexturePoolTest.cpp
+Transient texture pool unit tests checking textures reuse, memory aliasing, idle textures release
+reporting peak memory of the tutorial passes and actual memory of textures allocated on GPU
+
+******************************************************************************/
+
+#include "HeadlessRenderFixture.hpp"
+
+#include <Methane/Graphics/TransientTexturePool.h>
+#include <Methane/Graphics/FrameGraph.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <magic_enum.hpp>
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace magic_enum::bitwise_operators;
+
+static const Texture::Settings g_shadow_map_settings = Texture::Settings::DepthStencilBuffer(Dimensions(1024U, 1024U), PixelFormat::Depth32Float,
+                                                                                             Texture::Usage::RenderTarget | Texture::Usage::ShaderRead);
+static const Texture::Settings g_scene_color_settings = Texture::Settings::Image(Dimensions(1280U, 720U), std::nullopt, PixelFormat::RGBA8Unorm, false,
+                                                                                 Texture::Usage::RenderTarget | Texture::Usage::ShaderRead);
+static const Texture::Settings g_blur_color_settings = Texture::Settings::Image(Dimensions(640U, 360U), std::nullopt, PixelFormat::RGBA8Unorm, false,
+                                                                                Texture::Usage::RenderTarget | Texture::Usage::ShaderRead);
+
+static constexpr Data::Size g_shadow_map_size  = 1024U * 1024U * 4U;
+static constexpr Data::Size g_scene_color_size = 1280U * 720U * 4U;
+static constexpr Data::Size g_blur_color_size  = 640U * 360U * 4U;
+static constexpr uint32_t   g_frames_count     = 3U;
+
+// Frame graph declared like in the shadow cube tutorial: shadow map is written in shadow pass and sampled in final pass,
+// with blur post-processing the final pass renders scene color, which is blurred horizontally, vertically and composed to screen
+static const FrameGraph::Schedule& CompileShadowCubeFrameGraph(FrameGraph& frame_graph, bool with_blur)
+{
+    const FrameGraph::ResourceId shadow_map_id = frame_graph.CreateTransientTexture("Shadow Map", g_shadow_map_settings);
+    const FrameGraph::ResourceId screen_id     = frame_graph.ImportResource("Screen", ResourceState::Present);
+    std::ignore = frame_graph.AddPass({ "Shadow Pass", { }, { { shadow_map_id, ResourceState::DepthWrite } } });
+    if (!with_blur)
+    {
+        std::ignore = frame_graph.AddPass({ "Final Pass", { { shadow_map_id, ResourceState::ShaderResource } }, { { screen_id, ResourceState::RenderTarget } } });
+        return frame_graph.Compile();
+    }
+
+    const FrameGraph::ResourceId scene_color_id = frame_graph.CreateTransientTexture("Scene Color", g_scene_color_settings);
+    const FrameGraph::ResourceId blur_h_id      = frame_graph.CreateTransientTexture("Horizontal Blur", g_blur_color_settings);
+    const FrameGraph::ResourceId blur_v_id      = frame_graph.CreateTransientTexture("Vertical Blur", g_blur_color_settings);
+    std::ignore = frame_graph.AddPass({ "Final Pass", { { shadow_map_id, ResourceState::ShaderResource } }, { { scene_color_id, ResourceState::RenderTarget } } });
+    std::ignore = frame_graph.AddPass({ "Horizontal Blur Pass", { { scene_color_id, ResourceState::ShaderResource } }, { { blur_h_id, ResourceState::RenderTarget } } });
+    std::ignore = frame_graph.AddPass({ "Vertical Blur Pass", { { blur_h_id, ResourceState::ShaderResource } }, { { blur_v_id, ResourceState::RenderTarget } } });
+    std::ignore = frame_graph.AddPass({ "Compose Pass", { { blur_v_id, ResourceState::ShaderResource } }, { { screen_id, ResourceState::RenderTarget } } });
+    return frame_graph.Compile();
+}
+
+// Acquires transient textures of the compiled schedule for spans of their passes in the order of first use, like the frame graph does every frame
+static std::vector<TransientTexturePool::Allocation> AcquireScheduledTextures(TransientTexturePool& texture_pool, const FrameGraph::Schedule& schedule)
+{
+    std::vector<FrameGraph::ResourceId> resource_ids;
+    for(FrameGraph::ResourceId resource_id = 0U; resource_id < schedule.transient_allocations.size(); ++resource_id)
+    {
+        if (schedule.transient_allocations[resource_id])
+            resource_ids.push_back(resource_id);
+    }
+    std::stable_sort(resource_ids.begin(), resource_ids.end(),
+        [&schedule](FrameGraph::ResourceId left_id, FrameGraph::ResourceId right_id)
+        { return schedule.transient_allocations[left_id]->first_pass_index < schedule.transient_allocations[right_id]->first_pass_index; });
+
+    std::vector<TransientTexturePool::Allocation> allocations;
+    texture_pool.BeginFrame();
+    for(const FrameGraph::ResourceId resource_id : resource_ids)
+    {
+        const FrameGraph::TransientAllocation& allocation = *schedule.transient_allocations[resource_id];
+        allocations.push_back(texture_pool.Acquire(schedule.memory_slots[allocation.memory_slot_index].texture_settings,
+                                                   allocation.first_pass_index, allocation.last_pass_index));
+    }
+    texture_pool.EndFrame();
+    return allocations;
+}
+
+TEST_CASE("Transient texture pool peak memory of tutorial passes", "[transient-texture-pool]")
+{
+    SECTION("Shadow cube passes with shadow map per frame in flight")
+    {
+        FrameGraph frame_graph;
+        const FrameGraph::Schedule& schedule = CompileShadowCubeFrameGraph(frame_graph, false);
+
+        TransientTexturePool texture_pool;
+        std::vector<TransientTexturePool::Allocation> allocations;
+        for(uint32_t frame_index = 0U; frame_index < g_frames_count * 2U; ++frame_index)
+        {
+            allocations = AcquireScheduledTextures(texture_pool, schedule);
+        }
+
+        // Tutorial created shadow map render target per frame in flight, while transient shadow map is shared by frames
+        const Data::Size per_frame_targets_memory_size = g_shadow_map_size * g_frames_count;
+        INFO("Shadow cube peak memory: " << texture_pool.GetPeakMemorySize() << " bytes in transient pool vs "
+                      << per_frame_targets_memory_size << " bytes with render target per frame");
+        CHECK(allocations == std::vector<TransientTexturePool::Allocation>{ { 0U, 0U } });
+        CHECK(texture_pool.GetFrameIndex() == g_frames_count * 2U);
+        CHECK(texture_pool.GetTexturesCount() == 1U);
+        CHECK(texture_pool.GetFrameAcquiredMemorySize() == g_shadow_map_size);
+        CHECK(texture_pool.GetPeakMemorySize() == schedule.GetTransientMemorySize());
+        CHECK(texture_pool.GetPeakMemorySize() < per_frame_targets_memory_size);
+    }
+
+    SECTION("Shadow cube passes with blur post-processing")
+    {
+        FrameGraph frame_graph;
+        const FrameGraph::Schedule& schedule = CompileShadowCubeFrameGraph(frame_graph, true);
+
+        TransientTexturePool aliasing_texture_pool(TransientTexturePool::Settings{ 3U, true });
+        std::ignore = AcquireScheduledTextures(aliasing_texture_pool, schedule);
+        const auto aliased_allocations = AcquireScheduledTextures(aliasing_texture_pool, schedule);
+
+        TransientTexturePool texture_pool(TransientTexturePool::Settings{ 3U, false });
+        std::ignore = AcquireScheduledTextures(texture_pool, schedule);
+        const auto allocations = AcquireScheduledTextures(texture_pool, schedule);
+
+        const Data::Size acquired_memory_size = g_shadow_map_size + g_scene_color_size + g_blur_color_size * 2U;
+        INFO("Shadow cube with blur peak memory: " << aliasing_texture_pool.GetPeakMemorySize() << " bytes with aliasing vs "
+                      << texture_pool.GetPeakMemorySize() << " bytes without aliasing and "
+                      << schedule.GetTransientMemorySize() << " bytes in memory slots of the schedule");
+
+        // Blur targets alias memory of shadow map and scene color, which are not used in the blur passes
+        REQUIRE(aliased_allocations.size() == 4U);
+        CHECK(aliased_allocations[0] == TransientTexturePool::Allocation{ 0U, 0U });
+        CHECK(aliased_allocations[1] == TransientTexturePool::Allocation{ 1U, 0U });
+        CHECK(aliased_allocations[2] == TransientTexturePool::Allocation{ 0U, 1U });
+        CHECK(aliased_allocations[3] == TransientTexturePool::Allocation{ 1U, 1U });
+        CHECK(aliasing_texture_pool.GetTexturesCount() == 4U);
+        CHECK(aliasing_texture_pool.GetAliasedTexturesCount() == 2U);
+        CHECK(aliasing_texture_pool.GetFrameAcquiredMemorySize() == acquired_memory_size);
+        CHECK(aliasing_texture_pool.GetPeakMemorySize() == g_shadow_map_size + g_scene_color_size);
+
+        // Without aliasing only blur targets with equal settings could share memory, but their passes overlap like in schedule memory slots
+        REQUIRE(allocations.size() == 4U);
+        CHECK(allocations[2] != allocations[3]);
+        CHECK(texture_pool.GetMemoryBlocksCount() == 4U);
+        CHECK(texture_pool.GetPeakMemorySize() == schedule.GetTransientMemorySize());
+        CHECK(aliasing_texture_pool.GetPeakMemorySize() < schedule.GetTransientMemorySize());
+    }
+}
+
+TEST_CASE("Transient texture pool textures reuse", "[transient-texture-pool]")
+{
+    TransientTexturePool texture_pool;
+    texture_pool.BeginFrame();
+
+    SECTION("Textures with equal settings are reused in non-overlapping passes")
+    {
+        const TransientTexturePool::Allocation first_allocation = texture_pool.Acquire(g_scene_color_settings, 0U, 1U);
+        CHECK(texture_pool.Acquire(g_scene_color_settings, 2U, 3U) == first_allocation);
+        CHECK(texture_pool.GetTexturesCount() == 1U);
+        CHECK(texture_pool.GetPeakMemorySize() == g_scene_color_size);
+    }
+
+    SECTION("Textures with equal settings are not reused in overlapping passes")
+    {
+        const TransientTexturePool::Allocation first_allocation = texture_pool.Acquire(g_scene_color_settings, 0U, 2U);
+        CHECK(texture_pool.Acquire(g_scene_color_settings, 2U, 3U) != first_allocation);
+        CHECK(texture_pool.GetMemoryBlocksCount() == 2U);
+        CHECK(texture_pool.GetPeakMemorySize() == g_scene_color_size * 2U);
+    }
+
+    SECTION("Larger texture does not alias memory of smaller texture")
+    {
+        std::ignore = texture_pool.Acquire(g_blur_color_settings, 0U, 0U);
+        CHECK(texture_pool.Acquire(g_scene_color_settings, 1U, 1U) == TransientTexturePool::Allocation{ 1U, 0U });
+        CHECK(texture_pool.GetPeakMemorySize() == g_blur_color_size + g_scene_color_size);
+    }
+
+    SECTION("Smallest fitting memory block is aliased")
+    {
+        std::ignore = texture_pool.Acquire(g_shadow_map_settings, 0U, 0U);
+        std::ignore = texture_pool.Acquire(g_scene_color_settings, 0U, 0U);
+        CHECK(texture_pool.Acquire(g_blur_color_settings, 1U, 1U) == TransientTexturePool::Allocation{ 1U, 1U });
+        CHECK(texture_pool.GetPeakMemorySize() == g_shadow_map_size + g_scene_color_size);
+    }
+
+    texture_pool.EndFrame();
+}
+
+TEST_CASE("Transient texture pool shrinks after idle frames", "[transient-texture-pool]")
+{
+    TransientTexturePool texture_pool(TransientTexturePool::Settings{ 2U, true });
+
+    texture_pool.BeginFrame();
+    std::ignore = texture_pool.Acquire(g_shadow_map_settings,  0U, 0U);
+    std::ignore = texture_pool.Acquire(g_scene_color_settings, 1U, 1U);
+    texture_pool.EndFrame();
+    REQUIRE(texture_pool.GetTexturesCount() == 2U);
+    REQUIRE(texture_pool.GetMemoryBlocksCount() == 1U);
+
+    SECTION("Idle aliasing texture is released, while memory owning texture is kept")
+    {
+        for(uint32_t frame_index = 0U; frame_index < 2U; ++frame_index)
+        {
+            texture_pool.BeginFrame();
+            std::ignore = texture_pool.Acquire(g_shadow_map_settings, 0U, 0U);
+            texture_pool.EndFrame();
+            CHECK(texture_pool.GetTexturesCount() == 2U - frame_index);
+        }
+        CHECK(texture_pool.GetMemorySize() == g_shadow_map_size);
+    }
+
+    SECTION("Idle memory block is released with all textures")
+    {
+        for(uint32_t frame_index = 0U; frame_index < 2U; ++frame_index)
+        {
+            texture_pool.BeginFrame();
+            texture_pool.EndFrame();
+            CHECK(texture_pool.GetMemoryBlocksCount() == 1U - frame_index);
+        }
+        CHECK(texture_pool.GetTexturesCount() == 0U);
+        CHECK(texture_pool.GetMemorySize() == 0U);
+        CHECK(texture_pool.GetPeakMemorySize() == g_shadow_map_size);
+    }
+
+    SECTION("Aliasing texture acquired within idle frames count keeps memory block")
+    {
+        for(uint32_t frame_index = 0U; frame_index < 4U; ++frame_index)
+        {
+            texture_pool.BeginFrame();
+            if (frame_index % 2U)
+                std::ignore = texture_pool.Acquire(g_scene_color_settings, 0U, 0U);
+            texture_pool.EndFrame();
+        }
+        CHECK(texture_pool.GetTexturesCount() == 2U);
+        CHECK(texture_pool.GetMemorySize() == g_shadow_map_size);
+    }
+}
+
+TEST_CASE("Transient texture pool reports actual memory of textures allocated on GPU", "[.][gpu][transient-texture-pool]")
+{
+    HeadlessRenderFixture fixture;
+    TransientTexturePool  texture_pool(TransientTexturePool::Settings{ 3U, Texture::IsMemoryAliasingSupported() });
+
+    texture_pool.BeginFrame();
+    const TransientTexturePool::Allocation shadow_map_allocation = texture_pool.Acquire(g_shadow_map_settings, 0U, 1U);
+    const TransientTexturePool::Allocation blur_color_allocation = texture_pool.Acquire(g_blur_color_settings, 2U, 3U);
+    texture_pool.AllocateTextures(fixture.GetRenderContext());
+
+    const Texture& shadow_map_texture = *texture_pool.GetTexturePtr(shadow_map_allocation);
+    const Texture& blur_color_texture = *texture_pool.GetTexturePtr(blur_color_allocation);
+    const bool     is_blur_aliased    = blur_color_texture.IsMemoryAliased();
+    texture_pool.EndFrame();
+
+    // Memory block is sized by actual memory requirements, while texture which could not alias memory is counted with its own memory
+    INFO("Shadow map memory: " << shadow_map_texture.GetMemorySize() << " bytes, blur color memory: " << blur_color_texture.GetMemorySize()
+                               << " bytes, " << (is_blur_aliased ? "aliased" : "not aliased"));
+    CHECK((blur_color_allocation.memory_block_index == shadow_map_allocation.memory_block_index) == Texture::IsMemoryAliasingSupported());
+    CHECK_FALSE(shadow_map_texture.IsMemoryAliased());
+    CHECK(shadow_map_texture.GetMemorySize() >= g_shadow_map_size);
+    CHECK(texture_pool.IsMemoryShared(shadow_map_allocation));
+    CHECK(texture_pool.IsMemoryShared(blur_color_allocation) == (!blur_color_allocation.texture_index || is_blur_aliased));
+    CHECK(texture_pool.GetAliasedTexturesCount() == (is_blur_aliased ? 1U : 0U));
+    CHECK(texture_pool.GetMemorySize() == shadow_map_texture.GetMemorySize() + (is_blur_aliased ? 0U : blur_color_texture.GetMemorySize()));
+    CHECK(texture_pool.GetPeakMemorySize() >= texture_pool.GetMemorySize());
+}
+
+TEST_CASE("Frame graph acquires the same transient textures every frame", "[.][gpu][transient-texture-pool][frame-graph]")
+{
+    HeadlessRenderFixture fixture;
+    FrameGraph frame_graph;
+    std::ignore = CompileShadowCubeFrameGraph(frame_graph, false);
+    const FrameGraph::ResourceId shadow_map_id = 0U;
+
+    // Transient textures are allocated every frame like in the shadow cube tutorial frame loop
+    frame_graph.AllocateTransientTextures(fixture.GetRenderContext());
+    const Ptr<Texture> shadow_map_texture_ptr = frame_graph.GetTransientTexturePtr(shadow_map_id);
+    for(uint32_t frame_index = 1U; frame_index < g_frames_count * 2U; ++frame_index)
+    {
+        frame_graph.AllocateTransientTextures(fixture.GetRenderContext());
+        CHECK(frame_graph.GetTransientTexturePtr(shadow_map_id) == shadow_map_texture_ptr);
+    }
+
+    const TransientTexturePool& texture_pool = frame_graph.GetTexturePool();
+    CHECK(texture_pool.GetFrameIndex() == g_frames_count * 2U);
+    CHECK(texture_pool.GetTexturesCount() == 1U);
+    CHECK(texture_pool.GetMemorySize() == shadow_map_texture_ptr->GetMemorySize());
+}
@@ -0,0 +1,127 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/DynamicResolutionControllerTest.cpp
+Dynamic resolution controller unit tests with synthetic GPU frame times
+
+******************************************************************************/
+
+#include <Methane/Graphics/DynamicResolutionController.h>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+
+using namespace Methane::Graphics;
+using Catch::Approx;
+
+static constexpr double   g_target_frame_time_sec = 1.0 / 60.0;
+static constexpr uint32_t g_frames_count          = 600U;
+static constexpr uint32_t g_stable_frames_count   = 100U;
+
+// Synthetic GPU frame time is proportional to rendered pixels count with small periodic noise
+static double GetSyntheticGpuFrameTime(double full_resolution_time_sec, float scale, uint32_t frame_index)
+{
+    return full_resolution_time_sec * scale * scale * (1.0 + 0.03 * std::sin(frame_index * 0.7));
+}
+
+struct SimulationResult
+{
+    float    final_scale          = 0.F;
+    uint32_t stable_scale_changes = 0U;
+    double   max_stable_frame_time_sec = 0.0;
+};
+
+static SimulationResult SimulateFrames(DynamicResolutionController& controller, double full_resolution_time_sec, uint32_t frames_count = g_frames_count)
+{
+    SimulationResult result;
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        const double gpu_frame_time_sec = GetSyntheticGpuFrameTime(full_resolution_time_sec, controller.GetScale(), frame_index);
+        const bool   is_stable_frame    = frame_index >= frames_count - g_stable_frames_count;
+        if (controller.OnGpuFrameTime(gpu_frame_time_sec) && is_stable_frame)
+        {
+            result.stable_scale_changes++;
+        }
+        if (is_stable_frame)
+        {
+            result.max_stable_frame_time_sec = std::max(result.max_stable_frame_time_sec, gpu_frame_time_sec);
+        }
+    }
+    result.final_scale = controller.GetScale();
+    return result;
+}
+
+TEST_CASE("Dynamic resolution controller convergence", "[dynamic-resolution]")
+{
+    DynamicResolutionController::Settings settings;
+    settings.target_gpu_frame_time_sec = g_target_frame_time_sec;
+
+    SECTION("Full resolution is kept when GPU time fits in the budget")
+    {
+        DynamicResolutionController controller(settings);
+        const SimulationResult result = SimulateFrames(controller, 0.010);
+        CHECK(result.final_scale == Approx(settings.max_scale));
+        CHECK(controller.GetScaleChangesCount() == 0U);
+    }
+
+    SECTION("Scale converges to the largest step fitting in the budget under heavy load")
+    {
+        DynamicResolutionController controller(settings);
+        const SimulationResult result = SimulateFrames(controller, 0.025);
+        CHECK(result.final_scale == Approx(0.75F));
+        CHECK(result.stable_scale_changes == 0U);
+        CHECK(result.max_stable_frame_time_sec < g_target_frame_time_sec);
+    }
+
+    SECTION("Scale is clamped to min scale under overload")
+    {
+        DynamicResolutionController controller(settings);
+        const SimulationResult result = SimulateFrames(controller, 0.100);
+        CHECK(result.final_scale == Approx(settings.min_scale));
+        CHECK(result.stable_scale_changes == 0U);
+    }
+
+    SECTION("Scale recovers to full resolution when load decreases")
+    {
+        DynamicResolutionController controller(settings);
+        CHECK(SimulateFrames(controller, 0.025).final_scale == Approx(0.75F));
+
+        const SimulationResult result = SimulateFrames(controller, 0.008);
+        CHECK(result.final_scale == Approx(settings.max_scale));
+        CHECK(result.stable_scale_changes == 0U);
+    }
+
+    SECTION("Scale changes only at discrete steps")
+    {
+        DynamicResolutionController controller(settings);
+        for(uint32_t frame_index = 0U; frame_index < g_frames_count; ++frame_index)
+        {
+            // Load is slowly growing from half to double of the frame time budget
+            const double full_resolution_time_sec = g_target_frame_time_sec * (0.5 + 1.5 * frame_index / g_frames_count);
+            controller.OnGpuFrameTime(GetSyntheticGpuFrameTime(full_resolution_time_sec, controller.GetScale(), frame_index));
+
+            const float steps_from_max = (settings.max_scale - controller.GetScale()) / settings.scale_step;
+            CHECK(steps_from_max == Approx(std::round(steps_from_max)));
+            CHECK(controller.GetScale() >= settings.min_scale);
+            CHECK(controller.GetScale() <= settings.max_scale);
+        }
+        CHECK(controller.GetScaleChangesCount() <= 4U);
+    }
+}
@@ -0,0 +1,246 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/FrameLimiterTest.cpp
+Frame limiter pacing unit tests with fake clock
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrameLimiter.h>
+#include <Methane/Graphics/FpsCounter.h>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+using namespace Methane::Graphics;
+using namespace std::chrono_literals;
+using Catch::Approx;
+
+// Fake clock advances time only on sleep and yield calls, so that pacing is tested deterministically without wall-clock timing
+class FakeClock final : public FrameLimiter::IClock
+{
+public:
+    static constexpr FrameLimiter::Duration yield_duration = 50us;
+
+    [[nodiscard]] FrameLimiter::TimePoint Now() const override { return m_current_time; }
+
+    void SleepUntil(FrameLimiter::TimePoint wake_time) override
+    {
+        m_current_time = std::max(m_current_time, wake_time + m_sleep_overshoot);
+        m_sleeps_count++;
+    }
+
+    void YieldThread() override { m_current_time += yield_duration; }
+
+    void Advance(FrameLimiter::Duration duration)                 { m_current_time += duration; }
+    void SetSleepOvershoot(FrameLimiter::Duration sleep_overshoot) { m_sleep_overshoot = sleep_overshoot; }
+    [[nodiscard]] uint32_t GetSleepsCount() const noexcept        { return m_sleeps_count; }
+
+private:
+    FrameLimiter::TimePoint m_current_time { 1s };
+    FrameLimiter::Duration  m_sleep_overshoot { };
+    uint32_t                m_sleeps_count = 0U;
+};
+
+static constexpr double g_yield_duration_sec = std::chrono::duration<double>(FakeClock::yield_duration).count();
+
+// Paces given number of frames with simulated CPU work and returns maximum pacing error in seconds
+static double PaceFrames(FrameLimiter& frame_limiter, FakeClock& clock, uint32_t frames_count, FrameLimiter::Duration frame_work_duration = 1ms)
+{
+    double max_pacing_error_sec = 0.0;
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        max_pacing_error_sec = std::max(max_pacing_error_sec, frame_limiter.WaitForNextFrame());
+        clock.Advance(frame_work_duration);
+    }
+    return max_pacing_error_sec;
+}
+
+// Paces frames at the target frame rate with FPS counter measuring frame times with the same fake clock,
+// CPU work of the optional late frame takes the whole frame duration more than the work of other frames
+static FpsCounter PaceCountedFrames(uint32_t target_fps, FakeClock& clock, uint32_t frames_count,
+                                    uint32_t late_frame_index = std::numeric_limits<uint32_t>::max())
+{
+    FrameLimiter frame_limiter(target_fps, clock);
+    FpsCounter   fps_counter(frames_count, clock);
+
+    // First wait starts frames pacing without blocking
+    CHECK(frame_limiter.WaitForNextFrame() == 0.0);
+    fps_counter.Reset(frames_count);
+
+    for(uint32_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        if (frame_index == late_frame_index)
+            clock.Advance(frame_limiter.GetFrameDuration());
+
+        fps_counter.OnCpuFramePaced(frame_limiter.WaitForNextFrame());
+        fps_counter.OnCpuFramePresented();
+        clock.Advance(1ms);
+    }
+    return fps_counter;
+}
+
+TEST_CASE("Frame limiter setup", "[frame-limiter]")
+{
+    SECTION("Default frame limiter is disabled")
+    {
+        FrameLimiter frame_limiter;
+        CHECK_FALSE(frame_limiter.IsEnabled());
+        CHECK(frame_limiter.GetTargetFps() == 0U);
+        CHECK(frame_limiter.WaitForNextFrame() == 0.0);
+    }
+
+    SECTION("Frame duration is calculated from target FPS")
+    {
+        FrameLimiter frame_limiter(50U);
+        CHECK(frame_limiter.IsEnabled());
+        CHECK(frame_limiter.GetTargetFps() == 50U);
+        CHECK(std::chrono::duration<double>(frame_limiter.GetFrameDuration()).count() == Approx(0.02));
+        CHECK(frame_limiter.GetSpinWaitDuration() == 2ms);
+    }
+
+    SECTION("Frame limiter is disabled with zero target FPS")
+    {
+        FrameLimiter frame_limiter(60U);
+        frame_limiter.SetTargetFps(0U);
+        CHECK_FALSE(frame_limiter.IsEnabled());
+        CHECK(frame_limiter.GetFrameDuration() == FrameLimiter::Duration::zero());
+    }
+}
+
+TEST_CASE("Frame limiter pacing", "[frame-limiter]")
+{
+    FakeClock clock;
+
+    SECTION("First wait starts frames pacing without blocking")
+    {
+        FrameLimiter frame_limiter(60U, clock);
+        const FrameLimiter::TimePoint start_time = clock.Now();
+        CHECK(frame_limiter.WaitForNextFrame() == 0.0);
+        CHECK(clock.Now() == start_time);
+    }
+
+    SECTION("Frames are started at deadlines without drift")
+    {
+        constexpr uint32_t frames_count = 120U;
+        FrameLimiter frame_limiter(60U, clock);
+        frame_limiter.WaitForNextFrame();
+        const FrameLimiter::TimePoint start_time = clock.Now();
+
+        CHECK(PaceFrames(frame_limiter, clock, frames_count) <= g_yield_duration_sec);
+        const FrameLimiter::Duration paced_duration = clock.Now() - start_time;
+        CHECK(paced_duration >= frame_limiter.GetFrameDuration() * frames_count);
+        CHECK(paced_duration <= frame_limiter.GetFrameDuration() * frames_count + 1ms + FakeClock::yield_duration);
+        CHECK(clock.GetSleepsCount() == frames_count);
+    }
+
+    SECTION("Frame late for more than frame duration restarts pacing")
+    {
+        FrameLimiter frame_limiter(60U, clock);
+        frame_limiter.WaitForNextFrame();
+        clock.Advance(frame_limiter.GetFrameDuration() * 3);
+
+        const FrameLimiter::TimePoint late_time = clock.Now();
+        CHECK(frame_limiter.WaitForNextFrame() == Approx(std::chrono::duration<double>(frame_limiter.GetFrameDuration() * 2).count()));
+        CHECK(clock.Now() == late_time);
+        CHECK(PaceFrames(frame_limiter, clock, 10U) <= g_yield_duration_sec);
+    }
+}
+
+TEST_CASE("Frame limiter adaptive spin wait", "[frame-limiter]")
+{
+    FakeClock clock;
+
+    SECTION("Spin wait grows to cover coarse sleep overshoot of Windows timer")
+    {
+        constexpr FrameLimiter::Duration windows_timer_overshoot = 15600us;
+        clock.SetSleepOvershoot(windows_timer_overshoot);
+        FrameLimiter frame_limiter(30U, clock);
+        frame_limiter.WaitForNextFrame();
+
+        // Only the first frame is late, while spin wait duration adapts to the observed overshoot
+        CHECK(PaceFrames(frame_limiter, clock, 1U) > g_yield_duration_sec);
+        CHECK(frame_limiter.GetSpinWaitDuration() >= windows_timer_overshoot);
+        CHECK(PaceFrames(frame_limiter, clock, 60U) <= g_yield_duration_sec);
+    }
+
+    SECTION("Spin wait decays after sleep overshoot drops")
+    {
+        clock.SetSleepOvershoot(15600us);
+        FrameLimiter frame_limiter(30U, clock);
+        frame_limiter.WaitForNextFrame();
+        PaceFrames(frame_limiter, clock, 10U);
+        REQUIRE(frame_limiter.GetSpinWaitDuration() >= 15600us);
+
+        clock.SetSleepOvershoot(500us);
+        CHECK(PaceFrames(frame_limiter, clock, 120U) <= g_yield_duration_sec);
+        CHECK(frame_limiter.GetSpinWaitDuration() < 3ms);
+    }
+
+    SECTION("Spin wait does not exceed frame duration")
+    {
+        clock.SetSleepOvershoot(15600us);
+        FrameLimiter frame_limiter(144U, clock);
+        frame_limiter.WaitForNextFrame();
+        PaceFrames(frame_limiter, clock, 10U);
+        CHECK(frame_limiter.GetSpinWaitDuration() == frame_limiter.GetFrameDuration());
+    }
+}
+
+TEST_CASE("Frame limiter pacing statistics", "[frame-limiter]")
+{
+    constexpr uint32_t frames_count = 120U;
+    FakeClock clock;
+
+    SECTION("Frames are paced at 60 FPS")
+    {
+        const FpsCounter fps_counter = PaceCountedFrames(60U, clock, frames_count);
+        CHECK(fps_counter.GetAveragedTimingsCount() == frames_count);
+        CHECK(fps_counter.GetFramesPerSecond() == 60U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeSec() == Approx(1.0 / 60.0).margin(g_yield_duration_sec));
+        CHECK(fps_counter.GetMaxPacingErrorSec() <= g_yield_duration_sec);
+        CHECK(fps_counter.GetMaxPacingErrorSec() >= fps_counter.GetAverageFrameTiming().GetPacingErrorSec());
+        CHECK(fps_counter.GetFrameTimeJitterSec() <= g_yield_duration_sec);
+    }
+
+    SECTION("Frames are paced at 144 FPS")
+    {
+        const FpsCounter fps_counter = PaceCountedFrames(144U, clock, frames_count);
+        CHECK(fps_counter.GetAveragedTimingsCount() == frames_count);
+        CHECK(fps_counter.GetFramesPerSecond() == 144U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeSec() == Approx(1.0 / 144.0).margin(g_yield_duration_sec));
+        CHECK(fps_counter.GetMaxPacingErrorSec() <= g_yield_duration_sec);
+        CHECK(fps_counter.GetMaxPacingErrorSec() >= fps_counter.GetAverageFrameTiming().GetPacingErrorSec());
+        CHECK(fps_counter.GetFrameTimeJitterSec() <= g_yield_duration_sec);
+    }
+
+    SECTION("Late frame at 144 FPS is reported with pacing error and frame time jitter")
+    {
+        const FpsCounter fps_counter = PaceCountedFrames(144U, clock, frames_count, frames_count / 2U);
+        const double frame_duration_sec = 1.0 / 144.0;
+
+        // Frame late for less than frame duration does not restart pacing, so the following frames keep their deadlines
+        CHECK(fps_counter.GetAveragedTimingsCount() == frames_count);
+        CHECK(fps_counter.GetMaxPacingErrorSec() == Approx(1e-3).margin(2.0 * g_yield_duration_sec));
+        CHECK(fps_counter.GetAverageFrameTiming().GetPacingErrorSec() < fps_counter.GetMaxPacingErrorSec() / 10.0);
+        CHECK(fps_counter.GetFrameTimeJitterSec() > g_yield_duration_sec);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeSec() == Approx(frame_duration_sec).margin(g_yield_duration_sec));
+    }
+}
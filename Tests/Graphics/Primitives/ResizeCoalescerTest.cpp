@@ -0,0 +1,167 @@
+/******************************************************************************
+
+Copyright 2022 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/Primitives/ResizeCoalescerTest.cpp
+Resize coalescer unit tests replaying window resize events storm
+
+******************************************************************************/
+
+#include <Methane/Graphics/ResizeCoalescer.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using FrameSize = ResizeCoalescer::FrameSize;
+
+static constexpr uint32_t g_resize_events_count     = 200U;
+static constexpr uint32_t g_resize_events_per_frame = 4U;
+static const FrameSize    g_initial_frame_size(800U, 600U);
+
+// Window drag from initial size to the larger size and partially back, as produced by window manager
+static std::vector<FrameSize> GetResizeEvents()
+{
+    std::vector<FrameSize> resize_events;
+    resize_events.reserve(g_resize_events_count);
+    for(uint32_t event_index = 0U; event_index < g_resize_events_count; ++event_index)
+    {
+        const double drag_offset = std::sin(static_cast<double>(event_index) / g_resize_events_count * 4.0);
+        resize_events.emplace_back(g_initial_frame_size.GetWidth()  + static_cast<uint32_t>(drag_offset * 600.0),
+                                   g_initial_frame_size.GetHeight() + static_cast<uint32_t>(drag_offset * 400.0));
+    }
+    return resize_events;
+}
+
+struct ReplayResult
+{
+    uint32_t frames_count           = 0U;
+    uint32_t swapchain_recreations  = 0U;
+    uint32_t attachment_allocations = 0U;
+    bool     attachments_fit_frames = true;
+};
+
+static ReplayResult ReplayResizeEvents(ResizeCoalescer& coalescer, const std::vector<FrameSize>& resize_events,
+                                       bool is_live_resizing_reported, uint32_t idle_frames_count)
+{
+    ReplayResult result;
+    const auto render_frame = [&result, &coalescer](bool is_live_resizing)
+    {
+        result.frames_count++;
+        const Opt<ResizeCoalescer::Resize> resize_opt = coalescer.ApplyPendingResize(is_live_resizing);
+        if (!resize_opt)
+            return;
+
+        result.swapchain_recreations  += resize_opt->is_frame_resized ? 1U : 0U;
+        result.attachment_allocations += resize_opt->is_attachments_reallocated ? 1U : 0U;
+        result.attachments_fit_frames &= resize_opt->frame_size.GetWidth()  <= resize_opt->attachments_size.GetWidth() &&
+                                         resize_opt->frame_size.GetHeight() <= resize_opt->attachments_size.GetHeight();
+    };
+
+    for(size_t event_index = 0U; event_index < resize_events.size(); ++event_index)
+    {
+        coalescer.RequestResize(resize_events[event_index]);
+        if ((event_index + 1) % g_resize_events_per_frame == 0U)
+            render_frame(is_live_resizing_reported);
+    }
+
+    for(uint32_t frame_index = 0U; frame_index < idle_frames_count; ++frame_index)
+        render_frame(false);
+
+    return result;
+}
+
+TEST_CASE("Resize coalescer applies only the latest requested size", "[resize]")
+{
+    ResizeCoalescer coalescer(g_initial_frame_size);
+
+    SECTION("No resize is applied without requests")
+    {
+        CHECK_FALSE(coalescer.ApplyPendingResize(false).has_value());
+        CHECK(coalescer.GetFrameSize() == g_initial_frame_size);
+    }
+
+    SECTION("Requests of one frame are coalesced")
+    {
+        coalescer.RequestResize(FrameSize(900U, 700U));
+        coalescer.RequestResize(FrameSize(1000U, 800U));
+        coalescer.RequestResize(FrameSize(1024U, 768U));
+        CHECK(coalescer.HasPendingResize());
+
+        const Opt<ResizeCoalescer::Resize> resize_opt = coalescer.ApplyPendingResize(true);
+        REQUIRE(resize_opt.has_value());
+        CHECK(resize_opt->frame_size == FrameSize(1024U, 768U));
+        CHECK(resize_opt->is_frame_resized);
+        CHECK_FALSE(coalescer.HasPendingResize());
+        CHECK(coalescer.GetFrameResizesCount() == 1U);
+    }
+
+    SECTION("Request of the current size is ignored")
+    {
+        coalescer.RequestResize(g_initial_frame_size);
+        CHECK_FALSE(coalescer.ApplyPendingResize(false).has_value());
+        CHECK(coalescer.GetFrameResizesCount() == 0U);
+    }
+}
+
+TEST_CASE("Resize coalescer replays resize events storm", "[resize]")
+{
+    const std::vector<FrameSize> resize_events = GetResizeEvents();
+    const FrameSize&             final_size    = resize_events.back();
+    constexpr uint32_t           frames_with_events_count = g_resize_events_count / g_resize_events_per_frame;
+
+    SECTION("Live resizing reported by window")
+    {
+        ResizeCoalescer coalescer(g_initial_frame_size);
+        const ReplayResult result = ReplayResizeEvents(coalescer, resize_events, true, coalescer.GetSettings().live_resize_frames_count);
+
+        CHECK(result.swapchain_recreations <= frames_with_events_count);
+        CHECK(result.attachment_allocations < result.swapchain_recreations / 4U);
+        CHECK(result.attachments_fit_frames);
+        CHECK(coalescer.GetFrameSize() == final_size);
+        CHECK(coalescer.GetAttachmentsSize() == final_size);
+    }
+
+    SECTION("Live resizing detected by frequency of resize requests")
+    {
+        ResizeCoalescer coalescer(g_initial_frame_size);
+        const ReplayResult result = ReplayResizeEvents(coalescer, resize_events, false, coalescer.GetSettings().live_resize_frames_count - 1U);
+
+        CHECK(result.swapchain_recreations <= frames_with_events_count);
+        CHECK(result.attachment_allocations < result.swapchain_recreations / 4U);
+        CHECK(result.attachments_fit_frames);
+        CHECK(coalescer.GetAttachmentsSize() != final_size);
+
+        CHECK(coalescer.ApplyPendingResize(false).has_value());
+        CHECK(coalescer.GetAttachmentsSize() == final_size);
+        CHECK_FALSE(coalescer.ApplyPendingResize(false).has_value());
+    }
+
+    SECTION("Attachments are reallocated on every resize without slack")
+    {
+        ResizeCoalescer coalescer(g_initial_frame_size, ResizeCoalescer::Settings{ 0.F, 1U, 30U });
+        const ReplayResult result = ReplayResizeEvents(coalescer, resize_events, true, 1U);
+
+        CHECK(result.swapchain_recreations <= frames_with_events_count);
+        CHECK(result.attachment_allocations == result.swapchain_recreations);
+        CHECK(coalescer.GetAttachmentsSize() == final_size);
+    }
+}
@@ -57,6 +57,7 @@ public:
     [[nodiscard]] const std::string& GetAdapterName() const noexcept override { static std::string s_name; return s_name; }
     [[nodiscard]] bool IsSoftwareAdapter() const noexcept override { return true; }
     [[nodiscard]] const Capabilities& GetCapabilities() const noexcept override { static const Capabilities s_caps; return s_caps; }
+    [[nodiscard]] MemoryStatistics GetMemoryStatistics() const override { return { }; }
     [[nodiscard]] std::string ToString() const override { return { }; }
 
     // Object interface
@@ -158,7 +159,9 @@ public:
     [[nodiscard]] const Settings&   GetSettings() const noexcept override         { return m_settings; }
     [[nodiscard]] uint32_t          GetFrameBufferIndex() const noexcept override { return 0U; }
     [[nodiscard]] uint32_t          GetFrameIndex() const noexcept override       { return 0U; }
+    [[nodiscard]] uint32_t          GetMaxFramesInFlight() const noexcept override { return m_settings.frame_buffers_count; }
     [[nodiscard]] const FpsCounter& GetFpsCounter() const noexcept override       { return m_fps_counter; }
+    [[nodiscard]] FpsCounter&       GetFpsCounter() noexcept override             { return m_fps_counter; }
     bool SetVSyncEnabled(bool vsync_enabled) override                             { m_settings.vsync_enabled = vsync_enabled; return true; }
     bool SetFrameBuffersCount(uint32_t frame_buffers_count) override              { m_settings.frame_buffers_count = frame_buffers_count; return true; }
     bool SetFullScreen(bool is_full_screen) override                              { m_settings.is_full_screen = is_full_screen; return true; }
@@ -175,10 +178,13 @@ public:
     void WaitForGpu(WaitFor) override                                                   { META_FUNCTION_NOT_IMPLEMENTED(); }
     void Reset(Device&) override                                                        { META_FUNCTION_NOT_IMPLEMENTED(); }
     void Reset() override                                                               { META_FUNCTION_NOT_IMPLEMENTED(); }
+    void SubmitUploadBatch(ResourceUploadBatch&, CommandQueue&) override                { META_FUNCTION_NOT_IMPLEMENTED(); }
 
     [[nodiscard]] const Device& GetDevice() const override                              { return m_fake_device; }
     [[nodiscard]] CommandKit& GetDefaultCommandKit(CommandList::Type) const override    { throw Methane::NotImplementedException("GetDefaultCommandKit"); }
     [[nodiscard]] CommandKit& GetDefaultCommandKit(CommandQueue&) const override        { throw Methane::NotImplementedException("GetDefaultCommandKit"); }
+    [[nodiscard]] const DeferredDeletionBudget& GetDeferredDeletionBudget() const noexcept override { return m_deletion_budget; }
+    void SetDeferredDeletionBudget(const DeferredDeletionBudget& deletion_budget) override         { m_deletion_budget = deletion_budget; }
 
     // Object interface
     bool SetName(const std::string&) override                                           { META_FUNCTION_NOT_IMPLEMENTED_RETURN(false); }
@@ -190,6 +196,7 @@ private:
     FakeDevice             m_fake_device;
     FpsCounter             m_fps_counter;
     FakeObjectRegistry     m_object_registry;
+    DeferredDeletionBudget m_deletion_budget;
     mutable tf::Executor   m_executor;
 };
 